@@ -22,36 +22,35 @@ All Rights Reserved.
 * @brief Allocate a node dynamically.
 * 
 * @param tdata Binary string buffer for this instruction 
+* @param code Instruction word
 * @param a Program Memory Address for new node
 * 
 * @return Returns pointer to newly allocated node.
 */
-sBCode *sBCodeGetNode(char tdata[], unsigned int a)
+sBCode *sBCodeGetNode(char tdata[], unsigned int code, unsigned int a)
 {
-	int i, j;
+	int j;
 	sBCode *p;
-	char tbuf[INSTLEN+1];
+	int pos = 0;
 	int oprCntr = 0;	
 
 	p = (sBCode *)calloc(1, sizeof(sBCode));
 	assert(p != NULL);
 
 	strcpy(p->Binary, tdata);
+	p->Code = code;
 	p->PMA = a + codeSegAddr;
-	p->InstType = findInstType(tdata);
+	p->InstType = isaDecode(code);
 	p->Index = iUNKNOWN;
 
-	i = 0;
 	for(j = 0; j < MAX_FIELD; j++){
 		int w = sInstFormatTable[p->InstType].widths[j];
 		if(w != 0){
-			strncpy(tbuf, tdata + i, w);
-			tbuf[w] = '\0';
-			p->Field[oprCntr] = bin2int(tbuf, w);	
+			p->Field[oprCntr] = (code >> (INSTLEN - pos - w)) & ((1U << w) - 1);	
 			/* Note: Field[0] reserved for OpcodeType */
 
 			oprCntr++;
-			i += w;
+			pos += w;
 		} else {
 			break;
 		}
@@ -75,13 +74,14 @@ sBCode *sBCodeGetNode(char tdata[], unsigned int a)
 * 
 * @param list Pointer to linked list
 * @param tdata Binary string buffer for this instruction 
+* @param code Instruction word
 * @param a Program Memory Address for new node
 * 
 * @return Returns pointer to newly allocated node.
 */
-sBCode *sBCodeListAdd(sBCodeList *list, char tdata[INSTLEN+1], unsigned int a)
+sBCode *sBCodeListAdd(sBCodeList *list, char tdata[INSTLEN+1], unsigned int code, unsigned int a)
 {
-	sBCode *n = sBCodeGetNode(tdata, a);
+	sBCode *n = sBCodeGetNode(tdata, code, a);
 	if(n == NULL) return NULL;
 
 	if(list->FirstNode != NULL){ /* if FistNode is not NULL, 
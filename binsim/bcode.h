@@ -19,6 +19,7 @@ All Rights Reserved.
 */
 typedef struct sBCode {
 	char 	Binary[INSTLEN+1];				/**< one line of asm program */
+	unsigned int	Code;		/**< instruction word (MSB: first bit of Binary) */
 	unsigned int	PMA;		/**< program memory address for .CODE segment */
 	                            /*   PMA is determined at yyparse()           */
 	unsigned int	InstType;	/**< opcode type */
@@ -46,8 +47,8 @@ typedef struct sBCodeList {
 	sBCode *LastNode;			/* Points to last node of list; MUST be NULL when initialized */
 } sBCodeList;
 
-sBCode *sBCodeGetNode(char tdata[], unsigned int a);
-sBCode *sBCodeListAdd(sBCodeList *list, char tdata[], unsigned int a);
+sBCode *sBCodeGetNode(char tdata[], unsigned int code, unsigned int a);
+sBCode *sBCodeListAdd(sBCodeList *list, char tdata[], unsigned int code, unsigned int a);
 sBCode *sBCodeListInsertAfter(sBCode *p, sBCode *newNode);
 sBCode *sBCodeListInsertBeginning(sBCodeList *list, sBCode *newNode);
 void sBCodeListRemoveAfter(sBCodeList *list, sBCode *p);
@@ -35,6 +35,7 @@ All Rights Reserved.
 #define	DEF_ITRMAX	1			/* default value for ItrMax */
 #define	DEF_DUMPINSIZE	256		/* default value for dumpInSize */
 #define	DEF_DUMPOUTSIZE	256		/* default value for dumpOutSize */
+#define	DEF_GOLDSIZE	256		/* default value for goldSize */
 
 #define	INSTLEN	32	/* instruction width: 32 bits */
 
@@ -67,10 +68,18 @@ extern	int dumpInSize;
 extern	FILE *dumpOutFP;
 extern	int	dumpOutStart;
 extern 	int dumpOutSize;
+extern	int dumpOutImage;
+
+extern	FILE *goldFP;
+extern	int	goldStart;
+extern	int goldSize;
+extern	char *goldTol;
+extern	int goldStop;
 
 extern char *infile;
 extern FILE *inFP;
 extern FILE *LdiFP;
+extern FILE *InitDataFP;
 extern FILE *dumpDisFP;
 
 extern int codeSegAddr;
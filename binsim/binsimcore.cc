@@ -20,6 +20,8 @@ All Rights Reserved.
 #include "binsimcore.h"
 #include "binsimsupport.h"
 #include "stack.h"
+#include "dmimage.h"
+#include "golden.h"
 //#include "secinfo.h"
 
 #ifdef VHPI
@@ -267,6 +269,36 @@ void initSim(void)
 	rSstat.LSE = 1;
 	rSstat.SSE = 1;
 
+	/* initialized data (.VAR x[n] = ...) linked by dsplnk; -if may overwrite */
+	if(InitDataFP){
+		sDmImage img;
+
+		if(!dmiLoad(InitDataFP, &img)){
+			printRunTimeError(0, "dmi", "Invalid initialized data image.\n");
+		}
+
+		/* addresses already relocated by dsplnk */
+		for(unsigned int k = 0; k < img.Size; k++){
+			WrDataMem(NULL, dmiGet(&img, k, 0) & 0xFFF, img.Start + k);
+		}
+		dmiClose(&img);
+	}
+
+	/* binary image: start address and size from its header, lane 0 only */
+	if(dumpInFP && dmiIsImage(dumpInFP)){
+		sDmImage img;
+
+		if(!dmiLoad(dumpInFP, &img)){
+			printRunTimeError(0, "-if", "Invalid data memory image.\n");
+		}
+
+		for(unsigned int k = 0; k < img.Size; k++){
+			WrDataMem(NULL, dmiGet(&img, k, 0) & 0xFFF, img.Start - dataSegAddr + k);
+		}
+		dmiClose(&img);
+		return;
+	}
+
 	/* memory dump input */
 	if(dumpInFP){
 		//if -ad option set (dataSegAddr)
@@ -280,6 +312,54 @@ void initSim(void)
 }
 
 
+static sGolden Golden;		/**< -gold: golden stream */
+static int *GoldVal;		/**< -gold: output values of current iteration */
+int GoldFailed;				/**< -gold: number of failed iterations */
+
+/** 
+* @brief Open golden stream (-gold). A .dmi header sets start and size.
+* 
+* @return TRUE if success
+*/
+int initGolden(void)
+{
+	FILE *fp = goldFP;
+
+	goldFP = NULL;		/* owned by Golden */
+	if(!goldenOpen(&Golden, fp, "-gold", goldTol, goldStart, goldSize, 1, TRUE)){
+		goldenClose(&Golden);
+		return FALSE;
+	}
+	Golden.Stop = goldStop;
+	GoldVal = (int *)malloc(sizeof(int) * (Golden.Size + 1));
+	return TRUE;
+}
+
+/** 
+* @brief Compare output with next golden frame. Called after every simCore().
+* 
+* @return FALSE if iteration failed and -goldx is given
+*/
+int checkGolden(void)
+{
+	int data;
+	int failed = Golden.Failed;
+	int ok;
+
+	if(!GoldVal) return TRUE;	/* no -gold */
+
+	for(int i = 0; i < Golden.Size; i++){
+		data = briefRdDataMem(Golden.Start - dataSegAddr + i);
+		if(data >= 0x800){
+			data -= 0x1000;
+		}
+		GoldVal[i] = data;
+	}
+	ok = goldenCompare(&Golden, ItrCntr + 1, GoldVal);
+	if(Golden.Failed > failed) GoldFailed++;
+	return ok;
+}
+
 /** 
 * @brief Close files and write data if needed.
 */
@@ -288,8 +368,29 @@ void closeSim(void)
 	int i;
 	int data;
 
-	/* memory dump output */
-	if(dumpOutFP){
+	/* golden comparison summary */
+	if(GoldVal){
+		goldenReport(&Golden);
+		goldenClose(&Golden);
+		free(GoldVal);
+		GoldVal = NULL;
+	}
+
+	/* binary image: data memory copied straight into mapped file */
+	if(dumpOutFP && dumpOutImage){
+		sDmImage img;
+
+		if(dmiCreate(dumpOutFP, &img, dumpOutStart, dumpOutSize, 1)){
+			for(i = 0; i < dumpOutSize; i++){
+				data = briefRdDataMem(dumpOutStart - dataSegAddr + i);
+				if(data >= 0x800){
+					data -= 0x1000;
+				}
+				dmiSet(&img, i, 0, data);
+			}
+			dmiClose(&img);
+		}
+	}else if(dumpOutFP){
 		//if -ad option set (dataSegAddr)
 		dumpOutStart -= dataSegAddr;
 
@@ -305,6 +406,7 @@ void closeSim(void)
 	/* close file */
 	fclose(inFP);
 	if(LdiFP) fclose(LdiFP);
+	if(InitDataFP) fclose(InitDataFP);
 	if(dumpDisFP) fclose(dumpDisFP);
 	if(dumpInFP)  fclose(dumpInFP);
 	if(dumpOutFP) fclose(dumpOutFP);
@@ -17,6 +17,10 @@ sBCode *binSimOneStep(sBCode *p);
 sBCode *binSimOneStepMultiFunc(sBCode *p);
 void initSim(void);
 void closeSim(void);
+int initGolden(void);
+int checkGolden(void);
+
+extern int GoldFailed;
 int codeScan(sBCodeList *bcode);
 sBCode *codeScanOneInst(sBCode *p);
 //sBCode *codeScanOneInstMultiFunc(sBCode *p);
@@ -4308,22 +4308,9 @@ void processCordicFunc(sBCode *p, cplx ct1, int rdst)
 */
 int getIntField(sBCode *p, int fval)
 {
-	int code = UNDEF_FIELD;
-	int found = FALSE;
+	int code = isaGetField(p->InstType, fval, p->Code);
 
-	const sInstFormat *sp = &(sInstFormatTable[p->InstType]);
-
-	int sum = 0;
-	for(int i = 0; i < MAX_FIELD; i++){
-		if(sp->fields[i] == fval){ 
-			code = bin2int(p->Binary + sum, sp->widths[i]);
-			found = TRUE;
-			break;
-		}
-		sum += sp->widths[i];
-	}
-
-	if(found == FALSE){
+	if(code == ISA_NO_FIELD){
 		if(!(fval == fCOND || fval == fCONJ)){
 			/* print error message */
 			printRunTimeError(p->PMA, (char *)sField[fval], 
@@ -0,0 +1,83 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file dmimage.h
+* @brief Header for binary data memory image files (-if/-of)
+* @date 2026-10-19
+*/
+
+#ifndef	_DMIMAGE_H
+#define	_DMIMAGE_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define	DMI_MAGIC		"\177DMI"	/**< first 4 bytes of image; never starts a text dump */
+#define	DMI_VERSION		1			/**< image format version */
+#define	DMI_HDRSIZE		16			/**< header size in bytes */
+#define	DMI_MAXADDR		0x10000		/**< data memory address space */
+#define	DMI_MAXLANES	4			/**< data paths (NUMDP): most lanes per address */
+#define	DMI_EXT			".dmi"		/**< -of filename extension selecting binary output */
+
+/**
+* @brief Data memory image.
+*
+* File layout (all little-endian):
+*	offset  0: char[4]  magic "\177DMI"
+*	offset  4: uint16   version
+*	offset  6: uint16   lanes per address (1 ~ DMI_MAXLANES)
+*	offset  8: uint32   start address
+*	offset 12: uint32   size in words
+*	offset 16: int16    data[size][lanes]
+*/
+typedef struct sDmImage {
+	unsigned int	Start;		/**< first data memory address */
+	unsigned int	Size;		/**< number of addresses */
+	int		Lanes;				/**< values per address */
+	unsigned char	*Data;		/**< first value (after header) */
+	void	*Buf;				/**< mapped or allocated image including header */
+	size_t	Len;				/**< image length in bytes */
+	int		Mapped;				/**< TRUE if Buf is mmap()ed */
+	FILE	*FP;				/**< output stream if Buf is written by dmiClose() */
+} sDmImage;
+
+int dmiIsImage(FILE *fp);
+int dmiIsImageName(char *name);
+int dmiLoad(FILE *fp, sDmImage *img);
+int dmiCreate(FILE *fp, sDmImage *img, unsigned int start, unsigned int size, int lanes);
+void dmiClose(sDmImage *img);
+int dmiReadHeader(FILE *fp, sDmImage *img);
+int dmiWriteHeader(FILE *fp, unsigned int start, unsigned int size, int lanes);
+
+/**
+* @brief Read one value of the image.
+*
+* @param img Image
+* @param i Word index from img->Start
+* @param lane Lane number
+*
+* @return Signed 16-bit value
+*/
+static inline int dmiGet(sDmImage *img, unsigned int i, int lane)
+{
+	unsigned char *p = img->Data + 2 * (i * img->Lanes + lane);
+	return (short)(p[0] | (p[1] << 8));
+}
+
+/**
+* @brief Write one value of the image.
+*
+* @param img Image
+* @param i Word index from img->Start
+* @param lane Lane number
+* @param v Signed value (low 16 bits stored)
+*/
+static inline void dmiSet(sDmImage *img, unsigned int i, int lane, int v)
+{
+	unsigned char *p = img->Data + 2 * (i * img->Lanes + lane);
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+}
+
+#endif	/* _DMIMAGE_H */
@@ -15,11 +15,15 @@ All Rights Reserved.
 #include "dmem.h"
 //#include "secinfo.h"
 #include "binsimcore.h"
+#include "dmimage.h"
+#include "golden.h"
+#include "../common/asyncout.h"
 #include <stdio.h>	/* perror() */
 #include <stdlib.h>	/* strtol(), exit() */
 #include <string.h>	/* strcpy() */
 #include <ctype.h>
 #include <time.h>
+#include <unistd.h>	/* isatty() */
 
 #ifdef	VHPI		/* VHPI: dspsim.so library only */
 #include "dsp.h"
@@ -45,11 +49,18 @@ int dumpInSize = DEF_DUMPINSIZE;			/* size of memory dump input */
 FILE *dumpOutFP;		/* file pointer to memory dump output */
 int dumpOutStart;		/* start address of memory dump output */
 int dumpOutSize = DEF_DUMPOUTSIZE;		/* size of memory dump output */
+int dumpOutImage = FALSE;	/* TRUE if memory dump output is a binary image (.dmi) */
+FILE *goldFP;			/* file pointer to golden reference stream */
+int goldStart;			/* start address of compared output */
+int goldSize = DEF_GOLDSIZE;		/* words compared per iteration */
+char *goldTol;			/* golden comparison tolerance (-goldt) */
+int goldStop = FALSE;	/* for -goldx option: stop at first failing iteration */
 
 char *infile = NULL;	/* pointer to input file name */
 FILE *inFP;				/* file pointer to input binary executable file */
 FILE *dumpDisFP;		/* file pointer to dis-assembly file */
 FILE *LdiFP;			/* file pointer to loading info file */
+FILE *InitDataFP;		/* file pointer to initialized data image (.dmi) */
 char filebuf[MAX_LINEBUF];
 
 int codeSegAddr;		/* start address of code segment; specified by .ldi file */
@@ -82,6 +93,9 @@ int main(int argc, char *argv[])
 	/* process input arguments */
 	if(!processArg(argc, argv)) return 0;
 
+	/* non-interactive trace output goes through writer thread */
+	if(SimMode == 'C' && !VhpiMode && !isatty(STDOUT_FILENO)) asyncStdout();
+
 	/* self-diagnosis: verify instruction table */
 	int verifyResult = VerifyInstructionTable();
 
@@ -131,6 +145,10 @@ int main(int argc, char *argv[])
 
 	/* init simulator */
 	initSim();
+	if(goldFP && !initGolden()){
+		closeSim();
+		exit(1);
+	}
 
 	/* simulator main loop */
 	printf("\nBegin Simulation..\n\n");
@@ -138,6 +156,10 @@ int main(int argc, char *argv[])
 		printf("Iteration %d of %d:\n", ItrCntr+1, ItrMax);
 
 		simResult = simCore(bCode);
+		if(!checkGolden()){	/* golden comparison failed */
+			closeSim();
+			exit(1);
+		}
 		if(simResult){  /* exit simulation loop */
 			break;
 		}
@@ -165,7 +187,7 @@ int main(int argc, char *argv[])
 	dMemHashRemoveAll(dataMem);
 	//sSecInfoListRemoveAll(&secInfo);
 
-	exit(0);	/* no error */
+	exit(GoldFailed ? 1 : 0);	/* golden comparison failed or no error */
 }
 
 /** 
@@ -317,8 +339,9 @@ int	processArg(int argc, char *argv[])
 				}
 				printf("memory dump output filename: %s\n", argv[i]);
 
-				/* file open */
-				if(!(dumpOutFP = fopen(argv[i], "w"))){
+				/* file open: binary image is mapped, so open for update */
+				dumpOutImage = dmiIsImageName(argv[i]);
+				if(!(dumpOutFP = asyncOpen(argv[i], dumpOutImage ? "w+b" : "w"))){
 					printFileOpenError(argv[0], argv[i]);
 					return FALSE;
 				}
@@ -345,6 +368,59 @@ int	processArg(int argc, char *argv[])
 				dumpOutSize = atoi(argv[i]);
 				printf("memory dump output size in words: %d\n", dumpOutSize);
 			}
+		} else if(!strcmp("-gold", argv[i])){
+			if(!DisassemblerMode){
+				/* golden reference filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("golden reference filename: %s\n", argv[i]);
+
+				/* file open */
+				if(!(goldFP = fopen(argv[i], "rb"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-golda", argv[i])){
+			if(!DisassemblerMode){
+				/* compared output start address (absolute) */
+				i++;
+				if((argv[i] == NULL) || !isxdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldStart = (int)strtol(argv[i], NULL, 16);
+				printf("golden comparison start address (absolute): 0x%04X\n", goldStart);
+			}
+		} else if(!strcmp("-golds", argv[i])){
+			if(!DisassemblerMode){
+				/* words compared per iteration */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldSize = atoi(argv[i]);
+				printf("golden comparison size in words: %d\n", goldSize);
+			}
+		} else if(!strcmp("-goldt", argv[i])){
+			if(!DisassemblerMode){
+				/* golden comparison tolerance */
+				i++;
+				if((argv[i] == NULL) || !isalpha(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldTol = argv[i];
+				printf("golden comparison tolerance: %s\n", goldTol);
+			}
+		} else if(!strcmp("-goldx", argv[i])){
+			if(!DisassemblerMode){
+				goldStop = TRUE;
+			}
 		} else if(!strcmp("-a", argv[i])){
 			if(!DisassemblerMode){
 				/* disassembler mode set */
@@ -405,10 +481,16 @@ int	processArg(int argc, char *argv[])
 				return FALSE;
 			}
 
+			/* .dmi file open: written by dsplnk only if .VAR initializers exist */
+			changeFilenameExt(filebuf, argv[i], "dmi");
+			if((InitDataFP = fopen(filebuf, "rb")) != NULL){
+				printf("initialized data (.dmi) filename: %s\n", filebuf);
+			}
+
 			/* .dis file open */
 			changeFilenameExt(filebuf, argv[i], "dis");
 			printf("disassembly (.dis) filename: %s\n", filebuf);
-			if(!(dumpDisFP = fopen(filebuf, "wt"))){
+			if(!(dumpDisFP = asyncOpen(filebuf, "wt"))){
 				printFileOpenError(argv[0], filebuf);
 				return FALSE;
 			}
@@ -436,12 +518,17 @@ void printHelp(char *s)
 		printf("\t-q [--quiet]  \tprint only summary information (no human input)\n");
 		printf("\t-c            \trun in continuous mode\n");
 		printf("\t-l number     \tspecify number of loop iterations [default: %d]\n", DEF_ITRMAX);
-		printf("\t-if filename  \tload data memory from file\n");
+		printf("\t-if filename  \tload data memory from file (a decimal number per line, or .dmi image)\n");
 		printf("\t-ia hexnumber \tload data memory start address (absolute addr) [default: 0000]\n");
 		printf("\t-is words     \tnumber of words to load into data memory [default: %d]\n", DEF_DUMPINSIZE);
-		printf("\t-of filename  \tdump data memory into file\n");
+		printf("\t-of filename  \tdump data memory into file (binary image if filename ends with .dmi)\n");
 		printf("\t-oa hexnumber \tdump data memory start address (absolute addr) [default: 0000]\n");
 		printf("\t-os words     \tnumber of words to dump from data memory [default: %d]\n", DEF_DUMPOUTSIZE);
+		printf("\t-gold filename\tcompare output with next golden frame after each iteration (text or .dmi stream)\n");
+		printf("\t-golda hexnumber\tgolden comparison start address (absolute addr) [default: 0000]\n");
+		printf("\t-golds words  \tnumber of words compared per iteration [default: %d]\n", DEF_GOLDSIZE);
+		printf("\t-goldt tol    \tcomparison tolerance: exact, lsb=N or snr=dB [default: exact]\n");
+		printf("\t-goldx        \tstop at first failing iteration (exit code 1)\n");
 		printf("\t-a            \tdisassembler mode (no simulation)\n");
 //		printf("\t-ac hexnumber \tspecify code segment base address [default: 0000]\n");
 //		printf("\t-ad hexnumber \tspecify data segment base address [default: 0000]\n");
@@ -50,6 +50,7 @@ int parseBinary(void)
 {
 	char data[INSTLEN/8];
 	char tdata[INSTLEN+1];
+	unsigned int code;
 	int numInt = 0;
 	int instType;
 
@@ -59,13 +60,18 @@ int parseBinary(void)
 		}
 		tdata[INSTLEN] = '\0';
 
-		sBCodeListAdd(&bCode, tdata, numInt);
+		code = 0;
+		for(int i = 0; i < (INSTLEN/8); i++){
+			code = (code << 8) | (0xFF & data[i]);
+		}
+
+		sBCodeListAdd(&bCode, tdata, code, numInt);
 		/*
 		fprintf(dumpDisFP, "%04d: %02X %02X %02X %02X: ", numInt, 
 			0xFF & data[0], 0xFF & data[1], 
 			0xFF & data[2], 0xFF & data[3]); 
 
-		instType = findInstType(tdata);
+		instType = isaDecode(code);
 		if(instType){
 			fprintf(dumpDisFP, "%s %2d", sType[instType], sBinOp[instType].width);
 		}else{	
@@ -122,33 +128,6 @@ int bin2int(char str[], int width)
 }
 
 
-/** 
-* @brief Read opcode and determine instruction type
-* 
-* @param inst Character string which contain instruction (32 bytes)
-* 
-* @return eType type index
-*/
-int findInstType(char inst[INSTLEN+1])
-{
-	int i = 1;
-
-	while(sType[i] != NULL){
-		if(!strncmp(sBinOp[i].bits, inst, sBinOp[i].width)){	/* match found */
-			if(VerboseMode){
-				printf("%s: %s: %d\n", sBinOp[i].bits, inst, sBinOp[i].width);
-			}
-
-			return i;
-		}else{	/* not found - try next one */
-			i++;
-			continue;
-		}
-	}
-	return 0;
-}
-
-
 /** 
 * @brief Before start-up, self-test if instruction table is ok.
 * 
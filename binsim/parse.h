@@ -14,7 +14,6 @@ int readLdiFile(void);
 int parseBinary(void);
 void bin2txt(char bin32, char txt32[8]);
 int bin2int(char str[], int width);
-int findInstType(char inst[INSTLEN+1]);
 
 int VerifyInstructionTable(void);
 
@@ -0,0 +1,296 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file asyncout.cc
+* @brief Asynchronous buffered output files (writer thread)
+*
+* Output files (listing, symbol, object, disassembly and error files,
+* memory dumps, region and checksum files) and, in continuous mode, a
+* redirected stdout are stdio streams
+* whose write function only queues their full ASYNC_BLOCKSIZE buffer.
+* One writer thread takes the blocks from each stream's single-producer
+* ring and writes them with large sequential write()s, so tracing costs
+* the simulation thread formatting time only.
+*
+* The ring needs no lock: Tail is advanced by the producer (which holds
+* the stdio lock of its FILE) and Head by the writer thread. fclose()
+* queues a close marker; asyncShutdown() (at exit) drains all rings.
+* After shutdown, and in forked workers, streams write synchronously.
+*
+* Shared by dspsim, binsim and dsplnk (compiled from their makefiles).
+* @date 2026-10-19
+*/
+
+#ifndef	_GNU_SOURCE
+#define	_GNU_SOURCE		/* fopencookie() */
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include "asyncout.h"
+
+#ifndef	TRUE
+#define	TRUE	1
+#endif
+#ifndef	FALSE
+#define	FALSE	0
+#endif
+
+static sAsyncStream asyncStreams[ASYNC_MAXSTREAMS];
+static char *asyncStdioBuf[ASYNC_MAXSTREAMS];	/**< stdio buffer of each slot, kept for reuse */
+static sem_t asyncPending;			/**< blocks queued in all rings, +1 to stop */
+static pthread_t asyncThread;
+static pthread_mutex_t asyncLock = PTHREAD_MUTEX_INITIALIZER;	/**< slot allocation */
+static int asyncStarted = FALSE;	/**< writer thread was tried */
+static int asyncRunning = FALSE;	/**< writer thread takes blocks */
+static int asyncStopping = FALSE;	/**< writer thread exits when rings are empty */
+static int asyncErrors = 0;			/**< failed writes */
+
+/**
+* @brief Write whole buffer to file descriptor.
+*
+* @return TRUE if success
+*/
+static int asyncWriteAll(int fd, const char *buf, size_t len)
+{
+	ssize_t n;
+
+	while(len){
+		n = write(fd, buf, len);
+		if(n < 0){
+			if(errno == EINTR) continue;
+			return FALSE;
+		}
+		buf += n;
+		len -= n;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Writer thread: write queued blocks until stopped and drained.
+*/
+static void *asyncWriter(void *)
+{
+	int next = 0;
+	sAsyncStream *s;
+
+	for(;;){
+		while(sem_wait(&asyncPending) && errno == EINTR);
+
+		/* one wake-up per queued block: take it from any non-empty ring */
+		s = NULL;
+		for(int k = 0; k < ASYNC_MAXSTREAMS; k++){
+			sAsyncStream *t = &asyncStreams[(next + k) % ASYNC_MAXSTREAMS];
+
+			if(__atomic_load_n(&t->Used, __ATOMIC_ACQUIRE)
+				&& t->Head != __atomic_load_n(&t->Tail, __ATOMIC_ACQUIRE)){
+				s = t;
+				next = (next + k + 1) % ASYNC_MAXSTREAMS;
+				break;
+			}
+		}
+		if(!s){
+			if(asyncStopping) break;
+			continue;
+		}
+
+		int b = s->Head % ASYNC_QDEPTH;
+		if(s->Len[b] < 0){		/* close marker */
+			if(!s->KeepFd) close(s->Fd);
+			sem_destroy(&s->Free);
+			s->Head++;
+			__atomic_store_n(&s->Used, FALSE, __ATOMIC_RELEASE);
+			continue;
+		}
+		if(!asyncWriteAll(s->Fd, s->Buf + b * ASYNC_BLOCKSIZE, s->Len[b])) asyncErrors++;
+		__atomic_store_n(&s->Head, s->Head + 1, __ATOMIC_RELEASE);
+		sem_post(&s->Free);
+	}
+	return NULL;
+}
+
+/**
+* @brief Forked child has no writer thread: write synchronously.
+*/
+static void asyncAtFork(void)
+{
+	asyncRunning = FALSE;
+}
+
+/**
+* @brief Start writer thread on first use. Called with asyncLock held.
+*/
+static void asyncStart(void)
+{
+	if(asyncStarted) return;
+	asyncStarted = TRUE;
+
+	sem_init(&asyncPending, 0, 0);
+	if(pthread_create(&asyncThread, NULL, asyncWriter, NULL)) return;	/* stay synchronous */
+	asyncRunning = TRUE;
+	pthread_atfork(NULL, NULL, asyncAtFork);
+	atexit(asyncShutdown);
+}
+
+/**
+* @brief Queue one block (len < 0: close marker); blocks while ring is full.
+*/
+static void asyncPush(sAsyncStream *s, const char *buf, int len)
+{
+	while(sem_wait(&s->Free) && errno == EINTR);
+
+	int b = s->Tail % ASYNC_QDEPTH;
+	if(len > 0) memcpy(s->Buf + b * ASYNC_BLOCKSIZE, buf, len);
+	s->Len[b] = len;
+	__atomic_store_n(&s->Tail, s->Tail + 1, __ATOMIC_RELEASE);
+	sem_post(&asyncPending);
+}
+
+/**
+* @brief stdio write function: queue buffer contents.
+*/
+static ssize_t asyncCookieWrite(void *cookie, const char *buf, size_t size)
+{
+	sAsyncStream *s = (sAsyncStream *)cookie;
+	size_t done = 0;
+	int len;
+
+	if(!asyncRunning){
+		return asyncWriteAll(s->Fd, buf, size) ? (ssize_t)size : -1;
+	}
+
+	while(done < size){
+		len = (size - done > ASYNC_BLOCKSIZE) ? ASYNC_BLOCKSIZE : (int)(size - done);
+		asyncPush(s, buf + done, len);
+		done += len;
+	}
+	return size;
+}
+
+/**
+* @brief stdio close function: queue close marker behind the data.
+*/
+static int asyncCookieClose(void *cookie)
+{
+	sAsyncStream *s = (sAsyncStream *)cookie;
+
+	if(!asyncRunning){
+		if(!s->KeepFd) close(s->Fd);
+		sem_destroy(&s->Free);
+		__atomic_store_n(&s->Used, FALSE, __ATOMIC_RELEASE);
+		return 0;
+	}
+	asyncPush(s, NULL, -1);
+	return 0;
+}
+
+/**
+* @brief Make a stdio stream writing through the writer thread.
+*
+* @param fd Output file descriptor
+* @param keepfd TRUE: fclose() does not close fd
+*
+* @return Stream, NULL if no free slot
+*/
+static FILE *asyncCreate(int fd, int keepfd)
+{
+	cookie_io_functions_t io = { NULL, asyncCookieWrite, NULL, asyncCookieClose };
+	sAsyncStream *s = NULL;
+	FILE *fp;
+	int k;
+
+	pthread_mutex_lock(&asyncLock);
+	asyncStart();
+	for(k = 0; k < ASYNC_MAXSTREAMS; k++){
+		if(!__atomic_load_n(&asyncStreams[k].Used, __ATOMIC_ACQUIRE)){
+			s = &asyncStreams[k];
+			break;
+		}
+	}
+	if(s){
+		if(!s->Buf){
+			s->Buf = (char *)malloc(ASYNC_QDEPTH * ASYNC_BLOCKSIZE);
+			asyncStdioBuf[k] = (char *)malloc(ASYNC_BLOCKSIZE);
+		}
+		s->Fd = fd;
+		s->KeepFd = keepfd;
+		s->Head = s->Tail = 0;
+		sem_init(&s->Free, 0, ASYNC_QDEPTH);
+		__atomic_store_n(&s->Used, TRUE, __ATOMIC_RELEASE);
+	}
+	pthread_mutex_unlock(&asyncLock);
+	if(!s) return NULL;
+
+	if(!(fp = fopencookie(s, "w", io))){
+		sem_destroy(&s->Free);
+		__atomic_store_n(&s->Used, FALSE, __ATOMIC_RELEASE);
+		return NULL;
+	}
+	setvbuf(fp, asyncStdioBuf[k], _IOFBF, ASYNC_BLOCKSIZE);
+	return fp;
+}
+
+/**
+* @brief Open output file written by the writer thread. Used like fopen().
+* Modes that read back ('r' or '+') open a plain stdio stream.
+*
+* @param name Filename
+* @param mode fopen() mode: "w", "wt", "wb", "a", ...
+*
+* @return Stream, NULL if the file cannot be opened
+*/
+FILE *asyncOpen(const char *name, const char *mode)
+{
+	FILE *fp;
+	int fd;
+
+	if(strchr(mode, 'r') || strchr(mode, '+')) return fopen(name, mode);
+
+	fd = open(name, O_WRONLY | O_CREAT | (strchr(mode, 'a') ? O_APPEND : O_TRUNC), 0666);
+	if(fd < 0) return NULL;
+
+	if(!(fp = asyncCreate(fd, FALSE))){		/* no free slot */
+		fp = fdopen(fd, mode);
+	}
+	return fp;
+}
+
+/**
+* @brief Route stdout through the writer thread (non-interactive runs).
+*/
+void asyncStdout(void)
+{
+	FILE *fp;
+
+	fflush(stdout);
+	if((fp = asyncCreate(STDOUT_FILENO, TRUE)) != NULL){
+		stdout = fp;
+	}
+}
+
+/**
+* @brief Flush all streams, drain all rings and stop writer thread.
+* Registered with atexit(); streams still open write synchronously afterwards.
+*/
+void asyncShutdown(void)
+{
+	if(!asyncRunning) return;
+
+	fflush(NULL);
+	asyncStopping = TRUE;
+	sem_post(&asyncPending);
+	pthread_join(asyncThread, NULL);
+	asyncRunning = FALSE;
+
+	if(asyncErrors){
+		fprintf(stderr, "\nError: %d output block(s) could not be written\n", asyncErrors);
+	}
+}
@@ -0,0 +1,40 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file asyncout.h
+* @brief Header for asynchronous buffered output files (writer thread)
+* @date 2026-10-19
+*/
+
+#ifndef	_ASYNCOUT_H
+#define	_ASYNCOUT_H
+
+#include <stdio.h>
+#include <semaphore.h>
+
+#define	ASYNC_BLOCKSIZE		65536	/**< bytes per queued block (= stdio buffer size) */
+#define	ASYNC_QDEPTH		16		/**< blocks queued per stream */
+#define	ASYNC_MAXSTREAMS	32		/**< output streams open at once */
+
+/**
+* @brief One output stream: single-producer ring of blocks for the writer thread.
+* Producer is whoever holds the stdio lock of the FILE; Tail is only written
+* by the producer and Head only by the writer thread.
+*/
+typedef struct sAsyncStream {
+	int		Used;						/**< slot in use (until writer closes fd) */
+	int		Fd;							/**< output file descriptor */
+	int		KeepFd;						/**< TRUE: do not close Fd (stdout) */
+	char	*Buf;						/**< ASYNC_QDEPTH blocks of ASYNC_BLOCKSIZE */
+	int		Len[ASYNC_QDEPTH];			/**< bytes in block; -1: close marker */
+	unsigned int	Head;				/**< next block to write (writer thread) */
+	unsigned int	Tail;				/**< next block to fill (producer) */
+	sem_t	Free;						/**< free blocks */
+} sAsyncStream;
+
+FILE *asyncOpen(const char *name, const char *mode);
+void asyncStdout(void);
+void asyncShutdown(void);
+
+#endif	/* _ASYNCOUT_H */
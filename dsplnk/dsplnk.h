@@ -32,7 +32,7 @@ All Rights Reserved.
 * @brief Table ID (for reading .sym)
 */
 enum eTabID {
-	tSecInfo, tGlobal, tExtern, tAll, tPatchExternRef, tPatchOtherRef, tSymbol, tEnd = 9,
+	tSecInfo, tGlobal, tExtern, tAll, tPatchExternRef, tPatchOtherRef, tSymbol, tInitData = 7, tEnd = 9,
 };
 
 extern char linebuf[MAX_LINEBUF];
@@ -50,9 +50,6 @@ extern FILE *MapFP;				/* .map file pointer */
 extern FILE *LdiFP;				/* .ldi file pointer */
 extern int ModuleCntr;
 
-extern char	bytebuf[INSTLEN];
-extern char bitbuf[INSTLEN/8];
-
 extern int codeSegAddr;
 extern int dataSegAddr;
 
@@ -0,0 +1,143 @@
+/*
+All Rights Reserved.
+*/
+
+/** 
+* @file initdata.cc
+* @brief Initialized data (.VAR x[n] = ...) merge and .dmi output
+*
+* The assembler lists initial values of each module in the tInitData 
+* section of .sym, after the symbol table. Addresses are relocated by the 
+* module data segment address and written as a data memory image (.dmi, 
+* see dmimage.h) next to .out, which binsim loads before the first 
+* iteration. Words between initialized variables are -1 (UNDEFINED).
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>		/* unlink() */
+#include "dsplnk.h"
+#include "module.h"
+#include "dmimage.h"
+#include "initdata.h"
+#include "../common/asyncout.h"
+
+static int *initData = NULL;	/**< initial values of data segment; -1: not initialized */
+static int initCntr = 0;		/**< number of initialized words */
+
+/** 
+* @brief Read initialized data of all modules. 
+* Called after allSymTabBuild(): tInitData section follows symbol table in .sym.
+* 
+* @param modlist input module linked lists
+*/
+void initDataBuild(sModuleList *modlist)
+{
+	char linebuf[MAX_LINEBUF];
+	int tabID;
+	unsigned int addr;
+	unsigned int data;
+
+	if(VerboseMode) printf("\n.sym file reading at initDataBuild().\n");
+
+	initData = (int *)malloc(sizeof(int) * (totalDataSize + 1));
+	for(int i = 0; i < totalDataSize; i++) initData[i] = -1;
+
+	sModule *n = modlist->FirstNode;
+	while(n != NULL){
+		if(VerboseMode) printf("-- File %0d: %s --\n", n->ModuleNo, n->Name);
+
+		/* process each .sym file */
+		while(fgets(linebuf, MAX_LINEBUF, n->SymFP)){
+			if(linebuf[0] == ';') continue;
+			sscanf(linebuf, "%d ", &tabID);
+
+			if(tabID == tInitData){
+				sscanf(linebuf, "%d %04X %X\n", &tabID, &addr, &data);
+				if(VerboseMode) printf("addr: %04X, data: %03X\n", addr, data);
+
+				/* update address considering each module offset */
+				addr += n->DataSegAddr;
+
+				if(addr < (unsigned int)dataSegAddr || addr >= (unsigned int)(dataSegAddr + totalDataSize)){
+					sprintf(msgbuf, "initialized data address 0x%04X is out of data segment", addr);
+					printErrorMsg(n->Name, msgbuf);
+				}
+				if(initData[addr - dataSegAddr] < 0) initCntr++;
+				initData[addr - dataSegAddr] = 0x0FFF & data;
+			}else{
+				break;	/* move to next .sym file */
+			}
+		};
+
+		/* move to next .sym file */
+		n = n->Next;
+	};
+}
+
+/** 
+* @brief Write initialized data image (.dmi) and its summary to .map.
+* Stale .dmi of a previous link is removed if nothing is initialized.
+*/
+void initDataDump(void)
+{
+	char dmiFile[MAX_LINEBUF];
+	FILE *fp;
+	int first = -1, last = -1;
+
+	changeFilenameExt(dmiFile, outFile, "dmi");
+
+	for(int i = 0; i < totalDataSize; i++){
+		if(initData[i] >= 0){
+			if(first < 0) first = i;
+			last = i;
+		}
+	}
+
+	fprintf(MapFP, ";-----------------------------------------------------------\n");
+	fprintf(MapFP, "; Output: Initialized Data (.dmi)\n");
+	fprintf(MapFP, ";-----------------------------------------------------------\n");
+
+	if(first < 0){
+		unlink(dmiFile);
+		fprintf(MapFP, "; Total: 0 initialized words\n");
+		fprintf(MapFP, "\n");
+		return;
+	}
+
+	if(!(fp = asyncOpen(dmiFile, "wb"))){
+		printFileOpenError((char *)TARGET, dmiFile);
+		return;
+	}
+	printf("initialized data (.dmi) filename: %s\n", dmiFile);
+
+	dmiWriteHeader(fp, dataSegAddr + first, last - first + 1, 1);
+	for(int i = first; i <= last; i++){
+		/* 12-bit value sign-extended to int16 little-endian */
+		int v = (initData[i] < 0) ? -1 : ((initData[i] & 0x800) ? (initData[i] | ~0xFFF) : initData[i]);
+
+		fputc(v & 0xFF, fp);
+		fputc((v >> 8) & 0xFF, fp);
+	}
+	fclose(fp);
+
+	fprintf(MapFP, "Addr Data\n");
+	for(int i = first; i <= last; i++){
+		if(initData[i] >= 0) fprintf(MapFP, "%04X %03X\n", dataSegAddr + i, initData[i]);
+	}
+	fprintf(MapFP, "; Total: %d initialized words (0x%04X - 0x%04X) in %s\n", 
+		initCntr, dataSegAddr + first, dataSegAddr + last, dmiFile);
+	fprintf(MapFP, "\n");
+}
+
+/** 
+* @brief Free initialized data buffer.
+*/
+void initDataRemoveAll(void)
+{
+	if(initData) free(initData);
+	initData = NULL;
+	initCntr = 0;
+}
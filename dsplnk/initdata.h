@@ -0,0 +1,19 @@
+/*
+All Rights Reserved.
+*/
+/** 
+* @file initdata.h
+* Header for initialized data (.VAR x[n] = ...) merge and .dmi output
+* @date 2026-10-19
+*/
+
+#ifndef	_INITDATA_H
+#define	_INITDATA_H
+
+#include "module.h"		/* for sModule */
+
+void initDataBuild(sModuleList *modlist);
+void initDataDump(void);
+void initDataRemoveAll(void);
+
+#endif	/* _INITDATA_H */
@@ -18,6 +18,8 @@ All Rights Reserved.
 #include "symtab.h"
 #include "ocode.h"
 #include "extreftab.h"
+#include "initdata.h"
+#include "../common/asyncout.h"
 
 char linebuf[MAX_LINEBUF];
 int lineno = 1;
@@ -33,9 +35,6 @@ FILE *MapFP = NULL;		/* .map */
 FILE *LdiFP = NULL;		/* .ldi */
 int ModuleCntr = 0;		/* Number of input modules (= .obj) */
 
-char bytebuf[INSTLEN];		
-char bitbuf[INSTLEN/8]; 
-
 int codeSegAddr;		/* start address of code segment; specified by user */
 int dataSegAddr;		/* start address of data segment; specified by user */
 
@@ -80,6 +79,8 @@ int main(int argc, char *argv[])
 	externRefTabBuild(extRefTable, globalSymTable, &moduleList);
 	/* merge symbol table */
 	allSymTabBuild(allSymTable, &moduleList);
+	/* merge initialized data */
+	initDataBuild(&moduleList);
 	/* merge object files */
 	globalOCodeListBuild(&globalObjCode, &moduleList);
 
@@ -108,6 +109,10 @@ int main(int argc, char *argv[])
 	/* write .out & .map file */
 	sOCodeBinDump(&globalObjCode);
 
+	/* initialized data dump */
+	/* write .dmi & .map file */
+	initDataDump();
+
 	/* close file and dump memory if needed */
 	closeLnk();
 
@@ -117,6 +122,7 @@ int main(int argc, char *argv[])
 	sExtRefTabHashRemoveAll(extRefTable);
 	sOCodeListRemoveAll(&globalObjCode);
 	sTabHashRemoveAll(allSymTable);
+	initDataRemoveAll();
 
 	printf("\nLinker ended successfully.\n\n");
 	exit(0);	/* no error */
@@ -268,7 +274,7 @@ int	processArg(int argc, char *argv[])
 
 	/* .out file open */
 	printf("linker output (.out) filename: %s\n", outFile);
-	if(!(OutFP = fopen(outFile, "wb"))){
+	if(!(OutFP = asyncOpen(outFile, "wb"))){
 		printFileOpenError(argv[0], outFile);
 		return FALSE;
 	}
@@ -276,7 +282,7 @@ int	processArg(int argc, char *argv[])
 	/* .map file open */
 	changeFilenameExt(filebuf, outFile, "map");
 	printf("linker map (.map) filename: %s\n", filebuf);
-	if(!(MapFP = fopen(filebuf, "wt"))){
+	if(!(MapFP = asyncOpen(filebuf, "wt"))){
 		printFileOpenError(argv[0], filebuf);
 		return FALSE;
 	}
@@ -285,7 +291,7 @@ int	processArg(int argc, char *argv[])
 	/* .ldi file open */
 	changeFilenameExt(filebuf, outFile, "ldi");
 	printf("loading info (.ldi) filename: %s\n", filebuf);
-	if(!(LdiFP = fopen(filebuf, "wt"))){
+	if(!(LdiFP = asyncOpen(filebuf, "wt"))){
 		printFileOpenError(argv[0], filebuf);
 		return FALSE;
 	}
@@ -17,10 +17,6 @@ All Rights Reserved.
 #include "symtab.h"	
 #include "typetab.h"	/* for eType, getType() */
 
-int bitPos;		/* for use in bitwrite() and sOCodeBinDump() */
-int relAddr, relPos, relBitWidth;	/* for use with t03a, t03c, t03d, t03e 
-									   in sOCodeBinDump() */
-
 /** 
 * @brief Allocate a node dynamically.
 * 
@@ -322,7 +318,7 @@ void globalOCodeListBuild(sOCodeList *codelist, sModuleList *modlist)
 	char linebuf[MAX_LINEBUF];
 	int pma, ln, offset, pos, width;
 	char sbin[INSTLEN+1];
-	unsigned char shex[INSTLEN/8];
+	unsigned int shex[INSTLEN/8];
 	char stype[4];
 	char sinst[10];
 	char smemref[4];
@@ -357,7 +353,10 @@ void globalOCodeListBuild(sOCodeList *codelist, sModuleList *modlist)
 
 			/* add new code to list */
 			sOCode *p = sOCodeListAdd(codelist, pma, ln, n);	
-			strcpy(p->BinCode, sbin);
+			for(int i = 0; i < INSTLEN; i++){
+				p->Code = (p->Code << 1) | (sbin[i] == '1');
+			}
+			p->NotAssembled = (sbin[0] == '-');		/* "----...": assembler error */
 			if(!strcasecmp(smemref, "NON"))
 				p->MemoryRefType = tNON;
 			else if(!strcasecmp(smemref, "ABS"))
@@ -386,7 +385,8 @@ void globalOCodeListBuild(sOCodeList *codelist, sModuleList *modlist)
 void sOCodeBinDump(sOCodeList *list)
 {
 	char stype[10];
-	char bitb[INSTLEN/4];
+	char sbin[INSTLEN+1];
+	unsigned char bitb[INSTLEN/8];
 
 	/* dump global object code list */
 	fprintf(MapFP, ";-----------------------------------------------------------\n");
@@ -398,15 +398,21 @@ void sOCodeBinDump(sOCodeList *list)
 		
 	while(n != NULL){
 		sOCodeListPrintType(stype, n->MemoryRefType);
-		fprintf(MapFP, "%04X: %32s: ", n->PMA, n->BinCode);
+		for(int i = 0; i < INSTLEN; i++){
+			if(n->NotAssembled) sbin[i] = '-';
+			else sbin[i] = ((n->Code >> (INSTLEN - 1 - i)) & 0x1) ? '1' : '0';
+		}
+		sbin[INSTLEN] = '\0';
+		fprintf(MapFP, "%04X: %32s: ", n->PMA, sbin);
 
-		packbuf(n->BinCode, bitb);
+		for(int i = 0; i < INSTLEN/8; i++){
+			bitb[i] = (unsigned char)(n->Code >> (INSTLEN - 8 - 8*i));
+		}
 
 		/* binary write to .out file */
 		fwrite(bitb, 4, 1, OutFP);
 
-		fprintf(MapFP, "%02X %02X %02X %02X: ", (unsigned char)bitb[0], (unsigned char)bitb[1], 
-			(unsigned char)bitb[2], (unsigned char) bitb[3]);
+		fprintf(MapFP, "%02X %02X %02X %02X: ", bitb[0], bitb[1], bitb[2], bitb[3]);
 		if(n->MemoryRefType == tREL){
 			fprintf(MapFP, "%s %04X %02d %02d", stype, n->Offset, n->Pos, n->Width);
 		}else{
@@ -421,118 +427,6 @@ void sOCodeBinDump(sOCodeList *list)
 }
 
 
-/** 
-* @brief Write n bits of binary data to binary and text files.
-* 
-* @param p Pointer to current instruction
-* @param s Bitstream in string format
-* @param n Number of bits to write
-* @param byteb Character array to append input string s, where 1 char is binary 1 bit 
-* @param bitb Character array, where 1 bit is binary 1 bit
-* @param bFP File pointer to binary code dump file 
-* @param tFP File pointer to text code dump file (= object file)
-*/
-void bitwrite(sOCode *p, char *s, int n, char byteb[], char bitb[], FILE *bFP, FILE *tFP)
-{
-	int i;
-	char sMemoryRefType[10];
-
-	if(!bitPos){
-		if(tFP){
-			fprintf(tFP,"%04d %04X: ", p->LineCntr, p->PMA);
-		}
-	}
-
-	if(bFP){
-		for(i = 0; i < n; i++){
-			byteb[bitPos++] = s[i];
-		}
-	}
-
-	if(tFP){
-		for(i = 0; i < n; i++){
-			fprintf(tFP, "%d", s[i] - '0');
-		}
-	}
-
-	if(bitPos == INSTLEN){
-		packbuf(byteb, bitb);
-
-		//fwrite(bitb, sizeof(bitb), 1, bFP);
-		fwrite(bitb, 4, 1, bFP);
-
-		bitPos = 0;	/* reset counter */
-
-		/*
-		fprintf(tFP," %02X %02X %02X %02X", (unsigned char)bitb[0], 
-			(unsigned char)bitb[1], (unsigned char)bitb[2], (unsigned char)bitb[3]);
-		fprintf(tFP,"  %s %-10s", sType[p->InstType], sOp[p->Index]);
-
-		sOCodeListPrintType(sMemoryRefType, p->MemoryRefType);
-		fprintf(tFP," %s", sMemoryRefType);
-		*/
-	
-		if(p->MemoryRefType == tREL){
-			fprintf(tFP," %04X %d %d", 0xFFFF & relAddr, relPos, relBitWidth);
-		}
-
-		fprintf(tFP,"\n");
-	}else if(bitPos > INSTLEN){
-		assert(bitPos <= INSTLEN);
-	}
-}
-
-/** 
-* @brief Report bitwrite error to the text & binary dump file.
-* 
-* @param p Pointer to current instruction
-* @param bFP File pointer to binary code dump file 
-* @param tFP File pointer to text code dump file (= object file)
-*/
-void bitwriteError(sOCode *p, FILE *bFP, FILE *tFP)
-{
-	int i;
-
-	if(bFP){
-		char bitb[INSTLEN/8] = { 0, 0, 0, 0 };
-		fwrite(bitb, 4, 1, bFP);
-	}
-
-	/*
-	if(tFP){
-		fprintf(tFP,"%04d %04X: ", p->LineCntr, p->PMA);
-		fprintf(tFP, "--------------------------------");
-		fprintf(tFP, " XX XX XX XX");
-		fprintf(tFP,"  %s %-10s\n", sType[p->InstType], sOp[p->Index]);
-	}
-
-	printf("line %d: Error: Cannot assemble this instruction (Opcode: %s)\n",
-		p->LineCntr, sOp[p->Index]);
-	*/
-}
-
-/** 
-* @brief Pack INSTLEN bytes into INSTLEN bits
-* 
-* @param byteb Input character array, where 1 char is binary 1 bit 
-* @param bitb Output character array, where 1 bit is binary 1 bit
-*/
-void packbuf(char byteb[], char bitb[])
-{
-	int i, j;
-	char c;
-
-	for(i = 0; i < (INSTLEN/8); i++){
-		c = 0;
-		for(j = 0; j < 8; j++){
-			if(byteb[i*8 + j] == '1') c |= 0x1;
-			if(j != 7) c <<= 1;
-		}
-		bitb[i] = c;
-	}
-}
-
-
 /** 
 * Patch every external symbol reference of object code 
 * with relocated symbol address.
@@ -624,6 +518,30 @@ void patchOtherRef(sTabList tablist[], sExtRefTabList extlist[],
 }
 
 
+/** 
+* @brief Store the patched memory reference into the instruction word.
+* The field is found in sInstFormatTable[] by its bit position and width
+* as recorded by the assembler (relPos, relBitWidth in .obj).
+* 
+* @param n Pointer to object code 
+*/
+static void patchOCodeField(sOCode *n)
+{
+	const sInstFormat *f = &sInstFormatTable[n->InstType];
+	int k, pos = 0;
+
+	for(k = 0; k < MAX_FIELD && f->widths[k]; k++){
+		if(pos == n->Pos && f->widths[k] == n->Width){
+			n->Code = isaSetField(n->InstType, f->fields[k], n->Code, n->Offset);
+			return;
+		}
+		pos += f->widths[k];
+	}
+	sprintf(msgbuf, "no %s field at bit %d, width %d (Line %d)", 
+		sType[n->InstType], n->Pos, n->Width, n->LineCntr);
+	printErrorMsg(n->Module->Name, msgbuf);
+}
+
 /** 
 * @brief Apply global symbol address to the external memory reference field of object code.
 * 
@@ -665,7 +583,7 @@ void patchOCodeExternRef(sOCode *n, sTab *sp)
 	fprintf(MapFP, "\n");
 
 	/* more routines to patch binary opcode */
-	int2bin(n->BinCode + n->Pos, n->Offset, n->Width);
+	patchOCodeField(n);
 }
 
 /** 
@@ -696,32 +614,5 @@ void patchOCodeOtherRef(sOCode *n)
 	n->IsPatched = TRUE;
 
 	/* more routines to patch binary opcode */
-	int2bin(n->BinCode + n->Pos, n->Offset, n->Width);
+	patchOCodeField(n);
 }
-
-/**
-* @brief Simulate binary printf function, for example, something like '%b'
-*
-* @param ret String buffer to write in binary format, e.g. "0000"
-* @param val Binary integer number to convert
-* @param n Number of output characters
-*/
-void int2bin(char *ret, int val, int n)
-{
-    int i;
-    int mask = 0x1;
-
-    if(ret){
-        /* ret[0]: MSB, ret[n-1]: LSB */
-        for(i = 0; i < n; i++){
-            if(val & mask){
-                ret[n-1-i] = '1';
-            }else
-                ret[n-1-i] = '0';
-            mask <<= 1;
-        }
-    }else{
-        assert(ret != NULL);
-    }
-}
-
@@ -34,7 +34,8 @@ typedef struct sOCode {
 
 	//char 	*Line;				/**< one line of asm program */
 
-	char BinCode[INSTLEN+1];			/**< opcode in binary string format */
+	unsigned int Code;			/**< instruction word; bit 0 of .obj bit string is MSB */
+	int NotAssembled;			/**< TRUE if assembler could not encode it */
 
 	int	MemoryRefType;			/**< if memory reference exits, 
 									is it absolute or relative address?
@@ -72,14 +73,10 @@ void sOCodeBinDump(sOCodeList *list);
 void oCodeInit(sOCodeList *list);
 void globalOCodeListBuild(sOCodeList *codelist, sModuleList *modlist);
 
-void bitwrite(sOCode *p, char *s, int n, char byteb[], char bitb[], FILE *bFP, FILE *tFP);
-void bitwriteError(sOCode *p, FILE *bFP, FILE *tFP);
-void packbuf(char byteb[], char bitb[]);
 void patchExternRef(sTabList tablist[], sExtRefTabList extlist[], sOCodeList *codelist, sModuleList *modlist);
 void patchOtherRef(sTabList tablist[], sExtRefTabList extlist[], sOCodeList *codelist, sModuleList *modlist);
 void patchOCodeExternRef(sOCode *n, sTab *sp);
 void patchOCodeOtherRef(sOCode *n);
-void int2bin(char *ret, int val, int n);
 
 extern struct sOCodeList globalObjCode;       /**< Object Code List */
 
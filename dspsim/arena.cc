@@ -0,0 +1,187 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file arena.cc
+* Arena (region) allocation of program nodes and strings
+*
+* Everything a program load creates - sICode, sTab, sMemRef, dMem and
+* sSecInfo nodes with their line, operand, comment and name strings - is
+* bump-allocated from progArena (through curArena), so nodes of one
+* program lie together in memory and the whole program is released with
+* one arenaFree(). The simulation server keeps one arena per cached program.
+*
+* Small objects given back with arenaRelease() (data memory nodes removed
+* at run time) are reused by later allocations of the same size class.
+*
+* Objects the simulator does not touch while running (source lines,
+* comments, listing data) are taken from a separate block chain with
+* arenaAllocCold(), so that instructions, operands and symbols stay dense.
+*
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "arena.h"
+
+sArena progArena;				/**< current program: freed on unload */
+sArena *curArena = &progArena;	/**< arena new program nodes go to */
+
+/**
+* @brief Take zero-filled space from the current block of a chain.
+*
+* @param chain Block chain
+* @param size Object size in bytes (multiple of ARENA_ALIGN)
+*
+* @return Pointer to object
+*/
+static void *arenaBump(sArenaBlock **chain, size_t size)
+{
+	sArenaBlock *b = *chain;
+	void *p;
+
+	if(!b || b->Used + size > b->Size){
+		size_t bsize = (size > ARENA_BLOCKSIZE) ? size : ARENA_BLOCKSIZE;
+
+		b = (sArenaBlock *)calloc(1, sizeof(sArenaBlock) + bsize);
+		assert(b != NULL);
+		b->Size = bsize;
+		b->Used = 0;
+		b->Next = *chain;
+		*chain = b;
+	}
+	p = (char *)(b + 1) + b->Used;
+	b->Used += size;
+	return p;
+}
+
+/**
+* @brief Allocate zero-filled object from arena.
+*
+* @param a Arena
+* @param size Object size in bytes
+*
+* @return Pointer to object (ARENA_ALIGN aligned)
+*/
+void *arenaAlloc(sArena *a, size_t size)
+{
+	size_t units = (size + ARENA_ALIGN - 1) / ARENA_ALIGN;
+	void *p;
+
+	if(units == 0) units = 1;
+	size = units * ARENA_ALIGN;
+
+	/* released object of this size */
+	if(units <= ARENA_FREECLASSES && (p = a->Free[units-1]) != NULL){
+		a->Free[units-1] = *(void **)p;
+		memset(p, 0, size);
+		return p;
+	}
+	return arenaBump(&a->Block, size);
+}
+
+/**
+* @brief Allocate zero-filled object that is rarely used from arena.
+*
+* @param a Arena
+* @param size Object size in bytes
+*
+* @return Pointer to object (ARENA_ALIGN aligned)
+*/
+void *arenaAllocCold(sArena *a, size_t size)
+{
+	size_t units = (size + ARENA_ALIGN - 1) / ARENA_ALIGN;
+
+	if(units == 0) units = 1;
+	return arenaBump(&a->Cold, units * ARENA_ALIGN);
+}
+
+/**
+* @brief Copy string into arena.
+*
+* @param a Arena
+* @param s String
+*
+* @return Pointer to copy
+*/
+char *arenaStrdup(sArena *a, const char *s)
+{
+	return arenaStrndup(a, s, strlen(s));
+}
+
+/**
+* @brief Copy first len characters of string into arena (NUL-terminated).
+*
+* @param a Arena
+* @param s String
+* @param len Number of characters
+*
+* @return Pointer to copy
+*/
+char *arenaStrndup(sArena *a, const char *s, size_t len)
+{
+	char *t = (char *)arenaAlloc(a, len + 1);
+
+	memcpy(t, s, len);
+	t[len] = '\0';
+	return t;
+}
+
+/**
+* @brief Copy rarely used string into arena.
+*
+* @param a Arena
+* @param s String
+*
+* @return Pointer to copy
+*/
+char *arenaStrdupCold(sArena *a, const char *s)
+{
+	size_t len = strlen(s);
+	char *t = (char *)arenaAllocCold(a, len + 1);
+
+	memcpy(t, s, len + 1);
+	return t;
+}
+
+/**
+* @brief Give back an object for reuse by arenaAlloc() of the same size.
+* Larger objects stay allocated until arenaFree().
+*
+* @param a Arena the object was allocated from
+* @param p Object
+* @param size Object size in bytes (as allocated)
+*/
+void arenaRelease(sArena *a, void *p, size_t size)
+{
+	size_t units = (size + ARENA_ALIGN - 1) / ARENA_ALIGN;
+
+	if(!p || units == 0 || units > ARENA_FREECLASSES) return;
+	*(void **)p = a->Free[units-1];
+	a->Free[units-1] = p;
+}
+
+/**
+* @brief Free all objects of an arena at once. Arena is empty afterwards.
+*
+* @param a Arena
+*/
+void arenaFree(sArena *a)
+{
+	sArenaBlock *chain[2] = { a->Block, a->Cold };
+
+	for(int i = 0; i < 2; i++){
+		sArenaBlock *b = chain[i];
+
+		while(b){
+			sArenaBlock *n = b->Next;
+
+			free(b);
+			b = n;
+		}
+	}
+	memset(a, 0, sizeof(sArena));
+}
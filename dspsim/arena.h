@@ -0,0 +1,57 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file arena.h
+* Header for arena (region) allocation of program nodes and strings
+*
+* @date 2026-10-19
+*/
+
+#ifndef	_ARENA_H
+#define	_ARENA_H
+
+#include <stddef.h>
+
+#define	ARENA_BLOCKSIZE		65536	/**< bytes per arena block (more for large objects) */
+#define	ARENA_ALIGN			8		/**< object alignment */
+#define	ARENA_FREECLASSES	32		/**< released objects up to this many ARENA_ALIGN units are reused */
+
+/**
+* @brief One block of an arena; objects follow the header.
+*/
+typedef struct sArenaBlock {
+	struct sArenaBlock *Next;	/**< previously filled block */
+	size_t	Size;				/**< usable bytes */
+	size_t	Used;				/**< bytes handed out */
+} sArenaBlock;
+
+/**
+* @brief Arena: objects are bump-allocated and all freed at once.
+* MUST be all zero when initialized.
+*/
+typedef struct sArena {
+	sArenaBlock	*Block;					/**< current block; chain of all blocks */
+	sArenaBlock	*Cold;					/**< blocks of rarely used objects (arenaAllocCold) */
+	void	*Free[ARENA_FREECLASSES];	/**< released objects by size class */
+} sArena;
+
+#ifdef __cplusplus
+/* when called from C++ function */
+extern "C" {
+#endif
+void *arenaAlloc(sArena *a, size_t size);
+char *arenaStrdup(sArena *a, const char *s);
+char *arenaStrndup(sArena *a, const char *s, size_t len);
+void *arenaAllocCold(sArena *a, size_t size);
+char *arenaStrdupCold(sArena *a, const char *s);
+void arenaRelease(sArena *a, void *p, size_t size);
+void arenaFree(sArena *a);
+
+extern sArena progArena;
+extern sArena *curArena;
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _ARENA_H */
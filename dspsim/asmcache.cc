@@ -0,0 +1,238 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file asmcache.cc
+* @brief Content-addressed assembly cache (-acache option)
+*
+* In assembler mode the outputs of a source (.err, .lst, .sym, .bin, .mem
+* and .obj) depend only on its content, its name (file headers), the
+* options and the assembler itself. With -acache the key of the program
+* image cache (source and options, progImageKey()) is extended by the source
+* name and a hash of the running executable, and looked up as "<dir>/<key>.dac".
+*
+* On a hit whose initializer files (.VAR "file") are unchanged, the cached
+* outputs are written back and yyparse() and codeScan() are skipped; the
+* messages of the original run are printed again from the cached .err.
+* After an assembly without errors the outputs are stored in a new entry,
+* written under a temporary name so that concurrent runs (-jobs) never see
+* a partial one. The file headers keep the time of the original run.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "dspsim.h"
+#include "simserver.h"	/* hashBytes(), hashFile() */
+#include "progimage.h"	/* progImageKey(), progImageDepList() */
+#include "../common/asyncout.h"
+#include "asmcache.h"
+
+char *AsmCacheDir = NULL;		/**< -acache: cache directory */
+int AsmCacheHit = FALSE;		/**< TRUE if outputs came from the cache */
+
+/** output file extensions, in entry order */
+static const char *asmCacheExt[ASMCACHE_FILES] = { "err", "lst", "sym", "bin", "mem", "obj" };
+
+static unsigned long long asmCacheKeyValue;		/**< key of current source */
+static int asmCacheKeyValid = FALSE;
+
+/**
+* @brief Hash of everything the assembler outputs depend on, except
+* initializer files (checked against the entry).
+*
+* @param src Source filename
+* @param key Hash to return
+*
+* @return FALSE if source cannot be read
+*/
+static int asmCacheKey(char *src, unsigned long long *key)
+{
+	FILE *fp;
+	unsigned long long h, exe = 0;
+
+	if(!progImageKey(src, &h)) return FALSE;
+	h = hashBytes(h, src, strlen(src));			/* named in file headers */
+
+	/* assembler build: not only VERSION */
+	if((fp = fopen("/proc/self/exe", "rb")) != NULL){
+		exe = hashFile(fp);
+		fclose(fp);
+	}
+	*key = hashBytes(h, &exe, sizeof(exe));
+	return TRUE;
+}
+
+/**
+* @brief Cache entry filename of a key.
+*/
+static void asmCacheEntry(char *buf, unsigned long long key)
+{
+	snprintf(buf, MAX_LINEBUF, "%s/%016llx.dac", AsmCacheDir, key);
+}
+
+/**
+* @brief Copy len bytes between files.
+*
+* @return FALSE if not all bytes could be copied
+*/
+static int asmCacheCopy(FILE *from, FILE *to, unsigned long long len)
+{
+	char buf[4096];
+	size_t n;
+
+	while(len > 0){
+		n = (len > sizeof(buf)) ? sizeof(buf) : (size_t)len;
+		if(fread(buf, 1, n, from) != n || fwrite(buf, 1, n, to) != n) return FALSE;
+		len -= n;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Print messages of the original run: .err without its file header.
+*/
+static void asmCacheReplay(char *errfile)
+{
+	char line[MAX_LINEBUF];
+	int header = TRUE;
+	FILE *fp;
+
+	if(!(fp = fopen(errfile, "r"))) return;
+	while(fgets(line, sizeof(line), fp)){
+		if(header && line[0] == ';') continue;
+		header = FALSE;
+		fputs(line, stdout);
+	}
+	fclose(fp);
+}
+
+/**
+* @brief Look source up in the cache and write back its outputs on a hit.
+* Called before any output file is opened.
+*
+* @param src Source filename
+*
+* @return TRUE if outputs came from the cache (skip assembly)
+*/
+int asmCacheLoad(char *src)
+{
+	char entry[MAX_LINEBUF], out[MAX_LINEBUF];
+	static sPimDep dep[MAX_PIMDEPS];
+	sAsmCacheHeader h;
+	unsigned long long len, hash;
+	struct stat st;
+	FILE *fp, *op;
+
+	if(!(asmCacheKeyValid = asmCacheKey(src, &asmCacheKeyValue))) return FALSE;
+	asmCacheEntry(entry, asmCacheKeyValue);
+
+	if(!(fp = fopen(entry, "rb"))) return FALSE;
+	if(fread(&h, sizeof(h), 1, fp) != 1 || memcmp(h.Magic, ASMCACHE_MAGIC, 4)
+		|| h.Version != ASMCACHE_VERSION || h.Key != asmCacheKeyValue
+		|| h.DepCntr < 0 || h.DepCntr > MAX_PIMDEPS
+		|| fread(dep, sizeof(sPimDep), h.DepCntr, fp) != (size_t)h.DepCntr){
+		fclose(fp);
+		return FALSE;
+	}
+
+	/* complete entry with unchanged initializer files only */
+	len = sizeof(h) + h.DepCntr * sizeof(sPimDep);
+	for(int k = 0; k < ASMCACHE_FILES; k++) len += h.Len[k];
+	if(fstat(fileno(fp), &st) || (unsigned long long)st.st_size != len){
+		fclose(fp);
+		return FALSE;
+	}
+	for(int k = 0; k < h.DepCntr; k++){
+		if(!progImageDepHash(dep[k].Name, &hash) || hash != dep[k].Hash){
+			fclose(fp);
+			return FALSE;
+		}
+	}
+
+	for(int k = 0; k < ASMCACHE_FILES; k++){
+		changeFilenameExt(out, src, (char *)asmCacheExt[k]);
+		if(!(op = fopen(out, "wb"))){
+			printFileOpenError((char *)"assembly cache", out);
+			fclose(fp);
+			return FALSE;
+		}
+		int ok = asmCacheCopy(fp, op, h.Len[k]);
+		if(fclose(op) || !ok){
+			fclose(fp);
+			return FALSE;
+		}
+	}
+	fclose(fp);
+
+	printf("assembly cache hit: %s\n", entry);
+	changeFilenameExt(out, src, (char *)"err");
+	asmCacheReplay(out);
+	AsmCacheHit = TRUE;
+	return TRUE;
+}
+
+/**
+* @brief Store outputs of the source in a new cache entry.
+* Called after an assembly without errors, with all output files closed.
+*
+* @param src Source filename
+*/
+void asmCacheSave(char *src)
+{
+	char entry[MAX_LINEBUF], tmpfile[MAX_LINEBUF+16], out[MAX_LINEBUF];
+	static sPimDep dep[MAX_PIMDEPS];
+	sAsmCacheHeader h;
+	sPimDep *deps;
+	struct stat st;
+	FILE *fp, *ip;
+	int n, ok = TRUE;
+
+	if(!asmCacheKeyValid || (n = progImageDepList(&deps)) < 0) return;
+
+	/* outputs must be on disk before they are read back */
+	asyncShutdown();
+
+	memset(&h, 0, sizeof(h));
+	memcpy(h.Magic, ASMCACHE_MAGIC, 4);
+	h.Version = ASMCACHE_VERSION;
+	h.Key = asmCacheKeyValue;
+	h.DepCntr = n;
+	for(int k = 0; k < n; k++){
+		dep[k] = deps[k];
+		if(!progImageDepHash(dep[k].Name, &dep[k].Hash)) return;
+	}
+	for(int k = 0; k < ASMCACHE_FILES; k++){
+		changeFilenameExt(out, src, (char *)asmCacheExt[k]);
+		if(stat(out, &st)) return;
+		h.Len[k] = st.st_size;
+	}
+
+	mkdir(AsmCacheDir, 0777);		/* may exist */
+	asmCacheEntry(entry, asmCacheKeyValue);
+	sprintf(tmpfile, "%s.%d", entry, (int)getpid());
+	if(!(fp = fopen(tmpfile, "wb"))) return;
+
+	ok = (fwrite(&h, sizeof(h), 1, fp) == 1)
+		&& (fwrite(dep, sizeof(sPimDep), n, fp) == (size_t)n);
+	for(int k = 0; k < ASMCACHE_FILES && ok; k++){
+		changeFilenameExt(out, src, (char *)asmCacheExt[k]);
+		if(!(ip = fopen(out, "rb"))){
+			ok = FALSE;
+			break;
+		}
+		ok = asmCacheCopy(ip, fp, h.Len[k]);
+		fclose(ip);
+	}
+	ok = !fclose(fp) && ok;
+	if(ok && !rename(tmpfile, entry)){
+		printf("assembly cache entry saved: %s\n", entry);
+	}else{
+		unlink(tmpfile);
+	}
+}
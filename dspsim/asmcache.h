@@ -0,0 +1,36 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file asmcache.h
+* @brief Header for content-addressed assembly cache (-acache option)
+* @date 2026-10-19
+*/
+
+#ifndef	_ASMCACHE_H
+#define	_ASMCACHE_H
+
+#define	ASMCACHE_MAGIC		"\177DAC"	/**< cache entry file magic */
+#define	ASMCACHE_VERSION	1			/**< cache entry format version */
+#define	ASMCACHE_FILES		6			/**< outputs per entry: .err .lst .sym .bin .mem .obj */
+
+/**
+* @brief Cache entry header, followed by DepCntr sPimDep records and
+* the contents of the ASMCACHE_FILES outputs, in asmCacheExt[] order.
+*/
+typedef struct sAsmCacheHeader {
+	char	Magic[4];			/**< ASMCACHE_MAGIC */
+	int		Version;			/**< ASMCACHE_VERSION */
+	unsigned long long	Key;	/**< hash of source, options and assembler */
+	int		DepCntr;			/**< number of initializer files */
+	int		Pad;
+	unsigned long long	Len[ASMCACHE_FILES];	/**< output file lengths in bytes */
+} sAsmCacheHeader;
+
+int asmCacheLoad(char *src);
+void asmCacheSave(char *src);
+
+extern char *AsmCacheDir;
+extern int AsmCacheHit;
+
+#endif	/* _ASMCACHE_H */
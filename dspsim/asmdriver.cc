@@ -0,0 +1,138 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file asmdriver.cc
+* @brief Parallel assembly of several source files (-a file1.asm file2.asm ...)
+*
+* The lexer, parser and program tables are globals, so one process
+* assembles one source. Given several sources in assembler mode, the
+* driver forks up to AsmJobs workers; each opens its own output files
+* (.lst, .sym, .obj, ...) and runs the usual single-file assembly, with
+* stdout and stderr captured in a temporary file. When all workers have
+* ended, the captured output is printed in command line order followed
+* by a summary, so the report does not depend on scheduling.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "dspsim.h"
+#include "asmdriver.h"
+
+char *AsmFiles[MAX_ASMFILES];	/**< source filenames in command line order */
+int AsmFileCntr = 0;			/**< number of source filenames */
+int AsmJobs = 0;				/**< -jobs in assembler mode; 0: number of CPUs */
+int AsmWorker = FALSE;			/**< TRUE in worker process */
+
+/**
+* @brief Copy captured worker output to stdout.
+*
+* @param fp Captured output
+*/
+static void asmCopyOut(FILE *fp)
+{
+	char buf[4096];
+	size_t n;
+
+	rewind(fp);
+	while((n = fread(buf, 1, sizeof(buf), fp)) > 0){
+		fwrite(buf, 1, n, stdout);
+	}
+}
+
+/**
+* @brief Assemble all AsmFiles[] on a pool of worker processes.
+* Does not return in the driver process: exits with 1 if any source failed.
+* Returns in a worker process, with its source and output files opened
+* (openSourceFiles), to assemble it as the current program.
+*
+* @param prog Name of program
+*/
+void asmDriver(char *prog)
+{
+	static sAsmJob jobs[MAX_ASMFILES];
+	int next = 0, running = 0, failed = 0;
+
+	if(AsmJobs < 1) AsmJobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(AsmJobs < 1) AsmJobs = 1;
+	if(AsmJobs > MAX_ASMJOBS) AsmJobs = MAX_ASMJOBS;
+	if(AsmJobs > AsmFileCntr) AsmJobs = AsmFileCntr;
+	printf("assembling %d files on %d workers\n", AsmFileCntr, AsmJobs);
+	fflush(NULL);
+
+	while(next < AsmFileCntr || running > 0){
+		/* start workers while slots are free */
+		while(next < AsmFileCntr && running < AsmJobs){
+			sAsmJob *j = &jobs[next++];
+
+			j->Src = AsmFiles[next-1];
+			j->Status = 1;
+			if(!(j->Out = tmpfile())){
+				perror("tmpfile");
+				continue;
+			}
+			j->Pid = fork();
+			if(j->Pid == 0){	/* worker */
+				dup2(fileno(j->Out), 1);
+				dup2(fileno(j->Out), 2);
+				setvbuf(stdout, NULL, _IOLBF, BUFSIZ);		/* keep stdout & stderr in order */
+				AsmWorker = TRUE;
+				if(!openSourceFiles(prog, j->Src)){
+					fflush(NULL);
+					_exit(1);
+				}
+				return;
+			}
+			if(j->Pid < 0){
+				perror("fork");
+				fprintf(j->Out, "\nError: %s - cannot start worker for %s\n", prog, j->Src);
+				j->Pid = 0;
+				continue;
+			}
+			running++;
+		}
+
+		/* wait for one worker */
+		if(running > 0){
+			int status;
+			pid_t pid = waitpid(-1, &status, 0);
+
+			if(pid < 0){
+				perror("waitpid");
+				break;
+			}
+			for(int k = 0; k < next; k++){
+				if(jobs[k].Pid == pid){
+					jobs[k].Status = !(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+					running--;
+					break;
+				}
+			}
+		}
+	}
+
+	/* one report in command line order */
+	for(int k = 0; k < AsmFileCntr; k++){
+		printf("\n---- %s ----\n", jobs[k].Src);
+		if(jobs[k].Out){
+			asmCopyOut(jobs[k].Out);
+			fclose(jobs[k].Out);
+		}
+		if(jobs[k].Status) failed++;
+	}
+	printf("\n%d of %d files assembled successfully.\n", AsmFileCntr - failed, AsmFileCntr);
+	if(failed){
+		printf("Failed:");
+		for(int k = 0; k < AsmFileCntr; k++){
+			if(jobs[k].Status) printf(" %s", jobs[k].Src);
+		}
+		printf("\n");
+	}
+	exit(failed ? 1 : 0);
+}
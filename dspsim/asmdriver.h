@@ -0,0 +1,36 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file asmdriver.h
+* @brief Header for parallel assembly of several source files (-a file1.asm file2.asm ...)
+* @date 2026-10-19
+*/
+
+#ifndef	_ASMDRIVER_H
+#define	_ASMDRIVER_H
+
+#include <stdio.h>
+#include <sys/types.h>
+
+#define	MAX_ASMFILES		1024		/**< max. number of source files per command */
+#define	MAX_ASMJOBS			64			/**< upper limit for -jobs in assembler mode */
+
+/**
+* @brief One source file assembled by a worker process.
+*/
+typedef struct sAsmJob {
+	char	*Src;			/**< source filename (.asm) */
+	pid_t	Pid;			/**< worker process, 0 if not started */
+	FILE	*Out;			/**< captured stdout & stderr of worker */
+	int		Status;			/**< 0 if assembled without errors */
+} sAsmJob;
+
+void asmDriver(char *prog);
+
+extern char *AsmFiles[MAX_ASMFILES];
+extern int AsmFileCntr;
+extern int AsmJobs;
+extern int AsmWorker;
+
+#endif	/* _ASMDRIVER_H */
@@ -0,0 +1,986 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file bundle.cc
+* @brief Automatic multifunction bundling pass (-bundle option)
+*
+* Runs between yyparse() and codeScan(). A basic block is a run of
+* unconditional ALU, MAC, SHIFT, LD, ST and CP instructions without labels;
+* any other instruction, label or multifunction line ends it. Within a
+* block, instructions depend on each other through the registers, flags and
+* data memory they read and write (sBundleRes), and an instruction may move
+* up only past instructions it does not depend on.
+*
+* Blocks are list scheduled in program order: the first instruction not
+* placed yet opens a slot, and up to two later instructions independent of
+* it and of everything they move past are pulled into the slot if it then
+* is one of the forms checked by codeScanOneInstMultiFunc(), whose register
+* classes are those encodable in the sInstFormatTable fields, and the
+* simulator runs it as the single instructions (bundleForm()).
+*
+* Schedules are timed in cycles as the simulator counts them: Latency of
+* each instruction, one more for an LD right after an ST and for a MAC whose
+* next node is not isAnyMAC() (bundleTimeline()). RdReg2() reads a backup
+* value of an Ix/Mx/Lx/Bx register loaded by LD or CP 1 or 2 cycles before,
+* so no slot is made that changes such a load-to-use distance, counting the
+* two instructions before the block (by every way into it: list order, loop
+* end of a DO, return of a CALL) and the two after it (bundleLatencyOK()).
+*
+* The new schedule of a block is kept only if it takes fewer cycles. Bundles
+* are moved into Multi[] of their first instruction, and program memory
+* addresses and code labels are renumbered as the parser would have
+* assigned them.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "icode.h"
+#include "arena.h"
+#include "dspdef.h"
+#include "bundle.h"
+
+int BundleMode = FALSE;		/**< -bundle: run bundling pass */
+
+/** resources an instruction reads or writes: bit numbers of sBundleRes */
+#define	RES_R		0		/**< R0 ~ R31 */
+#define	RES_ACC		32		/**< ACC0 ~ ACC7 (with .H/.M/.L) */
+#define	RES_I		40		/**< I0 ~ I7 */
+#define	RES_M		48		/**< M0 ~ M7 */
+#define	RES_L		56		/**< L0 ~ L7 */
+#define	RES_B		64		/**< B0 ~ B7 */
+#define	RES_AFLAG	72		/**< AZ, AN, AV, AC */
+#define	RES_MFLAG	73		/**< MV */
+#define	RES_SFLAG	74		/**< SV */
+#define	RES_DM		75		/**< data memory */
+#define	RES_MISC	76		/**< control registers, program memory: not scheduled */
+#define	RES_WORDS	3
+
+#define	BUNDLE_LATWIN	2	/**< RdReg2(): Ix/Mx/Lx/Bx read 1 or 2 cycles after load is a backup */
+#define	BUNDLE_PATHS	3	/**< ways into a block: list order, DO loop end, CALL return */
+
+/**
+* @brief Set of resources (bit n: resource n)
+*/
+typedef struct sBundleRes {
+	unsigned int	W[RES_WORDS];
+} sBundleRes;
+
+/**
+* @brief Functional units of instructions that can be bundled
+*/
+enum eBundleUnit {
+	buNONE = 0,		/**< ends a basic block */
+	buALU,
+	buMAC,
+	buSHIFT,
+	buLD,
+	buST,
+	buCP
+};
+
+/**
+* @brief One instruction of a basic block
+*/
+typedef struct sBundleOp {
+	sICode	*p;
+	int		Unit;		/**< enum eBundleUnit */
+	int		Cplx;		/**< TRUE if .C/.RC opcode */
+	int		Pos;		/**< position in source order */
+	int		Seq;		/**< index in list nodes of block (see bundleBlock()) */
+	int		Slot;		/**< slot of new schedule, -1: not placed yet */
+	int		Lat;		/**< Latency set by codeScan(); 1 if not known (outside block) */
+	int		Cmt;		/**< next list node is a comment or pseudo-op (outside block) */
+	int		HasLD, HasST, HasMAC;	/**< for latency rules */
+	int		IsMAC;		/**< isAnyMAC(): MAC, also LD || LD (type 1a/1b) */
+	sBundleRes	Use;	/**< resources read */
+	sBundleRes	Def;	/**< resources written */
+	sBundleRes	DAGLoad;	/**< Ix/Mx/Lx/Bx loaded by LD or CP */
+} sBundleOp;
+
+static int bundleCntr;		/**< bundles made */
+static int bundleMerged;	/**< instructions moved into bundles */
+static int bundleSaved;		/**< cycles saved (one pass through the code) */
+
+static void resSet(sBundleRes *r, int n)
+{
+	r->W[n >> 5] |= 1u << (n & 31);
+}
+
+static int resTest(sBundleRes *r, int n)
+{
+	return (r->W[n >> 5] >> (n & 31)) & 1;
+}
+
+static int resMeet(sBundleRes *a, sBundleRes *b)
+{
+	for(int k = 0; k < RES_WORDS; k++)
+		if(a->W[k] & b->W[k]) return TRUE;
+	return FALSE;
+}
+
+/**
+* @brief TRUE if a and b share an Ix, Mx, Lx or Bx register
+* (any of them if b is NULL).
+*/
+static int resMeetDAG(sBundleRes *a, sBundleRes *b)
+{
+	for(int n = RES_I; n < RES_B + 8; n++)
+		if(resTest(a, n) && (!b || resTest(b, n))) return TRUE;
+	return FALSE;
+}
+
+/**
+* @brief Register number of "<c><digits>" such as R12 or I3, without messages.
+*
+* @return Number, -1 if s is not of this form
+*/
+static int bundleRegNum(char *s, char c)
+{
+	if(toupper(s[0]) != c || !isdigit(s[1])) return -1;
+	if(s[2] == '\0') return s[1] - '0';
+	if(isdigit(s[2]) && s[3] == '\0') return (s[1] - '0') * 10 + (s[2] - '0');
+	return -1;
+}
+
+/**
+* @brief Add resources of one operand string to r.
+*
+* @param r Resources to update
+* @param s Operand string
+* @param cplx TRUE if complex opcode: Rn and ACCn are register pairs
+*/
+static void bundleOprRes(sBundleRes *r, char *s, int cplx)
+{
+	int n;
+
+	if(!s) return;
+	if((n = bundleRegNum(s, 'R')) >= 0 && n <= 31){
+		resSet(r, RES_R + n);
+		if(cplx && n < 31) resSet(r, RES_R + n + 1);
+	}else if(!strncasecmp(s, "ACC", 3) && isdigit(s[3]) && s[3] <= '7'
+		&& (s[4] == '\0' || s[4] == '.')){
+		n = s[3] - '0';
+		resSet(r, RES_ACC + n);
+		if(cplx && n < 7) resSet(r, RES_ACC + n + 1);
+	}else if((n = bundleRegNum(s, 'I')) >= 0 && n <= 7){
+		resSet(r, RES_I + n);
+	}else if((n = bundleRegNum(s, 'M')) >= 0 && n <= 7){
+		resSet(r, RES_M + n);
+	}else if((n = bundleRegNum(s, 'L')) >= 0 && n <= 7){
+		resSet(r, RES_L + n);
+	}else if((n = bundleRegNum(s, 'B')) >= 0 && n <= 7){
+		resSet(r, RES_B + n);
+	}else if(!strcasecmp(s, "DM")){
+		resSet(r, RES_DM);
+	}else if(s[0] == '_' || !strncasecmp(s, "ASTAT", 5) || !strcasecmp(s, "PM")
+		|| !strcasecmp(s, "UMCOUNT") || !strcasecmp(s, "DID")){
+		resSet(r, RES_MISC);
+	}
+}
+
+/**
+* @brief Functional unit of an instruction that may be bundled.
+*
+* @param p Pointer to instruction
+* @param cplx TRUE returned if complex opcode
+*
+* @return enum eBundleUnit
+*/
+static int bundleUnit(sICode *p, int *cplx)
+{
+	*cplx = FALSE;
+	switch(p->Index){
+		case iADD_C: case iADDC_C: case iSUB_C: case iSUBC_C:
+		case iSUBB_C: case iSUBBC_C: case iNOT_C: case iABS_C:
+			*cplx = TRUE;
+			/* fall through */
+		case iADD: case iADDC: case iSUB: case iSUBC:
+		case iSUBB: case iSUBBC: case iAND: case iOR:
+		case iXOR: case iNOT: case iABS: case iINC: case iDEC:
+			return buALU;
+		case iMPY_C: case iMAC_C: case iMAS_C:
+		case iMPY_RC: case iMAC_RC: case iMAS_RC:
+			*cplx = TRUE;
+			/* fall through */
+		case iMPY: case iMAC: case iMAS:
+			return buMAC;
+		case iASHIFT_C: case iASHIFTOR_C: case iLSHIFT_C: case iLSHIFTOR_C:
+			*cplx = TRUE;
+			/* fall through */
+		case iASHIFT: case iASHIFTOR: case iLSHIFT: case iLSHIFTOR:
+			return buSHIFT;
+		case iLD_C:
+			*cplx = TRUE;
+			/* fall through */
+		case iLD:
+			return buLD;
+		case iST_C:
+			*cplx = TRUE;
+			/* fall through */
+		case iST:
+			return buST;
+		case iCP_C:
+			*cplx = TRUE;
+			/* fall through */
+		case iCP:
+			return buCP;
+	}
+	return buNONE;
+}
+
+/**
+* @brief Fill in unit and resources of one block instruction.
+*
+* @param o Block instruction, o->p set
+*
+* @return FALSE if the instruction ends a basic block
+*/
+static int bundleOpInit(sBundleOp *o)
+{
+	sICode *p = o->p;
+	char **opr = p->Operand;
+	int n = p->OperandCounter;
+
+	memset(&o->Use, 0, sizeof(o->Use));
+	memset(&o->Def, 0, sizeof(o->Def));
+	memset(&o->DAGLoad, 0, sizeof(o->DAGLoad));
+	o->Slot = -1;
+	o->Unit = bundleUnit(p, &o->Cplx);
+	if(o->Unit == buNONE || p->Cond || p->Conj || p->MultiCounter || p->Src->Label)
+		return FALSE;
+
+	/* all operands are read; the destination too (MAC, SHIFTOR, partial registers) */
+	for(int k = 0; k < n; k++) bundleOprRes(&o->Use, opr[k], o->Cplx);
+
+	switch(o->Unit){
+		case	buALU:
+			bundleOprRes(&o->Def, opr[0], o->Cplx);
+			resSet(&o->Def, RES_AFLAG);
+			if(p->Index == iADDC || p->Index == iSUBC || p->Index == iSUBB || p->Index == iSUBBC
+				|| p->Index == iADDC_C || p->Index == iSUBC_C || p->Index == iSUBB_C || p->Index == iSUBBC_C)
+				resSet(&o->Use, RES_AFLAG);		/* carry */
+			break;
+		case	buMAC:
+			bundleOprRes(&o->Def, opr[0], o->Cplx);
+			resSet(&o->Def, RES_MFLAG);
+			break;
+		case	buSHIFT:
+			bundleOprRes(&o->Def, opr[0], o->Cplx);
+			resSet(&o->Def, RES_SFLAG);
+			break;
+		case	buLD:
+		case	buCP:
+			bundleOprRes(&o->Def, opr[0], o->Cplx);
+			bundleOprRes(&o->DAGLoad, opr[0], o->Cplx);
+			/* LD DREG, DM(IREG += MREG): post-modify */
+			if(n == 5 && !strcasecmp(opr[4], "DM") && !strcmp(opr[1], "+="))
+				bundleOprRes(&o->Def, opr[2], FALSE);
+			break;
+		case	buST:
+			/* ST DM(IREG += MREG), DREG: post-modify */
+			if(n == 5 && !strcasecmp(opr[3], "DM") && !strcmp(opr[0], "+="))
+				bundleOprRes(&o->Def, opr[1], FALSE);
+			if(resTest(&o->Use, RES_DM)) resSet(&o->Def, RES_DM);
+			break;
+	}
+	if(o->Unit != buST && resTest(&o->Def, RES_DM)) return FALSE;
+
+	o->HasLD = (o->Unit == buLD);
+	o->HasST = (o->Unit == buST);
+	o->HasMAC = o->IsMAC = (o->Unit == buMAC);
+
+	/* LD.C ACC64, DM(IMM_UINT16) / ST.C DM(IMM_UINT16), ACC64: types 3e/3i, 2 cycles */
+	o->Lat = 1;
+	if(o->Cplx && n >= 3 && (o->Unit == buLD || o->Unit == buST)){
+		char *addr = (o->Unit == buLD) ? opr[1] : opr[0];
+		char *acc = (o->Unit == buLD) ? opr[0] : (n >= 5 && !strcasecmp(opr[3], "DM")) ? opr[4] : opr[2];
+
+		if(strcmp(addr, "+") && strcmp(addr, "+=") && acc && !strncasecmp(acc, "ACC", 3)
+			&& isdigit(acc[3]) && acc[4] == '\0')
+			o->Lat = 2;
+	}
+	return !resTest(&o->Use, RES_MISC) && !resTest(&o->Def, RES_MISC);
+}
+
+/**
+* @brief Describe an instruction before or after a block: registers it
+* names may be read and written, and its units for the latency rules.
+* Its own Latency is taken as 1: more is the same for every schedule.
+*
+* @param o Block boundary to fill in
+* @param p Pointer to instruction, NULL if none
+*/
+static void bundleEdgeInit(sBundleOp *o, sICode *p)
+{
+	int cplx;
+
+	memset(o, 0, sizeof(*o));
+	o->Slot = -1;
+	o->Lat = 1;
+	o->Cmt = p && p->Next && isNotRealInst(p->Next->Index);
+	for(sICode *q = p; q; q = (q == p && p->MultiCounter) ? p->Multi[0] :
+		(q == p->Multi[0] && p->MultiCounter == 2) ? p->Multi[1] : NULL){
+		int unit = bundleUnit(q, &cplx);
+
+		for(int k = 0; k < q->OperandCounter; k++) bundleOprRes(&o->Use, q->Operand[k], cplx);
+		if(unit == buLD || unit == buCP)
+			bundleOprRes(&o->DAGLoad, q->Operand[0], cplx);
+		else if(unit == buNONE)		/* may load any register it names */
+			for(int k = 0; k < q->OperandCounter; k++) bundleOprRes(&o->DAGLoad, q->Operand[k], cplx);
+		o->HasLD |= (unit == buLD);
+		o->HasST |= (unit == buST);
+		o->HasMAC |= (unit == buMAC);
+	}
+	/* LD || LD is isAnyMAC() */
+	o->IsMAC = o->HasMAC || (p && p->MultiCounter == 1 && bundleUnit(p, &cplx) == buLD);
+	o->Def = o->Use;
+}
+
+/**
+* @brief Describe an instruction not known before or after a block
+* (subroutine before a return, loop body after a loop end).
+*
+* @param o Block boundary to fill in
+* @param load TRUE: it loads every Ix/Mx/Lx/Bx register; FALSE: it reads every one
+*/
+static void bundleEdgeAll(sBundleOp *o, int load)
+{
+	bundleEdgeInit(o, NULL);
+	for(int k = RES_I; k < RES_B + 8; k++)
+		resSet(load ? &o->DAGLoad : &o->Use, k);
+}
+
+/**
+* @brief Last instruction of the body of a DO loop, which runs just before
+* the first one from the second pass on.
+*
+* @param d DO instruction
+* @param prev Returns the instruction before the loop end (d if none)
+*
+* @return Loop end, NULL if not found
+*/
+static sICode *bundleLoopEnd(sICode *d, sICode **prev)
+{
+	char *label = d->Operand[1];
+	int found = FALSE;
+
+	*prev = d;
+	for(sICode *q = d->Next; q && label; q = q->Next){
+		if(q->Src->Label && !strcmp(q->Src->Label->Name, label)) found = TRUE;
+		if(isNotRealInst(q->Index)) continue;
+		if(found) return q;
+		*prev = q;
+	}
+	return NULL;
+}
+
+/**
+* @brief Instructions that may run just before a block, for every way into
+* it: the two before it in the list; at the start of a DO loop body, the
+* loop end and the one before it; after a CALL, a return from anywhere.
+*
+* @param pre Paths to fill in: pre[k][1] just before block, pre[k][0] before that
+* @param i1 Instruction before block in the list, NULL if none
+* @param i2 Instruction before i1, NULL if none
+*
+* @return Number of paths
+*/
+static int bundlePre(sBundleOp pre[][2], sICode *i1, sICode *i2)
+{
+	sICode *end, *prev;
+	int np = 1;
+
+	bundleEdgeInit(&pre[0][0], i2);
+	bundleEdgeInit(&pre[0][1], i1);
+	if(i1 && i1->Index == iDO){
+		end = bundleLoopEnd(i1, &prev);
+		if(end && prev != i1) bundleEdgeInit(&pre[np][0], prev);
+		else bundleEdgeAll(&pre[np][0], TRUE);
+		if(end) bundleEdgeInit(&pre[np][1], end);
+		else bundleEdgeAll(&pre[np][1], TRUE);
+		pre[np++][1].Cmt = FALSE;		/* next is the loop start */
+	}else if(i1 && i1->Index == iCALL){
+		bundleEdgeAll(&pre[np][0], TRUE);
+		bundleEdgeInit(&pre[np++][1], NULL);	/* RTS */
+	}
+	if(i2 && i2->Index == iDO){
+		end = bundleLoopEnd(i2, &prev);
+		if(end) bundleEdgeInit(&pre[np][0], end);
+		else bundleEdgeAll(&pre[np][0], TRUE);
+		pre[np][0].Cmt = FALSE;
+		pre[np][1] = pre[0][1];
+		np++;
+	}
+	return np;
+}
+
+/**
+* @brief The two instructions that run just after a block. After a possible
+* loop end, branch or return, the second is any instruction.
+*
+* @param post Instructions to fill in
+* @param p List node after the block, NULL if none
+*/
+static void bundlePost(sBundleOp *post, sICode *p)
+{
+	int label = FALSE;
+
+	for(; p && isNotRealInst(p->Index); p = p->Next)
+		if(p->Src->Label) label = TRUE;
+	bundleEdgeInit(&post[0], p);
+	if(!p){
+		post[0].IsMAC = TRUE;		/* end of program: no MAC rule */
+		bundleEdgeInit(&post[1], NULL);
+	}else if(label || p->Src->Label || p->Index == iJUMP || p->Index == iCALL
+		|| p->Index == iRTS || p->Index == iRTI){
+		bundleEdgeAll(&post[1], FALSE);
+	}else{
+		bundleEdgeInit(&post[1], getNextCode(p));
+	}
+}
+
+/**
+* @brief TRUE if b (later in source) depends on a: read after write,
+* write after read or write after write.
+*/
+static int bundleDep(sBundleOp *a, sBundleOp *b)
+{
+	return resMeet(&a->Def, &b->Use) || resMeet(&a->Def, &b->Def) || resMeet(&a->Use, &b->Def);
+}
+
+/*
+* Register classes of multifunction operands, without messages
+* (codeScanOneInstMultiFunc() reports the same cases as errors).
+*/
+
+/** R0 ~ R7 (Reg12S); even only if cplx (Reg24S) */
+static int isRegS(char *s, int cplx)
+{
+	int n = s ? bundleRegNum(s, 'R') : -1;
+	return n >= 0 && n <= 7 && s[2] == '\0' && !(cplx && (n & 1));
+}
+
+/** ACC0 ~ ACC3 (ACC32S); ACC0, ACC2, ACC4, ACC6 if cplx (ACC64S) */
+static int isACCS(char *s, int cplx)
+{
+	if(!s || strncasecmp(s, "ACC", 3) || !isdigit(s[3]) || s[4] != '\0') return FALSE;
+	int n = s[3] - '0';
+	return cplx ? (n <= 7 && !(n & 1)) : (n <= 3);
+}
+
+/** DREG12 / DREG24: R0 ~ R31, ACCx.H/M/L (even only if cplx) */
+static int isDReg(char *s, int cplx)
+{
+	if(!s) return FALSE;
+	int n = bundleRegNum(s, 'R');
+	if(n >= 0) return n <= 31 && !(cplx && (n & 1));
+	if(strncasecmp(s, "ACC", 3) || !isdigit(s[3]) || s[4] != '.') return FALSE;
+	n = s[3] - '0';
+	return n <= 7 && !(cplx && (n & 1))
+		&& (!strcasecmp(s+5, "H") || !strcasecmp(s+5, "M") || !strcasecmp(s+5, "L"));
+}
+
+/** c<lo> ~ c<hi>: I0 ~ I7, Ix, Iy, M0 ~ M7, Mx, My */
+static int isDAG(char *s, char c, int lo, int hi)
+{
+	int n = s ? bundleRegNum(s, c) : -1;
+	return n >= lo && n <= hi;
+}
+
+/** IMM_INT5 given as a number: as the 5-bit field encodes it */
+static int isInt5(char *s)
+{
+	if(!s || !(isdigit(s[0]) || (s[0] == '-' && isdigit(s[1])))) return FALSE;
+	long v = strtol(s, NULL, 0);
+	return v >= -16 && v <= 15;
+}
+
+/** LD DREG, DM(IREG +/+= MREG) */
+static int isLDInd(sICode *p)
+{
+	return p->OperandCounter == 5 && !strcasecmp(p->Operand[4], "DM")
+		&& isDAG(p->Operand[2], 'I', 0, 7) && isDAG(p->Operand[3], 'M', 0, 7);
+}
+
+/** ST DM(IREG +/+= MREG), DREG */
+static int isSTInd(sICode *p)
+{
+	return p->OperandCounter == 5 && !strcasecmp(p->Operand[3], "DM")
+		&& isDAG(p->Operand[1], 'I', 0, 7) && isDAG(p->Operand[2], 'M', 0, 7);
+}
+
+/**
+* @brief Operands of the arithmetic part (first instruction) of a multifunction.
+*
+* @param o Block instruction: MAC or SHIFT
+*
+* @return TRUE if its operands are of the multifunction register classes
+*/
+static int bundleArithOK(sBundleOp *o)
+{
+	sICode *p = o->p;
+	char **opr = p->Operand;
+	int c = o->Cplx;
+
+	switch(o->Unit){
+		case	buMAC:		/* MAC ACC32S, XOP12S, YOP12S (option) */
+			return p->OperandCounter == 4 && isACCS(opr[0], c)
+				&& isRegS(opr[1], c) && isRegS(opr[2], c);
+		case	buSHIFT:	/* SHIFT ACC32S, XOP12S|ACC32S, IMM_INT5 (option) */
+			return p->OperandCounter == 4 && isACCS(opr[0], c)
+				&& (isRegS(opr[1], c) || isACCS(opr[1], c)) && isInt5(opr[2]);
+	}
+	return FALSE;
+}
+
+/**
+* @brief Operands of a data move part of a multifunction.
+*
+* @param o Block instruction: LD, ST or CP
+*
+* @return TRUE if its operands are of the multifunction register classes
+*/
+static int bundleMoveOK(sBundleOp *o)
+{
+	sICode *p = o->p;
+	int c = o->Cplx;
+
+	switch(o->Unit){
+		case	buLD:	return isLDInd(p) && isDReg(p->Operand[0], c);
+		case	buST:	return isSTInd(p) && isDReg(p->Operand[4], c);
+		case	buCP:	return p->OperandCounter == 2 && isDReg(p->Operand[0], c) && isDReg(p->Operand[1], c);
+	}
+	return FALSE;
+}
+
+/**
+* @brief Order instructions as a multifunction and check its form,
+* as codeScanOneInstMultiFunc() would.
+*
+* Only forms the simulator runs exactly as their single instructions are
+* made: with ALU, AC is not computed (sCarryCheck(), also ALU saturation);
+* ALU || MAC takes MV and MAC || SHIFT SV from other rules (sOVCheck()).
+* That leaves LD || LD, MAC || LD || LD and MAC/SHIFT || LD/ST/CP.
+*
+* @param o Instructions of the slot (2 or 3), reordered: first, second, third
+* @param n Number of instructions
+*
+* @return TRUE if a legal multifunction
+*/
+static int bundleForm(sBundleOp **o, int n)
+{
+	/* units in operand order: MAC, SHIFT, then LD (Ix before Iy), ST, CP */
+	for(int i = 0; i < n; i++){
+		for(int j = i+1; j < n; j++){
+			int swap = o[j]->Unit < o[i]->Unit;
+			if(o[i]->Unit == buLD && o[j]->Unit == buLD && isLDInd(o[j]->p))
+				swap = isDAG(o[j]->p->Operand[2], 'I', 0, 3);
+			if(swap){
+				sBundleOp *t = o[i];
+				o[i] = o[j];
+				o[j] = t;
+			}
+		}
+	}
+	for(int i = 0; i < n; i++)
+		if(o[i]->Cplx != o[0]->Cplx || o[i]->Unit == buALU) return FALSE;
+
+	sBundleOp *a = o[0], *b = o[1];
+	int c = a->Cplx;
+
+	if(n == 3){
+		/* MAC || LD || LD, MAC.C || LD.C || LD.C */
+		sBundleOp *d = o[2];
+		if(a->Unit != buMAC || !bundleArithOK(a)) return FALSE;
+		if(b->Unit != buLD || d->Unit != buLD || !bundleMoveOK(b) || !bundleMoveOK(d)) return FALSE;
+		return isDAG(b->p->Operand[2], 'I', 0, 3) && isDAG(b->p->Operand[3], 'M', 0, 3)
+			&& isDAG(d->p->Operand[2], 'I', 4, 7) && isDAG(d->p->Operand[3], 'M', 4, 7)
+			&& strcmp(b->p->Operand[1], "+") && strcmp(d->p->Operand[1], "+");
+	}
+
+	if(a->Unit == buLD){
+		/* LD || LD, LD.C || LD.C */
+		return b->Unit == buLD && isLDInd(a->p) && isLDInd(b->p)
+			&& isRegS(a->p->Operand[0], c) && isRegS(b->p->Operand[0], c)
+			&& isDAG(a->p->Operand[2], 'I', 0, 3) && isDAG(a->p->Operand[3], 'M', 0, 3)
+			&& isDAG(b->p->Operand[2], 'I', 4, 7) && isDAG(b->p->Operand[3], 'M', 4, 7);
+	}
+	/* MAC/SHIFT || LD/ST/CP */
+	return b->Unit >= buLD && bundleArithOK(a) && bundleMoveOK(b);
+}
+
+/**
+* @brief Describe a slot of a new schedule for the latency rules.
+*
+* @param s Slot to fill in
+* @param o Instructions of the slot
+* @param n Number of instructions
+*/
+static void bundleSlotInit(sBundleOp *s, sBundleOp **o, int n)
+{
+	memset(s, 0, sizeof(*s));
+	s->Seq = o[0]->Seq;
+	s->Lat = (n > 1) ? 1 : o[0]->Lat;
+	for(int i = 0; i < n; i++){
+		if(o[i]->Seq < s->Seq) s->Seq = o[i]->Seq;
+		s->HasLD |= o[i]->HasLD;
+		s->HasST |= o[i]->HasST;
+		s->HasMAC |= o[i]->HasMAC;
+	}
+	/* LD || LD is isAnyMAC() */
+	s->IsMAC = s->HasMAC || (n == 2 && o[0]->Unit == buLD && o[1]->Unit == buLD);
+}
+
+/**
+* @brief Start cycles of a block schedule and the instructions around it,
+* under the latency rules of the simulator: Lat cycles, one more for an LD
+* right after an ST and for a MAC whose next list node is not isAnyMAC()
+* (comments and pseudo-ops are not; they stay before the slot of the next
+* instruction in source order, see bundleBlock()).
+*
+* Runs in order: pre[0], pre[1], slots 0 ~ ns-1, instructions not placed
+* yet one by one in source order, post[0], post[1].
+*
+* @param op Block instructions
+* @param n Number of instructions
+* @param slot Slots placed
+* @param ns Number of slots
+* @param pre Two instructions before block
+* @param post Two instructions after block
+* @param cmt cmt[q]: comments in list nodes 0 ~ q-1 of the block;
+*        cmt[end]: with one for a comment or pseudo-op after the block
+* @param end Index of last entry of cmt
+* @param at Returns start cycles: at[0], at[1] for pre, at[2+k] for op[k],
+*        at[n+2], at[n+3] for post
+*/
+static void bundleTimeline(sBundleOp *op, int n, sBundleOp *slot, int ns,
+	sBundleOp *pre, sBundleOp *post, int *cmt, int end, int *at)
+{
+	static sBundleOp *e[MAX_BUNDLEBLOCK+4];
+	static int t[MAX_BUNDLEBLOCK+4];
+	int m = 0, last;
+
+	e[m++] = &pre[0];
+	e[m++] = &pre[1];
+	for(int s = 0; s < ns; s++) e[m++] = &slot[s];
+	for(int k = 0; k < n; k++)
+		if(op[k].Slot < 0) e[m++] = &op[k];
+	last = m;
+	e[m++] = &post[0];
+	e[m++] = &post[1];
+
+	t[0] = 0;
+	for(int i = 0; i+1 < m; i++){
+		int c = e[i]->Lat;
+		int nomac = e[i]->Cmt || !e[i+1]->IsMAC;
+
+		if(i >= 2 && i < last)
+			nomac = (cmt[(i+1 < last) ? e[i+1]->Seq : end] - cmt[e[i]->Seq + 1] > 0) || !e[i+1]->IsMAC;
+		if(i && e[i-1]->HasST && e[i]->HasLD) c++;
+		if(e[i]->HasMAC && nomac) c++;
+		t[i+1] = t[i] + c;
+	}
+
+	at[0] = t[0];
+	at[1] = t[1];
+	m = 2 + ns;
+	for(int k = 0; k < n; k++)
+		at[2+k] = (op[k].Slot >= 0) ? t[2 + op[k].Slot] : t[m++];
+	at[n+2] = t[last];
+	at[n+3] = t[last+1];
+}
+
+/**
+* @brief TRUE if no Ix/Mx/Lx/Bx load-to-use distance within the backup
+* window of RdReg2() changes from the source schedule to a new one.
+*
+* @param op Block instructions
+* @param n Number of instructions
+* @param pre Two instructions before block
+* @param post Two instructions after block
+* @param told Start cycles of source schedule (see bundleTimeline())
+* @param tnew Start cycles of new schedule
+*/
+static int bundleLatencyOK(sBundleOp *op, int n, sBundleOp *pre, sBundleOp *post,
+	int *told, int *tnew)
+{
+	for(int i = 0; i < n+4; i++){
+		sBundleOp *a = (i < 2) ? &pre[i] : (i < n+2) ? &op[i-2] : &post[i-n-2];
+
+		if(!resMeetDAG(&a->DAGLoad, NULL)) continue;
+		for(int j = (i < 2) ? 2 : i+1; j < n+4; j++){
+			sBundleOp *b = (j < n+2) ? &op[j-2] : &post[j-n-2];
+			int dold = told[j] - told[i], dnew = tnew[j] - tnew[i];
+
+			if(dold != dnew && (dold <= BUNDLE_LATWIN || dnew <= BUNDLE_LATWIN)
+				&& resMeetDAG(&a->DAGLoad, &b->Use))
+				return FALSE;
+		}
+	}
+	return TRUE;
+}
+
+/**
+* @brief Schedule one basic block and move its bundles into Multi[].
+*
+* @param op Block instructions, in source order
+* @param n Number of instructions
+* @param pre Two instructions before block, for every way into it
+* @param npre Number of ways into block
+* @param post Two instructions after block
+* @param seq Source order of the list nodes: block instructions and comments
+* @param nseq Number of list nodes
+* @param before List node before the block, NULL if first
+* @param icode Intermediate code list
+*
+* @return Cycles saved
+*/
+static int bundleBlock(sBundleOp *op, int n, sBundleOp pre[][2], int npre, sBundleOp *post,
+	sICode **seq, int nseq, sICode *before, sICodeList *icode)
+{
+	static sBundleOp *slot[MAX_BUNDLEBLOCK][3];
+	static sBundleOp step[MAX_BUNDLEBLOCK];
+	static int nslot[MAX_BUNDLEBLOCK];
+	static int cmt[2 * MAX_BUNDLEBLOCK + 2];
+	static int told[BUNDLE_PATHS][MAX_BUNDLEBLOCK+4], tnew[MAX_BUNDLEBLOCK+4];
+	sICode *after = seq[nseq-1]->Next;
+	int ns = 0, merged = 0;
+
+	/* comments among the list nodes, for the MAC rule */
+	cmt[0] = 0;
+	for(int q = 0, k = 0; q < nseq; q++){
+		cmt[q+1] = cmt[q] + (seq[q]->Index == iCOMMENT);
+		if(seq[q]->Index != iCOMMENT) op[k++].Seq = q;
+	}
+	cmt[nseq+1] = cmt[nseq] + (after && isNotRealInst(after->Index));
+	for(int w = 0; w < npre; w++)
+		bundleTimeline(op, n, step, 0, pre[w], post, cmt, nseq+1, told[w]);
+
+	for(int h = 0; h < n; h++){
+		if(op[h].Slot >= 0) continue;
+
+		/* later instructions that may move up to h */
+		int cand[BUNDLE_WINDOW], nc = 0;
+		for(int j = h+1; j < n && j <= h+BUNDLE_WINDOW; j++){
+			if(op[j].Slot >= 0) continue;
+			int ok = !bundleDep(&op[h], &op[j]);
+			for(int k = h+1; k < j && ok; k++)
+				if(op[k].Slot < 0 && bundleDep(&op[k], &op[j]))
+					ok = FALSE;
+			if(ok) cand[nc++] = j;
+		}
+
+		/* largest legal bundle, earliest partners first */
+		sBundleOp *best[3] = { &op[h] };
+		int nbest = 1;
+		for(int size = 3; size >= 2 && nbest == 1; size--){
+			for(int x = 0; x < nc && nbest == 1; x++){
+				/* y == nc: no third instruction */
+				for(int y = (size == 3) ? x+1 : nc; y <= nc; y++){
+					if(size == 3 && y == nc) break;
+					sBundleOp *t[3] = { &op[h], &op[cand[x]], (size == 3) ? &op[cand[y]] : NULL };
+					if(size == 3 && bundleDep(t[1], t[2])) continue;
+					if(!bundleForm(t, size)) continue;
+
+					/* no Ix/Mx/Lx/Bx load-to-use distance changed, on any way in */
+					int ok = TRUE;
+					for(int i = 0; i < size; i++) t[i]->Slot = ns;
+					bundleSlotInit(&step[ns], t, size);
+					for(int w = 0; w < npre && ok; w++){
+						bundleTimeline(op, n, step, ns+1, pre[w], post, cmt, nseq+1, tnew);
+						ok = bundleLatencyOK(op, n, pre[w], post, told[w], tnew);
+					}
+					for(int i = 0; i < size; i++) t[i]->Slot = -1;
+					if(!ok) continue;
+
+					for(int i = 0; i < size; i++) best[i] = t[i];
+					nbest = size;
+					break;
+				}
+			}
+		}
+
+		for(int i = 0; i < nbest; i++){
+			best[i]->Slot = ns;
+			slot[ns][i] = best[i];
+		}
+		bundleSlotInit(&step[ns], best, nbest);
+		nslot[ns++] = nbest;
+		merged += nbest - 1;
+	}
+	if(!merged) return 0;
+
+	/* cycles from the instruction before the block to the one after */
+	bundleTimeline(op, n, step, ns, pre[0], post, cmt, nseq+1, tnew);
+	int cold = told[0][n+2] - told[0][1];
+	int cnew = tnew[n+2] - tnew[1];
+	if(cnew >= cold) return 0;
+
+	/* relink: comments stay before the slot of the next instruction in source order */
+	sICode *prev = before;
+	int q = 0;
+	for(int s = 0; s < ns; s++){
+		sBundleOp *first = slot[s][0];
+		for(int i = 1; i < nslot[s]; i++)
+			if(slot[s][i]->Pos < first->Pos) first = slot[s][i];
+		sICode *head = first->p;
+
+		while(q < nseq && seq[q] != head){
+			if(seq[q]->Index == iCOMMENT){
+				if(prev) prev->Next = seq[q];
+				else icode->FirstNode = seq[q];
+				prev = seq[q];
+			}
+			q++;
+		}
+
+		sICode *p = slot[s][0]->p;
+		if(prev) prev->Next = p;
+		else icode->FirstNode = p;
+		prev = p;
+
+		if(nslot[s] > 1){
+			char buf[MAX_LINEBUF];
+			int len = snprintf(buf, sizeof(buf), "%s", p->Src->Line ? p->Src->Line : "");
+
+			for(int i = 1; i < nslot[s]; i++){
+				sICode *m = slot[s][i]->p;
+				char *line = m->Src->Line ? m->Src->Line : (char *)"";
+
+				while(isspace(*line)) line++;
+				if(len < (int)sizeof(buf))
+					len += snprintf(buf + len, sizeof(buf) - len, "\n\t||\t%s", line);
+				sICodeListInsertMulti(p, m);
+			}
+			p->Src->Line = arenaStrdupCold(curArena, buf);
+			if(VerboseMode){
+				printf("BUNDLE: line %d", p->LineCntr);
+				for(int i = 1; i < nslot[s]; i++) printf(" || line %d", p->Multi[i-1]->LineCntr);
+				printf("\n");
+			}
+			bundleCntr++;
+		}
+	}
+	for(; q < nseq; q++){
+		if(seq[q]->Index == iCOMMENT){
+			prev->Next = seq[q];
+			prev = seq[q];
+		}
+	}
+	prev->Next = after;
+	if(!after) icode->LastNode = prev;
+
+	bundleMerged += merged;
+	return cold - cnew;
+}
+
+/**
+* @brief Program memory addresses and code labels, as yyparse() assigns
+* them: .CODE restarts at codeSegAddr, every instruction line and .VAR
+* takes one address, a multifunction line too.
+*
+* @param icode Intermediate code list
+*/
+static void bundleRenumber(sICodeList *icode)
+{
+	sICode *p = icode->FirstNode;
+	unsigned int addr = p ? p->PMA : 0;
+
+	for(; p; p = p->Next){
+		if(p->Index == i_CODE) addr = codeSegAddr;
+		if(p->Src->Label && p->Src->Label->Addr == p->PMA) p->Src->Label->Addr = addr;
+		p->PMA = addr;
+		for(int j = 0; j < p->MultiCounter; j++) p->Multi[j]->PMA = addr;
+		if(!isNotRealInst(p->Index) || p->Index == i_VAR) addr++;
+	}
+}
+
+/**
+* @brief Bundling pass: pack independent instructions of each basic block
+* into multifunction instructions and report the cycles saved.
+* Called after yyparse() without errors, before codeScan().
+*
+* @param icode Intermediate code list
+*
+* @return Cycles saved in one pass through the code (static estimate)
+*/
+int bundleICode(sICodeList *icode)
+{
+	static sBundleOp op[MAX_BUNDLEBLOCK];
+	static sICode *seq[2 * MAX_BUNDLEBLOCK];
+	static sBundleOp pre[BUNDLE_PATHS][2];
+	sBundleOp post[2];
+	sICode *before = NULL, *pre1 = NULL, *pre2 = NULL;	/* list node and instructions before block */
+	sICode *lastNode = NULL, *last1 = NULL, *last2 = NULL;	/* last two instructions */
+	int n = 0, nseq = 0;
+
+	bundleCntr = bundleMerged = bundleSaved = 0;
+	if(DelaySlotMode) return 0;		/* delay slots are not modeled */
+
+	for(sICode *p = icode->FirstNode; ; lastNode = p, p = p->Next){
+		int comment = p && p->Index == iCOMMENT && !p->Src->Label;
+		int inBlock = FALSE;
+
+		if(comment && n && nseq < 2 * MAX_BUNDLEBLOCK){
+			seq[nseq++] = p;		/* comment inside a block */
+			continue;
+		}
+		if(p && !comment && n < MAX_BUNDLEBLOCK && nseq < 2 * MAX_BUNDLEBLOCK){
+			op[n].p = p;
+			op[n].Pos = n;
+			inBlock = bundleOpInit(&op[n]);
+		}
+
+		if(inBlock){
+			if(!n){
+				before = lastNode;
+				pre1 = last1;
+				pre2 = last2;
+			}
+			seq[nseq++] = p;
+			n++;
+		}else{
+			/* end of block: p is after it */
+			if(n > 1){
+				int npre = bundlePre(pre, pre1, pre2);
+				bundlePost(post, p);
+
+				/* block ends at its last instruction: trailing comments stay */
+				while(seq[nseq-1]->Index == iCOMMENT) nseq--;
+				int saved = bundleBlock(op, n, pre, npre, post, seq, nseq, before, icode);
+				if(saved){
+					/* last two instructions are slots now */
+					last1 = pre1;
+					last2 = pre2;
+					for(sICode *q = before ? before->Next : icode->FirstNode; q != p; q = q->Next){
+						if(!isNotRealInst(q->Index)){
+							last2 = last1;
+							last1 = q;
+						}
+					}
+				}
+				bundleSaved += saved;
+			}
+			n = nseq = 0;
+			if(!p) break;
+		}
+		if(!isNotRealInst(p->Index)){
+			last2 = last1;
+			last1 = p;
+		}
+	}
+
+	if(bundleCntr) bundleRenumber(icode);
+
+	printf("multifunction bundling: %d bundle(s) of %d instruction(s), %d cycle(s) saved per pass\n",
+		bundleCntr, bundleCntr + bundleMerged, bundleSaved);
+	return bundleSaved;
+}
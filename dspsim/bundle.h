@@ -0,0 +1,22 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file bundle.h
+* @brief Header for automatic multifunction bundling pass (-bundle option)
+* @date 2026-10-19
+*/
+
+#ifndef	_BUNDLE_H
+#define	_BUNDLE_H
+
+#include "icode.h"
+
+#define	MAX_BUNDLEBLOCK		256		/**< instructions scheduled at once in a basic block */
+#define	BUNDLE_WINDOW		16		/**< instructions searched ahead for a partner */
+
+int bundleICode(sICodeList *icode);
+
+extern int BundleMode;
+
+#endif	/* _BUNDLE_H */
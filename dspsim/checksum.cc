@@ -0,0 +1,265 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file checksum.cc
+* @brief Per-iteration output checksums (-ck option)
+*
+* A CRC32C is computed over a comma-separated list of items after every
+* iteration and at the end of simulation. Items are:
+*
+*	y				whole .VAR variable
+*	y+16/32			32 words from y+16
+*	0x4000/256		256 words from absolute address
+*	R0, ACC1, I2	register (any name accepted by sRdReg())
+*
+* Data memory words enter the CRC as NUMDP 16-bit little-endian lane
+* values, registers as NUMDP 32-bit little-endian lane values. Checksum
+* lines ("itr N XXXXXXXX", "end XXXXXXXX") go to stdout or the -co file,
+* and are compared with the -ce file of a known-good run: the first
+* mismatch ends the simulation with exit code 1.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "dmem.h"
+#include "simcore.h"
+#include "simsupport.h"
+#include "checksum.h"
+
+sCkItem CkItems[MAX_CKITEMS];	/**< checksum items */
+int CkItemCntr = 0;				/**< number of checksum items */
+
+static unsigned int crcTable[256];	/**< CRC32C (Castagnoli) table, reflected */
+
+/**
+* @brief Update CRC32C.
+*
+* @param crc CRC so far (0 to start)
+* @param buf Data
+* @param len Data length in bytes
+*
+* @return Updated CRC
+*/
+unsigned int crc32c(unsigned int crc, const unsigned char *buf, int len)
+{
+	if(!crcTable[1]){
+		for(unsigned int i = 0; i < 256; i++){
+			unsigned int c = i;
+			for(int k = 0; k < 8; k++){
+				c = (c & 1) ? (c >> 1) ^ 0x82F63B78 : (c >> 1);
+			}
+			crcTable[i] = c;
+		}
+	}
+
+	crc = ~crc;
+	while(len--){
+		crc = crcTable[(crc ^ *buf++) & 0xFF] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+/**
+* @brief Print checksum spec error.
+*
+* @param s Item
+* @param msg Error message
+*
+* @return FALSE
+*/
+static int checksumError(char *s, const char *msg)
+{
+	printf("\nError: -ck %s - %s\n", s, msg);
+	return FALSE;
+}
+
+/**
+* @brief Parse one item and resolve it through symTable.
+*
+* @param s Item string
+* @param ck Item to fill
+*
+* @return TRUE if success
+*/
+static int checksumParseItem(char *s, sCkItem *ck)
+{
+	char name[MAX_SYM_LENGTH];
+	char *p;
+	int offset = 0;
+	int size = -1;
+	sTab *sp;
+
+	memset(ck, 0, sizeof(sCkItem));
+	strncpy(ck->Name, s, MAX_SYM_LENGTH-1);
+	strncpy(name, s, MAX_SYM_LENGTH-1);
+	name[MAX_SYM_LENGTH-1] = '\0';
+
+	if((p = strchr(name, '/')) != NULL){
+		*p = '\0';
+		size = (int)strtol(p + 1, NULL, 0);
+	}
+	if((p = strchr(name, '+')) != NULL){
+		*p = '\0';
+		offset = (int)strtol(p + 1, NULL, 0);
+	}
+
+	if(isdigit(name[0])){
+		if(size < 0) return checksumError(s, "size is required for an address (addr/size)");
+		ck->Start = (unsigned int)strtol(name, NULL, 0) + offset;
+	}else if((sp = sTabHashSearch(&symTable, name)) != NULL && !sp->isConst
+		&& (sp->Type != tEXTERN) && (sp->Addr != UNDEFINED)){
+		ck->Start = sp->Addr + offset;
+		if(size < 0) size = sp->Size - offset;
+	}else if(size < 0 && !offset && isRegName(name)){
+		ck->IsReg = TRUE;
+		return TRUE;
+	}else{
+		return checksumError(s, "neither a data memory variable (.VAR) nor a register");
+	}
+
+	ck->Size = size;
+	if(size <= 0 || ck->Start + size > 0x10000){
+		return checksumError(s, "region is out of data memory space");
+	}
+	return TRUE;
+}
+
+/**
+* @brief Parse -ck item list. Called after assembly.
+*
+* @return TRUE if success
+*/
+int checksumInit(void)
+{
+	char buf[MAX_LINEBUF];
+	char *tok;
+
+	strncpy(buf, checksumList, MAX_LINEBUF-1);
+	buf[MAX_LINEBUF-1] = '\0';
+
+	CkItemCntr = 0;
+	for(tok = strtok(buf, ","); tok != NULL; tok = strtok(NULL, ",")){
+		if(CkItemCntr == MAX_CKITEMS) return checksumError(tok, "too many items");
+		if(!checksumParseItem(tok, &CkItems[CkItemCntr])){
+			CkItemCntr = 0;
+			return FALSE;
+		}
+		CkItemCntr++;
+	}
+	return TRUE;
+}
+
+/**
+* @brief CRC32C of all items in current state.
+*
+* @return CRC
+*/
+static unsigned int checksumCompute(void)
+{
+	unsigned char b[4*NUMDP];
+	unsigned int crc = 0;
+	dMem *dp;
+	sint v;
+	int d;
+
+	for(int k = 0; k < CkItemCntr; k++){
+		sCkItem *ck = &CkItems[k];
+
+		if(ck->IsReg){
+			v = sRdReg(ck->Name);
+			for(int j = 0; j < NUMDP; j++){
+				b[4*j]   = v.dp[j] & 0xFF;
+				b[4*j+1] = (v.dp[j] >> 8) & 0xFF;
+				b[4*j+2] = (v.dp[j] >> 16) & 0xFF;
+				b[4*j+3] = (v.dp[j] >> 24) & 0xFF;
+			}
+			crc = crc32c(crc, b, 4*NUMDP);
+			continue;
+		}
+
+		for(int i = 0; i < ck->Size; i++){
+			dp = dMemHashSearch(dataMem, ck->Start + i);
+			for(int j = 0; j < NUMDP; j++){
+				d = 0x0FFF & (dp ? dp->Data.dp[j] : UNDEFINED);
+				b[2*j]   = d & 0xFF;
+				b[2*j+1] = d >> 8;
+			}
+			crc = crc32c(crc, b, 2*NUMDP);
+		}
+	}
+	return crc;
+}
+
+/**
+* @brief Output a checksum line and compare it with the expected file.
+* Exits on mismatch.
+*
+* @param line Checksum line without newline
+*/
+static void checksumReport(char *line)
+{
+	char exp[MAX_LINEBUF];
+	char *p;
+
+	if(checksumOutFP) fprintf(checksumOutFP, "%s\n", line);
+	else printf("Checksum: %s\n", line);
+
+	if(!checksumExpFP) return;
+
+	do {
+		if(!fgets(exp, MAX_LINEBUF, checksumExpFP)){
+			strcpy(exp, "(end of file)");
+			break;
+		}
+	} while(exp[0] == ';' || exp[0] == '\n');
+
+	for(p = exp + strlen(exp); p > exp && isspace(p[-1]); p--) *(p-1) = '\0';
+
+	if(strcmp(exp, line)){
+		printf("\nError: checksum mismatch - expected \"%s\", got \"%s\"\n", exp, line);
+		if(dumpErrFP) fprintf(dumpErrFP, "\nError: checksum mismatch - expected \"%s\", got \"%s\"\n", exp, line);
+		closeSim();
+		exit(1);
+	}
+}
+
+/**
+* @brief Checksum after an iteration. Called after every simCore().
+*/
+void checksumIter(void)
+{
+	char line[MAX_LINEBUF];
+
+	sprintf(line, "itr %d %08X", ItrCntr + 1, checksumCompute());
+	checksumReport(line);
+}
+
+/**
+* @brief Checksum at the end of simulation.
+*/
+void checksumEnd(void)
+{
+	char line[MAX_LINEBUF];
+
+	sprintf(line, "end %08X", checksumCompute());
+	checksumReport(line);
+}
+
+/**
+* @brief Close checksum files.
+*/
+void checksumClose(void)
+{
+	if(checksumOutFP) fclose(checksumOutFP);
+	if(checksumExpFP) fclose(checksumExpFP);
+	checksumOutFP = NULL;
+	checksumExpFP = NULL;
+	CkItemCntr = 0;
+}
@@ -0,0 +1,36 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file checksum.h
+* @brief Header for per-iteration output checksums (-ck option)
+* @date 2026-10-19
+*/
+
+#ifndef	_CHECKSUM_H
+#define	_CHECKSUM_H
+
+#include "symtab.h"
+
+#define	MAX_CKITEMS		64		/**< maximum number of checksum items */
+
+/**
+* @brief One checksum item: a data memory region or a register.
+*/
+typedef struct sCkItem {
+	int		IsReg;					/**< TRUE: register, FALSE: data memory region */
+	char	Name[MAX_SYM_LENGTH];	/**< item as written */
+	unsigned int	Start;			/**< region start address */
+	int		Size;					/**< region size */
+} sCkItem;
+
+unsigned int crc32c(unsigned int crc, const unsigned char *buf, int len);
+int checksumInit(void);
+void checksumIter(void);
+void checksumEnd(void);
+void checksumClose(void);
+
+extern sCkItem CkItems[MAX_CKITEMS];
+extern int CkItemCntr;
+
+#endif	/* _CHECKSUM_H */
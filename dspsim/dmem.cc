@@ -16,9 +16,13 @@ All Rights Reserved.
 #include <string.h>
 #include <assert.h>
 #include "dmem.h"
+#include "arena.h"
+
+dMemMap dataMemMap[MAX_DMEMMAP];
+int dataMemMapCntr = 0;
 
 /** 
-* @brief Allocate a node dynamically.
+* @brief Allocate a node from the current arena (reusing removed nodes).
 * 
 * @param d SIMD (12-bit x NUMDP) Data for new node
 * @param a Data Memory Address for new node
@@ -28,7 +32,7 @@ All Rights Reserved.
 dMem *dMemGetNode(sint d, unsigned int a)
 {
 	dMem *p;
-	p = (dMem *)malloc(sizeof(dMem));
+	p = (dMem *)arenaAlloc(curArena, sizeof(dMem));
 	assert(p != NULL);
 
 	p->Data = d;
@@ -60,7 +64,7 @@ extern "C" dMem *dMemListAdd(dMemList *list, sint d, unsigned int a)
 		if(p == NULL)	/* if not exist, insert new node */
 			list->LastNode = dMemListInsertAfter(list->LastNode, n);
 		else{	/* if already exists, return found node  */
-			free(n);
+			arenaRelease(curArena, n, sizeof(dMem));
 			return p;
 		}
 	} else {	/* FirstNode == NULL (list empty) */
@@ -121,7 +125,7 @@ void dMemListRemoveAfter(dMemList *list, dMem *p)
 			if(obsoleteNode->Next == NULL){	/* if it is LastNode */
 				list->LastNode = p;		/* update LastNode */
 			}
-			free(obsoleteNode);
+			arenaRelease(curArena, obsoleteNode, sizeof(dMem));
 		}
 	}
 }
@@ -140,7 +144,7 @@ dMem *dMemListRemoveBeginning(dMemList *list)
 			dMem *obsoleteNode = list->FirstNode;
 			list->FirstNode = list->FirstNode->Next;
 			if(list->FirstNode == NULL) list->LastNode = NULL; /* removed last node */
-			free(obsoleteNode);
+			arenaRelease(curArena, obsoleteNode, sizeof(dMem));
 			return list->FirstNode;	/* return new FirstNode */
 		} else {
 			return NULL;
@@ -313,6 +317,24 @@ void dMemHashRemoveAll(dMemList htable[])
 }
 
 
+/** 
+* @brief Copy all nodes of a hash table into another.
+* 
+* @param dst Destination hash table
+* @param src Source hash table
+*/
+void dMemHashCopy(dMemList dst[], dMemList src[])
+{
+	int i;
+	dMem *n;
+
+	for(i = 0; i < MAX_HASHTABLE; i++){
+		for(n = src[i].FirstNode; n != NULL; n = n->Next){
+			dMemHashAdd(dst, n->Data, n->DMA);
+		}
+	}
+}
+
 /** 
 * @brief Initialize dataMem[]
 * 
@@ -328,3 +350,66 @@ void dataMemInit(dMemList htable[])
 	}
 }
 
+
+/** 
+* @brief Map a host buffer over a data memory range.
+* Reads and writes of the range go to the buffer directly instead of dataMem[].
+* 
+* @param a First data memory address
+* @param n Number of addresses
+* @param buf Host buffer (n * lanes words)
+* @param lanes Lanes per address in buf (1 ~ NUMDP)
+* 
+* @return TRUE if success, FALSE if overlapping, table full or bad argument
+*/
+int dMemMapAdd(unsigned int a, unsigned int n, short *buf, int lanes)
+{
+	if(!buf || !n || lanes < 1 || lanes > NUMDP) return FALSE;
+	if(dataMemMapCntr >= MAX_DMEMMAP) return FALSE;
+
+	for(int i = 0; i < dataMemMapCntr; i++){
+		dMemMap *m = &dataMemMap[i];
+		if(a < m->Start + m->Size && m->Start < a + n) return FALSE;
+	}
+
+	dataMemMap[dataMemMapCntr].Start = a;
+	dataMemMap[dataMemMapCntr].Size  = n;
+	dataMemMap[dataMemMapCntr].Buf   = buf;
+	dataMemMap[dataMemMapCntr].Lanes = lanes;
+	dataMemMapCntr++;
+	return TRUE;
+}
+
+/** 
+* @brief Remove host buffer mapping starting at given address.
+* 
+* @param a First data memory address of the mapping
+* 
+* @return TRUE if removed, FALSE if not found
+*/
+int dMemMapRemove(unsigned int a)
+{
+	for(int i = 0; i < dataMemMapCntr; i++){
+		if(dataMemMap[i].Start == a){
+			dataMemMap[i] = dataMemMap[--dataMemMapCntr];
+			return TRUE;
+		}
+	}
+	return FALSE;
+}
+
+/** 
+* @brief Find host buffer mapping containing given address.
+* 
+* @param a Data memory address
+* 
+* @return Pointer to mapping, NULL if not mapped
+*/
+dMemMap *dMemMapSearch(unsigned int a)
+{
+	for(int i = 0; i < dataMemMapCntr; i++){
+		dMemMap *m = &dataMemMap[i];
+		if(a >= m->Start && a - m->Start < m->Size) return m;
+	}
+	return NULL;
+}
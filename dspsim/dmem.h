@@ -31,6 +31,19 @@ typedef struct dMemList {
 	dMem *LastNode;			/* Points to last node of list; MUST be NULL when initialized */
 } dMemList;
 
+#define	MAX_DMEMMAP		16		/**< maximum number of host buffers mapped into data memory */
+
+/** 
+* @brief Host buffer mapped over a data memory range (libn1dsim).
+* Buffer holds one signed 16-bit word per lane: Buf[(addr - Start) * Lanes + lane].
+*/
+typedef struct dMemMap {
+	unsigned int	Start;	/**< first data memory address */
+	unsigned int	Size;	/**< number of addresses */
+	short	*Buf;			/**< host buffer, not owned */
+	int		Lanes;			/**< lanes per address in Buf (1 ~ NUMDP) */
+} dMemMap;
+
 dMem *dMemGetNode(sint d, unsigned int a);
 #ifdef __cplusplus
 /* when called from C++ function */
@@ -53,8 +66,15 @@ void dMemHashPrint(dMemList htable[]);
 dMem *dMemHashSearch(dMemList htable[], unsigned int a);
 void dMemHashRemoveAll(dMemList htable[]);
 void dMemHashRemoveAfter(dMemList htable[], dMem *p);
+void dMemHashCopy(dMemList dst[], dMemList src[]);
 void dataMemInit(dMemList htable[]);
 
+int dMemMapAdd(unsigned int a, unsigned int n, short *buf, int lanes);
+int dMemMapRemove(unsigned int a);
+dMemMap *dMemMapSearch(unsigned int a);
+
 extern struct dMemList dataMem[MAX_HASHTABLE]; /**< Data Memory to store 12-bit data */
+extern dMemMap dataMemMap[MAX_DMEMMAP];		/**< host buffers mapped into data memory */
+extern int dataMemMapCntr;					/**< number of entries in dataMemMap[] */
 
 #endif /* _DMEM_H */
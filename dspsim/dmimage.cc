@@ -0,0 +1,294 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file dmimage.cc
+* @brief Binary data memory image files (-if/-of)
+*
+* An image is a 16-byte header followed by raw little-endian int16 values,
+* one per lane per address (see sDmImage). Regular files are mmap()ed, so
+* loading and dumping need no decimal text conversion. Streams which cannot
+* be mapped (pipes, server connections) are read or written in one block.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "dmimage.h"
+
+#ifndef	TRUE
+#define	TRUE	1
+#endif
+#ifndef	FALSE
+#define	FALSE	0
+#endif
+
+/**
+* @brief Get little-endian 16-bit value.
+*/
+static unsigned int dmiGet16(unsigned char *p)
+{
+	return p[0] | (p[1] << 8);
+}
+
+/**
+* @brief Get little-endian 32-bit value.
+*/
+static unsigned int dmiGet32(unsigned char *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+/**
+* @brief Put little-endian 16-bit value.
+*/
+static void dmiPut16(unsigned char *p, unsigned int v)
+{
+	p[0] = v & 0xFF;
+	p[1] = (v >> 8) & 0xFF;
+}
+
+/**
+* @brief Put little-endian 32-bit value.
+*/
+static void dmiPut32(unsigned char *p, unsigned int v)
+{
+	dmiPut16(p, v & 0xFFFF);
+	dmiPut16(p + 2, v >> 16);
+}
+
+/**
+* @brief Fill image header.
+*/
+static void dmiPutHeader(unsigned char *p, unsigned int start, unsigned int size, int lanes)
+{
+	memcpy(p, DMI_MAGIC, 4);
+	dmiPut16(p + 4, DMI_VERSION);
+	dmiPut16(p + 6, lanes);
+	dmiPut32(p + 8, start);
+	dmiPut32(p + 12, size);
+}
+
+/**
+* @brief Check image header and set geometry of img.
+*
+* @return TRUE if header is valid
+*/
+static int dmiParseHeader(unsigned char *p, sDmImage *img)
+{
+	if(memcmp(p, DMI_MAGIC, 4) || (dmiGet16(p + 4) != DMI_VERSION)) return FALSE;
+
+	img->Lanes = dmiGet16(p + 6);
+	img->Start = dmiGet32(p + 8);
+	img->Size  = dmiGet32(p + 12);
+
+	return (img->Lanes >= 1) && (img->Lanes <= DMI_MAXLANES)
+		&& (img->Start < DMI_MAXADDR) && (img->Size <= DMI_MAXADDR - img->Start);
+}
+
+/**
+* @brief Check if input stream holds a binary image (not a decimal text dump).
+* Only the first byte is peeked, so non-seekable streams can be checked too.
+*
+* @param fp Input stream at its beginning
+*
+* @return TRUE if binary image
+*/
+int dmiIsImage(FILE *fp)
+{
+	int c = getc(fp);
+
+	if(c == EOF) return FALSE;
+	ungetc(c, fp);
+	return (c == DMI_MAGIC[0]);
+}
+
+/**
+* @brief Check if output filename selects binary image format.
+*
+* @param name Filename
+*
+* @return TRUE if name ends with DMI_EXT
+*/
+int dmiIsImageName(char *name)
+{
+	size_t n = strlen(name);
+	size_t e = strlen(DMI_EXT);
+
+	return (n > e) && !strcasecmp(name + n - e, DMI_EXT);
+}
+
+/**
+* @brief Read image from a stream which cannot be mapped (pipe, server
+* connection). Only header and data are consumed, nothing beyond.
+*
+* @param fp Input stream
+* @param img Image to set Buf and Len
+*
+* @return TRUE if success
+*/
+static int dmiRead(FILE *fp, sDmImage *img)
+{
+	unsigned char hdr[DMI_HDRSIZE];
+
+	if(fread(hdr, 1, DMI_HDRSIZE, fp) != DMI_HDRSIZE) return FALSE;
+
+	img->Len = DMI_HDRSIZE;
+	if(!memcmp(hdr, DMI_MAGIC, 4) && (dmiGet32(hdr + 12) <= DMI_MAXADDR)
+		&& (dmiGet16(hdr + 6) <= DMI_MAXLANES)){
+		img->Len += (size_t)dmiGet32(hdr + 12) * dmiGet16(hdr + 6) * 2;
+	}
+
+	img->Buf = malloc(img->Len);
+	if(!img->Buf) return FALSE;
+	img->Mapped = FALSE;
+	memcpy(img->Buf, hdr, DMI_HDRSIZE);
+	img->Len = DMI_HDRSIZE + fread((unsigned char *)img->Buf + DMI_HDRSIZE, 1, img->Len - DMI_HDRSIZE, fp);
+	return TRUE;
+}
+
+/**
+* @brief Load an image from input stream.
+* Regular files are mapped read-only; other streams are read to memory.
+*
+* @param fp Input stream at its beginning (after dmiIsImage())
+* @param img Image to initialize
+*
+* @return TRUE if success, FALSE if header or size is invalid
+*/
+int dmiLoad(FILE *fp, sDmImage *img)
+{
+	struct stat st;
+	unsigned char *p;
+
+	memset(img, 0, sizeof(sDmImage));
+
+	if(!fstat(fileno(fp), &st) && S_ISREG(st.st_mode) && (ftell(fp) == 0)
+		&& (st.st_size >= DMI_HDRSIZE)){
+		img->Buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+		if(img->Buf != MAP_FAILED){
+			img->Len = st.st_size;
+			img->Mapped = TRUE;
+		}else{
+			img->Buf = NULL;
+		}
+	}
+	if(!img->Buf && !dmiRead(fp, img)) return FALSE;
+
+	p = (unsigned char *)img->Buf;
+	img->Data = p + DMI_HDRSIZE;
+	if((img->Len < DMI_HDRSIZE) || !dmiParseHeader(p, img)
+		|| (img->Len < DMI_HDRSIZE + (size_t)img->Size * img->Lanes * 2)){
+		dmiClose(img);
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Create an output image of given geometry.
+* A regular file opened for update ("w+b") is sized and mapped; otherwise
+* the image is built in memory and written to the stream by dmiClose().
+*
+* @param fp Output stream
+* @param img Image to initialize
+* @param start First data memory address
+* @param size Number of addresses
+* @param lanes Values per address
+*
+* @return TRUE if success
+*/
+int dmiCreate(FILE *fp, sDmImage *img, unsigned int start, unsigned int size, int lanes)
+{
+	struct stat st;
+	unsigned char *p;
+
+	memset(img, 0, sizeof(sDmImage));
+	img->Start = start;
+	img->Size = size;
+	img->Lanes = lanes;
+	img->Len = DMI_HDRSIZE + (size_t)size * lanes * 2;
+
+	fflush(fp);
+	if(!fstat(fileno(fp), &st) && S_ISREG(st.st_mode)
+		&& !ftruncate(fileno(fp), img->Len)){
+		img->Buf = mmap(NULL, img->Len, PROT_READ | PROT_WRITE, MAP_SHARED, fileno(fp), 0);
+		if(img->Buf != MAP_FAILED){
+			img->Mapped = TRUE;
+		}else{
+			img->Buf = NULL;
+			ftruncate(fileno(fp), 0);
+		}
+	}
+	if(!img->Buf){
+		img->Buf = malloc(img->Len);
+		if(!img->Buf) return FALSE;
+		img->FP = fp;
+	}
+
+	p = (unsigned char *)img->Buf;
+	dmiPutHeader(p, start, size, lanes);
+	img->Data = p + DMI_HDRSIZE;
+	return TRUE;
+}
+
+/**
+* @brief Read only the header from a stream of frames; each frame that
+* follows is img->Size * img->Lanes values.
+*
+* @param fp Input stream
+* @param img Image to set Start, Size and Lanes (no data)
+*
+* @return TRUE if header is valid
+*/
+int dmiReadHeader(FILE *fp, sDmImage *img)
+{
+	unsigned char hdr[DMI_HDRSIZE];
+
+	memset(img, 0, sizeof(sDmImage));
+	if(fread(hdr, 1, DMI_HDRSIZE, fp) != DMI_HDRSIZE) return FALSE;
+	return dmiParseHeader(hdr, img);
+}
+
+/**
+* @brief Write only the header to a stream of frames.
+*
+* @param fp Output stream
+* @param start First data memory address of each frame
+* @param size Number of addresses per frame
+* @param lanes Values per address
+*
+* @return TRUE if success
+*/
+int dmiWriteHeader(FILE *fp, unsigned int start, unsigned int size, int lanes)
+{
+	unsigned char hdr[DMI_HDRSIZE];
+
+	dmiPutHeader(hdr, start, size, lanes);
+	return (fwrite(hdr, 1, DMI_HDRSIZE, fp) == DMI_HDRSIZE);
+}
+
+/**
+* @brief Release image; unmapping a created image commits it to the file.
+*
+* @param img Image
+*/
+void dmiClose(sDmImage *img)
+{
+	if(!img->Buf) return;
+
+	if(img->Mapped){
+		munmap(img->Buf, img->Len);
+	}else{
+		if(img->FP) fwrite(img->Buf, 1, img->Len, img->FP);
+		free(img->Buf);
+	}
+	img->Buf = NULL;
+	img->Data = NULL;
+}
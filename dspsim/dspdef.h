@@ -11,8 +11,7 @@ All Rights Reserved.
 #define	_DSPDEF_H
 
 #include <stdio.h>			/* for NULL */
-
-#define MAX_FIELD	15		/* max number of fields within a instruction format */
+#include "../isa/isa.h"	/* eType, eField, sType, sField, sBinOp, sInstFormatTable */
 
 #define	REG_X_LO	24		/* lower bound of cross-path register window */
 #define	REG_X_HI	31		/* upper bound of cross-path register window */
@@ -104,71 +103,6 @@ enum eOp
 	iUNKNOWN,
 };
 
-/** 
-* Instruction type - Each instruction can have different type even 
-* with the same opcode.
-*/
-enum eType {
-	t01a = 1, t01b, t01c, 
-	t03a, t03c, t03d, t03e, t03f, t03g, t03h, t03i,
-	t04a, t04b, t04c, t04d, t04e, t04f, t04g, t04h,
-	t06a, t06b, t06c, t06d,
-	t08a, t08b, t08c, t08d,
-	t09c, t09d, t09e, t09f, t09g, t09h, t09i,
-	t10a, t10b, 
-	t11a, 
-	t12e, t12f, t12g, t12h, t12m, t12n, t12o, t12p,
-	t14c, t14d, t14k, t14l, 
-	t15a, t15b, t15c, t15d, t15e, t15f,
-	t16a, t16b, t16c, t16d, t16e, t16f,
-	t17a, t17b, t17c, t17d, t17e, t17f, t17g, t17h,
-	t18a, t18b, t18c,
-	t19a,
-	t20a, 
-	t22a, 
-	t23a, 
-	t25a, t25b, 
-	t26a, 
-	t29a, t29b, t29c, t29d,
-	t30a, 
-	t31a, 
-	t32a, t32b, t32c, t32d,
-	t37a, 
-	t40e, t40f, t40g, 
-	t41a, t41b, t41c, t41d, 
-	t42a, t42b, 
-	t43a, 
-	t44b, t44d,
-	t45b, t45d,
-	t46a, t46b,
-	t47a,
-	t48a,
-	t49a, t49b, t49c, t49d,
-	t50a, 
-	eTypeEnd,
-};
-
-
-/** 
-* @brief Every Instruction Field is an eField enum value after parsing.
-*/
-enum eField {
-	fOpcodeType, fAMF, fSF, fSF2, fAF, 
-	fMF, fYZ, fDSTA, fSRCA1, fSRCA2, 
-	fDSTM, fSRCM1, fSRCM2, fDSTS, fSRCS1,	
-	fSRCS2,	fDSTLS,	fSRCLS,	fDSTC, fSRCC, 
-	fDSTB, fDSTID, fTERM, fINTN, fU, 
-	fU2, fS, fT, fLPP, fPPP, 
-	fSPP, fC, fCONJ, fENA, fPOLAR, 
-	fDD, fPD, 
-	fDC, fLSF, fDF, fMN, 
-	fIDE, fIDM, fIDR, fIDN, fCW,
-	fReserved, 
-	fCOND,
-	fPMM, fPMI, fDMM, fDMI, 
-};
-
-
 /** 
 * @brief Every register is represented as an eRegIndex enum value after parsing.
 */
@@ -245,21 +179,7 @@ enum eShift {
 	esHIX, 
 };
 
-typedef struct sBinMapping {
-	char *bits; /* pointer to binary opcode string */
-	int width;  /* number of bits */
-} sBinMapping;
-
-typedef struct sInstFormat {
-	int fields[MAX_FIELD];		/* fields (eField enum values) */
-	int widths[MAX_FIELD];		/* field widths */
-} sInstFormat;
-
 extern const char *sOp[];						/**< Opcode mnemonics */
-extern const char *sType[];						/**< Instruction type mnemonics */
-extern const char *sField[];					/**< Instruction field mnemonics */
 extern const char *sResSym[];					/**< Reserved keywords mnemonics */
-extern const sInstFormat sInstFormatTable[];	/**< Instruction format table */
-extern const sBinMapping sBinOp[];				/**< Binary opcode mapping table */
 
 #endif	/* _DSPDEF_H */
@@ -36,6 +36,9 @@ All Rights Reserved.
 #define	DEF_ITRMAX	1			/* default value for ItrMax */
 #define	DEF_DUMPINSIZE	256		/* default value for dumpInSize */
 #define	DEF_DUMPOUTSIZE	256		/* default value for dumpOutSize */
+#define	DEF_FRAMESIZE	256		/* default value for frameInSize & frameOutSize */
+#define	DEF_GENSIZE		256		/* default value for genSize */
+#define	DEF_GOLDSIZE	256		/* default value for goldSize */
 
 #define	INSTLEN	32	/* instruction width: 32 bits */
 
@@ -49,7 +52,7 @@ extern int lineno;
 extern unsigned int curaddr;
 extern sICode *curicode;
 extern char	condbuf[MAX_CONDBUF];
-extern char linebuf[MAX_LINEBUF];
+extern char *linebuf;		/* current source line (grown by lexer) */
 extern int isParsingMultiFunc;
 extern char msgbuf[MAX_LINEBUF];
 
@@ -73,6 +76,9 @@ extern int SIMD2Mode;
 extern int SIMD4Mode;
 extern int SIMD4ForceMode;
 extern int SuppressUndefinedDMMode;
+extern int LockstepCount;
+extern int LockstepDiverged;
+extern int SpecJobs;
 
 extern	FILE *dumpInFP;
 extern	int	dumpInStart;
@@ -80,6 +86,32 @@ extern	int dumpInSize;
 extern	FILE *dumpOutFP;
 extern	int	dumpOutStart;
 extern 	int dumpOutSize;
+extern	int dumpOutImage;
+
+extern	FILE *frameInFP;
+extern	int	frameInStart;
+extern	int frameInSize;
+extern	FILE *frameOutFP;
+extern	int	frameOutStart;
+extern	int frameOutSize;
+extern	int frameOutImage;
+
+extern	FILE *regionFP;
+extern	char *regionFile;
+
+extern	char *genSpec;
+extern	int	genStart;
+extern	int genSize;
+
+extern	char *checksumList;
+extern	FILE *checksumExpFP;
+extern	FILE *checksumOutFP;
+
+extern	FILE *goldFP;
+extern	int	goldStart;
+extern	int goldSize;
+extern	char *goldTol;
+extern	int goldStop;
 
 extern FILE *dumpBinFP;
 extern FILE *dumpMemFP;
@@ -87,8 +119,6 @@ extern FILE *dumpTxtFP;
 extern FILE *dumpSymFP;
 extern FILE *dumpErrFP;
 extern FILE *dumpLstFP;
-extern char	bytebuf[INSTLEN];
-extern char bitbuf[INSTLEN/8];
 extern int bitPosition;
 extern int bitWidth;
 
@@ -104,6 +134,8 @@ extern "C"
 #endif
 	int yyparse(void);
 	int yylex(void);
+	void lexOpen(FILE *fp);
+	void lexClose(void);
 #ifdef	__cplusplus
 	int yyerror(char *msg);
 };
@@ -119,7 +151,9 @@ extern struct sTab* symlook(char *s, unsigned int n);
 void addlabel(char *name, unsigned int address);
 void yyerror2(char *s);
 unsigned int isOpcode(char *s);
-extern struct sTab* isResSym(char *s);
+char *lexSave(char *s, int len);
+void lexSetLine(char *s, int len);
+int isResSym(char *s);
 
 int addOperand(char *s);
 void addConjugate(void);
@@ -130,10 +164,11 @@ int processArg(int argc, char *argv[]);
 void printHelp(char *s);
 void printArgError(char *prog, char *opt);
 void printFileOpenError(char *prog, char *filename);
+int openSourceFiles(char *prog, char *src);
 
 int getFilenameExt(char *buf, char *filename, int *sp);
-int changeFilenameExt(char *buf, char *filename, char *newext);
-int compareFilenameExt(char *oldext, char *filename, char *newext);
+int changeFilenameExt(char *buf, char *filename, const char *newext);
+int compareFilenameExt(char *oldext, char *filename, const char *newext);
 void printFileHeader(FILE *fp, char *filename);
 void printMemFileHeader(FILE *fp);
 
@@ -8,6 +8,7 @@
 #include "optab.h"
 #include "simsupport.h"
 #include "dspdef.h"
+#include "arena.h"
 
 %}
 
@@ -120,7 +121,7 @@ sentence:	LABEL	statement '\n'
 
 					char linebuf2[MAX_LINEBUF];
 					sprintf(linebuf2, "%s:", $1->Name);
-					curicode->Line = strdup(linebuf2);
+					curicode->Src->Line = arenaStrdupCold(curArena, linebuf2);
 				}else{		/* when statement is not blank */
 					if($1->Addr != curaddr){		/* happens just after multifunction */
 						/* example:
@@ -136,7 +137,7 @@ sentence:	LABEL	statement '\n'
 
 				if(VerboseMode) printf("> LINE2:\t%s\n", linebuf); 
 
-				curicode->Label = $1;
+				curicode->Src->Label = $1;
 
 				if(VerboseMode) printf("LABEL:\t%s(0x%04X) %p\n", $1->Name, $1->Addr, $1); 
 				if(VerboseMode) printf("curaddr = %X\n", curaddr);
@@ -150,13 +151,13 @@ sentence:	LABEL	statement '\n'
 statement:	/* empty */
 	|	instruction_cond	COMMENT	
 			{
-				curicode->Comment = $2;	
+				curicode->Src->Comment = $2;	
 			}
 	|	instruction_cond	
 	|	COMMENT 
 			{
 				curicode = sICodeListAdd(&iCode, iCOMMENT, curaddr, lineno);
-				curicode->Comment = $1;	
+				curicode->Src->Comment = $1;	
 			}
 	|	instruction_cond	KSEPARATOR instruction
 			{
@@ -164,7 +165,7 @@ statement:	/* empty */
 			}
 	|	instruction_cond	KSEPARATOR instruction COMMENT
 			{
-				curicode->Comment = $4;	
+				curicode->Src->Comment = $4;	
 				if(VerboseMode) printf("MULTIFUNC3:\n");
 				if(VerboseMode) printf("COMMENT4: %s at PMA %04X\n", $4, curicode->PMA);
 			}
@@ -174,7 +175,7 @@ statement:	/* empty */
 			}
 	|	instruction_cond	KSEPARATOR instruction KSEPARATOR instruction COMMENT
 			{
-				curicode->Comment = $6;	
+				curicode->Src->Comment = $6;	
 				if(VerboseMode) printf("MULTIFUNC4:\n");
 				if(VerboseMode) printf("COMMENT6: %s at PMA %04X\n", $6, curicode->PMA);
 			}
@@ -570,7 +571,16 @@ int addOperand(char *s)
 		exit(1);
 	}
 
-	curicode->Operand[t] = strdup(s);
+	/* operand vector: small one first, bigger one for long lists */
+	if(t == 0){
+		curicode->Operand = (char **)arenaAlloc(curArena, OPERAND_SLOTS * sizeof(char *));
+	}else if(t == OPERAND_SLOTS-2){
+		char **v = (char **)arenaAlloc(curArena, OPERAND_SLOTSMAX * sizeof(char *));
+
+		memcpy(v, curicode->Operand, t * sizeof(char *));
+		curicode->Operand = v;
+	}
+	curicode->Operand[t] = arenaStrdup(curArena, s);
 	if(VerboseMode) printf("Operand[%d]:\t%s\n", t, curicode->Operand[t]);
 
 	return t;
@@ -0,0 +1,350 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file framestream.cc
+* @brief Streaming frame input/output across iterations (-fi/-fo options)
+*
+* Each iteration of the main loop takes the next frame of the -fi stream
+* into data memory before simCore(), and appends the -fo region to the
+* output stream after it. A reader thread parses input frames ahead and a
+* writer thread formats output frames behind, each through a bounded
+* queue of FRAME_QDEPTH frames, so file conversion overlaps simulation.
+*
+* Frame format is the -if/-of decimal text format (frame after frame), or
+* a binary image stream: one .dmi header followed by any number of frames
+* of header size (see dmimage.h).
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "dspsim.h"
+#include "simsupport.h"
+#include "dmimage.h"
+#include "framestream.h"
+
+static int frameStreaming = FALSE;		/**< TRUE between frameStreamOpen() and frameStreamClose() */
+static int frameInBinary = FALSE;		/**< input is a binary image stream */
+static int frameInLanes = NUMDP;		/**< lanes per address in binary input */
+static sFrameQueue frameInQ;			/**< reader thread -> simulator */
+static sFrameQueue frameOutQ;			/**< simulator -> writer thread */
+static pthread_t frameInThread;
+static pthread_t frameOutThread;
+
+/**
+* @brief Initialize an empty queue.
+*
+* @param q Queue
+* @param words Addresses per frame
+*/
+static void frameQueueInit(sFrameQueue *q, int words)
+{
+	q->Buf = (sint *)malloc(sizeof(sint) * FRAME_QDEPTH * (words ? words : 1));
+	q->Words = words;
+	q->Head = 0;
+	q->Count = 0;
+	q->Done = FALSE;
+	pthread_mutex_init(&q->Lock, NULL);
+	pthread_cond_init(&q->NotEmpty, NULL);
+	pthread_cond_init(&q->NotFull, NULL);
+}
+
+/**
+* @brief Put a copy of frame; blocks while queue is full.
+*
+* @param q Queue
+* @param f Frame of q->Words addresses
+*
+* @return FALSE if queue was finished (nobody takes frames any more)
+*/
+static int frameQueuePut(sFrameQueue *q, sint *f)
+{
+	pthread_mutex_lock(&q->Lock);
+	while(q->Count == FRAME_QDEPTH && !q->Done){
+		pthread_cond_wait(&q->NotFull, &q->Lock);
+	}
+	if(q->Done){
+		pthread_mutex_unlock(&q->Lock);
+		return FALSE;
+	}
+	memcpy(q->Buf + ((q->Head + q->Count) % FRAME_QDEPTH) * q->Words, f, sizeof(sint) * q->Words);
+	q->Count++;
+	pthread_cond_signal(&q->NotEmpty);
+	pthread_mutex_unlock(&q->Lock);
+	return TRUE;
+}
+
+/**
+* @brief Take next frame; blocks while queue is empty and not finished.
+*
+* @param q Queue
+* @param f Frame buffer of q->Words addresses
+*
+* @return FALSE if queue is empty and finished
+*/
+static int frameQueueGet(sFrameQueue *q, sint *f)
+{
+	pthread_mutex_lock(&q->Lock);
+	while(q->Count == 0 && !q->Done){
+		pthread_cond_wait(&q->NotEmpty, &q->Lock);
+	}
+	if(q->Count == 0){
+		pthread_mutex_unlock(&q->Lock);
+		return FALSE;
+	}
+	memcpy(f, q->Buf + q->Head * q->Words, sizeof(sint) * q->Words);
+	q->Head = (q->Head + 1) % FRAME_QDEPTH;
+	q->Count--;
+	pthread_cond_signal(&q->NotFull);
+	pthread_mutex_unlock(&q->Lock);
+	return TRUE;
+}
+
+/**
+* @brief Mark queue finished and wake up both sides.
+*
+* @param q Queue
+*/
+static void frameQueueFinish(sFrameQueue *q)
+{
+	pthread_mutex_lock(&q->Lock);
+	q->Done = TRUE;
+	pthread_cond_broadcast(&q->NotEmpty);
+	pthread_cond_broadcast(&q->NotFull);
+	pthread_mutex_unlock(&q->Lock);
+}
+
+/**
+* @brief Read one input frame in decimal text format.
+* Same format as initDumpIn(): one address per line, ';' comment lines.
+*
+* @param f Frame buffer
+*
+* @return FALSE at end of input (incomplete last frame is dropped)
+*/
+static int frameReadText(sint *f)
+{
+	char tstr[8*NUMDP+1];
+
+	for(int i = 0; i < frameInSize; i++){
+		if(fgets(tstr, sizeof(tstr), frameInFP) == NULL){
+			return FALSE;
+		}
+		if(tstr[0] == ';'){
+			i--;		/* don't count this line */
+			continue;	/* skip comment line */
+		}
+
+		for(int j = 0; j < NUMDP; j++){
+			f[i].dp[j] = UNDEFINED;
+		}
+		sscanf(tstr, "%d %d %d %d", &f[i].dp[0], &f[i].dp[1], &f[i].dp[2], &f[i].dp[3]);
+		for(int j = 0; j < NUMDP; j++){
+			f[i].dp[j] &= 0xFFF;
+		}
+	}
+	return TRUE;
+}
+
+/**
+* @brief Read one input frame of a binary image stream.
+*
+* @param f Frame buffer
+* @param raw Buffer of frameInSize * frameInLanes int16 values
+*
+* @return FALSE at end of input (incomplete last frame is dropped)
+*/
+static int frameReadBinary(sint *f, unsigned char *raw)
+{
+	size_t n = (size_t)frameInSize * frameInLanes * 2;
+	unsigned char *p;
+
+	if(fread(raw, 1, n, frameInFP) != n){
+		return FALSE;
+	}
+
+	for(int i = 0; i < frameInSize; i++){
+		for(int j = 0; j < NUMDP; j++){
+			if(j < frameInLanes){
+				p = raw + 2 * (i * frameInLanes + j);
+				f[i].dp[j] = 0xFFF & (p[0] | (p[1] << 8));
+			}else{
+				f[i].dp[j] = 0xFFF & UNDEFINED;
+			}
+		}
+	}
+	return TRUE;
+}
+
+/**
+* @brief Reader thread: parse input frames ahead of the simulator.
+* It can be cancelled only while reading the stream (e.g. blocked on a pipe).
+*/
+static void *frameReader(void *)
+{
+	sint *f = (sint *)malloc(sizeof(sint) * (frameInSize ? frameInSize : 1));
+	unsigned char *raw = NULL;
+	int ok;
+
+	pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	if(frameInBinary) raw = (unsigned char *)malloc((size_t)frameInSize * frameInLanes * 2 + 1);
+	pthread_cleanup_push(free, f);
+	pthread_cleanup_push(free, raw);
+
+	do {
+		pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+		ok = frameInBinary ? frameReadBinary(f, raw) : frameReadText(f);
+		pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+	} while(ok && frameQueuePut(&frameInQ, f));
+
+	pthread_cleanup_pop(1);
+	pthread_cleanup_pop(1);
+
+	frameQueueFinish(&frameInQ);
+	return NULL;
+}
+
+/**
+* @brief Writer thread: format output frames behind the simulator.
+*/
+static void *frameWriter(void *)
+{
+	sint *f = (sint *)malloc(sizeof(sint) * (frameOutSize ? frameOutSize : 1));
+	unsigned char *raw = (unsigned char *)malloc((size_t)frameOutSize * NUMDP * 2 + 1);
+	unsigned char *p;
+	int data;
+
+	while(frameQueueGet(&frameOutQ, f)){
+		if(frameOutImage){
+			p = raw;
+			for(int i = 0; i < frameOutSize; i++){
+				for(int j = 0; j < NUMDP; j++){
+					data = f[i].dp[j];
+					if(data >= 0x800) data -= 0x1000;
+					*p++ = data & 0xFF;
+					*p++ = (data >> 8) & 0xFF;
+				}
+			}
+			fwrite(raw, 1, p - raw, frameOutFP);
+		}else{
+			for(int i = 0; i < frameOutSize; i++){
+				for(int j = 0; j < NUMDP; j++){
+					data = f[i].dp[j];
+					if(data >= 0x800) data -= 0x1000;
+					fprintf(frameOutFP, "%d ", data);
+				}
+				fprintf(frameOutFP, "\n");
+			}
+		}
+	}
+	fflush(frameOutFP);
+
+	free(f);
+	free(raw);
+	return NULL;
+}
+
+/**
+* @brief Read stream headers and start reader/writer threads.
+* Called after initDumpIn() and before the first iteration.
+*
+* @return TRUE if success, FALSE if binary input header is invalid
+*/
+int frameStreamOpen(void)
+{
+	if(frameInFP){
+		if(dmiIsImage(frameInFP)){
+			sDmImage img;
+
+			if(!dmiReadHeader(frameInFP, &img)) return FALSE;
+			frameInBinary = TRUE;
+			frameInStart = img.Start;
+			frameInSize = img.Size;
+			frameInLanes = img.Lanes;
+		}
+		frameQueueInit(&frameInQ, frameInSize);
+		pthread_create(&frameInThread, NULL, frameReader, NULL);
+	}
+
+	if(frameOutFP){
+		if(frameOutImage) dmiWriteHeader(frameOutFP, frameOutStart, frameOutSize, NUMDP);
+		frameQueueInit(&frameOutQ, frameOutSize);
+		pthread_create(&frameOutThread, NULL, frameWriter, NULL);
+	}
+
+	frameStreaming = TRUE;
+	return TRUE;
+}
+
+/**
+* @brief Load next input frame into data memory.
+* Called before simCore() in each iteration.
+*
+* @return FALSE at end of input stream
+*/
+int frameStreamIn(void)
+{
+	sint *f = (sint *)malloc(sizeof(sint) * (frameInSize ? frameInSize : 1));
+	sint trueMask = { 1, 1, 1, 1 };
+	int ok;
+
+	ok = frameQueueGet(&frameInQ, f);
+	if(ok){
+		InitSimMode = TRUE;		/* written regardless of data path enable */
+		for(int i = 0; i < frameInSize; i++){
+			sWrDataMem(f[i], frameInStart + i, trueMask);
+		}
+		InitSimMode = FALSE;
+	}
+
+	free(f);
+	return ok;
+}
+
+/**
+* @brief Append output region to output stream.
+* Called after simCore() in each iteration.
+*/
+void frameStreamOut(void)
+{
+	sint *f = (sint *)malloc(sizeof(sint) * (frameOutSize ? frameOutSize : 1));
+
+	for(int i = 0; i < frameOutSize; i++){
+		f[i] = sBriefRdDataMem(frameOutStart + i);
+	}
+	frameQueuePut(&frameOutQ, f);
+
+	free(f);
+}
+
+/**
+* @brief Stop reading ahead, drain output frames and close streams.
+* Called from closeSim(), also on run-time error exit.
+*/
+void frameStreamClose(void)
+{
+	if(!frameStreaming) return;
+	frameStreaming = FALSE;
+
+	if(frameInFP){
+		/* wake reader waiting for a free slot; cancel it if blocked reading a pipe */
+		frameQueueFinish(&frameInQ);
+		pthread_cancel(frameInThread);
+		pthread_join(frameInThread, NULL);
+		fclose(frameInFP);
+		free(frameInQ.Buf);
+		frameInFP = NULL;
+	}
+
+	if(frameOutFP){
+		frameQueueFinish(&frameOutQ);
+		pthread_join(frameOutThread, NULL);
+		fclose(frameOutFP);
+		free(frameOutQ.Buf);
+		frameOutFP = NULL;
+	}
+}
@@ -0,0 +1,38 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file framestream.h
+* @brief Header for streaming frame input/output across iterations (-fi/-fo options)
+* @date 2026-10-19
+*/
+
+#ifndef	_FRAMESTREAM_H
+#define	_FRAMESTREAM_H
+
+#include <pthread.h>
+#include "simsupport.h"
+
+#define	FRAME_QDEPTH	8			/**< frames buffered ahead (input) and behind (output) */
+#define	FRAME_ITRMAX	0x7FFFFFFF	/**< ItrMax with -fi and no -l: until end of input */
+
+/**
+* @brief Bounded queue of frames between simulator and an I/O thread.
+*/
+typedef struct sFrameQueue {
+	sint	*Buf;			/**< FRAME_QDEPTH frames of Words addresses */
+	int		Words;			/**< addresses per frame */
+	int		Head;			/**< next frame to take */
+	int		Count;			/**< frames in queue */
+	int		Done;			/**< no more frames will be put */
+	pthread_mutex_t	Lock;
+	pthread_cond_t	NotEmpty;
+	pthread_cond_t	NotFull;
+} sFrameQueue;
+
+int frameStreamOpen(void);
+int frameStreamIn(void);
+void frameStreamOut(void);
+void frameStreamClose(void);
+
+#endif	/* _FRAMESTREAM_H */
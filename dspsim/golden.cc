@@ -0,0 +1,217 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file golden.cc
+* @brief Streaming golden-reference comparison (-gold option)
+*
+* The output region is compared with the next frame of a golden stream
+* after every iteration, while the simulation runs. The golden stream has
+* the frame format of -fi: decimal text, one address per line with one
+* value per lane, or a .dmi header followed by frames (see dmimage.h).
+*
+* Tolerance is "exact", "lsb=N" (every value within N LSB) or "snr=dB"
+* (signal-to-error ratio of the whole frame at least dB). The first
+* failing iteration is reported with its address; with stop set the
+* caller ends the simulation right there.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dmimage.h"
+#include "golden.h"
+
+#ifndef	TRUE
+#define	TRUE	1
+#endif
+#ifndef	FALSE
+#define	FALSE	0
+#endif
+
+/**
+* @brief Parse tolerance string.
+*
+* @param g Golden stream
+* @param tol "exact", "lsb=N" or "snr=dB"; NULL for exact
+*
+* @return TRUE if valid
+*/
+static int goldenParseTol(sGolden *g, const char *tol)
+{
+	if(!tol || !strcmp(tol, "exact")){
+		g->Tol = GOLD_EXACT;
+	}else if(!strncmp(tol, "lsb=", 4)){
+		g->Tol = GOLD_LSB;
+		g->Lsb = atoi(tol + 4);
+	}else if(!strncmp(tol, "snr=", 4)){
+		g->Tol = GOLD_SNR;
+		g->Snr = atof(tol + 4);
+	}else{
+		return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Start comparing against a golden stream.
+*
+* @param g Golden stream to initialize
+* @param fp Golden stream file
+* @param name Region name for messages
+* @param tol Tolerance string
+* @param start Region start address
+* @param size Addresses per iteration
+* @param lanes Values per address
+* @param fromHeader TRUE: .dmi header sets start and size; FALSE: they must match
+*
+* @return TRUE if success, FALSE on invalid tolerance or header (message printed)
+*/
+int goldenOpen(sGolden *g, FILE *fp, const char *name, const char *tol,
+	unsigned int start, int size, int lanes, int fromHeader)
+{
+	memset(g, 0, sizeof(sGolden));
+	strncpy(g->Name, name, sizeof(g->Name) - 1);
+	g->FP = fp;
+	g->Start = start;
+	g->Size = size;
+	g->Lanes = lanes;
+
+	if(!goldenParseTol(g, tol)){
+		printf("\nError: %s - tolerance must be exact, lsb=N or snr=dB\n", g->Name);
+		return FALSE;
+	}
+
+	if(dmiIsImage(fp)){
+		sDmImage img;
+
+		if(!dmiReadHeader(fp, &img) || (img.Lanes != lanes)
+			|| (!fromHeader && (img.Start != start || (int)img.Size != size))){
+			printf("\nError: %s - golden image header does not match output region\n", g->Name);
+			return FALSE;
+		}
+		g->Binary = TRUE;
+		g->Start = img.Start;
+		g->Size = img.Size;
+		g->Raw = (unsigned char *)malloc((size_t)g->Size * lanes * 2 + 1);
+	}
+
+	g->Ref = (int *)malloc(sizeof(int) * (g->Size * lanes + 1));
+	return TRUE;
+}
+
+/**
+* @brief Read next golden frame into g->Ref.
+*
+* @return FALSE at end of golden stream
+*/
+static int goldenRead(sGolden *g)
+{
+	char tstr[160];
+	char *s;
+
+	if(g->Binary){
+		size_t n = (size_t)g->Size * g->Lanes * 2;
+
+		if(fread(g->Raw, 1, n, g->FP) != n) return FALSE;
+		for(int k = 0; k < g->Size * g->Lanes; k++){
+			g->Ref[k] = (short)(g->Raw[2*k] | (g->Raw[2*k+1] << 8));
+		}
+		return TRUE;
+	}
+
+	for(int i = 0; i < g->Size; i++){
+		do {
+			if(!fgets(tstr, sizeof(tstr), g->FP)) return FALSE;
+		} while(tstr[0] == ';');	/* skip comment line */
+
+		s = tstr;
+		for(int j = 0; j < g->Lanes; j++){
+			g->Ref[i * g->Lanes + j] = (int)strtol(s, &s, 10);
+		}
+	}
+	return TRUE;
+}
+
+/**
+* @brief Compare one iteration's output with next golden frame.
+*
+* @param g Golden stream
+* @param itr Iteration number (from 1)
+* @param out Size * Lanes output values, signed
+*
+* @return FALSE if this iteration failed and g->Stop is set
+*/
+int goldenCompare(sGolden *g, int itr, int *out)
+{
+	int n = g->Size * g->Lanes;
+	int bad = -1;
+	double ps = 0.0, pe = 0.0, snr = 0.0;
+
+	if(g->Ended) return TRUE;
+	if(!goldenRead(g)){
+		g->Ended = TRUE;
+		printf("Golden: %s - golden stream ended after %d iterations\n", g->Name, g->Checked);
+		return TRUE;
+	}
+	g->Checked++;
+
+	for(int k = 0; k < n; k++){
+		int d = out[k] - g->Ref[k];
+		int ad = (d < 0) ? -d : d;
+
+		if(g->Tol == GOLD_SNR){
+			ps += (double)g->Ref[k] * g->Ref[k];
+			pe += (double)d * d;
+			if(ad && (bad < 0 || ad > abs(out[bad] - g->Ref[bad]))) bad = k;	/* worst value */
+		}else if(ad > ((g->Tol == GOLD_LSB) ? g->Lsb : 0)){
+			bad = k;
+			break;
+		}
+	}
+
+	if(g->Tol == GOLD_SNR){
+		if(pe == 0.0) return TRUE;
+		snr = (ps > 0.0) ? 10.0 * log10(ps / pe) : -HUGE_VAL;
+		if(snr >= g->Snr) return TRUE;
+	}else if(bad < 0){
+		return TRUE;
+	}
+
+	g->Failed++;
+	if(g->Failed == 1 || g->Stop){
+		printf("\nGolden: %s - iteration %d failed", g->Name, itr);
+		if(g->Tol == GOLD_SNR) printf(" (SNR %.2f dB < %.2f dB)", snr, g->Snr);
+		printf(" at addr 0x%04X lane %d: got %d, expected %d\n",
+			g->Start + bad / g->Lanes, bad % g->Lanes, out[bad], g->Ref[bad]);
+	}
+	return !g->Stop;
+}
+
+/**
+* @brief Print summary of comparison.
+*
+* @param g Golden stream
+*/
+void goldenReport(sGolden *g)
+{
+	printf("Golden: %s - %d iterations compared, %d failed\n", g->Name, g->Checked, g->Failed);
+}
+
+/**
+* @brief Close golden stream and free buffers.
+*
+* @param g Golden stream
+*/
+void goldenClose(sGolden *g)
+{
+	if(g->FP) fclose(g->FP);
+	if(g->Ref) free(g->Ref);
+	if(g->Raw) free(g->Raw);
+	g->FP = NULL;
+	g->Ref = NULL;
+	g->Raw = NULL;
+}
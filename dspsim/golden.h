@@ -0,0 +1,52 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file golden.h
+* @brief Header for streaming golden-reference comparison (-gold option)
+* @date 2026-10-19
+*/
+
+#ifndef	_GOLDEN_H
+#define	_GOLDEN_H
+
+#include <stdio.h>
+
+/**
+* @brief Comparison tolerance
+*/
+enum eGoldTol {
+	GOLD_EXACT,		/**< all values equal */
+	GOLD_LSB,		/**< |output - golden| <= Lsb for every value */
+	GOLD_SNR,		/**< SNR of output against golden >= Snr (dB) per iteration */
+};
+
+/**
+* @brief One golden stream compared with one output region every iteration.
+* Values are signed 12-bit, Size addresses of Lanes values per iteration.
+*/
+typedef struct sGolden {
+	char	Name[80];		/**< region name for messages */
+	FILE	*FP;			/**< golden stream: decimal text or .dmi header + frames */
+	int		Binary;			/**< TRUE if .dmi stream */
+	unsigned int	Start;	/**< region start address */
+	int		Size;			/**< addresses per iteration */
+	int		Lanes;			/**< values per address */
+	int		Tol;			/**< enum eGoldTol */
+	int		Lsb;			/**< GOLD_LSB tolerance */
+	double	Snr;			/**< GOLD_SNR threshold (dB) */
+	int		Stop;			/**< TRUE: stop at first failing iteration */
+	int		*Ref;			/**< golden values of current iteration */
+	unsigned char	*Raw;	/**< binary frame buffer */
+	int		Ended;			/**< golden stream ended */
+	int		Checked;		/**< iterations compared */
+	int		Failed;			/**< iterations failed */
+} sGolden;
+
+int goldenOpen(sGolden *g, FILE *fp, const char *name, const char *tol,
+	unsigned int start, int size, int lanes, int fromHeader);
+int goldenCompare(sGolden *g, int itr, int *out);
+void goldenReport(sGolden *g);
+void goldenClose(sGolden *g);
+
+#endif	/* _GOLDEN_H */
@@ -21,13 +21,23 @@ All Rights Reserved.
 #include "symtab.h"	
 #include "simsupport.h"
 #include "dspdef.h"
+#include "arena.h"
+
+char *sICodeNoOperand[OPERAND_SLOTS];	/* shared, all NULL */
 
 int bitPos;		/* for use in bitwrite() and sICodeBinDump() */
+static unsigned int binWord;			/* instruction word being built by bitwrite() */
+static unsigned int binLine, binPMA;	/* line & address of its first field */
+static int binType;						/* eType of the word, fixed by its first field */
+static int binField, binFieldBits;		/* current field index & its bits written so far */
+static unsigned int binFieldVal;		/* current field value so far */
 int relAddr, relPos, relBitWidth;	/* for use with t03a, t03c, t03d, t03e 
 									   in sICodeBinDump() */
 
 /** 
-* @brief Allocate a node dynamically.
+* @brief Allocate a node from the program arena.
+* Source-level part goes to the cold part of the arena; operand vector 
+* is allocated by the first operand (see addOperand()).
 * 
 * @param i Opcode index for new node
 * @param a Program Memory Address for new node
@@ -37,14 +47,29 @@ int relAddr, relPos, relBitWidth;	/* for use with t03a, t03c, t03d, t03e
 sICode *sICodeGetNode(unsigned int i, unsigned int a)
 {
 	sICode *p;
-	p = (sICode *)calloc(1, sizeof(sICode));
+	p = (sICode *)arenaAlloc(curArena, sizeof(sICode));
 	assert(p != NULL);
 	p->Index = i;
 	p->PMA = a;
+	p->Operand = sICodeNoOperand;
+	p->Src = (sICodeSrc *)arenaAllocCold(curArena, sizeof(sICodeSrc));
 
 	return p;
 }
 
+/** 
+* @brief Number of entries in operand vector of an instruction.
+* 
+* @param p Pointer to instruction
+* 
+* @return OPERAND_SLOTS or OPERAND_SLOTSMAX
+*/
+int sICodeOperandSlots(sICode *p)
+{
+	if(p->OperandCounter > OPERAND_SLOTS-2) return OPERAND_SLOTSMAX;
+	return OPERAND_SLOTS;
+}
+
 /** 
 * Check for data duplication and add new node to the END(LastNode) of the list.
 * * Note: Before adding first node (empty list), FirstNode MUST be NULL.
@@ -166,43 +191,7 @@ void sICodeListRemoveAfter(sICodeList *list, sICode *p)
 			if(obsoleteNode->Next == NULL){	/* if it is LastNode */
 				list->LastNode = p;		/* update LastNode */
 			}
-			/* free node */
-			if(obsoleteNode->Line) free(obsoleteNode->Line);
-			if(obsoleteNode->Comment) free(obsoleteNode->Comment);
-			if(obsoleteNode->Cond) free(obsoleteNode->Cond);
-			if(obsoleteNode->OperandCounter){
-				for(int i = 0; i < obsoleteNode->OperandCounter; i++){
-					free(obsoleteNode->Operand[i]);
-				}
-			}
-
-			if(obsoleteNode->Multi[0]) {
-				sICode *nm1 = obsoleteNode->Multi[0];
-				if(nm1->Line) free(nm1->Line);
-				if(nm1->Comment) free(nm1->Comment);
-				if(nm1->Cond) free(nm1->Cond);
-				if(nm1->OperandCounter){
-					for(int i = 0; i < nm1->OperandCounter; i++){
-						free(nm1->Operand[i]);
-					}
-				}
-				free(obsoleteNode->Multi[0]);
-			}
-
-			if(obsoleteNode->Multi[1]) {
-				sICode *nm1 = obsoleteNode->Multi[1];
-				if(nm1->Line) free(nm1->Line);
-				if(nm1->Comment) free(nm1->Comment);
-				if(nm1->Cond) free(nm1->Cond);
-				if(nm1->OperandCounter){
-					for(int i = 0; i < nm1->OperandCounter; i++){
-						free(nm1->Operand[i]);
-					}
-				}
-				free(obsoleteNode->Multi[1]);
-			}
-
-			free(obsoleteNode);
+			/* node and its strings stay in program arena until arenaFree() */
 		}
 	}
 }
@@ -218,47 +207,10 @@ sICode *sICodeListRemoveBeginning(sICodeList *list)
 {
 	if(list != NULL){
 		if(list->FirstNode != NULL){
-			sICode *obsoleteNode = list->FirstNode;
 			list->FirstNode = list->FirstNode->Next;
 			if(list->FirstNode == NULL) list->LastNode = NULL; /* removed last node */
 
-			/* free node */
-			if(obsoleteNode->Line) free(obsoleteNode->Line);
-			if(obsoleteNode->Comment) free(obsoleteNode->Comment);
-			if(obsoleteNode->Cond) free(obsoleteNode->Cond);
-			if(obsoleteNode->OperandCounter){
-				for(int i = 0; i < obsoleteNode->OperandCounter; i++){
-					free(obsoleteNode->Operand[i]);
-				}
-			}
-
-			if(obsoleteNode->Multi[0]) {
-				sICode *nm1 = obsoleteNode->Multi[0];
-				if(nm1->Line) free(nm1->Line);
-				if(nm1->Comment) free(nm1->Comment);
-				if(nm1->Cond) free(nm1->Cond);
-				if(nm1->OperandCounter){
-					for(int i = 0; i < nm1->OperandCounter; i++){
-						free(nm1->Operand[i]);
-					}
-				}
-				free(obsoleteNode->Multi[0]);
-			}
-
-			if(obsoleteNode->Multi[1]) {
-				sICode *nm1 = obsoleteNode->Multi[1];
-				if(nm1->Line) free(nm1->Line);
-				if(nm1->Comment) free(nm1->Comment);
-				if(nm1->Cond) free(nm1->Cond);
-				if(nm1->OperandCounter){
-					for(int i = 0; i < nm1->OperandCounter; i++){
-						free(nm1->Operand[i]);
-					}
-				}
-				free(obsoleteNode->Multi[1]);
-			}
-			free(obsoleteNode);
-			
+			/* node and its strings stay in program arena until arenaFree() */
 			return list->FirstNode;	/* return new FirstNode */
 		} else {
 			return NULL;
@@ -268,14 +220,14 @@ sICode *sICodeListRemoveBeginning(sICodeList *list)
 
 /** 
 * @brief Remove all nodes in the list.
+* * Note: Nodes are freed with the program arena (arenaFree()). 
 * 
 * @param list Pointer to linked list
 */
 void sICodeListRemoveAll(sICodeList *list)
 {
-	while(list->FirstNode != NULL){
-		sICodeListRemoveBeginning(list);
-	}
+	list->FirstNode = NULL;
+	list->LastNode = NULL;
 }
 
 /** 
@@ -292,7 +244,7 @@ sICode *sICodeListSearch(sICodeList *list, unsigned int a)
 
 	while(n != NULL) {
 		if(n->PMA == a && n->Index != iCOMMENT){	/** ignore comment-only line */
-			if(n->Sec != NULL && n->Sec->Type == tCODE){
+			if(n->Src->Sec != NULL && n->Src->Sec->Type == tCODE){
 				/* modified for .CODE segment only checking */
 				/* match found */
 				return n;
@@ -339,11 +291,11 @@ void sICodeListPrint(sICodeList *list)
 
 		/* do not print PMA if comment */
 		if(!isNotRealInst(n->Index) || (n->Index == i_VAR))	{
-			if(n->Sec){
-				if(n->Sec->Type == tCODE)
+			if(n->Src->Sec){
+				if(n->Src->Sec->Type == tCODE)
 					sprintf(sAddr, "%04X", n->PMA);
 				else	
-					sprintf(sAddr, "%04X", n->DMA);
+					sprintf(sAddr, "%04X", n->Src->DMA);
 			}else{
 				sprintf(sAddr, "%04X", n->PMA);
 			}
@@ -397,8 +349,8 @@ void sICodeListPrint(sICodeList *list)
 
 		/* do not print Section if pseudo(except .VAR) or comment or label instruction */
 		if(!isNotRealInst(n->Index) || (n->Index == i_VAR))	{
-			if(n->Sec)
-				sprintf(sSecType, "%s", n->Sec->Name);
+			if(n->Src->Sec)
+				sprintf(sSecType, "%s", n->Src->Sec->Name);
 			else
 				strcpy(sSecType, "----");
 		} else 
@@ -422,8 +374,8 @@ void sICodeListPrint(sICodeList *list)
 			}
 			if(n->Conj) fprintf(dumpLstFP, " *");
 			if(n->Cond) fprintf(dumpLstFP, " IF-%s", n->Cond);
-			if(n->Label){
-				fprintf(dumpLstFP, " [%s]", n->Label->Name);
+			if(n->Src->Label){
+				fprintf(dumpLstFP, " [%s]", n->Src->Label->Name);
 			}
 
 			if(n->MultiCounter){
@@ -445,13 +397,13 @@ void sICodeListPrint(sICodeList *list)
 
 		/* Input text line */
 		if(n->Index != iCOMMENT){
-			if(n->Line){
+			if(n->Src->Line){
 				if(!VerboseMode) fprintf(dumpLstFP, "\t");
-				fprintf(dumpLstFP, "%s\n", n->Line);
+				fprintf(dumpLstFP, "%s\n", n->Src->Line);
 			}
 		}else{		/* comment */
 			if(!VerboseMode) fprintf(dumpLstFP, "\t");
-			fprintf(dumpLstFP, "%s\n", n->Comment);
+			fprintf(dumpLstFP, "%s\n", n->Src->Comment);
 		}
 		if(VerboseMode) fprintf(dumpLstFP, "\n");
 
@@ -544,55 +496,55 @@ void sICodeBinDump(sICodeList *list)
 					case t09c:
 						/* write opcode: 7b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AF: 4b */
 						getCodeAF(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12 or 0): 5b */
 						if(!p->Operand[2]){		/* iNOT, iABS, iINC, iDEC */
 							strcpy(str, "00000");
-							bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						} else {
 							getCodeXOP12(str, p->Operand[2]);
-							bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						}
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t09e:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AF: 4b */
 						getCodeAF(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT4/IMM_UINT4): 4b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 4);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 4);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t09i:
 						/* write opcode: 7b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AF: 4b */
 						getCodeAF(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write YZ: 1b */
 						if(p->Index == iCLRBIT){	
 							/* because CLRBIT is same as bit ANDing with 0 */
@@ -600,56 +552,56 @@ void sICodeBinDump(sICodeList *list)
 						} else {
 							strcpy(str, "0"); /* yz = 0; */
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT4/IMM_UINT4): 4b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 4);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 4);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t09g:
 						/* write opcode: 13b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AMF: 5b */
 						getCodeAMF(str, p);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (ACC32): 3b */
 						getCodeACC32(str, p->Operand[1]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (ACC32): 3b */
 						getCodeACC32(str, p->Operand[2]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t46a:
 						/* write opcode: 11b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -671,122 +623,122 @@ void sICodeBinDump(sICodeList *list)
 					case t09d:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AF: 4b */
 						getCodeAF(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (XOP24 or (0,0)): 4b */
 						if(!p->Operand[2]){		/* iNOT_C, iABS_C */
 							strcpy(str, "0000");
-							bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						} else {
 							getCodeXOP24(str, p->Operand[2]);
-							bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						}
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t09f:
 						/* write opcode: 5b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AF: 4b */
 						getCodeAF(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_COMPLEX8): 8b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 4);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[3]), 4);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 4);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[3]), 4);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t09h:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AMF: 5b */
 						getCodeAMF(str, p);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (ACC64): 2b */
 						getCodeACC64(str, p->Operand[1]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (ACC64): 2b */
 						getCodeACC64(str, p->Operand[2]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t46b:
 						/* write opcode: 13b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[2]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t50a:
 						/* write opcode: 12b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CW: 1b */
 						if(p->Index == iRCW_C){	
 							strcpy(str, "1"); /* RCW.C : CW = 1; */
 						} else {
 							strcpy(str, "0"); /* RCCW.C: CW = 0; */
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -800,25 +752,25 @@ void sICodeBinDump(sICodeList *list)
 					case t40e:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AMF: 5b */
 						getCodeAMF(str, p);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12 or 0): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write MN: 1b */
 						getCodeMN(str, p->Operand[0]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -835,54 +787,54 @@ void sICodeBinDump(sICodeList *list)
 					case t40f:
 						/* write opcode: 10b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AMF: 5b */
 						getCodeAMF(str, p);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP24): 4b */
 						getCodeXOP24(str, p->Operand[2]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write MN: 1b */
 						getCodeMN(str, p->Operand[0]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t40g:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write AMF: 5b */
 						getCodeAMF(str, p);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP24): 4b */
 						getCodeXOP24(str, p->Operand[2]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write MN: 1b */
 						getCodeMN(str, p->Operand[0]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -900,63 +852,63 @@ void sICodeBinDump(sICodeList *list)
 					case t41c:
 						/* write opcode: 24b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t41b:
 						/* write opcode: 24b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t41d:
 						/* write opcode: 25b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t25a:
 						/* write opcode: 24b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t25b:
 						/* write opcode: 24b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -973,119 +925,119 @@ void sICodeBinDump(sICodeList *list)
 					case t16a:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t16c:
 						/* write opcode: 11b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[2], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t16e:
 						/* write opcode: 6b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15a:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT5): 5b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15c:
 						/* write opcode: 10b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (ACC32): 3b */
 						getCodeACC32(str, p->Operand[1]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT6): 6b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 6);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 6);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15e:
 						/* write opcode: 6b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP12): 5b */
 						getCodeXOP12(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT5): 5b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1102,119 +1054,119 @@ void sICodeBinDump(sICodeList *list)
 					case t16b:
 						/* write opcode: 11b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12 or 0): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t16d:
 						/* write opcode: 13b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[2], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t16f:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (YOP12 or 0): 5b */
 						getCodeXOP12(str, p->Operand[2]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15b:
 						/* write opcode: 11b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT5): 5b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15d:
 						/* write opcode: 12b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (ACC64): 2b */
 						getCodeACC64(str, p->Operand[1]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT6): 6b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 6);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 6);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t15f:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SF: 5b */
 						getCodeSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC2 (IMM_INT5): 5b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1228,153 +1180,153 @@ void sICodeBinDump(sICodeList *list)
 					case t03f:
 						/* write opcode: 5b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						if(p->Index == iST){	/* iST */
 							getCodeDReg12(str, p->Operand[2]);
 						} else {				/* iLD */
 							getCodeDReg12(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_UINT16): 16b */
 						if(p->Index == iST){	/* iST */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[0]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[0]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						} else {				/* iLD */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						}
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t03d:
 					case t03h:
 						/* write opcode: 7b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						if(p->Index == iST){	/* iST */
 							getCodeACC32(str, p->Operand[2]);
 						} else {				/* iLD */
 							getCodeACC32(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_UINT16): 16b */
 						if(p->Index == iST){	/* iST */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[0]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[0]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						} else {				/* iLD */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						}
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write LSF: 1b */
 						getCodeLSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t06a:	/* iLD only */
 						/* write opcode: 5b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (RREG16): 6b */
 						getCodeRReg16(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_INT16): 16b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 						relPos = bitPos;
 						relBitWidth = 16;
 						int2bin(str, relAddr, 16);
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t06b:	/* iLD only */
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_INT12): 12b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 						relPos = bitPos;
 						relBitWidth = 12;
 						int2bin(str, relAddr, 12);
-						bitwrite(p, str, 12, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 12, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t06d:	/* iLD only */
 						/* write opcode: 5b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_INT24): 24b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 						relPos = bitPos;
 						relBitWidth = 24;
 						int2bin(str, relAddr, 24);
-						bitwrite(p, str, 24, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 24, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t32a:
 					case t32c:
 						/* write opcode: 14b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						if(p->Index == iST){	/* iST */
 							getCodeDReg12(str, p->Operand[4]);
 						} else {				/* iLD */
 							getCodeDReg12(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 						if(p->Index == iST){	/* iST */
 							getCodeU(str, p->Operand[0]);
 						} else {				/* iLD */
 							getCodeU(str, p->Operand[1]);
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMM: 3b */
 						if(p->Index == iST){	/* iST */
 							getCodeMReg3b(str, p->Operand[2]);
 						} else {				/* iLD */
 							getCodeMReg3b(str, p->Operand[3]);
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						if(p->Index == iST){	/* iST */
 							getCodeIReg3b(str, p->Operand[1]);
 						} else {				/* iLD */
 							getCodeIReg3b(str, p->Operand[2]);
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t29a:
 					case t29c:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG12): 6b */
 						if(p->Index == iST){	/* iST */
 							if(p->Operand[3]){	/* ST DM(IREG +/+= <IMM_INT8>), DREG12 */
@@ -1389,22 +1341,22 @@ void sICodeBinDump(sICodeList *list)
 								getCodeDReg12(str, p->Operand[0]);
 							}
 						}
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_INT8): 8b */
 						if(p->Index == iST){	/* iST */
 							if(p->Operand[3]){	/* ST DM(IREG +/+= <IMM_INT8>), DREG12 */
-								int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 8);
+								int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 8);
 							}else{				/* ST DM(IREG), DREG12 */
 								int2bin(str, 0, 8);
 							}
 						} else {				/* iLD */
 							if(p->Operand[3]){	/* LD DREG12, DM(IREG +/+= <IMM_INT8>) */
-								int2bin(str, getIntSymAddr(p, symTable, p->Operand[3]), 8);
+								int2bin(str, getIntSymAddr(p, &symTable, p->Operand[3]), 8);
 							}else{				/* LD DREG12, DM(IREG) */
 								int2bin(str, 0, 8);
 							}
 						}
-						bitwrite(p, str, 8, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 8, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 						if(p->Index == iST){	/* iST */
 							if(p->Operand[3]){	/* ST DM(IREG +/+= <IMM_INT8>), DREG12 */
@@ -1419,10 +1371,10 @@ void sICodeBinDump(sICodeList *list)
 								strcpy(str, "0");
 							}
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						if(p->Index == iST){	/* iST */
 							if(p->Operand[3]){	/* ST DM(IREG +/+= <IMM_INT8>), DREG12 */
@@ -1437,27 +1389,27 @@ void sICodeBinDump(sICodeList *list)
 								getCodeIReg3b(str, p->Operand[1]);
 							}
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t22a:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (IMM_INT12): 12b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[4]), 12);
-						bitwrite(p, str, 12, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[4]), 12);
+						bitwrite(p, str, 12, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 						getCodeU(str, p->Operand[0]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMM: 3b */
 						getCodeMReg3b(str, p->Operand[2]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						getCodeIReg3b(str, p->Operand[1]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1471,118 +1423,118 @@ void sICodeBinDump(sICodeList *list)
 					case t03g:
 						/* write opcode: 6b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						if(p->Index == iST_C){	/* iST */
 							getCodeDReg24(str, p->Operand[2]);
 						} else {				/* iLD_C */
 							getCodeDReg24(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_UINT16): 16b */
 						if(p->Index == iST_C){	/* iST */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[0]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[0]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						} else {				/* iLD_C */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						}
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t03e:
 					case t03i:
 						/* write opcode: 8b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (ACC64): 2b */
 						if(p->Index == iST_C){	/* iST_C */
 							getCodeACC64(str, p->Operand[2]);
 						} else {				/* iLD_C */
 							getCodeACC64(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_UINT16): 16b */
 						if(p->Index == iST_C){	/* iST_C */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[0]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[0]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						} else {				/* iLD_C */
-							relAddr = getIntSymAddr(p, symTable, p->Operand[1]);
+							relAddr = getIntSymAddr(p, &symTable, p->Operand[1]);
 							relPos = bitPos;
 							relBitWidth = 16;
 							int2bin(str, relAddr, 16);
 						}
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write LSF: 1b */
 						getCodeLSF(str, p->Operand[3], p->Index);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t06c:	/* iLD_C only */
 						/* write opcode: 3b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DRE24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_COMPLEX24): 24b */
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[1]), 12);
-						bitwrite(p, str, 12, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
-						int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 12);
-						bitwrite(p, str, 12, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[1]), 12);
+						bitwrite(p, str, 12, dumpBinFP, dumpTxtFP, dumpMemFP);
+						int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 12);
+						bitwrite(p, str, 12, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t32b:
 					case t32d:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (CREG): 5b */
 						if(p->Index == iST_C){	/* iST_C */
 							getCodeCReg(str, p->Operand[4]);
 						} else {				/* iLD_C */
 							getCodeCReg(str, p->Operand[0]);
 						}
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 						if(p->Index == iST_C){	/* iST_C */
 							getCodeU(str, p->Operand[0]);
 						} else {				/* iLD_C */
 							getCodeU(str, p->Operand[1]);
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMM: 3b */
 						if(p->Index == iST_C){	/* iST_C */
 							getCodeMReg3b(str, p->Operand[2]);
 						} else {				/* iLD_C */
 							getCodeMReg3b(str, p->Operand[3]);
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						if(p->Index == iST_C){	/* iST_C */
 							getCodeIReg3b(str, p->Operand[1]);
 						} else {				/* iLD_C */
 							getCodeIReg3b(str, p->Operand[2]);
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t29b:
 					case t29d:
 						/* write opcode: 10b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						if(p->Index == iST_C){	/* iST_C */
 							if(p->Operand[3]){	/* ST.C DM(IREG +/+= <IMM_INT8>), DREG24 */
@@ -1597,22 +1549,22 @@ void sICodeBinDump(sICodeList *list)
 								getCodeDReg24(str, p->Operand[0]);
 							}
 						}
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (IMM_INT8): 8b */
 						if(p->Index == iST_C){	/* iST_C */
 							if(p->Operand[3]){	/* ST.C DM(IREG +/+= <IMM_INT8>), DREG24 */
-								int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 8);
+								int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 8);
 							}else{				/* ST.C DM(IREG), DREG24 */
 								int2bin(str, 0, 8);
 							}
 						} else {				/* iLD_C */
 							if(p->Operand[3]){	/* LD.C DREG24, DM(IREG +/+= <IMM_INT8>) */
-								int2bin(str, getIntSymAddr(p, symTable, p->Operand[3]), 8);
+								int2bin(str, getIntSymAddr(p, &symTable, p->Operand[3]), 8);
 							}else{				/* LD.C DREG24, DM(IREG) */
 								int2bin(str, 0, 8);
 							}
 						}
-						bitwrite(p, str, 8, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 8, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 						if(p->Index == iST_C){	/* iST_C */
 							if(p->Operand[3]){	/* ST.C DM(IREG +/+= <IMM_INT8>), DREG24 */
@@ -1627,10 +1579,10 @@ void sICodeBinDump(sICodeList *list)
 								strcpy(str, "0");
 							}
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						if(p->Index == iST_C){	/* iST_C */
 							if(p->Operand[3]){	/* ST.C DM(IREG +/+= <IMM_INT8>), DREG24 */
@@ -1645,7 +1597,7 @@ void sICodeBinDump(sICodeList *list)
 								getCodeIReg3b(str, p->Operand[1]);
 							}
 						}
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1658,138 +1610,138 @@ void sICodeBinDump(sICodeList *list)
 					case t17a:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[1]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17b:
 						/* write opcode: 14b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						if(isDReg12(p, p->Operand[0]) && isRReg16(p, p->Operand[1])){
 							/* write DSTLS (DREG12): 6b */
 							getCodeDReg12(str, p->Operand[0]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 							/* write SRCLS (RREG16): 6b */
 							getCodeRReg16(str, p->Operand[1]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						} else if(isRReg16(p, p->Operand[0]) && isDReg12(p, p->Operand[1])){
 							/* write SRCLS (DREG12): 6b */
 							getCodeDReg12(str, p->Operand[1]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 							/* write DSTLS (RREG16): 6b */
 							getCodeRReg16(str, p->Operand[0]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						}
 						/* write DC: 1b */
 						getCodeDC(p, str, p->Operand[0], p->Operand[1]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17c:
 						/* write opcode: 21b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (ACC32): 3b */
 						getCodeACC32(str, p->Operand[1]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17d:
 						/* write opcode: 17b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17e:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						if(isDReg24(p, p->Operand[0]) && isRReg16(p, p->Operand[1])){
 							/* write DSTLS (DREG24): 5b */
 							getCodeDReg24(str, p->Operand[0]);
-							bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 							/* write SRCLS (RREG16): 6b */
 							getCodeRReg16(str, p->Operand[1]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						} else if(isRReg16(p, p->Operand[0]) && isDReg24(p, p->Operand[1])){
 							/* write SRCLS (DREG24): 5b */
 							getCodeDReg24(str, p->Operand[1]);
-							bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 							/* write DSTLS (RREG16): 6b */
 							getCodeRReg16(str, p->Operand[0]);
-							bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						}
 						/* write DC: 1b */
 						getCodeDC(p, str, p->Operand[0], p->Operand[1]);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17f:
 						/* write opcode: 23b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (ACC64): 2b */
 						getCodeACC64(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (ACC64): 2b */
 						getCodeACC64(str, p->Operand[1]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17g:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (RREG16): 6b */
 						getCodeRReg16(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (RREG16): 6b */
 						getCodeRReg16(str, p->Operand[1]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t17h:
 						/* write opcode: 18b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (ACC32): 3b */
 						getCodeACC32(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[1]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1804,82 +1756,82 @@ void sICodeBinDump(sICodeList *list)
 					case t49a:
 						/* write opcode: 16b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (XREG12): 3b */
 						getCodeXReg12(str, p->Operand[1]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDR (IMM_UINT2): 2b */		
-                        int2bin(str, 0x03 & getIntSymAddr(p, symTable, p->Operand[2]), 2);
-                        bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x03 & getIntSymAddr(p, &symTable, p->Operand[2]), 2);
+                        bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDN (IMM_UINT4): 4b */		
-                        int2bin(str, 0x0F & getIntSymAddr(p, symTable, p->Operand[3]), 4);
-                        bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x0F & getIntSymAddr(p, &symTable, p->Operand[3]), 4);
+                        bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t49b:
 						/* write opcode: 18b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (XREG24): 2b */
 						getCodeXReg24(str, p->Operand[1]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDR (IMM_UINT2): 2b */		
-                        int2bin(str, 0x03 & getIntSymAddr(p, symTable, p->Operand[2]), 2);
-                        bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x03 & getIntSymAddr(p, &symTable, p->Operand[2]), 2);
+                        bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDN (IMM_UINT4): 4b */		
-                        int2bin(str, 0x0F & getIntSymAddr(p, symTable, p->Operand[3]), 4);
-                        bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x0F & getIntSymAddr(p, &symTable, p->Operand[3]), 4);
+                        bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t49c:
 						/* write opcode: 16b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (XREG12): 3b */
 						getCodeXReg12(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[1]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDR (IMM_UINT2): 2b */		
-                        int2bin(str, 0x03 & getIntSymAddr(p, symTable, p->Operand[2]), 2);
-                        bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x03 & getIntSymAddr(p, &symTable, p->Operand[2]), 2);
+                        bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDN (IMM_UINT4): 4b */		
-                        int2bin(str, 0x0F & getIntSymAddr(p, symTable, p->Operand[3]), 4);
-                        bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x0F & getIntSymAddr(p, &symTable, p->Operand[3]), 4);
+                        bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t49d:
 						/* write opcode: 18b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTLS (XREG24): 2b */
 						getCodeXReg24(str, p->Operand[0]);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRCLS (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[1]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDR (IMM_UINT2): 2b */		
-                        int2bin(str, 0x03 & getIntSymAddr(p, symTable, p->Operand[2]), 2);
-                        bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x03 & getIntSymAddr(p, &symTable, p->Operand[2]), 2);
+                        bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDN (IMM_UINT4): 4b */		
-                        int2bin(str, 0x0F & getIntSymAddr(p, symTable, p->Operand[3]), 4);
-                        bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x0F & getIntSymAddr(p, &symTable, p->Operand[3]), 4);
+                        bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1891,16 +1843,16 @@ void sICodeBinDump(sICodeList *list)
 					case t11a:
 						/* write opcode: 16b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write BRDST (IMM_UINT12): 12b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[1]) - p->PMA;
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[1]) - p->PMA;
 						relPos = bitPos;
 						relBitWidth = 12;
 						int2bin(str, relAddr, 12);
-						bitwrite(p, str, 12, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 12, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write TERM: 4b */
 						getCodeTERM(str, p->Operand[0]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1913,59 +1865,59 @@ void sICodeBinDump(sICodeList *list)
 					case t10a:
 						/* write opcode: 13b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write BRDST (IMM_INT13): 13b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[0]) - p->PMA;
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[0]) - p->PMA;
 						relPos = bitPos;
 						relBitWidth = 13;
 						int2bin(str, relAddr, 13);
-						bitwrite(p, str, 13, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 13, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write S: 1b */
 						if(p->Index == iCALL){	/* iCALL */
 							strcpy(str, "1");
 						} else {				/* iJUMP */
 							strcpy(str, "0");
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t10b:
 						/* write opcode: 15b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write BRDST (IMM_INT16): 16b */
-						relAddr = getIntSymAddr(p, symTable, p->Operand[0]) - p->PMA;
+						relAddr = getIntSymAddr(p, &symTable, p->Operand[0]) - p->PMA;
 						relPos = bitPos;
 						relBitWidth = 16;
 						int2bin(str, relAddr, 16);
-						bitwrite(p, str, 16, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 16, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write S: 1b */
 						if(p->Index == iCALL){	/* iCALL */
 							strcpy(str, "1");
 						} else {				/* iJUMP */
 							strcpy(str, "0");
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					case t19a:
 						/* write opcode: 23b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write S: 1b */
 						if(p->Index == iCALL){	/* iCALL */
 							strcpy(str, "1");
 						} else {				/* iJUMP */
 							strcpy(str, "0");
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DMI: 3b */
 						getCodeIReg3b(str, p->Operand[0]);
-						bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -1978,17 +1930,17 @@ void sICodeBinDump(sICodeList *list)
 					case t20a:
 						/* write opcode: 26b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write T: 1b */
 						if(p->Index == iRTI){	/* iRTI */
 							strcpy(str, "1");
 						} else {				/* iRTS */
 							strcpy(str, "0");
 						}
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2001,19 +1953,19 @@ void sICodeBinDump(sICodeList *list)
 					case t26a:
 						/* write opcode: 21b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write LPP: 2b */
 						getCodeLPP(str, p->Operand[0], p->Index);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write PPP: 2b */
 						getCodePPP(str, p->Operand[0], p->Index);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SPP: 2b */
 						getCodeSPP(str, p->Operand[0], p->Operand[1], p->Index);
-						bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2025,10 +1977,10 @@ void sICodeBinDump(sICodeList *list)
 					case t30a:
 						/* write opcode: 27b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2041,13 +1993,13 @@ void sICodeBinDump(sICodeList *list)
 					case t18a:
 						/* write opcode: 9b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write ENA: 18b */
 						getCodeENA(str, p);
-						bitwrite(p, str, 18, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 18, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2059,16 +2011,16 @@ void sICodeBinDump(sICodeList *list)
 					case t18b:
 						/* write opcode: 21b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDE: 4b */
 						getCodeIDE(str, p);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write IDM (IMM_UINT2): 2b */		
-                        int2bin(str, 0x03 & getIntSymAddr(p, symTable, p->Operand[0]), 2);
-                        bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x03 & getIntSymAddr(p, &symTable, p->Operand[0]), 2);
+                        bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2080,13 +2032,13 @@ void sICodeBinDump(sICodeList *list)
 					case t18c:
 						/* write opcode: 21b */
 						bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-							bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+							dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DSTID (DREG12): 6b */
 						getCodeDReg12(str, p->Operand[0]);
-						bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						break;
 					default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2098,10 +2050,10 @@ void sICodeBinDump(sICodeList *list)
                     case t31a:
                         /* write opcode: 27b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2114,20 +2066,20 @@ void sICodeBinDump(sICodeList *list)
                     case t37a:
                         /* write opcode: 22b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write INTN (IMM_UINT4): 4b */
-                        int2bin(str, 0x0F & getIntSymAddr(p, symTable, p->Operand[0]), 4);
-                        bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        int2bin(str, 0x0F & getIntSymAddr(p, &symTable, p->Operand[0]), 4);
+                        bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write C: 1b */
                         if(p->Index == iSETINT){    /* SETINT */
                             strcpy(str, "1");
                         } else {                    /* CLRINT */
                             strcpy(str, "0");
                         }
-                        bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2140,26 +2092,26 @@ void sICodeBinDump(sICodeList *list)
                     case t23a:
                         /* write opcode: 11b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write DST (REG12): 5b */
                         getCodeReg12(str, p->Operand[0]);
-                        bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write SRC1 (XOP12): 5b */
                         getCodeXOP12(str, p->Operand[1]);
-                        bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write SRC2 (YOP12): 5b */
                         getCodeXOP12(str, p->Operand[2]);
-                        bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write DF: 1b */
                         if(p->Index == iDIVS){    /* DIVS */
                             strcpy(str, "1");
                         } else {                  /* DIVQ */
                             strcpy(str, "0");
                         }
-                        bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     default:
                         bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2174,57 +2126,57 @@ void sICodeBinDump(sICodeList *list)
                     case t42a:
                         /* write opcode: 16b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
                         /* write POLAR: 1b */
                         if(p->Index == iRECT_C){    /* RECT.C */
                             strcpy(str, "1");
                         } else {                  /* POLAR.C */
                             strcpy(str, "0");
                         }
-                        bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                        bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     case t42b:
                         /* write opcode: 18b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     case t47a:
                         /* write opcode: 17b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write DST (DREG24): 5b */
 						getCodeDReg24(str, p->Operand[0]);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write SRC1 (XOP24): 4b */
 						getCodeXOP24(str, p->Operand[1]);
-						bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write CONJ: 1b */
 						getCodeCONJ(str, p->Conj);
-						bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     default:
                         bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2236,10 +2188,10 @@ void sICodeBinDump(sICodeList *list)
                     case t48a:
                         /* write opcode: 27b */
                         bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width,
-                            bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+                            dumpBinFP, dumpTxtFP, dumpMemFP);
 						/* write COND: 5b */
 						getCodeCOND(str, p->Cond);
-						bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
                         break;
                     default:
                 		bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -2283,809 +2235,809 @@ void sICodeBinDumpMultiFunc(sICode *p)
 				case t01a:		/* LD || LD */
 					/* write opcode: 4b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					strcpy(str, "0000");	/* NOP */
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					strcpy(str, "00");
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					strcpy(str, "000");
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					strcpy(str, "000");
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, p->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U2: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m1->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST3 (YOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMM: 2b */
 					getCodeMReg2b(str, m1->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMI: 2b */
 					getCodeIReg2b(str, m1->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 2b */
 					getCodeMReg2b(str, p->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 2b */
 					getCodeIReg2b(str, p->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t01b:		/* LD.C || LD.C */
 					/* write opcode: 8b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					strcpy(str, "0000");	/* NOP */
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					strcpy(str, "00");
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					strcpy(str, "00");
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					strcpy(str, "00");
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, p->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U2: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m1->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST3 (YOP24S): 2b */
 					getCodeReg24S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMM: 2b */
 					getCodeMReg2b(str, m1->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMI: 2b */
 					getCodeIReg2b(str, m1->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 2b */
 					getCodeMReg2b(str, p->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 2b */
 					getCodeIReg2b(str, p->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t04a:
 				case t04e:
 					/* write opcode: 7b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					getCodeReg12S(str, p->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG/SDREG (DREG12): 6b */
 					if(m1->Index == iST){	/* iST */
 						getCodeDReg12(str, m1->Operand[4]);
 					} else {				/* iLD */
 						getCodeDReg12(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST){	/* iST */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t04b:
 				case t04f:
 					/* write opcode: 10b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					getCodeReg24S(str, p->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG/SDREG (DREG24): 5b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeDReg24(str, m1->Operand[4]);
 					} else {				/* iLD_C */
 						getCodeDReg24(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD_C */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD_C */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD_C */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t04c:
 				case t04g:
 					/* write opcode: 5b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG/SDREG (DREG12): 6b */
 					if(m1->Index == iST){	/* iST */
 						getCodeDReg12(str, m1->Operand[4]);
 					} else {				/* iLD */
 						getCodeDReg12(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST){	/* iST */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t04d:
 				case t04h:
 					/* write opcode: 9b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG24S): 3b */
 					getCodeDReg24S(str, p->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					if(p->Operand[2]){
 						getCodeReg24S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "00");
 					}
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG/SDREG (DREG24): 5b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeDReg24(str, m1->Operand[4]);
 					} else {				/* iLD_C */
 						getCodeDReg24(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD_C */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD_C */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD_C */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t08a:
 					/* write opcode: 8b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					getCodeReg12S(str, p->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[0]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[1]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t08b:
 					/* write opcode: 12b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 1b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					getCodeReg24S(str, p->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[0]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[1]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t08c:
 					/* write opcode: 6b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[0]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[1]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t08d:
 					/* write opcode: 11b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG24S): 3b */
 					getCodeDReg24S(str, p->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					if(p->Operand[2]){
 						getCodeReg24S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "00");
 					}
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[0]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[1]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t12e:
 				case t12g:
 					/* write opcode: 5b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DSTLS/SRCLS (DREG12): 6b */
 					if(m1->Index == iST){	/* iST */
 						getCodeDReg12(str, m1->Operand[4]);
 					} else {				/* iLD */
 						getCodeDReg12(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST){	/* iST */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t12f:
 				case t12h:
 					/* write opcode: 7b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DSTLS/SRCLS (DREG24): 5b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeDReg24(str, m1->Operand[4]);
 					} else {				/* iLD_C */
 						getCodeDReg24(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD_C */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD_C */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD_C */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t12m:
 				case t12o:
 					/* write opcode: 6b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DSTLS/SRCLS (DREG12): 6b */
 					if(m1->Index == iST){	/* iST */
 						getCodeDReg12(str, m1->Operand[4]);
 					} else {				/* iLD */
 						getCodeDReg12(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST){	/* iST */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST){	/* iST */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t12n:
 				case t12p:
 					/* write opcode: 7b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DSTLS/SRCLS (DREG24): 5b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeDReg24(str, m1->Operand[4]);
 					} else {				/* iLD_C */
 						getCodeDReg24(str, m1->Operand[0]);
 					}
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeU(str, m1->Operand[0]);
 					} else {				/* iLD_C */
 						getCodeU(str, m1->Operand[1]);
 					}
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeMReg3b(str, m1->Operand[2]);
 					} else {				/* iLD_C */
 						getCodeMReg3b(str, m1->Operand[3]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 3b */
 					if(m1->Index == iST_C){	/* iST_C */
 						getCodeIReg3b(str, m1->Operand[1]);
 					} else {				/* iLD_C */
 						getCodeIReg3b(str, m1->Operand[2]);
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t14c:
 					/* write opcode: 6b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[0]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[1]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t14d:
 					/* write opcode: 9b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[0]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[1]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t14k:
 					/* write opcode: 7b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[0]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG12): 6b */
 					getCodeDReg12(str, m1->Operand[1]);
-					bitwrite(p, str, 6, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 6, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t14l:
 					/* write opcode: 9b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, p->Operand[3], p->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, p->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, p->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[0]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SDREG (DREG24): 5b */
 					getCodeDReg24(str, m1->Operand[1]);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t43a:
 					/* write opcode: 6b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, m1);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC3 (XOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC4 (YOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t44b:
 					/* write opcode: 4b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, m1->Operand[3], m1->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC3 (XOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC4 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, m1->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, m1->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t44d:
 					/* write opcode: 5b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, m1->Operand[3], m1->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC3 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC4 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, m1->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, m1->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t45b:
 					/* write opcode: 6b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, m1->Operand[3], m1->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					getCodeReg12S(str, p->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC3 (XOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC4 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, m1->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, m1->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t45d:
 					/* write opcode: 7b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SF2: 4b */
 					getCodeSF2(str, m1->Operand[3], m1->Index);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					getCodeReg12S(str, p->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST2 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC3 (ACC32S): 2b */
 					getCodeACC32S(str, m1->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC4 (IMM_INT5): 5b */
-					int2bin(str, getIntSymAddr(p, symTable, m1->Operand[2]), 5);
-					bitwrite(p, str, 5, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					int2bin(str, getIntSymAddr(p, &symTable, m1->Operand[2]), 5);
+					bitwrite(p, str, 5, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				default:
                 	bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -3100,123 +3052,123 @@ void sICodeBinDumpMultiFunc(sICode *p)
 				case t01a:		/* MAC || LD || LD */
 					/* write opcode: 4b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC32S): 2b */
 					getCodeACC32S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					getCodeReg12S(str, p->Operand[2]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m1->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U2: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m2->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DD (XOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PD (YOP12S): 3b */
 					getCodeReg12S(str, m2->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMM: 2b */
 					getCodeMReg2b(str, m2->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMI: 2b */
 					getCodeIReg2b(str, m2->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 2b */
 					getCodeMReg2b(str, m1->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 2b */
 					getCodeIReg2b(str, m1->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t01b:		/* MAC.C || LD.C || LD.C */
 					/* write opcode: 8b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write MF: 4b */
 					getCodeMF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DST1 (ACC64S): 2b */
 					getCodeACC64S(str, p->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP24S): 2b */
 					getCodeReg24S(str, p->Operand[1]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP24S): 2b */
 					getCodeReg24S(str, p->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m1->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write U2: 1b */		/* 0 for premodify, 1 for postmodify */
 					getCodeU(str, m2->Operand[1]);
-					bitwrite(p, str, 1, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 1, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DD (XOP24S): 2b */
 					getCodeReg24S(str, m1->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PD (YOP24S): 2b */
 					getCodeReg24S(str, m2->Operand[0]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMM: 2b */
 					getCodeMReg2b(str, m2->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMI: 2b */
 					getCodeIReg2b(str, m2->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 2b */
 					getCodeMReg2b(str, m1->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 2b */
 					getCodeIReg2b(str, m1->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				case t01c:		/* ALU || LD || LD */
 					/* write opcode: 4b */
 					bitwrite(p, sBinOp[p->InstType].bits, sBinOp[p->InstType].width, 
-						bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+						dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write AF: 4b */
 					getCodeAF(str, p);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DSTA (DREG12S): 4b */
 					getCodeDReg12S(str, p->Operand[0]);
-					bitwrite(p, str, 4, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 4, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC1 (XOP12S): 3b */
 					getCodeReg12S(str, p->Operand[1]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write SRC2 (YOP12S): 3b */
 					if(p->Operand[2]){
 						getCodeReg12S(str, p->Operand[2]);
 					}else{
 						strcpy(str, "000");
 					}
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DD (XOP12S): 3b */
 					getCodeReg12S(str, m1->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PD (YOP12S): 3b */
 					getCodeReg12S(str, m2->Operand[0]);
-					bitwrite(p, str, 3, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 3, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMM: 2b */
 					getCodeMReg2b(str, m2->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write PMI: 2b */
 					getCodeIReg2b(str, m2->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMM: 2b */
 					getCodeMReg2b(str, m1->Operand[3]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					/* write DMI: 2b */
 					getCodeIReg2b(str, m1->Operand[2]);
-					bitwrite(p, str, 2, bytebuf, bitbuf, dumpBinFP, dumpTxtFP, dumpMemFP);
+					bitwrite(p, str, 2, dumpBinFP, dumpTxtFP, dumpMemFP);
 					break;
 				default:
                 	bitwriteError(p, dumpBinFP, dumpTxtFP, dumpMemFP);
@@ -3231,69 +3183,81 @@ void sICodeBinDumpMultiFunc(sICode *p)
 }
 
 /** 
-* @brief Write n bits of binary data to binary and text files.
+* @brief Insert n bits of binary data into the instruction word; write 
+* the completed word to binary, text and mem files.
 * 
 * @param p Pointer to current instruction
 * @param s Bitstream in string format
 * @param n Number of bits to write
-* @param byteb Character array to append input string s, where 1 char is binary 1 bit 
-* @param bitb Character array, where 1 bit is binary 1 bit
 * @param bFP File pointer to binary code dump file 
 * @param tFP File pointer to text code dump file (= object file)
 * @param mFP File pointer to mem code dump file (= .mem file)
 */
-void bitwrite(sICode *p, char *s, int n, char byteb[], char bitb[], FILE *bFP, FILE *tFP, FILE *mFP)
+void bitwrite(sICode *p, char *s, int n, FILE *bFP, FILE *tFP, FILE *mFP)
 {
 	int i;
 	char sMemoryRefType[10];
-
-	if(!bitPos){
-		if(tFP){
-			fprintf(tFP,"%04d %04X: ", p->LineCntr, p->PMA);
-		}
-
-		if(mFP){
-			fprintf(mFP,"%x/ ", p->PMA);
-		}
-	}
-
-	if(bFP){
-		for(i = 0; i < n; i++){
-			byteb[bitPos++] = s[i];
-		}
+	char sbin[INSTLEN+1];
+	unsigned char bitb[INSTLEN/8];
+
+	if(!bitPos){	/* first field: line, address & format of the word */
+		binLine = p->LineCntr;
+		binPMA = p->PMA;
+		binType = p->InstType;
+		binWord = isaOpcode(binType);
+		binField = 0;
+		binFieldBits = 0;
+		binFieldVal = 0;
 	}
 
-	if(tFP){
-		for(i = 0; i < n; i++){
-			fprintf(tFP, "%d", s[i] - '0');
+	/* bits are stored field by field of sInstFormatTable[] with isaSetField();
+	   a field may be written in several pieces (e.g. t06c SRCLS) */
+	for(i = 0; i < n; i++){
+		assert(binField < MAX_FIELD && sInstFormatTable[binType].widths[binField]);
+		binFieldVal = (binFieldVal << 1) | (s[i] == '1');
+		if(++binFieldBits == sInstFormatTable[binType].widths[binField]){
+			binWord = isaSetField(binType, sInstFormatTable[binType].fields[binField], 
+				binWord, binFieldVal);
+			binField++;
+			binFieldBits = 0;
+			binFieldVal = 0;
 		}
 	}
+	bitPos += n;
 
 	if(bitPos == INSTLEN){
-		packbuf(byteb, bitb);
-
-		//fwrite(bitb, sizeof(bitb), 1, bFP);
-		fwrite(bitb, 4, 1, bFP);
-
-		bitPos = 0;	/* reset counter */
+		for(i = 0; i < INSTLEN/8; i++){
+			bitb[i] = (unsigned char)(binWord >> (INSTLEN - 8 - 8*i));
+		}
+		if(bFP) fwrite(bitb, 4, 1, bFP);
 
 		//print .obj
-		fprintf(tFP," %02X %02X %02X %02X", (unsigned char)bitb[0], 
-			(unsigned char)bitb[1], (unsigned char)bitb[2], (unsigned char)bitb[3]);
-		fprintf(tFP,"  %s %-10s", sType[p->InstType], sOp[p->Index]);
+		if(tFP){
+			for(i = 0; i < INSTLEN; i++){
+				sbin[i] = ((binWord >> (INSTLEN - 1 - i)) & 0x1) ? '1' : '0';
+			}
+			sbin[INSTLEN] = '\0';
+			fprintf(tFP,"%04d %04X: %s", binLine, binPMA, sbin);
+			fprintf(tFP," %02X %02X %02X %02X", bitb[0], bitb[1], bitb[2], bitb[3]);
+			fprintf(tFP,"  %s %-10s", sType[p->InstType], sOp[p->Index]);
+
+			sICodeListPrintType(sMemoryRefType, p->MemoryRefType);
+			fprintf(tFP," %s", sMemoryRefType);
+		
+			if(p->MemoryRefType == tREL){
+				fprintf(tFP," %04X %d %d", 0xFFFF & relAddr, relPos, relBitWidth);
+			}
 
-		sICodeListPrintType(sMemoryRefType, p->MemoryRefType);
-		fprintf(tFP," %s", sMemoryRefType);
-	
-		if(p->MemoryRefType == tREL){
-			fprintf(tFP," %04X %d %d", 0xFFFF & relAddr, relPos, relBitWidth);
+			fprintf(tFP,"\n");
 		}
 
-		fprintf(tFP,"\n");
-
 		//print .mem
-		fprintf(mFP,"%02x%02x%02x%02x\n", (unsigned char)bitb[0], (unsigned char)bitb[1], (unsigned char)bitb[2], (unsigned char)bitb[3]);
+		if(mFP){
+			fprintf(mFP,"%x/ %02x%02x%02x%02x\n", binPMA, bitb[0], bitb[1], bitb[2], bitb[3]);
+		}
 
+		bitPos = 0;	/* reset counter */
+		binWord = 0;
 	}else if(bitPos > INSTLEN){
 		assert(bitPos <= INSTLEN);
 	}
@@ -3333,27 +3297,6 @@ void bitwriteError(sICode *p, FILE *bFP, FILE *tFP, FILE *mFP)
 	AssemblerError++;
 }
 
-/** 
-* @brief Pack INSTLEN bytes into INSTLEN bits
-* 
-* @param byteb Input character array, where 1 char is binary 1 bit 
-* @param bitb Output character array, where 1 bit is binary 1 bit
-*/
-void packbuf(char byteb[], char bitb[])
-{
-	int i, j;
-	char c;
-
-	for(i = 0; i < (INSTLEN/8); i++){
-		c = 0;
-		for(j = 0; j < 8; j++){
-			if(byteb[i*8 + j] == '1') c |= 0x1;
-			if(j != 7) c <<= 1;
-		}
-		bitb[i] = c;
-	}
-}
-
 /** 
 * @brief Check if this instruction is one of pseudo instructions
 * 
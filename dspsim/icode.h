@@ -12,6 +12,8 @@ All Rights Reserved.
 #define	_ICODE_H
 
 #define	MAX_OPERAND		10
+#define	OPERAND_SLOTS		8					/**< operand vector entries (up to 6 operands) */
+#define	OPERAND_SLOTSMAX	(MAX_OPERAND+2)		/**< operand vector entries for longer lists */
 #include "symtab.h"		/* for sTab */
 #include "secinfo.h"	/* for sSecInfo */
 
@@ -23,46 +25,53 @@ enum eMemRef {
 };
 
 /** 
-* @brief After parsing, input assembly/binary program is converted to an 
-* intermediate code, sICode. 
+* @brief Source-level part of an instruction: used only for listings,
+* diagnostics and the interactive display, kept apart from sICode.
 */
-typedef struct sICode {
+typedef struct sICodeSrc {
 	sSecInfo *Sec;				/**< segment */
 	char 	*Line;				/**< one line of asm program */
-	unsigned int	LineCntr;	/**< line counter */
-	unsigned int	PMA;		/**< program memory address for .CODE segment */
-	                            /*   PMA is determined at yyparse()           */
 	unsigned int	DMA;		/**< data memory address for .DATA segment */
 	                            /*   DMA is determined at codeScan()       */
-	unsigned int	Index;		/**< opcode index: eOp value */
-	unsigned int	InstType;	/**< opcode type */
-
-	int		MemoryRefType;		/**< if memory reference exits, 
-									is it absolute or relative address?
-									one of tNON, tABS, tREL */
 	int		MemoryRefExtern;	/**< 1 if refers to EXTERN variable */
-
-	char	*Operand[MAX_OPERAND];			/**< operand strings */
-	int		OperandCounter;			/**< number of operands */
 	char	*Comment;				/**< comment */
+	char	*Init;					/**< .VAR initializer: value list or "file" (after '=') */
 	sTab	*Label;					/**< label */
+} sICodeSrc;
+
+/** 
+* @brief After parsing, input assembly/binary program is converted to an 
+* intermediate code, sICode. 
+* Only what the simulator reads while running is kept here; the rest is in Src.
+*/
+typedef struct sICode {
+	unsigned int	Index;		/**< opcode index: eOp value */
+	unsigned int	InstType;	/**< opcode type */
+	unsigned int	PMA;		/**< program memory address for .CODE segment */
+	                            /*   PMA is determined at yyparse()           */
+	unsigned int	LineCntr;	/**< line counter */
+
 	char	*Cond;					/**< condition code (COND) string */
+	char	**Operand;				/**< operand strings: OPERAND_SLOTS entries, 
+										OPERAND_SLOTSMAX if more than OPERAND_SLOTS-2 operands */
+	int		OperandCounter;			/**< number of operands */
 	int		Conj;					/**< complex conjugate modifier (*) */
 
+	int		MemoryRefType;		/**< if memory reference exits, 
+									is it absolute or relative address?
+									one of tNON, tABS, tREL */
 	int		MultiCounter;			/**< 1 if two instructions, 2 if three instructions. */
 	struct sICode *Multi[2];		/**< pointer to next instruction in multifunction inst. */ 
 
-	//int		Data;				
-									/**< PM(Program Memory) data */
-
 	int isDelaySlot;				/**< TRUE if delay slot */
+	int Latency;					/**< latency determined at compile time */
 	struct sICode *BrTarget;		/**< pointer to branch target instruction 
 										- set by previous branch inst., valid only if delay slot is TRUE */
-	int Latency;					/**< latency determined at compile time */
 	int LatencyAdded;				/**< latency added at run-time (if necessary) */
 
 	struct sICode *LastExecuted;	/**< pointer to last instruction (for checking adjenct ld/st stall) */
 	struct sICode *Next;			/**< pointer to next instruction (in memory) */
+	sICodeSrc *Src;					/**< source-level data */
 } sICode;
 
 typedef struct sICodeList {
@@ -94,14 +103,15 @@ void sICodeListPrintType(char *s, int type);
 void sICodeBinDump(sICodeList *list);
 void sICodeBinDumpMultiFunc(sICode *p);
 void iCodeInit(sICodeList *list);
+int sICodeOperandSlots(sICode *p);
 
-void bitwrite(sICode *p, char *s, int n, char byteb[], char bitb[], FILE *bFP, FILE *tFP, FILE *mFP);
+void bitwrite(sICode *p, char *s, int n, FILE *bFP, FILE *tFP, FILE *mFP);
 void bitwriteError(sICode *p, FILE *bFP, FILE *tFP, FILE *mFP);
-void packbuf(char byteb[], char bitb[]);
 int isCommentLabelInst(unsigned int index);
 int isNotRealInst(unsigned int index);
 sICode *getNextCode(sICode *p);
 
 extern struct sICodeList iCode;       /**< Intermediate Code List */
+extern char *sICodeNoOperand[OPERAND_SLOTS];	/**< operand vector of instructions without operands */
 
 #endif	/* _ICODE_H */
@@ -872,20 +872,24 @@ char *yytext;
 #include <stdio.h>	/* perror() */
 #include <stdlib.h>	/* strtol(), exit() */
 #include <string.h>	/* strcpy() */
+#include <ctype.h>	/* isspace() */
 #include "dspsim.h"
 #include "symtab.h"	
 #include "icode.h"	
 #include "optab.h"
 #include "secinfo.h"
 #include "dspdef.h"
+#include "arena.h"
 
-extern char linebuf[MAX_LINEBUF];
+extern char *linebuf;
 extern int lineno;
 extern unsigned int curaddr;
 extern sICode *curicode;
 extern char	condbuf[MAX_CONDBUF];
 
-#line 889 "lex.yy.c"
+void scanVarInit(sICode *p);
+
+#line 893 "lex.yy.c"
 
 /* Macros after this point can all be overridden by user definitions in
  * section 1.
@@ -1036,11 +1040,11 @@ YY_DECL
 	register char *yy_cp = NULL, *yy_bp = NULL;
 	register int yy_act;
 
-#line 21 "dspsim.l"
+#line 25 "dspsim.l"
 
 	/* literal keyword tokens */
 	/* AMF, AF, MF */
-#line 1044 "lex.yy.c"
+#line 1048 "lex.yy.c"
 
 	if ( yy_init )
 		{
@@ -1125,741 +1129,741 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 24 "dspsim.l"
+#line 28 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FRND;	
 			}
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 29 "dspsim.l"
+#line 33 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FSS;	
 			}
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 34 "dspsim.l"
+#line 38 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FSU;	
 			}
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 39 "dspsim.l"
+#line 43 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FUS;	
 			}
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 44 "dspsim.l"
+#line 48 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FUU;	
 			}
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 49 "dspsim.l"
+#line 53 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FC1;	}
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 53 "dspsim.l"
+#line 57 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FC2;	}
 	YY_BREAK
 /* COND */
 case 8:
 YY_RULE_SETUP
-#line 58 "dspsim.l"
+#line 62 "dspsim.l"
 {	return CIF;	}
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 60 "dspsim.l"
+#line 64 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CEQC;	}
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 64 "dspsim.l"
+#line 68 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CEQ;	}
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
-#line 68 "dspsim.l"
+#line 72 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNEC;	}
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 72 "dspsim.l"
+#line 76 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNE;	}
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 76 "dspsim.l"
+#line 80 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CGT;	}
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 80 "dspsim.l"
+#line 84 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CLE;	}
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 84 "dspsim.l"
+#line 88 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CLT;	}
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 88 "dspsim.l"
+#line 92 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CGE;	}
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 92 "dspsim.l"
+#line 96 "dspsim.l"
 {		
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CAVC;	}
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 96 "dspsim.l"
+#line 100 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_AVC;	}
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 100 "dspsim.l"
+#line 104 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CAV;	}
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 104 "dspsim.l"
+#line 108 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_AV;	}
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 108 "dspsim.l"
+#line 112 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CACC;	}
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 112 "dspsim.l"
+#line 116 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_ACC;	}
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 116 "dspsim.l"
+#line 120 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CAC;	}
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 120 "dspsim.l"
+#line 124 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_AC;	}
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 124 "dspsim.l"
+#line 128 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CSVC;	}
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 128 "dspsim.l"
+#line 132 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_SVC;	}
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 132 "dspsim.l"
+#line 136 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CSV;	}
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 136 "dspsim.l"
+#line 140 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_SV;	}
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 140 "dspsim.l"
+#line 144 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CMVC;	}
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 144 "dspsim.l"
+#line 148 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_MVC;	}
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 148 "dspsim.l"
+#line 152 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CMV;	}
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 152 "dspsim.l"
+#line 156 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_MV;	}
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 156 "dspsim.l"
+#line 160 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_CE;	}
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 160 "dspsim.l"
+#line 164 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CTRUE;	}
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 164 "dspsim.l"
+#line 168 "dspsim.l"
 {		
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CUMC;	}
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 168 "dspsim.l"
+#line 172 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return CNOT_UMC;	}
 	YY_BREAK
 /* PUSH/POP stack */
 case 37:
 YY_RULE_SETUP
-#line 173 "dspsim.l"
+#line 177 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return KPC;	
 			}
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 178 "dspsim.l"
+#line 182 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return KLOOP;	
 			}
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 183 "dspsim.l"
+#line 187 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return KSTS;	
 			}
 	YY_BREAK
 /* CONJ modifier */
 case 40:
 YY_RULE_SETUP
-#line 189 "dspsim.l"
+#line 193 "dspsim.l"
 {	return MCONJ;	}
 	YY_BREAK
 /* SF */
 case 41:
 YY_RULE_SETUP
-#line 192 "dspsim.l"
+#line 196 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FHI;	}
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 196 "dspsim.l"
+#line 200 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FLO;	}
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 200 "dspsim.l"
+#line 204 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FHIRND;	}
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 204 "dspsim.l"
+#line 208 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FLORND;	}
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 208 "dspsim.l"
+#line 212 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FNORND;	
 			}
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 213 "dspsim.l"
+#line 217 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return FHIX;	}
 	YY_BREAK
 /* Registers */
 case 47:
 YY_RULE_SETUP
-#line 218 "dspsim.l"
+#line 222 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RCNTR;	}
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 222 "dspsim.l"
+#line 226 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RLPEVER;	}
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 226 "dspsim.l"
+#line 230 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RLPSTACK;	}
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 230 "dspsim.l"
+#line 234 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RPCSTACK;	}
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 234 "dspsim.l"
+#line 238 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RASTATR;	}
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 237 "dspsim.l"
+#line 241 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RASTATI;	}
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 240 "dspsim.l"
+#line 244 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RASTATC;	}
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 244 "dspsim.l"
+#line 248 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RMSTAT;	}
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 248 "dspsim.l"
+#line 252 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RSSTAT;	}
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 252 "dspsim.l"
+#line 256 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RDSTAT0;	}
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 256 "dspsim.l"
+#line 260 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RDSTAT1;	}
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 260 "dspsim.l"
+#line 264 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RICNTL;	}
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 264 "dspsim.l"
+#line 268 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIMASK;	}
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 268 "dspsim.l"
+#line 272 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIRPTL;	}
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 272 "dspsim.l"
+#line 276 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIVEC0;	}
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 276 "dspsim.l"
+#line 280 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIVEC1;	}
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 280 "dspsim.l"
+#line 284 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIVEC2;	}
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 284 "dspsim.l"
+#line 288 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RIVEC3;	}
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 288 "dspsim.l"
+#line 292 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RUMCOUNT;	}
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 292 "dspsim.l"
+#line 296 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RID;	}
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 296 "dspsim.l"
+#line 300 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RCACTL;	}
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 300 "dspsim.l"
+#line 304 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return RPX;	}
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 304 "dspsim.l"
+#line 308 "dspsim.l"
 {		/* Ix registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RIX;
 	}
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 309 "dspsim.l"
+#line 313 "dspsim.l"
 {		/* Mx registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RMX;
 	}
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 314 "dspsim.l"
+#line 318 "dspsim.l"
 {		/* Lx registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RLX;
 	}
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 319 "dspsim.l"
+#line 323 "dspsim.l"
 {		/* Bx registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RBX;
 	}
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 324 "dspsim.l"
+#line 328 "dspsim.l"
 {		/* Rx registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RRX;
 	}
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 329 "dspsim.l"
+#line 333 "dspsim.l"
 {		/* ACCx registers */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return RACC;
 	}
 	YY_BREAK
 /* MSTAT Fields: TBD */
 case 75:
 YY_RULE_SETUP
-#line 336 "dspsim.l"
+#line 340 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MSEC_REG;	
 	}
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
-#line 341 "dspsim.l"
+#line 345 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MSEC_REG;
 	}
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
-#line 346 "dspsim.l"
+#line 350 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MBIT_REV;	
 	}
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
-#line 351 "dspsim.l"
+#line 355 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MBIT_REV;	
 	}
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
-#line 356 "dspsim.l"
+#line 360 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MAV_LATCH;	
 	}
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
-#line 361 "dspsim.l"
+#line 365 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MAV_LATCH;	
 	}
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
-#line 366 "dspsim.l"
+#line 370 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MAL_SAT;	
 	}
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
-#line 371 "dspsim.l"
+#line 375 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MAL_SAT;	
 	}
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
-#line 376 "dspsim.l"
+#line 380 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MM_MODE;	
 	}
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
-#line 381 "dspsim.l"
+#line 385 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MM_MODE;	
 	}
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
-#line 386 "dspsim.l"
+#line 390 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MTIMER;	
 	}
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
-#line 391 "dspsim.l"
+#line 395 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MTIMER;	
 	}
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
-#line 396 "dspsim.l"
+#line 400 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MSEC_DAG;	
 	}
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
-#line 401 "dspsim.l"
+#line 405 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MSEC_DAG;	
 	}
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
-#line 406 "dspsim.l"
+#line 410 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MM_BIAS;	
 	}
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
-#line 411 "dspsim.l"
+#line 415 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MM_BIAS;	
 	}
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
-#line 416 "dspsim.l"
+#line 420 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return MINT;	
 	}
 	YY_BREAK
 /* other keywords */
 case 92:
 YY_RULE_SETUP
-#line 422 "dspsim.l"
+#line 426 "dspsim.l"
 {	
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = lexSave(yytext, yyleng);
 		return KNONE;	
 	}
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
-#line 427 "dspsim.l"
+#line 431 "dspsim.l"
 {	return KSEPARATOR;	}
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
-#line 429 "dspsim.l"
+#line 433 "dspsim.l"
 {	return KPM;	}
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
-#line 431 "dspsim.l"
+#line 435 "dspsim.l"
 {	return KDM;	}
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
-#line 433 "dspsim.l"
+#line 437 "dspsim.l"
 {	return KUNTIL;	}
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
-#line 435 "dspsim.l"
+#line 439 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return KCE;	
 			}
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
-#line 440 "dspsim.l"
+#line 444 "dspsim.l"
 {	
-				yylval.tstr = strdup(yytext);
+				yylval.tstr = lexSave(yytext, yyleng);
 				return KFOREVER;
 			}
 	YY_BREAK
 /* address operator */
 case 99:
 YY_RULE_SETUP
-#line 446 "dspsim.l"
+#line 450 "dspsim.l"
 {	
-			yylval.tstr = strdup(yytext);
+			yylval.tstr = lexSave(yytext, yyleng);
 			return KPOST;	
 		}
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
-#line 451 "dspsim.l"
+#line 455 "dspsim.l"
 {	
-			yylval.tstr = strdup(yytext);
+			yylval.tstr = lexSave(yytext, yyleng);
 			return KPRE;	
 		}
 	YY_BREAK
 /* numbers */
 case 101:
 YY_RULE_SETUP
-#line 457 "dspsim.l"
+#line 461 "dspsim.l"
 {
 		yylval.ival = (int)strtol(yytext, NULL, 10);
 		return DEC_NUMBER;
@@ -1867,7 +1871,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
-#line 462 "dspsim.l"
+#line 466 "dspsim.l"
 {
 		yylval.ival = (int)strtol(&yytext[2], NULL, 16);
 		return HEX_NUMBER;
@@ -1875,7 +1879,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
-#line 467 "dspsim.l"
+#line 471 "dspsim.l"
 {
 		yylval.ival = (int)strtol(&yytext[2], NULL, 2);
 		return BIN_NUMBER;
@@ -1883,24 +1887,24 @@ YY_RULE_SETUP
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
-#line 472 "dspsim.l"
+#line 476 "dspsim.l"
 ;	/* ignore whitespace */
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
-#line 474 "dspsim.l"
+#line 478 "dspsim.l"
 {	/* return symbol pointer */
 		yytext[yyleng-1] = '\0';	/* remove trailing colon */
 
 		/* check if this keyword is a reserved one. */
-		sTab *rsp = isResSym(yytext);
+		int rsp = isResSym(yytext);
 		if(rsp){	/* if reserved, mark as error */
 			yyerror("Reserved keyword used");
 			AssemblerError++;
 			if(VerboseMode) printf("> RESSYM0: %s (0x%04X)\n", yytext, curaddr);
 		}
 
-		sTab *sp0 = sTabHashSearch(symTable, yytext);
+		sTab *sp0 = sTabHashSearch(&symTable, yytext);
 		/* check if this label is new */
 		if(sp0 && sp0->Defined){	/* not new: duplicated */
 			yyerror("Duplicated LABEL defined");
@@ -1917,7 +1921,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
-#line 500 "dspsim.l"
+#line 504 "dspsim.l"
 {	/* should return opcode */
 		unsigned int code = isOpcode(yytext);
 		if(VerboseMode) printf("yytext:\t%s\n", yytext);
@@ -1942,7 +1946,7 @@ YY_RULE_SETUP
 					if(VerboseMode) printf("> CURADDR1: 0x%04X -> 0x%04X\n", curaddr-1, curaddr);
 				}
 
-				curicode->Line = strdup(linebuf);
+				curicode->Src->Line = arenaStrdupCold(curArena, linebuf);
 				if(VerboseMode) printf("> LINE1:\t%s\n", linebuf);
 			}else{
 				isParsingMultiFunc = TRUE;
@@ -1957,20 +1961,21 @@ YY_RULE_SETUP
 				if(VerboseMode) printf("NOTE: curicode not NULL at addr %X, line %d\n", curaddr, lineno);
 			}
 			if(condbuf[0] != '\0') {
-				curicode->Cond = strdup(condbuf);
+				curicode->Cond = arenaStrdup(curArena, condbuf);
 				if(VerboseMode) printf("COND:\t%s\n", condbuf);
 			}
+			if(code == i_VAR) scanVarInit(curicode);	/* initializer is not for parser */
 			return OPCODE;
 		} else {
 			/* check if this keyword is a reserved one. */
-			sTab *rsp = isResSym(yytext);
+			int rsp = isResSym(yytext);
 			if(rsp){	/* if reserved, mark as error */
 				yyerror("Reserved keyword used");
 				AssemblerError++;
 				if(VerboseMode) printf("> RESSYM1: %s (0x%04X)\n", yytext, curaddr);
 			}
 
-			sTab *sp = sTabHashSearch(symTable, yytext);
+			sTab *sp = sTabHashSearch(&symTable, yytext);
 			if(sp){	/* it's already in symbol table */
 				yylval.symp = sp;
 				if(VerboseMode) printf("> LABEL2: %p\n", sp);
@@ -1985,23 +1990,23 @@ YY_RULE_SETUP
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
-#line 565 "dspsim.l"
+#line 570 "dspsim.l"
 {	/* return comment */
-		yylval.tstr = strdup(yytext);
+		yylval.tstr = arenaStrdupCold(curArena, yytext);
 		return COMMENT;
 	}
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
-#line 570 "dspsim.l"
+#line 575 "dspsim.l"
 { return 0; }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
-#line 572 "dspsim.l"
+#line 577 "dspsim.l"
 {	
 			int c = yytext[0];
-			strcpy(linebuf, yytext+1);
+			lexSetLine(yytext+1, yyleng-1);
 			yyless(1);
 
 			if(VerboseMode) printf("> %s\n", linebuf);
@@ -2010,15 +2015,15 @@ YY_RULE_SETUP
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 581 "dspsim.l"
+#line 586 "dspsim.l"
 { return yytext[0]; }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
-#line 582 "dspsim.l"
+#line 587 "dspsim.l"
 ECHO;
 	YY_BREAK
-#line 2022 "lex.yy.c"
+#line 2027 "lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -2900,7 +2905,7 @@ int main()
 	return 0;
 	}
 #endif
-#line 582 "dspsim.l"
+#line 587 "dspsim.l"
 
 
 int yyerror(char *s)
@@ -2914,7 +2919,7 @@ struct sTab* symlook(char *s, unsigned int n)
 {
     struct sTab *sp;
 
-	return sTabHashAdd(symTable, s, n);
+	return sTabHashAdd(&symTable, s, n);
 } /* symlook */
 
 void addlabel(char *name, unsigned int address)
@@ -2929,18 +2934,193 @@ void yyerror2(char *s)
 
 unsigned int isOpcode(char *s)
 {
-	oTab* p;
-	p = oTabHashSearch(opTable, s);
-	if(p == NULL) return FALSE;
+	int i = oHashSearch(&opHash, s);
+	if(i < 0) return FALSE;
 	else 
-		return p->Index;
+		return i;
 }
 
-struct sTab* isResSym(char *s)
+int isResSym(char *s)
 {
-	struct sTab* p;
-	p = sTabHashSearch(resSymTable, s);
-	if(p == NULL) return NULL;
-	else 
-		return p;
+	return (oHashSearch(&resSymHash, s) >= 0);
+}
+
+/** 
+* @brief Append one character to a growing string.
+* 
+* @param s Pointer to string (NULL to start)
+* @param len Pointer to string length
+* @param cap Pointer to allocated size
+* @param c Character to append
+*/
+static void strAppendChar(char **s, int *len, int *cap, int c)
+{
+	if(*len + 1 >= *cap){
+		*cap = *cap ? *cap * 2 : MAX_LINEBUF;
+		*s = (char *)realloc(*s, *cap);
+	}
+	(*s)[(*len)++] = c;
+	(*s)[*len] = '\0';
+}
+
+/** 
+* @brief Cut initializer off a .VAR line before the parser sees it.
+* ".VAR coeff[4] = 0x7FF, 0, -1, 2 ; comment": the text after '=' goes to
+* p->Src->Init, the comment to p->Src->Comment, and "coeff[4]" is pushed back for
+* the parser. A value list ending with ',' continues on the next line.
+* Initial values are resolved at codeScan().
+* 
+* @param p Pointer to .VAR instruction
+*/
+void scanVarInit(sICode *p)
+{
+	char pre[MAX_LINEBUF];
+	char *init = NULL;
+	char *cmt = NULL;
+	int plen = 0, ilen = 0, icap = 0, clen = 0, ccap = 0;
+	int c, last;
+
+	/* operands up to '=': give them back if there is no initializer */
+	for(;;){
+		c = input();
+		if(c == '=' || c == ';' || c == '\n' || c == EOF || c == 0 || plen == MAX_LINEBUF-1) break;
+		pre[plen++] = c;
+	}
+	if(c != '='){
+		if(c != EOF && c != 0) unput(c);
+		while(plen) unput(pre[--plen]);
+		return;
+	}
+
+	/* initial values up to comment or end of line */
+	for(;;){
+		last = 0;
+		while((c = input()) != ';' && c != '\n' && c != EOF && c != 0){
+			strAppendChar(&init, &ilen, &icap, c);
+			if(!isspace(c)) last = c;
+		}
+		if(c == ';'){	/* comment: keep the first one only */
+			int keep = (cmt == NULL);
+
+			if(keep) strAppendChar(&cmt, &clen, &ccap, c);
+			while((c = input()) != '\n' && c != EOF && c != 0){
+				if(keep) strAppendChar(&cmt, &clen, &ccap, c);
+			}
+		}
+		if(last != ',' || c != '\n') break;
+		lineno++;		/* continuation line */
+		strAppendChar(&init, &ilen, &icap, ' ');
+	}
+
+	/* instruction strings live in program arena */
+	p->Src->Init = arenaStrdupCold(curArena, init ? init : "");
+	if(cmt) p->Src->Comment = arenaStrdupCold(curArena, cmt);
+	free(init);
+	free(cmt);
+
+	if(c == '\n') unput(c);
+	while(plen) unput(pre[--plen]);
+}
+
+/*
+* Source input: the whole file is mapped and scanned in place with
+* yy_scan_buffer(), so the scanner never refills or copies its buffer.
+* Token strings the parser copies anyway (registers, conditions, options)
+* are kept in an arena freed after the parse instead of strdup()'d.
+*/
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+
+static sArena lexArena;						/**< token strings of current parse */
+static YY_BUFFER_STATE lexBuf = NULL;		/**< scanner buffer over mapped source */
+static FILE *lexFile = NULL;				/**< source file (scanner clears yyin) */
+static char *lexMap = NULL;					/**< mapped source */
+static size_t lexMapLen = 0;				/**< mapped length */
+static int linebufSize = 0;					/**< allocated size of linebuf */
+
+/** 
+* @brief Copy token text into token arena. Valid until lexClose().
+* 
+* @param s Token text
+* @param len Token length
+* 
+* @return Pointer to NUL-terminated copy
+*/
+char *lexSave(char *s, int len)
+{
+	return arenaStrndup(&lexArena, s, len);
+}
+
+/** 
+* @brief Keep current source line in linebuf (any length).
+* 
+* @param s Line text
+* @param len Line length
+*/
+void lexSetLine(char *s, int len)
+{
+	if(len + 1 > linebufSize){
+		linebufSize = (len + 1 > MAX_LINEBUF) ? len + 1 : MAX_LINEBUF;
+		linebuf = (char *)realloc(linebuf, linebufSize);
+	}
+	memcpy(linebuf, s, len);
+	linebuf[len] = '\0';
+}
+
+/** 
+* @brief Start scanning a source file. Regular files are mapped and
+* scanned in place; other inputs (pipes) are read through stdio.
+* 
+* @param fp Opened source file
+*/
+void lexOpen(FILE *fp)
+{
+	struct stat st;
+	size_t len, pg = (size_t)sysconf(_SC_PAGESIZE);
+	char *m;
+
+	lexClose();
+	lexSetLine("", 0);
+
+	if(fstat(fileno(fp), &st) || !S_ISREG(st.st_mode) || st.st_size == 0){
+		yyrestart(fp);
+		return;
+	}
+
+	/* file followed by zero bytes for the two end-of-buffer marks */
+	len = st.st_size;
+	lexMapLen = (len + 2 + pg - 1) & ~(pg - 1);
+	m = (char *)mmap(NULL, lexMapLen, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(m == MAP_FAILED){
+		yyrestart(fp);
+		return;
+	}
+	if(mmap(m, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fileno(fp), 0) == MAP_FAILED){
+		munmap(m, lexMapLen);
+		yyrestart(fp);
+		return;
+	}
+	lexMap = m;
+	lexFile = fp;
+	lexBuf = yy_scan_buffer(lexMap, len + 2);
+}
+
+/** 
+* @brief End of parse: unmap source and free token strings.
+*/
+void lexClose(void)
+{
+	if(lexBuf){
+		yy_delete_buffer(lexBuf);
+		yyin = lexFile;		/* caller closes it */
+	}
+	lexBuf = NULL;
+	lexFile = NULL;
+	if(lexMap) munmap(lexMap, lexMapLen);
+	lexMap = NULL;
+	lexMapLen = 0;
+
+	arenaFree(&lexArena);
 }
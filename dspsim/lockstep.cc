@@ -0,0 +1,199 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file lockstep.cc
+* @brief Lockstep multi-instance mode (-k option)
+*
+* A single data path program is run as K independent instances, one per
+* SIMD data path: instance j owns data path j and column j of the memory
+* dump files. Data path 0 is master and decides control flow and the
+* values of shared (non-SIMD) registers. An instance whose branch
+* condition or shared register value differs from the master's leaves
+* lockstep: its data path is disabled for the rest of the run, and it is
+* re-run alone from the initial memory image after the lockstep run.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "dspsim.h"
+#include "icode.h"
+#include "dmem.h"
+#include "simcore.h"
+#include "simsupport.h"
+#include "lockstep.h"
+
+long LockstepCycles[NUMDP];					/**< cycles of each instance */
+dMemList LockstepInitMem[MAX_HASHTABLE];	/**< data memory before first iteration */
+
+/**
+* @brief Check if register is shared by all data paths (not SIMD)
+*
+* @param s Register name
+*
+* @return TRUE if system register (_XXX) or Ix/Mx/Lx/Bx
+*/
+int isScalarRegName(const char *s)
+{
+	if(s[0] == '_') return TRUE;
+	if(strchr("IiMmLlBb", s[0]) && isdigit(s[1])) return TRUE;
+	return FALSE;
+}
+
+/**
+* @brief Enable one data path per instance; data path 0 is master.
+* Called after initSim().
+*/
+void lockstepInit(void)
+{
+	WrReg("_DSTAT0", (1 << LockstepCount) - 1);
+	WrReg("_DSTAT1", 1);
+	LockstepDiverged = 0;
+}
+
+/**
+* @brief Keep initial data memory (after initDumpIn()) for re-runs.
+*/
+void lockstepSaveInit(void)
+{
+	dataMemInit(LockstepInitMem);
+	dMemHashCopy(LockstepInitMem, dataMem);
+}
+
+/**
+* @brief Compare branch condition of every instance with the master's.
+*
+* @param s Condition code string
+* @param c Condition result of master data path
+*/
+void lockstepCheckCond(const char *s, int c)
+{
+	for(int j = 1; j < LockstepCount; j++){
+		if(rDPENA.dp[j] && (ifCondDP(s, j) != c)){
+			lockstepDiverge(j, s);
+		}
+	}
+}
+
+/**
+* @brief Compare value written to a shared register by every instance with the master's.
+*
+* @param s Register name
+* @param data Data to write
+* @param mask Write enable per data path
+*/
+void lockstepCheckScalar(const char *s, sint data, sint mask)
+{
+	if(!strcasecmp(s, "_DSTAT0") || !strcasecmp(s, "_DSTAT1")){
+		printRunTimeError(lineno, s,
+			"Data path enable/master cannot be changed in lockstep mode (-k).\n");
+	}
+
+	for(int j = 1; j < LockstepCount; j++){
+		if(!rDPENA.dp[j]) continue;
+
+		if((!mask.dp[j] != !mask.dp[0]) || (mask.dp[0] && (data.dp[j] != data.dp[0]))){
+			lockstepDiverge(j, s);
+		}
+	}
+}
+
+/**
+* @brief Take an instance out of lockstep; it is re-run alone later.
+*
+* @param j Data path (instance) number
+* @param s Condition code or register name which made it diverge
+*/
+void lockstepDiverge(int j, const char *s)
+{
+	LockstepDiverged |= (1 << j);
+	rDPENA.dp[j] = 0;
+	rDstat0 &= ~(1 << j);
+
+	if(VerboseMode) printf("Lockstep: instance %d diverged at PC %04X (%s)\n", j, oldPC, s);
+}
+
+/**
+* @brief Re-run diverged instances one by one on their own data path.
+* Data memory of other instances and their statistics are kept.
+*/
+void lockstepRerun(void)
+{
+	long cycles = Cycles;
+	int count = LockstepCount;
+	sint ov, um;
+
+	LockstepCycles[0] = Cycles;
+	for(int j = 1; j < count; j++){
+		LockstepCycles[j] = Cycles;
+	}
+
+	LockstepCount = 0;		/* no lockstep checks while re-running */
+	for(int d = 1; d < count; d++){
+		if(!(LockstepDiverged & (1 << d))) continue;
+		if(SimMode == 'Q') break;
+
+		/* restore initial data memory of this instance */
+		for(int i = 0; i < MAX_HASHTABLE; i++){
+			for(dMem *n = dataMem[i].FirstNode; n != NULL; n = n->Next){
+				dMem *m = dMemHashSearch(LockstepInitMem, n->DMA);
+				n->Data.dp[d] = m ? m->Data.dp[d] : (0x0FFF & UNDEFINED);
+			}
+		}
+
+		ov = OVCount;
+		um = rUMCOUNT;
+
+		InitSimMode = TRUE;
+		initSim();
+		InitSimMode = FALSE;
+		WrReg("_DSTAT0", 1 << d);
+		WrReg("_DSTAT1", 1 << d);
+
+		OVCount = ov;
+		OVCount.dp[d] = 0;
+		rUMCOUNT = um;
+		rUMCOUNT.dp[d] = 0;
+
+		if(!QuietMode) printf("Lockstep: re-running instance %d\n", d);
+		Cycles = 0;
+		for(ItrCntr = 0; ItrCntr < ItrMax; ItrCntr++){
+			if(simCore(iCode)) break;
+		}
+		LockstepCycles[d] = Cycles;
+	}
+
+	Cycles = cycles;
+	LockstepCount = count;
+}
+
+/**
+* @brief Print per-instance statistics.
+*/
+void lockstepReport(void)
+{
+	int n = 0;
+
+	for(int j = 1; j < LockstepCount; j++){
+		if(LockstepDiverged & (1 << j)) n++;
+	}
+
+	printf("Lockstep: %d instances, %d diverged\n", LockstepCount, n);
+	for(int j = 0; j < LockstepCount; j++){
+		printf("Instance %d: %ld cycles, overflow %d times, unaligned memory access %d times%s\n",
+			j, LockstepCycles[j], OVCount.dp[j], rUMCOUNT.dp[j],
+			(LockstepDiverged & (1 << j)) ? " (re-run)" : "");
+	}
+}
+
+/**
+* @brief Free initial data memory copy.
+*/
+void lockstepClose(void)
+{
+	dMemHashRemoveAll(LockstepInitMem);
+}
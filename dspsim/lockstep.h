@@ -0,0 +1,29 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file lockstep.h
+* @brief Header for lockstep multi-instance mode (-k option)
+* @date 2026-10-19
+*/
+
+#ifndef	_LOCKSTEP_H
+#define	_LOCKSTEP_H
+
+#include "simsupport.h"
+#include "dmem.h"
+
+int isScalarRegName(const char *s);
+void lockstepInit(void);
+void lockstepSaveInit(void);
+void lockstepCheckCond(const char *s, int c);
+void lockstepCheckScalar(const char *s, sint data, sint mask);
+void lockstepDiverge(int j, const char *s);
+void lockstepRerun(void);
+void lockstepReport(void);
+void lockstepClose(void);
+
+extern long LockstepCycles[NUMDP];
+extern dMemList LockstepInitMem[MAX_HASHTABLE];
+
+#endif	/* _LOCKSTEP_H */
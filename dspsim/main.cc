@@ -16,17 +16,32 @@ All Rights Reserved.
 #include "secinfo.h"
 #include "simcore.h"
 #include "simsupport.h"
+#include "simserver.h"
+#include "lockstep.h"
+#include "specitr.h"
+#include "dmimage.h"
+#include "framestream.h"
+#include "region.h"
+#include "testvec.h"
+#include "checksum.h"
+#include "../common/asyncout.h"
+#include "progimage.h"
+#include "arena.h"
+#include "asmdriver.h"
+#include "asmcache.h"
+#include "bundle.h"
 #include <stdio.h>	/* perror() */
 #include <stdlib.h>	/* strtol(), exit() */
 #include <string.h>	/* strcpy() */
 #include <ctype.h>
 #include <time.h>
+#include <unistd.h>	/* isatty() */
 
 #ifdef	VHPI		/* VHPI: dspsim.so library only */
 #include "dsp.h"
 #endif
 
-char linebuf[MAX_LINEBUF];
+char *linebuf = NULL;
 char condbuf[MAX_CONDBUF];
 int lineno = 1;
 unsigned int curaddr = 0;
@@ -54,6 +69,9 @@ int SIMD2Mode = FALSE;		/* for -2 option */
 int	SIMD4Mode = FALSE;		/* for -4 option */
 int	SIMD4ForceMode = FALSE;		/* for -4f option */
 int SuppressUndefinedDMMode = FALSE;		/* for -x option */
+int LockstepCount = 0;		/* for -k option: instances run in lockstep */
+int LockstepDiverged = 0;	/* bit j set: instance j left lockstep */
+int SpecJobs = 1;			/* for -p option: iterations run in parallel */
 
 FILE *dumpInFP;			/* file pointer to memory dump input */
 int dumpInStart;		/* start address of memory dump input */
@@ -61,6 +79,27 @@ int dumpInSize = DEF_DUMPINSIZE;			/* size of memory dump input */
 FILE *dumpOutFP;		/* file pointer to memory dump output */
 int dumpOutStart;		/* start address of memory dump output */
 int dumpOutSize = DEF_DUMPOUTSIZE;		/* size of memory dump output */
+int dumpOutImage = FALSE;	/* TRUE if memory dump output is a binary image (.dmi) */
+FILE *frameInFP;		/* file pointer to streaming frame input */
+int frameInStart;		/* start address of each input frame */
+int frameInSize = DEF_FRAMESIZE;		/* size of each input frame */
+FILE *frameOutFP;		/* file pointer to streaming frame output */
+int frameOutStart;		/* start address of each output frame */
+int frameOutSize = DEF_FRAMESIZE;		/* size of each output frame */
+int frameOutImage = FALSE;	/* TRUE if frame output is a binary image stream (.dmi) */
+FILE *regionFP;			/* file pointer to region spec file */
+char *regionFile;		/* region spec filename */
+char *genSpec;			/* test vector generator spec (-g) */
+int genStart;			/* start address of generated block */
+int genSize = DEF_GENSIZE;		/* words generated per iteration */
+char *checksumList;		/* checksum items (-ck) */
+FILE *checksumExpFP;	/* file pointer to expected checksums */
+FILE *checksumOutFP;	/* file pointer to checksum output */
+FILE *goldFP;			/* file pointer to golden reference stream */
+int goldStart;			/* start address of compared output */
+int goldSize = DEF_GOLDSIZE;		/* words compared per iteration */
+char *goldTol;			/* golden comparison tolerance (-goldt) */
+int goldStop = FALSE;	/* for -goldx option: stop at first failing iteration */
 
 FILE *dumpBinFP;			/* file pointer to binary code dump */
 FILE *dumpMemFP;			/* file pointer to binmem code dump */
@@ -69,19 +108,14 @@ FILE *dumpSymFP;			/* file pointer to symbol table dump */
 FILE *dumpErrFP;			/* file pointer to error msg dump */
 FILE *dumpLstFP;			/* file pointer to list file */
 char filebuf[MAX_LINEBUF];
-char bytebuf[INSTLEN];		/* for use in sICodeBinDump() */
-char bitbuf[INSTLEN/8]; 	/* for use in sICodeBinDump() */
 
 int codeSegAddr;		/* start address of code segment; specified by user */
 int dataSegAddr;		/* start address of data segment; specified by user */
 
-sTabList symTable[MAX_HASHTABLE]; 		/**< Symbol Table for labels */
+sTabList symTable;						/**< Symbol Table for labels */
 sICodeList iCode;						/**< Intermediate Code List */
 sSecInfoList secInfo;					/**< Section Information List */
 dMemList dataMem[MAX_HASHTABLE];		/**< Data Memory Table for variables */
-oTabList opTable[MAX_OPHASHTABLE];		/**< Opcode Table for iCode's reference */
-
-sTabList resSymTable[MAX_HASHTABLE]; 		/**< Reserved Symbol Table */
 
 sSecInfo *curSecInfo;		/* pointer to current segment info. data structure */
 
@@ -89,6 +123,7 @@ sint OVCount;	/**< Overflow counter */
 int AssemblerError = 0;	/* number of assembler errors */
 
 
+#ifndef	LIBN1DSIM	/* libn1dsim.so: entry points are in n1dsim.cc */
 /** 
 * @brief Program entry point - includes input argument processing & post-processing
 * 
@@ -101,20 +136,45 @@ int main(int argc, char *argv[])
 {
 	int i;
 	int simResult;
+	int parseResult;
 
 	if(!processArg(argc, argv)) return 0;
 
+	/* several sources: driver exits, each worker assembles one of them below */
+	if(AsmFileCntr > 1) asmDriver(argv[0]);
+	if(AsmCacheHit){
+		printf("\nAssembler ended successfully.\n\n");
+		exit(0);
+	}
+
+	/* non-interactive trace output goes through writer thread */
+	if(SimMode == 'C' && !ServerPath && !isatty(STDOUT_FILENO)) asyncStdout();
+
 	/* initialize global variables */
 	iCodeInit(&iCode);
-	symTableInit(symTable);
-	resSymTableInit(resSymTable);
+	symTableInit(&symTable);
 	dataMemInit(dataMem);
-	opTableInit(opTable);
 	secInfoInit(&secInfo);
 
+#ifndef DSPASM
+	/* persistent simulation server: parses programs on demand */
+	if(ServerPath){
+		dumpErrFP = stderr;
+		exit(runServer(ServerPath));
+	}
+#endif
+
+#ifndef DSPASM
+	/* unchanged program: use precompiled image instead of parsing */
+	if(ProgImageMode && !AssemblerMode && progImageLoad(infile)) goto progReady;
+#endif
+
 	/* first pass scan */
 	/* start lexer & parser */
-	if(!yyparse() && !AssemblerError){
+	lexOpen(yyin);
+	parseResult = yyparse();
+	lexClose();
+	if(!parseResult && !AssemblerError){
 		if(VerboseMode) printf("Parser worked :)\n\n");
 	}else{
 		if(VerboseMode) printf("Parser failed :(\n\n");
@@ -126,70 +186,118 @@ int main(int argc, char *argv[])
 
 		/* free memory */
 		sICodeListRemoveAll(&iCode);
-		sTabHashRemoveAll(symTable);
-		sTabHashRemoveAll(resSymTable);
+		sTabHashRemoveAll(&symTable);
 		dMemHashRemoveAll(dataMem);
-		oTabHashRemoveAll(opTable);
 		sSecInfoListRemoveAll(&secInfo);
+		arenaFree(&progArena);
 		exit(1);
 	}
 
+	/* pack instructions into multifunction instructions */
+	if(BundleMode) bundleICode(&iCode);
+
 	/* second pass scan */
 	/* type resolution & resolve pseudo instructions */
 	codeScan(&iCode);	
 
 	/* for data segment even-byte patching */
 	changeFilenameExt(filebuf, filebuf, "");
-	sTabSymEvenBytePatch(symTable, &secInfo, filebuf);
+	sTabSymEvenBytePatch(&symTable, &secInfo, filebuf);
 
 	/* for debug */
-	if(VerboseMode) sTabHashPrint(symTable);
+	if(VerboseMode) sTabHashPrint(&symTable);
 
 	/* if assembler-only mode */
 	if(AssemblerMode){
 		sICodeListPrint(&iCode);
 		sSecInfoSymDump(&secInfo);
-		sTabSymDump(symTable);
+		sTabSymDump(&symTable);
 		sICodeBinDump(&iCode);
 		if(VerboseMode) sSecInfoListPrint(&secInfo);
-		if(VerboseMode) sTabHashPrint(symTable);
-		if(VerboseMode) sTabHashPrint(resSymTable);
+		if(VerboseMode) sTabHashPrint(&symTable);
+		if(VerboseMode) oHashPrint(&resSymHash, "Reserved Keyword Table");
 		if(VerboseMode) dMemHashPrint(dataMem);
 		closeSim();
+		if(AsmCacheDir && !AssemblerError) asmCacheSave(infile);
 
 		/* free memory */
 		sICodeListRemoveAll(&iCode);
-		sTabHashRemoveAll(symTable);
-		sTabHashRemoveAll(resSymTable);
+		sTabHashRemoveAll(&symTable);
 		dMemHashRemoveAll(dataMem);
-		oTabHashRemoveAll(opTable);
 		sSecInfoListRemoveAll(&secInfo);
+		arenaFree(&progArena);
 
 		if(!AssemblerError)
 			printf("\nAssembler ended successfully.\n\n");
 		else
 			printf("\nAssembler failed - Total %d error(s) found.\n\n", AssemblerError);
-		exit(0);	/* no error */
+		exit((AsmWorker && AssemblerError) ? 1 : 0);	/* no error; worker reports errors to driver */
 	}
 
 #ifndef DSPASM
+	if(ProgImageMode && !AssemblerError) progImageSave(infile);
+
+progReady:
 	/* init simulator */
 	InitSimMode = TRUE;
 	initSim();
+	if(LockstepCount) lockstepInit();
 	initDumpIn();
+	if((regionFP || goldFP) && !regionInit()){
+		closeSim();
+		exit(1);
+	}
+	if(genSpec && !genAdd(genSpec, genStart, genSize, (1 << NUMDP) - 1)){
+		closeSim();
+		exit(1);
+	}
+	if(checksumList && !checksumInit()){
+		closeSim();
+		exit(1);
+	}
+	if(LockstepCount) lockstepSaveInit();
 	InitSimMode = FALSE;
 
+	/* streaming frame input/output threads */
+	if((frameInFP || frameOutFP) && !frameStreamOpen()){
+		printf("\nError: %s - invalid data memory image header in frame input\n", argv[0]);
+		closeSim();
+		exit(1);
+	}
+
 	/* simulator main loop */
 	printf("\nBegin Simulation..\n\n");
-	for(ItrCntr = 0; ItrCntr < ItrMax; ItrCntr++){
-		printf("Iteration %d of %d:\n", ItrCntr+1, ItrMax);
-
-		simResult = simCore(iCode);
-		if(simResult){  /* exit simulation loop */
-			break;
+	if(SpecJobs > 1){		/* speculative parallel iterations */
+		simResult = specRun();
+	}else{
+		for(ItrCntr = 0; ItrCntr < ItrMax; ItrCntr++){
+			if(frameInFP && !frameStreamIn()){	/* end of input stream */
+				ItrMax = ItrCntr;
+				break;
+			}
+			if(GenCntr) genIter();
+			if(ItrMax == FRAME_ITRMAX)
+				printf("Iteration %d:\n", ItrCntr+1);
+			else
+				printf("Iteration %d of %d:\n", ItrCntr+1, ItrMax);
+
+			simResult = simCore(iCode);
+			if(frameOutFP) frameStreamOut();
+			if(RegionCntr) regionIter();
+			if(CkItemCntr) checksumIter();
+			if(RegionCntr && !regionCheck()){	/* golden comparison failed */
+				closeSim();
+				exit(1);
+			}
+			if(simResult){  /* exit simulation loop */
+				break;
+			}
+			printf("\n");
 		}
-		printf("\n");
 	}
+	/* instances which left lockstep run alone */
+	if(LockstepCount) lockstepRerun();
+	if(CkItemCntr) checksumEnd();
 	printf("End of Simulation!!\n");
 
 	/* print statistics */
@@ -199,28 +307,32 @@ int main(int argc, char *argv[])
 	/*
 	sICodeListPrint(&iCode);
 	sSecInfoSymDump(&secInfo);
-	sTabSymDump(symTable);
+	sTabSymDump(&symTable);
 	if(BinDumpMode) sICodeBinDump(&iCode);
 	if(VerboseMode) sSecInfoListPrint(&secInfo);
-	if(VerboseMode) sTabHashPrint(symTable);
-	if(VerboseMode) sTabHashPrint(resSymTable);
+	if(VerboseMode) sTabHashPrint(&symTable);
+	if(VerboseMode) oHashPrint(&resSymHash, "Reserved Keyword Table");
 	if(VerboseMode) dMemHashPrint(dataMem);
 	*/
 
 	/* close file and dump memory if needed */
 	closeSim();
+	if(LockstepCount) lockstepClose();
 
 	/* free memory */
-	sICodeListRemoveAll(&iCode);
-	sTabHashRemoveAll(symTable);
-	sTabHashRemoveAll(resSymTable);
-	dMemHashRemoveAll(dataMem);
-	oTabHashRemoveAll(opTable);
-	sSecInfoListRemoveAll(&secInfo);
-
-	exit(0);	/* no error */
+	if(!ProgImageLoaded){
+		sICodeListRemoveAll(&iCode);
+		sTabHashRemoveAll(&symTable);
+		dMemHashRemoveAll(dataMem);
+		sSecInfoListRemoveAll(&secInfo);
+	}
+	progImageClose();
+	arenaFree(&progArena);
+
+	exit(CheckFailCntr ? 1 : 0);	/* golden comparison failed or no error */
 #endif
 }
+#endif	/* LIBN1DSIM */
 
 /** 
 * @brief Print results after all iterations
@@ -237,6 +349,8 @@ void reportResult(void)
 	printf("----------------------------------\n");
 	printf("Time: %ld cycles for %d iteration\n", Cycles, ItrMax);
 	printf("Overflow: %d times\n", OVCount);
+	printf("Unaligned memory access: %d times\n", rUMCOUNT.dp[0]);
+	if(LockstepCount) lockstepReport();
 	printf("\n");
 }
 
@@ -266,6 +380,7 @@ void displayInternalStates(void)
 int	processArg(int argc, char *argv[])
 {
 	int i;
+	int itrGiven = FALSE;
 
 #ifdef DSPASM
 	AssemblerMode = TRUE;
@@ -287,6 +402,13 @@ int	processArg(int argc, char *argv[])
 		printf("\nError: %s - input filename extension must be \".asm\"\n", infile);
 		return FALSE;	
 	}
+
+	/* unchanged source: outputs from assembly cache, no files opened */
+	if(AssemblerMode && AsmCacheDir && asmCacheLoad(infile)){
+		fclose(yyin);
+		yyin = NULL;
+		return TRUE;
+	}
 #else				/* simulator & assembler */
 	if(argc == 1){	/* if no arguments given */
 		printHelp(argv[0]);
@@ -334,6 +456,7 @@ int	processArg(int argc, char *argv[])
 					return FALSE;
 				}
 				ItrMax = atoi(argv[i]);
+				itrGiven = TRUE;
 				printf("number of iteration: %d\n", ItrMax);
 			}
 		} else if(!strcmp("-if", argv[i])){
@@ -384,12 +507,236 @@ int	processArg(int argc, char *argv[])
 				}
 				printf("memory dump output filename: %s\n", argv[i]);
 
+				/* file open: binary image is mapped, so open for update */
+				dumpOutImage = dmiIsImageName(argv[i]);
+				if(!(dumpOutFP = asyncOpen(argv[i], dumpOutImage ? "w+b" : "w"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-fi", argv[i])){
+			if(!AssemblerMode){
+				/* streaming frame input filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("frame input filename: %s\n", argv[i]);
+
+				/* file open */
+				if(!(frameInFP = fopen(argv[i], "r"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-fia", argv[i])){
+			if(!AssemblerMode){
+				/* frame input start address (absolute) */
+				i++;
+				if((argv[i] == NULL) || !isxdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				frameInStart = (int)strtol(argv[i], NULL, 16);
+				printf("frame input start address (absolute): 0x%04X\n", frameInStart);
+			}
+		} else if(!strcmp("-fis", argv[i])){
+			if(!AssemblerMode){
+				/* frame input size */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				frameInSize = atoi(argv[i]);
+				printf("frame input size in words: %d\n", frameInSize);
+			}
+		} else if(!strcmp("-fo", argv[i])){
+			if(!AssemblerMode){
+				/* streaming frame output filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("frame output filename: %s\n", argv[i]);
+
+				/* file open */
+				frameOutImage = dmiIsImageName(argv[i]);
+				if(!(frameOutFP = fopen(argv[i], frameOutImage ? "wb" : "w"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-foa", argv[i])){
+			if(!AssemblerMode){
+				/* frame output start address (absolute) */
+				i++;
+				if((argv[i] == NULL) || !isxdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				frameOutStart = (int)strtol(argv[i], NULL, 16);
+				printf("frame output start address (absolute): 0x%04X\n", frameOutStart);
+			}
+		} else if(!strcmp("-fos", argv[i])){
+			if(!AssemblerMode){
+				/* frame output size */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				frameOutSize = atoi(argv[i]);
+				printf("frame output size in words: %d\n", frameOutSize);
+			}
+		} else if(!strcmp("-rf", argv[i])){
+			if(!AssemblerMode){
+				/* region spec filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("region spec filename: %s\n", argv[i]);
+
+				/* file open */
+				regionFile = argv[i];
+				if(!(regionFP = fopen(argv[i], "r"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-g", argv[i])){
+			if(!AssemblerMode){
+				/* test vector generator spec */
+				i++;
+				if((argv[i] == NULL) || !isalpha(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				genSpec = argv[i];
+				printf("test vector generator: %s\n", genSpec);
+			}
+		} else if(!strcmp("-ga", argv[i])){
+			if(!AssemblerMode){
+				/* generated block start address (absolute) */
+				i++;
+				if((argv[i] == NULL) || !isxdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				genStart = (int)strtol(argv[i], NULL, 16);
+				printf("test vector start address (absolute): 0x%04X\n", genStart);
+			}
+		} else if(!strcmp("-gs", argv[i])){
+			if(!AssemblerMode){
+				/* words generated per iteration */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				genSize = atoi(argv[i]);
+				printf("test vector size in words: %d\n", genSize);
+			}
+		} else if(!strcmp("-ck", argv[i])){
+			if(!AssemblerMode){
+				/* checksum items */
+				i++;
+				if((argv[i] == NULL) || (!isalnum(argv[i][0]) && argv[i][0] != '_')){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				checksumList = argv[i];
+				printf("checksum items: %s\n", checksumList);
+			}
+		} else if(!strcmp("-ce", argv[i])){
+			if(!AssemblerMode){
+				/* expected checksum filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("expected checksum filename: %s\n", argv[i]);
+
+				/* file open */
+				if(!(checksumExpFP = fopen(argv[i], "r"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-co", argv[i])){
+			if(!AssemblerMode){
+				/* checksum output filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("checksum output filename: %s\n", argv[i]);
+
 				/* file open */
-				if(!(dumpOutFP = fopen(argv[i], "w"))){
+				if(!(checksumOutFP = asyncOpen(argv[i], "w"))){
 					printFileOpenError(argv[0], argv[i]);
 					return FALSE;
 				}
 			}
+		} else if(!strcmp("-gold", argv[i])){
+			if(!AssemblerMode){
+				/* golden reference filename */
+				i++;
+				if((argv[i] == NULL) || !isalnum(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				printf("golden reference filename: %s\n", argv[i]);
+
+				/* file open */
+				if(!(goldFP = fopen(argv[i], "rb"))){
+					printFileOpenError(argv[0], argv[i]);
+					return FALSE;
+				}
+			}
+		} else if(!strcmp("-golda", argv[i])){
+			if(!AssemblerMode){
+				/* compared output start address (absolute) */
+				i++;
+				if((argv[i] == NULL) || !isxdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldStart = (int)strtol(argv[i], NULL, 16);
+				printf("golden comparison start address (absolute): 0x%04X\n", goldStart);
+			}
+		} else if(!strcmp("-golds", argv[i])){
+			if(!AssemblerMode){
+				/* words compared per iteration */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldSize = atoi(argv[i]);
+				printf("golden comparison size in words: %d\n", goldSize);
+			}
+		} else if(!strcmp("-goldt", argv[i])){
+			if(!AssemblerMode){
+				/* golden comparison tolerance */
+				i++;
+				if((argv[i] == NULL) || !isalpha(argv[i][0])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				goldTol = argv[i];
+				printf("golden comparison tolerance: %s\n", goldTol);
+			}
+		} else if(!strcmp("-goldx", argv[i])){
+			if(!AssemblerMode){
+				goldStop = TRUE;
+			}
 		} else if(!strcmp("-oa", argv[i])){
 			if(!AssemblerMode){
 				/* memory dump output start address (absolute) */
@@ -483,95 +830,247 @@ int	processArg(int argc, char *argv[])
 				SIMD4ForceMode = TRUE;
 				printf("forced quad SIMD data path display mode set.\n");
 			}
+		} else if(!strcmp("-k", argv[i])){
+			if(!AssemblerMode){
+				/* lockstep instances: one per data path */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])
+					|| (atoi(argv[i]) < 1) || (atoi(argv[i]) > NUMDP)){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				LockstepCount = atoi(argv[i]);
+				printf("lockstep instances: %d\n", LockstepCount);
+			}
+		} else if(!strcmp("-p", argv[i])){
+			if(!AssemblerMode){
+				/* iterations run in parallel */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0])
+					|| (atoi(argv[i]) < 1) || (atoi(argv[i]) > MAX_SPECJOBS)){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				SpecJobs = atoi(argv[i]);
+				printf("parallel iterations: %d\n", SpecJobs);
+			}
 		} else if(!strcmp("-x", argv[i])){
 			if(!AssemblerMode){
 				/* suppress undefined data memory message mode set */
 				SuppressUndefinedDMMode = TRUE;
 				printf("suppressing undefined data memory message mode set.\n");
 			}
+		} else if(!strcmp("-pc", argv[i])){
+			if(!AssemblerMode){
+				/* precompiled program image cache */
+				ProgImageMode = TRUE;
+				printf("program image cache (.pim) enabled.\n");
+			}
+		} else if(!strcmp("-server", argv[i])){
+			if(!AssemblerMode){
+				/* persistent simulation server mode */
+				i++;
+				if((argv[i] == NULL) || (argv[i][0] == '-')){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				ServerPath = argv[i];
+				printf("simulation server socket: %s\n", ServerPath);
+			}
+		} else if(!strcmp("-cache", argv[i])){
+			if(!AssemblerMode){
+				/* number of programs cached by server */
+				i++;
+				if((argv[i] == NULL) || !isdigit(argv[i][0]) || !atoi(argv[i])){	/* error check */
+					printArgError(argv[0], argv[i-1]);
+					return FALSE;
+				}
+				ServerCacheSize = atoi(argv[i]);
+				if(ServerCacheSize > MAX_SERVERCACHE) ServerCacheSize = MAX_SERVERCACHE;
+				printf("server program cache size: %d\n", ServerCacheSize);
+			}
+		} else if(!strcmp("-jobs", argv[i])){
+			/* number of concurrent server jobs or assembler workers */
+			i++;
+			if((argv[i] == NULL) || !isdigit(argv[i][0]) || !atoi(argv[i])){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			if(AssemblerMode){
+				AsmJobs = atoi(argv[i]);
+				printf("assembler workers: %d\n", AsmJobs);
+			}else{
+				ServerMaxJobs = atoi(argv[i]);
+				printf("server concurrent jobs: %d\n", ServerMaxJobs);
+			}
+		} else if(!strcmp("-acache", argv[i])){
+			/* content-addressed assembly cache */
+			i++;
+			if(argv[i] == NULL){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			AsmCacheDir = argv[i];
+			printf("assembly cache directory: %s\n", AsmCacheDir);
+		} else if(!strcmp("-bundle", argv[i])){
+			/* automatic multifunction bundling */
+			BundleMode = TRUE;
+			printf("multifunction bundling mode set.\n");
 		} else if(argv[i][0] == '-') {	/* cannot understand this command */
 			printHelp(argv[0]);
 			return FALSE; /* early exit */
 		} else {	/* if not command, must be filename */
-			infile = argv[i];
-			printf("source filename (.asm): %s\n", argv[i]);
-
-			if(!infile) {
-				printf("\nError: %s - no input file\n", argv[0]);
-				return FALSE;
+			for(int k = 0; k < AsmFileCntr; k++){
+				if(!strcmp(AsmFiles[k], argv[i])){
+					printf("\nError: %s - %s given twice\n", argv[0], argv[i]);
+					return FALSE;
+				}
 			}
-
-			yyin = fopen(infile, "r");
-			if(yyin == NULL){	/* open failed */
-				printf("\nError: %s - cannot open %s\n", argv[0], infile);
+			if(AsmFileCntr == MAX_ASMFILES){
+				printf("\nError: %s - too many source files (max. %d)\n", argv[0], MAX_ASMFILES);
 				return FALSE;
 			}
+			AsmFiles[AsmFileCntr++] = argv[i];
+			printf("source filename (.asm): %s\n", argv[i]);
+		}
+	}
 
-			if(!compareFilenameExt(filebuf, infile, "asm")){
-				printf("\nError: %s - input filename extension must be \".asm\"\n", infile);
-				return FALSE;	
-			}
+	/* several sources: opened by assembler workers (asmDriver) */
+	if(AsmFileCntr > 1 && !AssemblerMode){
+		printf("\nError: %s - simulator takes one source file (use -a to assemble several)\n", argv[0]);
+		return FALSE;
+	}
+	if(AsmFileCntr == 1 && !openSourceFiles(argv[0], AsmFiles[0])) return FALSE;
+#endif
 
-			/* .err file open */
-			changeFilenameExt(filebuf, argv[i], "err");
-			printf("error message filename: %s\n", filebuf);
-			if(!(dumpErrFP = fopen(filebuf, "wt"))){
-				printFileOpenError(argv[0], filebuf);
-				return FALSE;
-			}
-			printFileHeader(dumpErrFP, filebuf);
+	if(LockstepCount && !SIMD1Mode){
+		printf("\nError: %s - lockstep mode (-k) runs single data path programs only\n", argv[0]);
+		return FALSE;
+	}
+	if(SpecJobs > 1 && (!QuietMode || LockstepCount)){
+		printf("\nError: %s - parallel iterations (-p) need quiet mode (-q) and no lockstep (-k)\n", argv[0]);
+		return FALSE;
+	}
+	if((frameInFP || frameOutFP) && (SpecJobs > 1 || LockstepCount)){
+		printf("\nError: %s - streaming frames (-fi/-fo) cannot be used with -p or -k\n", argv[0]);
+		return FALSE;
+	}
+	if(genSpec && (SpecJobs > 1 || LockstepCount)){
+		printf("\nError: %s - test vector generator (-g) cannot be used with -p or -k\n", argv[0]);
+		return FALSE;
+	}
+	if((checksumExpFP || checksumOutFP) && !checksumList){
+		printf("\nError: %s - -ce/-co need checksum items (-ck)\n", argv[0]);
+		return FALSE;
+	}
+	if(checksumList && SpecJobs > 1){
+		printf("\nError: %s - checksums (-ck) cannot be used with parallel iterations (-p)\n", argv[0]);
+		return FALSE;
+	}
+	if(goldFP && SpecJobs > 1){
+		printf("\nError: %s - golden comparison (-gold) cannot be used with parallel iterations (-p)\n", argv[0]);
+		return FALSE;
+	}
+	if(frameInFP && !itrGiven){		/* run until end of input stream */
+		ItrMax = FRAME_ITRMAX;
+	}
+	return TRUE;
+}
 
-			/* if binary code dump mode set */
-//			if(BinDumpMode || AssemblerMode){
-			if(AssemblerMode){
 
-				/* .lst file open */
-				changeFilenameExt(filebuf, argv[i], "lst");
-				printf("list filename: %s\n", filebuf);
-				if(!(dumpLstFP = fopen(filebuf, "wt"))){
-					printFileOpenError(argv[0], filebuf);
-					return FALSE;
-				}
-				printFileHeader(dumpLstFP, filebuf);
+/** 
+* @brief Open source file (yyin) and the error and assembler output files of it.
+* 
+* @param prog Name of program
+* @param src Source filename (.asm)
+* 
+* @return TRUE if success
+*/
+int openSourceFiles(char *prog, char *src)
+{
+	infile = src;
 
-				/* .sym file open */
-				changeFilenameExt(filebuf, argv[i], "sym");
-				printf("symbol table filename: %s\n", filebuf);
-				if(!(dumpSymFP = fopen(filebuf, "wt"))){
-					printFileOpenError(argv[0], filebuf);
-					return FALSE;
-				}
-				printFileHeader(dumpSymFP, filebuf);
+	if(!infile) {
+		printf("\nError: %s - no input file\n", prog);
+		return FALSE;
+	}
 
-				/* file open */
-				changeFilenameExt(filebuf, argv[i], "bin");
-				printf("binary code dump filename: %s\n", filebuf);
-				if(!(dumpBinFP = fopen(filebuf, "wb"))){
-					printFileOpenError(argv[0], filebuf);
-					return FALSE;
-				}
+	yyin = fopen(infile, "r");
+	if(yyin == NULL){	/* open failed */
+		printf("\nError: %s - cannot open %s\n", prog, infile);
+		return FALSE;
+	}
 
-				changeFilenameExt(filebuf, argv[i], "mem");
-				printf("binary memory dump filename: %s\n", filebuf);
-				if(!(dumpMemFP = fopen(filebuf, "wb"))){
-					printFileOpenError(argv[0], filebuf);
-					return FALSE;
-				}
-				printMemFileHeader(dumpMemFP);
+	if(!compareFilenameExt(filebuf, infile, "asm")){
+		printf("\nError: %s - input filename extension must be \".asm\"\n", infile);
+		return FALSE;	
+	}
 
-				changeFilenameExt(filebuf, argv[i], "obj");
-				printf("object filename: %s\n", filebuf);
-				if(!(dumpTxtFP = fopen(filebuf, "wt"))){
-					printFileOpenError(argv[0], filebuf);
-					return FALSE;
-				}
-				printFileHeader(dumpTxtFP, filebuf);
-    			fprintf(dumpTxtFP, 
-					";-----------------------------------------------------------\n");
-			}
+	/* unchanged source: outputs from assembly cache, no files opened */
+	if(AssemblerMode && AsmCacheDir && asmCacheLoad(infile)){
+		fclose(yyin);
+		yyin = NULL;
+		return TRUE;
+	}
+
+	/* .err file open */
+	changeFilenameExt(filebuf, src, "err");
+	printf("error message filename: %s\n", filebuf);
+	if(!(dumpErrFP = asyncOpen(filebuf, "wt"))){
+		printFileOpenError(prog, filebuf);
+		return FALSE;
+	}
+	printFileHeader(dumpErrFP, filebuf);
+
+	/* if binary code dump mode set */
+//	if(BinDumpMode || AssemblerMode){
+	if(AssemblerMode){
+
+		/* .lst file open */
+		changeFilenameExt(filebuf, src, "lst");
+		printf("list filename: %s\n", filebuf);
+		if(!(dumpLstFP = asyncOpen(filebuf, "wt"))){
+			printFileOpenError(prog, filebuf);
+			return FALSE;
+		}
+		printFileHeader(dumpLstFP, filebuf);
+
+		/* .sym file open */
+		changeFilenameExt(filebuf, src, "sym");
+		printf("symbol table filename: %s\n", filebuf);
+		if(!(dumpSymFP = asyncOpen(filebuf, "wt"))){
+			printFileOpenError(prog, filebuf);
+			return FALSE;
+		}
+		printFileHeader(dumpSymFP, filebuf);
+
+		/* file open */
+		changeFilenameExt(filebuf, src, "bin");
+		printf("binary code dump filename: %s\n", filebuf);
+		if(!(dumpBinFP = asyncOpen(filebuf, "wb"))){
+			printFileOpenError(prog, filebuf);
+			return FALSE;
+		}
+
+		changeFilenameExt(filebuf, src, "mem");
+		printf("binary memory dump filename: %s\n", filebuf);
+		if(!(dumpMemFP = asyncOpen(filebuf, "wb"))){
+			printFileOpenError(prog, filebuf);
+			return FALSE;
 		}
+		printMemFileHeader(dumpMemFP);
+
+		changeFilenameExt(filebuf, src, "obj");
+		printf("object filename: %s\n", filebuf);
+		if(!(dumpTxtFP = asyncOpen(filebuf, "wt"))){
+			printFileOpenError(prog, filebuf);
+			return FALSE;
+		}
+		printFileHeader(dumpTxtFP, filebuf);
+		fprintf(dumpTxtFP, 
+			";-----------------------------------------------------------\n");
 	}
-#endif
+
 	return TRUE;
 }
 
@@ -592,12 +1091,30 @@ void printHelp(char *s)
 		printf("\t-q [--quiet]  \tprint only summary information (no human input)\n");
 		printf("\t-c            \trun in continuous mode\n");
 		printf("\t-l number     \tspecify number of loop iterations [default: %d]\n", DEF_ITRMAX);
-		printf("\t-if filename  \tload data memory from file (format: a decimal number per line)\n");
+		printf("\t-if filename  \tload data memory from file (format: a decimal number per line, or .dmi image)\n");
 		printf("\t-ia hexnumber \tload data memory start address (absolute addr) [default: 0000]\n");
 		printf("\t-is words     \tnumber of words to load into data memory [default: %d]\n", DEF_DUMPINSIZE);
-		printf("\t-of filename  \tdump data memory into file\n");
+		printf("\t-of filename  \tdump data memory into file (binary image if filename ends with .dmi)\n");
 		printf("\t-oa hexnumber \tdump data memory start address (absolute addr) [default: 0000]\n");
 		printf("\t-os words     \tnumber of words to dump from data memory [default: %d]\n", DEF_DUMPOUTSIZE);
+		printf("\t-rf filename  \tload/dump data memory regions listed in region spec file\n");
+		printf("\t-g spec       \tgenerate test vectors before each iteration (tone, chirp, qam, ofdm, awgn; see testvec.cc)\n");
+		printf("\t-ga hexnumber \ttest vector start address (absolute addr) [default: 0000]\n");
+		printf("\t-gs words     \tnumber of words generated per iteration [default: %d]\n", DEF_GENSIZE);
+		printf("\t-ck items     \tCRC32C of regions/registers after each iteration (e.g. y,x0+4/8,0x4000/16,R0)\n");
+		printf("\t-ce filename  \tcompare checksums with file; stop at first mismatch\n");
+		printf("\t-co filename  \twrite checksums into file (instead of stdout)\n");
+		printf("\t-gold filename\tcompare output with next golden frame after each iteration (text or .dmi stream)\n");
+		printf("\t-golda hexnumber\tgolden comparison start address (absolute addr) [default: 0000]\n");
+		printf("\t-golds words  \tnumber of words compared per iteration [default: %d]\n", DEF_GOLDSIZE);
+		printf("\t-goldt tol    \tcomparison tolerance: exact, lsb=N or snr=dB [default: exact]\n");
+		printf("\t-goldx        \tstop at first failing iteration (exit code 1)\n");
+		printf("\t-fi filename  \tload next frame from stream before each iteration (text or .dmi stream)\n");
+		printf("\t-fia hexnumber\tframe input start address (absolute addr) [default: 0000]\n");
+		printf("\t-fis words    \tnumber of words per input frame [default: %d]\n", DEF_FRAMESIZE);
+		printf("\t-fo filename  \tappend frame to stream after each iteration (.dmi stream if filename ends with .dmi)\n");
+		printf("\t-foa hexnumber\tframe output start address (absolute addr) [default: 0000]\n");
+		printf("\t-fos words    \tnumber of words per output frame [default: %d]\n", DEF_FRAMESIZE);
 //		printf("\t-b            \tbinary code dump after execution (.bin & .mem)\n");
 		printf("\t-a            \tassembler mode (no simulation)\n");
 		printf("\t-u            \tallow unaligned memory access\n");
@@ -606,7 +1123,18 @@ void printHelp(char *s)
 		printf("\t-4            \tQuad data path mode (4 SIMD)\n");
 		printf("\t-4f           \tforce quad data path display mode (4 SIMD)\n");
 		printf("\t-x            \tsuppress undefined data memory message mode\n");
+		printf("\t-p number     \trun number (1~%d) iterations of -l in parallel, speculatively\n", MAX_SPECJOBS);
+		printf("\t-k number     \trun number (1~%d) instances of a single data path program in lockstep\n", NUMDP);
+		printf("\t-pc           \tcache parsed program in <file>.pim, reuse it while unchanged\n");
+		printf("\t-server path  \trun as simulation server on unix socket (no filename)\n");
+		printf("\t-cache number \tnumber of programs cached by server [default: %d]\n", DEF_SERVERCACHE);
+		printf("\t-jobs number  \tnumber of concurrent server jobs [default: %d]\n", DEF_SERVERJOBS);
+		printf("\t              \twith -a and several filenames: number of assembler workers [default: CPUs]\n");
+#else
+		printf("\t-jobs number  \tnumber of assembler workers for several filenames [default: CPUs]\n");
 #endif
+		printf("\t-acache dir   \twith -a: reuse outputs of unchanged sources from cache directory\n");
+		printf("\t-bundle       \tpack independent instructions into multifunction instructions\n");
 ////////////////////////////////////////////////////////////////////////////////////////////////////////
 //	/* delay slot mode option disabled in v2.07 (2010/06/01) */
 //		printf("\t-d            \tenable delay slot\n");
@@ -680,7 +1208,7 @@ int getFilenameExt(char *buf, char *filename, int *sp)
 * 
 * @return 1 if success, 0 otherwise
 */
-int changeFilenameExt(char *buf, char *filename, char *newext)
+int changeFilenameExt(char *buf, char *filename, const char *newext)
 {
 	int success = FALSE;
 	char oldext[MAX_LINEBUF];
@@ -720,7 +1248,7 @@ int changeFilenameExt(char *buf, char *filename, char *newext)
 * 
 * @return 1 if old extension is same as new extension, 0 otherwise
 */
-int compareFilenameExt(char *oldext, char *filename, char *newext)
+int compareFilenameExt(char *oldext, char *filename, const char *newext)
 {
 	int success = FALSE;
 	int sp;
@@ -14,6 +14,7 @@ All Rights Reserved.
 #include <assert.h>
 #include "dspsim.h"
 #include "memref.h"
+#include "arena.h"
 //#include "simsupport.h"
 
 /** 
@@ -26,7 +27,7 @@ All Rights Reserved.
 sMemRef *sMemRefGetNode(int addr)
 {
 	sMemRef *p;
-	p = (sMemRef *)calloc(1, sizeof(sMemRef));
+	p = (sMemRef *)arenaAlloc(curArena, sizeof(sMemRef));
 	assert(p != NULL);
 
 	p->Addr = addr;
@@ -111,8 +112,7 @@ void sMemRefListRemoveAfter(sMemRefList *list, sMemRef *p)
 			if(obsoleteNode->Next == NULL){	/* if it is LastNode */
 				list->LastNode = p;		/* update LastNode */
 			}
-			/* free node */
-			free(obsoleteNode);
+			/* node stays in program arena until arenaFree() */
 		}
 	}
 }
@@ -128,12 +128,10 @@ sMemRef *sMemRefListRemoveBeginning(sMemRefList *list)
 {
 	if(list != NULL){
 		if(list->FirstNode != NULL){
-			sMemRef *obsoleteNode = list->FirstNode;
 			list->FirstNode = list->FirstNode->Next;
 			if(list->FirstNode == NULL) list->LastNode = NULL; /* removed last node */
 
-			/* free node */
-			free(obsoleteNode);
+			/* node stays in program arena until arenaFree() */
 			return list->FirstNode;	/* return new FirstNode */
 		} else {
 			return NULL;
@@ -143,14 +141,14 @@ sMemRef *sMemRefListRemoveBeginning(sMemRefList *list)
 
 /** 
 * @brief Remove all nodes in the list.
+* * Note: Nodes are freed with the program arena (arenaFree()). 
 * 
 * @param list Pointer to linked list
 */
 void sMemRefListRemoveAll(sMemRefList *list)
 {
-	while(list->FirstNode != NULL){
-		sMemRefListRemoveBeginning(list);
-	}
+	list->FirstNode = NULL;
+	list->LastNode = NULL;
 }
 
 /** 
@@ -0,0 +1,143 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file mkophash.cc
+* Generate ophash.cc: minimal perfect hashes over sOp[] and sResSym[]
+*
+* Hash and displace: keys are spread over Size/4 buckets by the seeded
+* hash; buckets are placed largest first, each with the first
+* displacement whose slot hashes hit only free slots. Usage:
+* "mkophash > ophash.cc" (see makefile). Output depends only on dspdef.cc.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include "dspdef.h"
+#include "optab.h"
+
+#define	MAX_HASHKEYS	1024		/**< max. number of names in a table */
+#define	MAX_DISP		65535		/**< displacement must fit unsigned short */
+
+/**
+* @brief Build one perfect hash and print it as C source.
+*
+* @param name Table name in generated source (opHash, resSymHash)
+* @param names String table
+* @param first Index of first name to include
+* @param tname Name of string table in generated source
+*
+* @return TRUE if success
+*/
+static int genHash(const char *name, const char **names, int first, const char *tname)
+{
+	static int key[MAX_HASHKEYS];				/* index into names */
+	static int bucketOf[MAX_HASHKEYS];
+	static int order[MAX_HASHKEYS];
+	static int slot[MAX_HASHKEYS];				/* index into names, -1 if free */
+	static unsigned short disp[MAX_HASHKEYS];
+	static int size[MAX_HASHKEYS];
+	int n = 0;
+
+	/* keys: first of case-insensitive duplicates wins, as in the old table */
+	for(int i = first; names[i] != NULL; i++){
+		int dup = 0;
+
+		for(int j = 0; j < n; j++){
+			if(!strcasecmp(names[key[j]], names[i])) dup = 1;
+		}
+		if(!dup){
+			if(n == MAX_HASHKEYS) return 0;
+			key[n++] = i;
+		}
+	}
+
+	int buckets = (n + 3) / 4;
+
+	for(unsigned int seed = 1; seed < 1000; seed++){
+		int nb = 0, ok = 1;
+
+		for(int b = 0; b < buckets; b++){
+			size[b] = 0;
+			disp[b] = 0;
+		}
+		for(int k = 0; k < n; k++){
+			bucketOf[k] = oHashKey(names[key[k]], seed) % buckets;
+			size[bucketOf[k]]++;
+		}
+		for(int k = 0; k < n; k++) slot[k] = -1;
+
+		/* buckets, largest first */
+		for(int b = 0; b < buckets; b++) order[nb++] = b;
+		for(int i = 1; i < nb; i++){
+			int b = order[i], j = i;
+
+			while(j > 0 && size[order[j-1]] < size[b]){
+				order[j] = order[j-1];
+				j--;
+			}
+			order[j] = b;
+		}
+
+		for(int o = 0; o < nb && ok; o++){
+			int b = order[o];
+			int placed = 0;
+
+			if(!size[b]) continue;
+			for(unsigned int d = 0; d <= MAX_DISP && !placed; d++){
+				int used[8], u = 0, fit = 1;
+
+				for(int k = 0; k < n && fit; k++){
+					if(bucketOf[k] != b) continue;
+					int s = oHashKey(names[key[k]], d) % n;
+
+					if(slot[s] >= 0 || u == 8) fit = 0;
+					for(int x = 0; x < u; x++){
+						if(used[x] == s) fit = 0;
+					}
+					used[u++] = s;
+				}
+				if(fit){
+					u = 0;
+					for(int k = 0; k < n; k++){
+						if(bucketOf[k] == b) slot[used[u++]] = key[k];
+					}
+					disp[b] = d;
+					placed = 1;
+				}
+			}
+			if(!placed) ok = 0;
+		}
+		if(!ok) continue;
+
+		printf("static const unsigned short %sDisp[%d] = {", name, buckets);
+		for(int b = 0; b < buckets; b++) printf("%s%u,", (b % 12) ? " " : "\n\t", disp[b]);
+		printf("\n};\n\n");
+		printf("static const unsigned short %sSlot[%d] = {", name, n);
+		for(int s = 0; s < n; s++) printf("%s%d,", (s % 12) ? " " : "\n\t", slot[s]);
+		printf("\n};\n\n");
+		printf("extern \"C\" const oHashTable %s = {\n", name);
+		printf("\t%u, %d, %d, %sDisp, %sSlot, %s\n};\n\n", seed, buckets, n, name, name, tname);
+		return 1;
+	}
+	return 0;
+}
+
+int main(void)
+{
+	printf("/*\nAll Rights Reserved.\n*/\n");
+	printf("/**\n* @file ophash.cc\n");
+	printf("* Perfect hashes over sOp[] and sResSym[] - generated by mkophash, do not edit\n*/\n\n");
+	printf("#include \"dspdef.h\"\n#include \"optab.h\"\n\n");
+
+	/* sOp[0] (comment-only line) is not an opcode */
+	if(!genHash("opHash", sOp, 1, "sOp")
+		|| !genHash("resSymHash", sResSym, 0, "sResSym")){
+		fprintf(stderr, "mkophash: no perfect hash found\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,304 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file n1dsim.cc
+* @brief Embeddable simulator library (libn1dsim.so): C API over the dspsim core
+*
+* The library keeps one program loaded in the dspsim global tables and
+* steps it with the same inner loop as simCore(), without the interactive
+* commands. Host buffers are mapped into data memory with dMemMapAdd(), so
+* no -if/-of text conversion is needed between the host and the model.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "icode.h"
+#include "dmem.h"
+#include "optab.h"
+#include "secinfo.h"
+#include "simcore.h"
+#include "simsupport.h"
+#include "simserver.h"
+#include "arena.h"
+#include "dspdef.h"
+#include "n1dsim.h"
+
+static int libTablesReady = FALSE;		/**< TRUE after global tables init */
+static int libLoaded = FALSE;			/**< TRUE if a program is loaded */
+static sICode *libNextCode = NULL;		/**< next instruction to execute; NULL at end */
+static dMemList libInitDataMem[MAX_HASHTABLE];	/**< data memory right after loading */
+
+/**
+* @brief Release currently loaded program.
+*/
+static void libFreeProgram(void)
+{
+	sICodeListRemoveAll(&iCode);
+	sTabHashRemoveAll(&symTable);
+	dMemHashRemoveAll(dataMem);
+	dMemHashRemoveAll(libInitDataMem);
+	sSecInfoListRemoveAll(&secInfo);
+	arenaFree(&progArena);
+
+	iCodeInit(&iCode);
+	symTableInit(&symTable);
+	dataMemInit(dataMem);
+	dataMemInit(libInitDataMem);
+	secInfoInit(&secInfo);
+
+	libLoaded = FALSE;
+	libNextCode = NULL;
+}
+
+/**
+* @brief Assemble a .asm program and make it the current program.
+* The simulator is reset; previous program and its state are released.
+*
+* @param path Source filename
+*
+* @return 1 if success, 0 on assembler error
+*/
+int n1dsim_load(const char *path)
+{
+	if(!libTablesReady){
+		iCodeInit(&iCode);
+		symTableInit(&symTable);
+		dataMemInit(dataMem);
+		dataMemInit(libInitDataMem);
+		secInfoInit(&secInfo);
+		libTablesReady = TRUE;
+	}else{
+		libFreeProgram();
+	}
+
+	if(!dumpErrFP) dumpErrFP = stderr;
+	SimMode = 'C';
+	QuietMode = TRUE;
+
+	if(!parseProgram((char *)path)){
+		libFreeProgram();
+		return FALSE;
+	}
+
+	dMemHashCopy(libInitDataMem, dataMem);
+	libLoaded = TRUE;
+	return n1dsim_reset();
+}
+
+/**
+* @brief Select SIMD data path mode; effective from next n1dsim_reset().
+*
+* @param simd 1, 2 or 4
+*
+* @return 1 if success, 0 if invalid mode
+*/
+int n1dsim_set_mode(int simd)
+{
+	if(simd != 1 && simd != 2 && simd != 4) return FALSE;
+
+	SIMD1Mode = (simd == 1);
+	SIMD2Mode = (simd == 2);
+	SIMD4Mode = (simd == 4);
+	return TRUE;
+}
+
+/**
+* @brief Map a host buffer over a data memory range (zero-copy).
+*
+* @param addr First data memory address
+* @param words Number of addresses
+* @param buf Host buffer of words * lanes signed 16-bit values
+* @param lanes Lanes per address in buf (1 ~ 4)
+*
+* @return 1 if success, 0 if overlapping, too many maps or bad argument
+*/
+int n1dsim_map(unsigned int addr, unsigned int words, short *buf, int lanes)
+{
+	return dMemMapAdd(addr, words, buf, lanes);
+}
+
+/**
+* @brief Remove host buffer mapping.
+*
+* @param addr First data memory address given to n1dsim_map()
+*
+* @return 1 if removed, 0 if not mapped
+*/
+int n1dsim_unmap(unsigned int addr)
+{
+	return dMemMapRemove(addr);
+}
+
+/**
+* @brief Reset registers, data memory, cycle & overflow counters and PC.
+* Mapped host buffers are left as they are.
+*
+* @return 1 if success, 0 if no program or run-time error
+*/
+int n1dsim_reset(void)
+{
+	if(!libLoaded) return FALSE;
+
+	dMemHashRemoveAll(dataMem);
+	dataMemInit(dataMem);
+	dMemHashCopy(dataMem, libInitDataMem);
+
+	RunTimeErrorCatch = TRUE;
+	if(setjmp(RunTimeErrorJmp)){
+		RunTimeErrorCatch = FALSE;
+		libNextCode = NULL;
+		return FALSE;
+	}
+
+	InitSimMode = TRUE;
+	initSim();
+	InitSimMode = FALSE;
+	RunTimeErrorCatch = FALSE;
+
+	Cycles = 0;
+	for(int j = 0; j < NUMDP; j++) OVCount.dp[j] = 0;
+	ItrCntr = 0;
+	libNextCode = updatePC(NULL, iCode.FirstNode);
+	return TRUE;
+}
+
+/**
+* @brief Restart program from the first instruction keeping all state,
+* like the next iteration of -l.
+*
+* @return 1 if success, 0 if no program
+*/
+int n1dsim_rewind(void)
+{
+	if(!libLoaded) return FALSE;
+
+	ItrCntr++;
+	libNextCode = updatePC(NULL, iCode.FirstNode);
+	return TRUE;
+}
+
+/**
+* @brief Run until a stop condition.
+* The instruction at until_pc is not a stop condition for the very first
+* instruction executed, so consecutive calls with the same until_pc advance.
+*
+* @param max_cycles Cycle budget for this call; 0 for no limit
+* @param until_pc Stop before the instruction at this PMA; -1 for none
+*
+* @return N1DSIM_END, N1DSIM_IDLE, N1DSIM_PC, N1DSIM_CYCLES or N1DSIM_ERROR
+*/
+int n1dsim_run(long max_cycles, int until_pc)
+{
+	sICode *oldp;
+	long start = Cycles;
+	int first = TRUE;
+	int ret;
+
+	if(!libLoaded) return N1DSIM_ERROR;
+	if(!libNextCode) return N1DSIM_END;
+
+	RunTimeErrorCatch = TRUE;
+	if(setjmp(RunTimeErrorJmp)){
+		RunTimeErrorCatch = FALSE;
+		libNextCode = NULL;
+		return N1DSIM_ERROR;
+	}
+
+	while(TRUE){
+		if(!libNextCode){
+			ret = N1DSIM_END;
+			break;
+		}
+		if(!first && (until_pc >= 0) && (libNextCode->PMA == (unsigned int)until_pc)
+			&& !isNotRealInst(libNextCode->Index)){
+			ret = N1DSIM_PC;
+			break;
+		}
+		if((max_cycles > 0) && (Cycles - start >= max_cycles)){
+			ret = N1DSIM_CYCLES;
+			break;
+		}
+
+		/* same as simCore() inner loop */
+		oldp = libNextCode;
+		libNextCode = asmSimOneStep(libNextCode, iCode);
+		if(libNextCode) libNextCode->LastExecuted = oldp;
+
+		if(!isNotRealInst(oldp->Index)) {
+			Cycles += oldp->Latency;
+			if(oldp->LatencyAdded){
+				Cycles += oldp->LatencyAdded;
+				oldp->LatencyAdded = 0;
+			}
+			first = FALSE;
+		}
+
+		if(oldp->Index == iIDLE){
+			ret = N1DSIM_IDLE;
+			break;
+		}
+	}
+
+	RunTimeErrorCatch = FALSE;
+	return ret;
+}
+
+/**
+* @brief Total cycles since last reset.
+*
+* @return Cycles
+*/
+long n1dsim_cycles(void)
+{
+	return Cycles;
+}
+
+/**
+* @brief PMA of next instruction to execute.
+*
+* @return PC, -1 if program ended
+*/
+int n1dsim_pc(void)
+{
+	return libNextCode ? (int)libNextCode->PMA : -1;
+}
+
+/**
+* @brief Read register by assembler name, e.g. "R0", "ACC1.H", "_CNTR", "UMCOUNT".
+*
+* @param name Register name
+* @param lane Data path number (0 ~ 3)
+* @param value Pointer to store register value
+*
+* @return 1 if success, 0 if invalid name or lane
+*/
+int n1dsim_reg(const char *name, int lane, int *value)
+{
+	sint v;
+
+	if(lane < 0 || lane >= NUMDP) return FALSE;
+	if(!isRegName((char *)name)) return FALSE;
+
+	v = sRdReg((char *)name);
+	*value = v.dp[lane];
+	return TRUE;
+}
+
+/**
+* @brief Release program, mappings and all tables.
+*/
+void n1dsim_close(void)
+{
+	if(!libTablesReady) return;
+
+	libFreeProgram();
+	dataMemMapCntr = 0;
+	libTablesReady = FALSE;
+}
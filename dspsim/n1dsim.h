@@ -0,0 +1,56 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file n1dsim.h
+* @brief C API of the embeddable simulator library (libn1dsim.so)
+*
+* Typical use from a host simulator:
+* @code
+*	short buf[64*4];
+*	n1dsim_load("fft.asm");
+*	n1dsim_set_mode(4);
+*	n1dsim_map(0x1000, 64, buf, 4);		// DM 0x1000~0x103F lives in buf
+*	n1dsim_reset();
+*	while(n1dsim_run(0, -1) == N1DSIM_IDLE) {
+*		... consume/produce buf ...
+*	}
+*	n1dsim_close();
+* @endcode
+*
+* Mapped buffers are not copied: the simulator reads and writes them in
+* place, one signed 16-bit word per lane, buf[(addr - start) * lanes + lane].
+* @date 2026-10-19
+*/
+
+#ifndef	_N1DSIM_H
+#define	_N1DSIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** n1dsim_run() stop reasons */
+#define	N1DSIM_ERROR	-1		/**< run-time error; see message on stdout */
+#define	N1DSIM_END		0		/**< end of program reached */
+#define	N1DSIM_IDLE		1		/**< IDLE instruction executed */
+#define	N1DSIM_PC		2		/**< next instruction is at given PC */
+#define	N1DSIM_CYCLES	3		/**< cycle budget used up */
+
+int n1dsim_load(const char *path);
+int n1dsim_set_mode(int simd);
+int n1dsim_map(unsigned int addr, unsigned int words, short *buf, int lanes);
+int n1dsim_unmap(unsigned int addr);
+int n1dsim_reset(void);
+int n1dsim_rewind(void);
+int n1dsim_run(long max_cycles, int until_pc);
+long n1dsim_cycles(void);
+int n1dsim_pc(void);
+int n1dsim_reg(const char *name, int lane, int *value);
+void n1dsim_close(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	/* _N1DSIM_H */
@@ -0,0 +1,48 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file ophash.cc
+* Perfect hashes over sOp[] and sResSym[] - generated by mkophash, do not edit
+*/
+
+#include "dspdef.h"
+#include "optab.h"
+
+static const unsigned short opHashDisp[32] = {
+	7, 120, 80, 50, 82, 77, 233, 140, 58, 204, 2, 0,
+	4, 14, 14, 24, 0, 7, 9, 6, 13, 25, 904, 101,
+	6, 547, 439, 123, 5, 31, 51, 1105,
+};
+
+static const unsigned short opHashSlot[127] = {
+	126, 121, 68, 109, 127, 108, 104, 120, 111, 44, 9, 105,
+	35, 96, 42, 123, 112, 57, 66, 27, 74, 16, 30, 23,
+	55, 43, 53, 77, 102, 61, 6, 69, 24, 67, 37, 29,
+	101, 79, 7, 87, 39, 98, 95, 103, 13, 119, 10, 82,
+	56, 88, 59, 80, 78, 31, 60, 20, 63, 99, 117, 110,
+	116, 3, 18, 86, 21, 1, 47, 92, 32, 15, 84, 81,
+	113, 46, 71, 62, 85, 70, 115, 25, 89, 118, 90, 91,
+	94, 100, 93, 38, 48, 5, 34, 33, 8, 2, 4, 58,
+	73, 26, 28, 36, 106, 14, 54, 83, 114, 51, 76, 40,
+	52, 125, 17, 12, 49, 45, 64, 107, 22, 11, 41, 124,
+	122, 75, 65, 97, 72, 19, 50,
+};
+
+extern "C" const oHashTable opHash = {
+	8, 32, 127, opHashDisp, opHashSlot, sOp
+};
+
+static const unsigned short resSymHashDisp[4] = {
+	28, 5, 10, 0,
+};
+
+static const unsigned short resSymHashSlot[15] = {
+	5, 9, 11, 0, 7, 1, 12, 14, 3, 4, 2, 6,
+	8, 10, 13,
+};
+
+extern "C" const oHashTable resSymHash = {
+	1, 4, 15, resSymHashDisp, resSymHashSlot, sResSym
+};
+
@@ -0,0 +1,702 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file oprmatch.cc
+* @brief Table-driven operand pattern matching of codeScanOneInst()
+*
+* The instruction forms of an opcode used to be an if-else chain of is*()
+* predicates, so one operand was parsed again for every form tried. Here
+* each operand is classified once into a set of operand kinds (sOprClass),
+* and the forms of the opcode (sOprForm tables below) are matched against
+* these sets in the order of the former chain. Adding a form is a table edit.
+*
+* The predicates report some near misses (e.g. R3 as a complex register,
+* ACC9) with printRunTimeError(). The classifier marks these in Err without
+* a message, and the matcher then calls the predicate itself at the same
+* point of the search, so the diagnostics do not change.
+*
+* Multifunction instructions (codeScanOneInstMultiFunc()) are selected by the
+* opcode classes of their slots (oprFormMultiFunc[]); each form lists its
+* operand checks with their error messages, in the order of the former chain.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "icode.h"
+#include "simsupport.h"
+#include "dspdef.h"
+#include "optab.h"	/* for sOp */
+#include "oprmatch.h"
+
+#define	OK(k)	(1u << (k))
+
+/**
+* @brief Classify accumulator operands: ACC12, ACC24, ACC32, ACC64 as
+* isACC12() ... isACC64(). The result is written in kind bits of
+* DREG12 (ACC12), DREG24 (ACC24), ACC32 and ACC64.
+*
+* @param c Operand kinds to update
+* @param s Operand string
+*/
+static void oprClassifyACC(sOprClass *c, char *s)
+{
+	if(!strcasecmp("NONE", s)){
+		c->Is |= OK(okDREG12) | OK(okDREG24) | OK(okACC32) | OK(okACC64);
+		return;
+	}
+	if(strncasecmp(s, "ACC", 3) || !isdigit(s[3])) return;
+
+	int val = s[3] - '0';
+	int odd = val & 0x01;
+
+	/* ACC32, ACC64: ACCx, and ACCx.* too */
+	c->Is |= (val > 7) ? 0 : OK(okACC32);
+	c->Err |= (val > 7) ? OK(okACC32) : 0;
+	c->Is |= (val > 7 || odd) ? 0 : OK(okACC64);
+	c->Err |= (val > 7 || odd) ? OK(okACC64) : 0;
+
+	/* ACC12, ACC24: ACCx.H, ACCx.M, ACCx.L */
+	if(s[4] == '.'){
+		int hml = !strcasecmp(s+5, "H") || !strcasecmp(s+5, "M") || !strcasecmp(s+5, "L");
+
+		if(val > 7 || !hml) c->Err |= OK(okDREG12);
+		else c->Is |= OK(okDREG12);
+		if(odd || val > 7 || !hml) c->Err |= OK(okDREG24);
+		else c->Is |= OK(okDREG24);
+	}
+}
+
+/**
+* @brief Classify one operand string into operand kinds, without messages.
+*
+* @param p Pointer to instruction
+* @param c Operand kinds to return
+* @param s Operand string, NULL if not given
+*/
+static void oprClassify(sICode *p, sOprClass *c, char *s)
+{
+	c->Is = c->Err = c->Lazy = 0;
+	if(!s) return;
+
+	c->Is |= OK(okANY);
+	c->Lazy |= OK(okRREG16);		/* control register names: looked up when needed */
+
+	if((s[0] == 'R') || (s[0] == 'r')){
+		int len = strlen(s);
+
+		if(isReg12(p, s)) c->Is |= OK(okREG12) | OK(okXOP12) | OK(okDREG12);
+
+		/* REG24: as isReg24(), the last digit must be even */
+		if((len == 2 && isdigit(s[1])) || (len == 3 && isdigit(s[1]) && isdigit(s[2]))){
+			if((s[len-1] - '0') & 0x01) c->Err |= OK(okXOP24) | OK(okDREG24);
+			else c->Is |= OK(okXOP24) | OK(okDREG24);
+		}
+	}else{
+		oprClassifyACC(c, s);
+	}
+
+	if(isdigit(s[0]) || (s[0] == '-')) c->Is |= OK(okINT);
+	else c->Lazy |= OK(okINT);		/* symbol: looked up when needed */
+}
+
+/**
+* @brief Check operand kind with its is*() predicate, reporting errors.
+*
+* @param p Pointer to instruction
+* @param kind Operand kind (enum eOprKind)
+* @param s Operand string
+*
+* @return TRUE if operand is of kind
+*/
+static int oprCheck(sICode *p, int kind, char *s)
+{
+	switch(kind){
+		case	okANY:		return (s != NULL);
+		case	okREG12:	return isReg12(p, s);
+		case	okXOP12:	return isXOP12(p, s);
+		case	okDREG12:	return isDReg12(p, s);
+		case	okXOP24:	return isXOP24(p, s);
+		case	okDREG24:	return isDReg24(p, s);
+		case	okACC32:	return isACC32(p, s);
+		case	okACC64:	return isACC64(p, s);
+		case	okRREG16:	return isRReg16(p, s);
+		case	okINT:		return isInt(s);
+	}
+	return FALSE;
+}
+
+/**
+* @brief Select instruction type of p from the forms of its opcode.
+*
+* @param p Pointer to instruction
+* @param form Forms of the opcode, ended by Type 0
+*
+* @return TRUE if p->InstType was set, FALSE if no form matched
+*/
+int oprMatch(sICode *p, const sOprForm *form)
+{
+	sOprClass c[MAX_FORMOPR];
+	unsigned int done = 0;		/* bit k set: Operand[k] classified */
+
+	for(const sOprForm *f = form; f->Type; f++){
+		int k;
+
+		for(k = 0; k < MAX_FORMOPR && f->Kind[k] != okEND; k++){
+			unsigned int m = OK(f->Kind[k]);
+			char *s = p->Operand[k];
+
+			if(!(done & (1u << k))){
+				oprClassify(p, &c[k], s);
+				done |= 1u << k;
+			}
+			if(c[k].Lazy & m){		/* predicate without messages */
+				if(oprCheck(p, f->Kind[k], s)) c[k].Is |= m;
+				c[k].Lazy &= ~m;
+			}
+			if(c[k].Err & m){
+				/* near miss: the predicate reports it */
+				if(!oprCheck(p, f->Kind[k], s)) break;
+			}else if(!(c[k].Is & m)){
+				break;
+			}
+		}
+		if(k < MAX_FORMOPR && f->Kind[k] != okEND) continue;
+
+		if(f->Imm >= 0 && !isIntNM(p, &symTable, p->Operand[f->Imm], f->Lo, f->Hi))
+			return FALSE;
+		p->InstType = f->Type;
+		return TRUE;
+	}
+	return FALSE;
+}
+
+/**
+* @brief Run one multifunction check.
+*
+* @param p Pointer to instruction
+* @param q Slots: p, p->Multi[0], p->Multi[1]
+* @param c Check
+*
+* @return TRUE if the check passes
+*/
+static int oprMFTest(sICode *p, sICode **q, const sMFCheck *c)
+{
+	char *s = q[c->Slot]->Operand[c->Opr];
+
+	switch(c->Check){
+		case	mcREG12S:	return isReg12S(p, s);
+		case	mcREG24S:	return isReg24S(p, s);
+		case	mcDREG12S:	return isDReg12S(p, s);
+		case	mcDREG24S:	return isDReg24S(p, s);
+		case	mcACC32S:	return isACC32S(p, s);
+		case	mcACC64S:	return isACC64S(p, s);
+		case	mcDREG12:	return isDReg12(p, s);
+		case	mcDREG24:	return isDReg24(p, s);
+		case	mcIREG:		return isIReg(p, s);
+		case	mcMREG:		return isMReg(p, s);
+		case	mcIX:		return isIx(p, s);
+		case	mcMX:		return isMx(p, s);
+		case	mcIY:		return isIy(p, s);
+		case	mcMY:		return isMy(p, s);
+		case	mcREG12S_OPT:	return !s || isReg12S(p, s);
+		case	mcREG24S_OPT:	return !s || isReg24S(p, s);
+		case	mcGIVEN:
+		case	mcMULOPT:	return (s != NULL);
+		case	mcINT:		return isInt(s);
+		case	mcNOTNONE:	return !isNONE(p, s);
+		case	mcDIFF:		return strcasecmp(q[c->Slot]->Operand[0], q[c->Opr]->Operand[0]) != 0;
+		case	mcPOSTMOD:	return strcmp(s, "+") != 0;
+	}
+	return FALSE;		/* mcNOFORM, mcNOSUPP */
+}
+
+/**
+* @brief Select instruction type of a multifunction instruction and check
+* its operands, reporting the first error with printRunTimeError().
+*
+* @param p Pointer to instruction (first opcode)
+* @param form Multifunction forms, ended by Check NULL
+*
+* @return TRUE if p->InstType was set and all checks passed
+*/
+int oprMatchMultiFunc(sICode *p, const sMFForm *form)
+{
+	sICode *q[3];
+	int n = p->MultiCounter;
+
+	if(n != 1 && n != 2) return FALSE;
+	q[0] = p;
+	q[1] = p->Multi[0];
+	q[2] = (n == 2) ? p->Multi[1] : NULL;
+
+	for(const sMFForm *f = form; f->Check; f++){
+		if((n == 2) != (f->Op[2] != NULL)) continue;
+		if(!f->Op[0](q[0]) || !f->Op[1](q[1]) || (q[2] && !f->Op[2](q[2]))) continue;
+		if(f->Sel.Check != mcEND && !oprMFTest(p, q, &f->Sel)) continue;
+
+		if(f->Type) p->InstType = f->Type;
+		for(const sMFCheck *c = f->Check; c->Check != mcEND; c++){
+			if(oprMFTest(p, q, c)) continue;
+
+			char *s;
+			switch(c->Check){
+				case	mcMULOPT:	s = (char *)"(RND), (SS), (SU), (US), (UU)"; break;
+				case	mcINT:
+				case	mcNOSUPP:	s = (char *)sOp[q[c->Slot]->Index]; break;
+				case	mcDIFF:		s = q[c->Slot]->Operand[0]; break;
+				default:			s = q[c->Slot]->Operand[c->Opr]; break;
+			}
+			printRunTimeError(p->LineCntr, s, (char *)c->Msg);
+			return FALSE;
+		}
+		return TRUE;
+	}
+	return FALSE;
+}
+
+/*
+* Instruction forms, in the order they are tried.
+*/
+
+/** [IF COND] ABS DREG12, XOP12 (also NOT, INC, DEC) */
+const sOprForm oprFormABS[] = {
+	{ t09c, { okDREG12, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] ABS.C DREG24, XOP24[*] (also NOT.C) */
+const sOprForm oprFormABS_C[] = {
+	{ t09d, { okDREG24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] ADD (also SUB, SUBB) */
+const sOprForm oprFormADD[] = {
+	{ t09c, { okDREG12, okXOP12, okXOP12 }, IMM_NONE },			/* DREG12, XOP12, YOP12 */
+	{ t09e, { okDREG12, okXOP12, okINT }, IMM_INT(2, 4) },		/* DREG12, XOP12, IMM_INT4 */
+	{ t09g, { okACC32, okACC32, okACC32 }, IMM_NONE },			/* ACC32, ACC32, ACC32 */
+	OPR_FORM_END
+};
+
+/** [IF COND] ADDC (also SUBC, SUBBC) */
+const sOprForm oprFormADDC[] = {
+	{ t09c, { okDREG12, okXOP12, okXOP12 }, IMM_NONE },			/* DREG12, XOP12, YOP12 */
+	{ t09e, { okDREG12, okXOP12, okINT }, IMM_INT(2, 4) },		/* DREG12, XOP12, IMM_INT4 */
+	OPR_FORM_END
+};
+
+/** [IF COND] AND (also OR, XOR) */
+const sOprForm oprFormAND[] = {
+	{ t09c, { okDREG12, okXOP12, okXOP12 }, IMM_NONE },			/* DREG12, XOP12, YOP12 */
+	{ t09i, { okDREG12, okXOP12, okINT }, IMM_UINT(2, 4) },		/* DREG12, XOP12, IMM_UINT4 */
+	OPR_FORM_END
+};
+
+/** [IF COND] ASHIFT (also ASHIFTOR, LSHIFT, LSHIFTOR) */
+const sOprForm oprFormASHIFT[] = {
+	{ t16a, { okACC32, okXOP12, okXOP12, okANY }, IMM_NONE },			/* ACC32, XOP12, YOP12 (|HI, LO, HIRND, LORND|) */
+	{ t16e, { okDREG12, okXOP12, okXOP12, okANY }, IMM_NONE },			/* DREG12, XOP12, YOP12 (|NORND, RND|) */
+	{ t15a, { okACC32, okXOP12, okINT, okANY }, IMM_RANGE(2, -11, 11) },	/* ACC32, XOP12, IMM_INT5 (|HI, LO, HIRND, LORND|) */
+	{ t15c, { okACC32, okACC32, okINT, okANY }, IMM_RANGE(2, -31, 31) },	/* ACC32, ACC32, IMM_INT6 (|NORND, RND|) */
+	{ t15e, { okDREG12, okXOP12, okINT, okANY }, IMM_RANGE(2, -11, 11) },	/* DREG12, XOP12, IMM_INT5 (|NORND, RND|) */
+	OPR_FORM_END
+};
+
+/** [IF COND] ASHIFT.C (also ASHIFTOR.C, LSHIFT.C, LSHIFTOR.C) */
+const sOprForm oprFormASHIFT_C[] = {
+	{ t16b, { okACC64, okXOP24, okXOP12, okANY }, IMM_NONE },			/* ACC64, XOP24, YOP12 (|HI, LO, HIRND, LORND|) */
+	{ t16f, { okDREG24, okXOP24, okXOP12, okANY }, IMM_NONE },			/* DREG24, XOP24, YOP12 (|NORND, RND|) */
+	{ t15b, { okACC64, okXOP24, okINT, okANY }, IMM_RANGE(2, -11, 11) },	/* ACC64, XOP24, IMM_INT5 (|HI, LO, HIRND, LORND|) */
+	{ t15d, { okACC64, okACC64, okINT, okANY }, IMM_RANGE(2, -31, 31) },	/* ACC64, ACC64, IMM_INT6 (|NORND, RND|) */
+	{ t15f, { okDREG24, okXOP24, okINT, okANY }, IMM_RANGE(2, -11, 11) },	/* DREG24, XOP24, IMM_INT5 (|NORND, RND|) */
+	OPR_FORM_END
+};
+
+/** [IF COND] CLRACC ACC32 */
+const sOprForm oprFormCLRACC[] = {
+	{ t41c, { okACC32 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] CLRACC.C ACC64 */
+const sOprForm oprFormCLRACC_C[] = {
+	{ t41d, { okACC64 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] CLRBIT DREG12, XOP12, IMM_UINT4 (also SETBIT, TGLBIT, TSTBIT): bit 0 ~ 11 */
+const sOprForm oprFormCLRBIT[] = {
+	{ t09i, { okDREG12, okXOP12, okINT }, IMM_RANGE(2, 0, 11) },
+	OPR_FORM_END
+};
+
+/** [IF COND] SETINT IMM_UINT4 (also CLRINT) */
+const sOprForm oprFormSETINT[] = {
+	{ t37a, { okINT }, IMM_UINT(0, 4) },
+	OPR_FORM_END
+};
+
+/** [IF COND] CONJ.C DREG24, XOP24 */
+const sOprForm oprFormCONJ_C[] = {
+	{ t42b, { okDREG24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] CP */
+const sOprForm oprFormCP[] = {
+	{ t17a, { okDREG12, okDREG12 }, IMM_NONE },		/* DREG12, DREG12 */
+	{ t17b, { okDREG12, okRREG16 }, IMM_NONE },		/* DREG12, RREG16 */
+	{ t17b, { okRREG16, okDREG12 }, IMM_NONE },		/* RREG16, DREG12 */
+	{ t17g, { okRREG16, okRREG16 }, IMM_NONE },		/* RREG16, RREG16 */
+	{ t17c, { okACC32, okACC32 }, IMM_NONE },		/* ACC32, ACC32 */
+	{ t17h, { okACC32, okDREG12 }, IMM_NONE },		/* ACC32, DREG12 */
+	OPR_FORM_END
+};
+
+/** [IF COND] CP.C */
+const sOprForm oprFormCP_C[] = {
+	{ t17d, { okDREG24, okDREG24 }, IMM_NONE },		/* DREG24, DREG24 */
+	{ t17e, { okDREG24, okRREG16 }, IMM_NONE },		/* DREG24, RREG16 */
+	{ t17e, { okRREG16, okDREG24 }, IMM_NONE },		/* RREG16, DREG24 */
+	{ t17f, { okACC64, okACC64 }, IMM_NONE },		/* ACC64, ACC64 */
+	OPR_FORM_END
+};
+
+/** [IF COND] DIVS REG12, XOP12, YOP12 (also DIVQ) */
+const sOprForm oprFormDIVS[] = {
+	{ t23a, { okREG12, okXOP12, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] DPID DREG12 */
+const sOprForm oprFormDPID[] = {
+	{ t18c, { okDREG12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] EXP DREG12, XOP12 (|HIX, HI, LO|) */
+const sOprForm oprFormEXP[] = {
+	{ t16c, { okDREG12, okXOP12, okANY }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] EXP.C DREG24, XOP24 (|HIX, HI, LO|) */
+const sOprForm oprFormEXP_C[] = {
+	{ t16d, { okDREG24, okXOP24, okANY }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] EXPADJ DREG12, XOP12 */
+const sOprForm oprFormEXPADJ[] = {
+	{ t16c, { okDREG12, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] EXPADJ.C DREG24, XOP24 */
+const sOprForm oprFormEXPADJ_C[] = {
+	{ t16d, { okDREG24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] MAC ACC32, XOP12, YOP12 (|RND, SS, SU, US, UU|) (also MAS, MPY) */
+const sOprForm oprFormMAC[] = {
+	{ t40e, { okACC32, okXOP12, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] MAC.C ACC64, XOP24, YOP24[*] (|RND, SS, SU, US, UU|) (also MAS.C, MPY.C) */
+const sOprForm oprFormMAC_C[] = {
+	{ t40f, { okACC64, okXOP24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] MAC.RC ACC64, XOP12, YOP24[*] (|RND, SS, SU, US, UU|) (also MAS.RC, MPY.RC) */
+const sOprForm oprFormMAC_RC[] = {
+	{ t40g, { okACC64, okXOP12, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] MAG.C DREG24, XOP24[*] */
+const sOprForm oprFormMAG_C[] = {
+	{ t47a, { okDREG24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] POLAR.C DREG24, XOP24[*] (also RECT.C) */
+const sOprForm oprFormPOLAR_C[] = {
+	{ t42a, { okDREG24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] RCCW.C DREG24, XOP24, YOP12 (also RCW.C) */
+const sOprForm oprFormRCCW_C[] = {
+	{ t50a, { okDREG24, okXOP24, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] RNDACC ACC32 */
+const sOprForm oprFormRNDACC[] = {
+	{ t41a, { okACC32 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] RNDACC.C ACC64[*] */
+const sOprForm oprFormRNDACC_C[] = {
+	{ t41b, { okACC64 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] SATACC ACC32 */
+const sOprForm oprFormSATACC[] = {
+	{ t25a, { okACC32 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] SATACC.C ACC64[*] */
+const sOprForm oprFormSATACC_C[] = {
+	{ t25b, { okACC64 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] SCR DREG12, XOP12, YOP12 */
+const sOprForm oprFormSCR[] = {
+	{ t46a, { okDREG12, okXOP12, okXOP12 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/** [IF COND] SCR.C DREG24, XOP24, YOP24[*] */
+const sOprForm oprFormSCR_C[] = {
+	{ t46b, { okDREG24, okXOP24, okXOP24 }, IMM_NONE },
+	OPR_FORM_END
+};
+
+/*
+* Multifunction forms of codeScanOneInstMultiFunc(), in the order they are tried.
+*/
+
+static const char mLdDst8[]		= "For destination of LD, only R0, R1, ..., R7 registers are allowed.\n";
+static const char mLdCDst4[]	= "For destination of LD.C, only R0, R2, R4, R6 registers are allowed.\n";
+static const char mLdIx[]		= "For IX operand of LD, only I0, I1, I2, I3 registers are allowed.\n";
+static const char mLdMx[]		= "For MX operand of LD, only M0, M1, M2, M3 registers are allowed.\n";
+static const char mLdIy[]		= "For IY operand of LD, only I4, I5, I6, I7 registers are allowed.\n";
+static const char mLdMy[]		= "For MY operand of LD, only M4, M5, M6, M7 registers are allowed.\n";
+static const char mLdCIx[]		= "For IX operand of LD.C, only I0, I1, I2, I3 registers are allowed.\n";
+static const char mLdCMx[]		= "For MX operand of LD.C, only M0, M1, M2, M3 registers are allowed.\n";
+static const char mLdCIy[]		= "For IY operand of LD.C, only I4, I5, I6, I7 registers are allowed.\n";
+static const char mLdCMy[]		= "For MY operand of LD.C, only M4, M5, M6, M7 registers are allowed.\n";
+static const char mLdDst[]		= "For destination of LD, only R0~R31, "
+									"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n";
+static const char mLdCDst[]		= "For destination of LD.C, only R0, R2, ..., R30,\n"
+									"ACC[0/2/4/6].[H/M/L] registers are allowed.\n";
+static const char mLdIReg[]		= "For IREG operand of LD, only I0~7 registers are allowed.\n";
+static const char mLdMReg[]		= "For MREG operand of LD, only M0~7 registers are allowed.\n";
+static const char mStDst[]		= "For destination of ST, only R0~R31, "
+									"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n";
+static const char mStCDst[]		= "For destination of ST.C, only R0, R2, ..., R30,\n"
+									"ACC[0/2/4/6].[H/M/L] registers are allowed.\n";
+static const char mStIReg[]		= "For IREG operand of ST, only I0~7 registers are allowed.\n";
+static const char mStMReg[]		= "For MREG operand of ST, only M0~7 registers are allowed.\n";
+static const char mCpDst[]		= "For destination of CP, only R0~R31, "
+									"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n";
+static const char mCpSrc[]		= "For source of CP, only R0~R31, "
+									"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n";
+static const char mCpCDst[]		= "For destination of CP.C, only R0, R2, ..., R30,\n"
+									"ACC[0/2/4/6].[H/M/L] registers are allowed.\n";
+static const char mCpCSrc[]		= "For source of CP.C, only R0, R2, ..., R30,\n"
+									"ACC[0/2/4/6].[H/M/L] registers are allowed.\n";
+static const char mMacDst[]		= "For destination of this MAC instruction, "
+									"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n";
+static const char mMacSrc[]		= "For source of MAC instruction, "
+									"only R0, R1, ..., R7 registers are allowed.\n";
+static const char mMacCDst[]	= "For destination of this MAC.C instruction, "
+									"only ACC0, ACC2 registers are allowed.\n";
+static const char mMacCSrc[]	= "For source of MAC.C instruction, "
+									"only R0, R2, R4, R6 registers are allowed.\n";
+static const char mMulOpt[]		= "One of these multiplier options must be given.\n";
+static const char mAluDst[]		= "For destination of ALU instruction, "
+									"only R0~R7 and ACC0.L~ACC7.L registers are allowed.\n";
+static const char mAluDst2[]	= "For destination of ALU instruction, "
+									"only R0~R7, ACC0.L~ACC7.L registers are allowed.\n";
+static const char mAluAcc[]		= "For destination of ALU instruction, "
+									"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n";
+static const char mAluSrc[]		= "For source of ALU instruction, "
+									"only R0, R1, ..., R7 registers are allowed.\n";
+static const char mAluCDst[]	= "For destination of ALU.C instruction, "
+									"only R[0/2/4/6] and ACC[0/2/4/6].L registers are allowed.\n";
+static const char mAluCSrc[]	= "For source of ALU.C instruction, "
+									"only R0, R2, R4, R6 registers are allowed.\n";
+static const char mShOpt[]		= "For the SHIFT instruction, "
+									"one of HI, LO, HIRND, LORND options must be specified.\n";
+static const char mShOptRnd[]	= "For the SHIFT instruction, "
+									"one of NORND, RND options must be specified.\n";
+static const char mShDst[]		= "For destination of SHIFT instruction, "
+									"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n";
+static const char mShCDst[]		= "For destination of SHIFT.C instruction, "
+									"only ACC0, ACC2 registers are allowed.\n";
+static const char mShCDst4[]	= "For destination of SHIFT.C instruction, "
+									"only ACC0, ACC2, ACC4, ACC6 registers are allowed.\n";
+static const char mShSrc[]		= "For source of SHIFT instruction, "
+									"only ACC0, ACC1, ACC2, ACC3 or R0, R1, ..., R7 registers are allowed.\n";
+static const char mShCSrc[]		= "For source of SHIFT instruction, "
+									"only ACC0, ACC2, ACC4, ACC6 or R0, R2, R4, R6 registers are allowed.\n";
+static const char mShSrc1[]		= "For 1st source of SHIFT instruction, "
+									"only R0, R1, ..., R7 or ACC0, ACC1, ACC2, ACC3 registers are allowed.\n";
+static const char mNone[]		= "For destination of Multifunction instruction, "
+									"NONE is not allowed.\n";
+static const char mDiff[]		= "Destination registers should not be identical.\n";
+static const char mPreMod[]		= "Premodify addressing is not supported in this instruction type.\n";
+static const char mNoSupp[]		= "Sorry, this multifuction format is no longer supported. "
+									"Please check instruction syntax.\n";
+
+/* operand groups of one opcode in slot n */
+#define	MF_MAC(n)		{ mcACC32S, (n), 0, mMacDst }, { mcREG12S, (n), 1, mMacSrc }, \
+						{ mcREG12S, (n), 2, mMacSrc }, { mcMULOPT, (n), 3, mMulOpt }
+#define	MF_MAC_C(n)		{ mcACC64S, (n), 0, mMacCDst }, { mcREG24S, (n), 1, mMacCSrc }, \
+						{ mcREG24S, (n), 2, mMacCSrc }, { mcMULOPT, (n), 3, mMulOpt }
+#define	MF_ALU(dst)		{ mcDREG12S, 0, 0, (dst) }, { mcREG12S, 0, 1, mAluSrc }, \
+						{ mcREG12S_OPT, 0, 2, mAluSrc }
+#define	MF_ALU_C		{ mcDREG24S, 0, 0, mAluCDst }, { mcREG24S, 0, 1, mAluCSrc }, \
+						{ mcREG24S_OPT, 0, 2, mAluCSrc }
+#define	MF_LD			{ mcDREG12, 1, 0, mLdDst }, { mcIREG, 1, 2, mLdIReg }, { mcMREG, 1, 3, mLdMReg }
+#define	MF_LD_C			{ mcDREG24, 1, 0, mLdCDst }, { mcIREG, 1, 2, mLdIReg }, { mcMREG, 1, 3, mLdMReg }
+#define	MF_ST			{ mcDREG12, 1, 4, mStDst }, { mcIREG, 1, 1, mStIReg }, { mcMREG, 1, 2, mStMReg }
+#define	MF_ST_C			{ mcDREG24, 1, 4, mStCDst }, { mcIREG, 1, 1, mStIReg }, { mcMREG, 1, 2, mStMReg }
+#define	MF_CP			{ mcDREG12, 1, 0, mCpDst }, { mcDREG12, 1, 1, mCpSrc }
+#define	MF_CP_C			{ mcDREG24, 1, 0, mCpCDst }, { mcDREG24, 1, 1, mCpCSrc }
+/* SHIFT in slot n: option, immediate (former register form), destination */
+#define	MF_SHIFT(n, opt, k, dst)	{ mcGIVEN, (n), 3, (opt) }, { mcINT, (n), 2, mNoSupp }, \
+						{ (k), (n), 0, (dst) }
+#define	MF_DIFF(a, b)	{ mcDIFF, (a), (b), mDiff }
+
+static const sMFCheck mf01a[] = {	/* LD || LD */
+	{ mcREG12S, 0, 0, mLdDst8 }, { mcREG12S, 1, 0, mLdDst8 },
+	{ mcIX, 0, 2, mLdIx }, { mcMX, 0, 3, mLdMx }, { mcIY, 1, 2, mLdIy }, { mcMY, 1, 3, mLdMy },
+	MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf01b[] = {	/* LD.C || LD.C */
+	{ mcREG24S, 0, 0, mLdCDst4 }, { mcREG24S, 1, 0, mLdCDst4 },
+	{ mcIX, 0, 2, mLdCIx }, { mcMX, 0, 3, mLdCMx }, { mcIY, 1, 2, mLdCIy }, { mcMY, 1, 3, mLdCMy },
+	MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf04a[] = { MF_MAC(0), MF_LD, MF_DIFF(1, 0), MF_END };			/* MAC || LD */
+static const sMFCheck mf04c[] = { MF_ALU(mAluDst), MF_LD, MF_DIFF(1, 0), MF_END };		/* ALU || LD */
+static const sMFCheck mf04b[] = { MF_MAC_C(0), MF_LD_C, MF_DIFF(1, 0), MF_END };		/* MAC.C || LD.C */
+static const sMFCheck mf04d[] = { MF_ALU_C, MF_LD_C, MF_DIFF(1, 0), MF_END };			/* ALU.C || LD.C */
+static const sMFCheck mf04e[] = { MF_MAC(0), MF_ST, MF_END };							/* MAC || ST */
+static const sMFCheck mf04g[] = { MF_ALU(mAluDst), MF_ST, MF_END };						/* ALU || ST */
+static const sMFCheck mf04f[] = { MF_MAC_C(0), MF_ST_C, MF_END };						/* MAC.C || ST.C */
+static const sMFCheck mf04h[] = { MF_ALU_C, MF_ST_C, MF_END };							/* ALU.C || ST.C */
+static const sMFCheck mf08a[] = { MF_MAC(0), MF_CP, MF_DIFF(1, 0), MF_END };			/* MAC || CP */
+static const sMFCheck mf08c[] = { MF_ALU(mAluDst), MF_CP, MF_DIFF(1, 0), MF_END };		/* ALU || CP */
+static const sMFCheck mf08b[] = { MF_MAC_C(0), MF_CP_C, MF_DIFF(1, 0), MF_END };		/* MAC.C || CP.C */
+static const sMFCheck mf08d[] = { MF_ALU_C, MF_CP_C, MF_DIFF(1, 0), MF_END };			/* ALU.C || CP.C */
+static const sMFCheck mf12e[] = { MF_SHIFT(0, mShOpt, mcACC32S, mShDst), MF_LD, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf12m[] = { MF_SHIFT(0, mShOptRnd, mcACC32S, mShDst), MF_LD, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf12f[] = { MF_SHIFT(0, mShOpt, mcACC64S, mShCDst4), MF_LD_C, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf12n[] = { MF_SHIFT(0, mShOptRnd, mcACC64S, mShCDst4), MF_LD_C, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf12g[] = { MF_SHIFT(0, mShOpt, mcACC32S, mShDst), MF_ST, MF_END };
+static const sMFCheck mf12o[] = { MF_SHIFT(0, mShOptRnd, mcACC32S, mShDst), MF_ST, MF_END };
+static const sMFCheck mf12h[] = { MF_SHIFT(0, mShOpt, mcACC64S, mShCDst), MF_ST_C, MF_END };
+static const sMFCheck mf12p[] = { MF_SHIFT(0, mShOptRnd, mcACC64S, mShCDst), MF_ST_C, MF_END };
+static const sMFCheck mf14c[] = { MF_SHIFT(0, mShOpt, mcACC32S, mShDst), MF_CP, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf14k[] = { MF_SHIFT(0, mShOptRnd, mcACC32S, mShDst), MF_CP, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf14d[] = { MF_SHIFT(0, mShOpt, mcACC64S, mShCDst), MF_CP_C, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf14l[] = { MF_SHIFT(0, mShOptRnd, mcACC64S, mShCDst), MF_CP_C, MF_DIFF(1, 0), MF_END };
+static const sMFCheck mf43a[] = { MF_ALU(mAluDst2), MF_MAC(1), MF_DIFF(1, 0), MF_END };	/* ALU || MAC */
+static const sMFCheck mf44b[] = {	/* ALU || SHIFT */
+	{ mcGIVEN, 1, 3, mShOpt }, { mcINT, 1, 2, mNoSupp }, MF_ALU(mAluDst2),
+	{ mcACC32S, 1, 0, mShDst }, MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf44d[] = {
+	{ mcGIVEN, 1, 3, mShOptRnd }, { mcINT, 1, 2, mNoSupp }, MF_ALU(mAluDst2),
+	{ mcACC32S, 1, 0, mShDst }, MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf45b[] = {	/* MAC || SHIFT */
+	{ mcGIVEN, 1, 3, mShOpt }, { mcINT, 1, 2, mNoSupp },
+	{ mcACC32S, 0, 0, mAluAcc }, { mcNOTNONE, 0, 0, mNone },
+	{ mcREG12S, 0, 1, mAluSrc }, { mcREG12S, 0, 2, mAluSrc },
+	{ mcACC32S, 1, 0, mShDst }, MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf45d[] = {
+	{ mcGIVEN, 1, 3, mShOptRnd }, { mcINT, 1, 2, mNoSupp },
+	{ mcACC32S, 0, 0, mAluAcc }, { mcNOTNONE, 0, 0, mNone },
+	{ mcREG12S, 0, 1, mAluSrc }, { mcREG12S, 0, 2, mAluSrc },
+	{ mcACC32S, 1, 0, mShDst }, MF_DIFF(1, 0), MF_END
+};
+static const sMFCheck mf01c[] = {	/* ALU || LD || LD */
+	MF_ALU(mAluDst), { mcDREG12, 1, 0, mLdDst }, { mcDREG12, 2, 0, mLdDst },
+	{ mcIX, 1, 2, mLdIx }, { mcMX, 1, 3, mLdMx }, { mcIY, 2, 2, mLdIy }, { mcMY, 2, 3, mLdMy },
+	MF_DIFF(1, 0), MF_DIFF(2, 0), MF_DIFF(1, 2),
+	{ mcPOSTMOD, 1, 1, mPreMod }, { mcPOSTMOD, 2, 1, mPreMod }, MF_END
+};
+static const sMFCheck mf01a3[] = {	/* MAC || LD || LD */
+	MF_MAC(0), { mcDREG12, 1, 0, mLdDst }, { mcDREG12, 2, 0, mLdDst },
+	{ mcIX, 1, 2, mLdIx }, { mcMX, 1, 3, mLdMx }, { mcIY, 2, 2, mLdIy }, { mcMY, 2, 3, mLdMy },
+	MF_DIFF(1, 0), MF_DIFF(2, 0), MF_DIFF(1, 2), MF_END
+};
+static const sMFCheck mf01b3[] = {	/* MAC.C || LD.C || LD.C */
+	MF_MAC_C(0), { mcDREG24, 1, 0, mLdCDst }, { mcDREG24, 2, 0, mLdCDst },
+	{ mcIX, 1, 2, mLdCIx }, { mcMX, 1, 3, mLdCMx }, { mcIY, 2, 2, mLdCIy }, { mcMY, 2, 3, mLdCMy },
+	MF_DIFF(1, 0), MF_DIFF(2, 0), MF_DIFF(1, 2), MF_END
+};
+static const sMFCheck mfShSrc[]		= { { mcNOFORM, 0, 1, mShSrc }, MF_END };
+static const sMFCheck mfShCSrc[]	= { { mcNOFORM, 0, 1, mShCSrc }, MF_END };
+static const sMFCheck mfShSrc1[]	= { { mcNOFORM, 1, 1, mShSrc1 }, MF_END };
+static const sMFCheck mfNoSupp[]	= { { mcNOSUPP, 0, 0, mNoSupp }, MF_END };
+
+/** multifunction forms: two opcodes, then three opcodes */
+const sMFForm oprFormMultiFunc[] = {
+	{ t01a, { isLD, isLD, NULL }, MF_END, mf01a },
+	{ t01b, { isLD_C, isLD_C, NULL }, MF_END, mf01b },
+	{ t04a, { isMAC, isLD, NULL }, MF_END, mf04a },
+	{ t04c, { isALU, isLD, NULL }, MF_END, mf04c },
+	{ t04b, { isMAC_C, isLD_C, NULL }, MF_END, mf04b },
+	{ t04d, { isALU_C, isLD_C, NULL }, MF_END, mf04d },
+	{ t04e, { isMAC, isST, NULL }, MF_END, mf04e },
+	{ t04g, { isALU, isST, NULL }, MF_END, mf04g },
+	{ t04f, { isMAC_C, isST_C, NULL }, MF_END, mf04f },
+	{ t04h, { isALU_C, isST_C, NULL }, MF_END, mf04h },
+	{ t08a, { isMAC, isCP, NULL }, MF_END, mf08a },
+	{ t08c, { isALU, isCP, NULL }, MF_END, mf08c },
+	{ t08b, { isMAC_C, isCP_C, NULL }, MF_END, mf08b },
+	{ t08d, { isALU_C, isCP_C, NULL }, MF_END, mf08d },
+	{ t12e, { isSHIFT, isLD, NULL }, MF_SEL(mcREG12S, 0), mf12e },
+	{ t12m, { isSHIFT, isLD, NULL }, MF_SEL(mcACC32S, 0), mf12m },
+	{ 0, { isSHIFT, isLD, NULL }, MF_END, mfShSrc },
+	{ t12f, { isSHIFT_C, isLD_C, NULL }, MF_SEL(mcREG24S, 0), mf12f },
+	{ t12n, { isSHIFT_C, isLD_C, NULL }, MF_SEL(mcACC64S, 0), mf12n },
+	{ 0, { isSHIFT_C, isLD_C, NULL }, MF_END, mfShCSrc },
+	{ t12g, { isSHIFT, isST, NULL }, MF_SEL(mcREG12S, 0), mf12g },
+	{ t12o, { isSHIFT, isST, NULL }, MF_SEL(mcACC32S, 0), mf12o },
+	{ 0, { isSHIFT, isST, NULL }, MF_END, mfShSrc },
+	{ t12h, { isSHIFT_C, isST_C, NULL }, MF_SEL(mcREG24S, 0), mf12h },
+	{ t12p, { isSHIFT_C, isST_C, NULL }, MF_SEL(mcACC64S, 0), mf12p },
+	{ 0, { isSHIFT_C, isST_C, NULL }, MF_END, mfShCSrc },
+	{ t14c, { isSHIFT, isCP, NULL }, MF_SEL(mcREG12S, 0), mf14c },
+	{ t14k, { isSHIFT, isCP, NULL }, MF_SEL(mcACC32S, 0), mf14k },
+	{ 0, { isSHIFT, isCP, NULL }, MF_END, mfShSrc },
+	{ t14d, { isSHIFT_C, isCP_C, NULL }, MF_SEL(mcREG24S, 0), mf14d },
+	{ t14l, { isSHIFT_C, isCP_C, NULL }, MF_SEL(mcACC64S, 0), mf14l },
+	{ 0, { isSHIFT_C, isCP_C, NULL }, MF_END, mfShCSrc },
+	{ t43a, { isALU, isMAC, NULL }, MF_END, mf43a },
+	{ 0, { isALU_C, isMAC_C, NULL }, MF_END, mfNoSupp },		/* t43b: no longer supported (2008.12.5) */
+	{ t44b, { isALU, isSHIFT, NULL }, MF_SEL(mcREG12S, 1), mf44b },
+	{ t44d, { isALU, isSHIFT, NULL }, MF_SEL(mcACC32S, 1), mf44d },
+	{ 0, { isALU, isSHIFT, NULL }, MF_END, mfShSrc1 },
+	{ t45b, { isMAC, isSHIFT, NULL }, MF_SEL(mcREG12S, 1), mf45b },
+	{ t45d, { isMAC, isSHIFT, NULL }, MF_SEL(mcACC32S, 1), mf45d },
+	{ 0, { isMAC, isSHIFT, NULL }, MF_END, mfShSrc1 },
+
+	{ t01c, { isALU, isLD, isLD }, MF_END, mf01c },
+	{ 0, { isALU_C, isLD_C, isLD_C }, MF_END, mfNoSupp },		/* t01d: no longer supported (2008.12.5) */
+	{ t01a, { isMAC, isLD, isLD }, MF_END, mf01a3 },
+	{ t01b, { isMAC_C, isLD_C, isLD_C }, MF_END, mf01b3 },
+	{ 0, { NULL, NULL, NULL }, MF_END, NULL }
+};
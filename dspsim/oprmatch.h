@@ -0,0 +1,149 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file oprmatch.h
+* @brief Header for table-driven operand pattern matching of codeScanOneInst()
+* @date 2026-10-19
+*/
+
+#ifndef	_OPRMATCH_H
+#define	_OPRMATCH_H
+
+#include "icode.h"
+
+#define	MAX_FORMOPR		4		/**< operands checked per instruction form */
+
+/**
+* @brief Operand kinds of instruction forms, one per is*() predicate
+*/
+enum eOprKind {
+	okEND = 0,	/**< operand not checked (end of form) */
+	okANY,		/**< operand given, e.g. shift or multiplier option */
+	okREG12,	/**< isReg12():   R0 ~ R31 */
+	okXOP12,	/**< isXOP12():   R0 ~ R31 */
+	okDREG12,	/**< isDReg12():  REG12, ACC12 */
+	okXOP24,	/**< isXOP24():   R0, R2, ..., R30 */
+	okDREG24,	/**< isDReg24():  REG24, ACC24 */
+	okACC32,	/**< isACC32():   ACC0 ~ ACC7 */
+	okACC64,	/**< isACC64():   ACC0, ACC2, ACC4, ACC6 */
+	okRREG16,	/**< isRReg16():  Ix, Mx, Lx, Bx and 16-bit control registers */
+	okINT,		/**< isInt():     integer constant or symbol */
+	okMAX
+};
+
+/**
+* @brief Operand kinds of one operand string, classified once per instruction
+*/
+typedef struct sOprClass {
+	unsigned int	Is;		/**< bit (1 << kind) set: predicate of kind returns TRUE */
+	unsigned int	Err;	/**< bit set: predicate of kind reports an error */
+	unsigned int	Lazy;	/**< bit set: not classified yet, predicate has no messages */
+} sOprClass;
+
+/**
+* @brief One instruction form: operand kinds and an optional immediate range.
+* Forms of an opcode are tried in table order; the first form whose operand
+* kinds match selects the type, if its immediate is in range.
+*/
+typedef struct sOprForm {
+	int		Type;					/**< instruction type (enum eType), 0: end of table */
+	unsigned char	Kind[MAX_FORMOPR];	/**< enum eOprKind of Operand[0], [1], ... */
+	int		Imm;					/**< operand checked by isIntNM(), -1: none */
+	int		Lo, Hi;					/**< immediate range */
+} sOprForm;
+
+/** immediate operand op: signed n-bit, as isIntSignedN() */
+#define	IMM_INT(op, n)			(op), -(1 << ((n)-1)), (1 << (n))-1
+/** immediate operand op: unsigned n-bit, as isIntUnsignedN() */
+#define	IMM_UINT(op, n)			(op), 0, (1 << (n))-1
+/** immediate operand op: lo <= x <= hi, as isIntNM() */
+#define	IMM_RANGE(op, lo, hi)	(op), (lo), (hi)
+/** no immediate operand */
+#define	IMM_NONE				-1, 0, 0
+/** end of a form table */
+#define	OPR_FORM_END			{ 0, { okEND }, IMM_NONE }
+
+/**
+* @brief Operand checks of multifunction forms, one per is*() predicate.
+* Unlike eOprKind, a failed check is an error reported with its message.
+*/
+enum eMFCheck {
+	mcEND = 0,	/**< end of check list, or no selector */
+	mcREG12S,	/**< isReg12S():  R0 ~ R7 */
+	mcREG24S,	/**< isReg24S():  R0, R2, R4, R6 */
+	mcDREG12S,	/**< isDReg12S(): R0 ~ R7, ACC0.L ~ ACC7.L */
+	mcDREG24S,	/**< isDReg24S(): R0, R2, R4, R6, ACC0.L, ACC2.L, ... */
+	mcACC32S,	/**< isACC32S():  ACC0 ~ ACC3 */
+	mcACC64S,	/**< isACC64S():  ACC0, ACC2 */
+	mcDREG12,	/**< isDReg12() */
+	mcDREG24,	/**< isDReg24() */
+	mcIREG,		/**< isIReg():    I0 ~ I7 */
+	mcMREG,		/**< isMReg():    M0 ~ M7 */
+	mcIX,		/**< isIx():      I0 ~ I3 */
+	mcMX,		/**< isMx():      M0 ~ M3 */
+	mcIY,		/**< isIy():      I4 ~ I7 */
+	mcMY,		/**< isMy():      M4 ~ M7 */
+	mcREG12S_OPT,	/**< isReg12S() if operand is given */
+	mcREG24S_OPT,	/**< isReg24S() if operand is given */
+	mcGIVEN,	/**< operand given, e.g. shift option */
+	mcMULOPT,	/**< multiplier option given, reported as the list of options */
+	mcINT,		/**< isInt(), reported with the opcode: former register form */
+	mcNOTNONE,	/**< !isNONE() */
+	mcDIFF,		/**< Operand[0] differs from Operand[0] of slot Opr */
+	mcPOSTMOD,	/**< post-modify addressing: operand is not "+" */
+	mcNOFORM,	/**< always fails: no form of the opcode pair matched */
+	mcNOSUPP,	/**< always fails, reported with the opcode: format not supported */
+};
+
+/**
+* @brief One check of a multifunction form.
+*/
+typedef struct sMFCheck {
+	unsigned char	Check;		/**< enum eMFCheck */
+	unsigned char	Slot;		/**< 0: p, 1: p->Multi[0], 2: p->Multi[1] */
+	unsigned char	Opr;		/**< operand index of slot (mcDIFF: other slot) */
+	const char		*Msg;		/**< error message, NULL for selectors */
+} sMFCheck;
+
+/**
+* @brief One multifunction form: opcode classes of the slots, an optional
+* selector and the operand checks, in the order of codeScanOneInstMultiFunc().
+* The first form whose classes and selector match sets the type; its checks
+* then report the first error.
+*/
+typedef struct sMFForm {
+	int		Type;					/**< instruction type (enum eType), 0: none */
+	int		(*Op[3])(sICode *);		/**< isLD() ... of p, Multi[0], Multi[1]; Op[2] NULL: two opcodes */
+	sMFCheck	Sel;				/**< selector among forms of the same classes, mcEND: none */
+	const sMFCheck	*Check;			/**< checks, ended by mcEND; NULL: end of table */
+} sMFForm;
+
+/** end of a check list, or no selector */
+#define	MF_END					{ mcEND, 0, 0, NULL }
+/** selector: Operand[1] of slot is of kind k */
+#define	MF_SEL(k, slot)			{ (k), (slot), 1, NULL }
+
+int oprMatch(sICode *p, const sOprForm *form);
+int oprMatchMultiFunc(sICode *p, const sMFForm *form);
+
+extern const sOprForm oprFormABS[], oprFormABS_C[];
+extern const sOprForm oprFormADD[], oprFormADDC[];
+extern const sOprForm oprFormAND[];
+extern const sOprForm oprFormASHIFT[], oprFormASHIFT_C[];
+extern const sOprForm oprFormCLRACC[], oprFormCLRACC_C[];
+extern const sOprForm oprFormCLRBIT[], oprFormSETINT[];
+extern const sOprForm oprFormCONJ_C[];
+extern const sOprForm oprFormCP[], oprFormCP_C[];
+extern const sOprForm oprFormDIVS[], oprFormDPID[];
+extern const sOprForm oprFormEXP[], oprFormEXP_C[];
+extern const sOprForm oprFormEXPADJ[], oprFormEXPADJ_C[];
+extern const sOprForm oprFormMAC[], oprFormMAC_C[], oprFormMAC_RC[];
+extern const sOprForm oprFormMAG_C[], oprFormPOLAR_C[];
+extern const sOprForm oprFormRCCW_C[];
+extern const sOprForm oprFormRNDACC[], oprFormRNDACC_C[];
+extern const sOprForm oprFormSATACC[], oprFormSATACC_C[];
+extern const sOprForm oprFormSCR[], oprFormSCR_C[];
+extern const sMFForm oprFormMultiFunc[];
+
+#endif	/* _OPRMATCH_H */
@@ -1,67 +1,60 @@
 /*
 All Rights Reserved.
 */
-/** 
+/**
 * @file optab.h
-* Header for oTab linked list and hashing table for opcode table
-* - ref: http://faculty.ycp.edu/~dhovemey/spring2007/cs201/info/hashTables.html
+* Header for opcode and reserved keyword tables: minimal perfect hashes
+* generated from sOp[] and sResSym[] at build time (mkophash -> ophash.cc)
 * @date 2008-09-24
 */
 
 #ifndef	_OPTAB_H
 #define	_OPTAB_H
 
-#define	MAX_OPCODE_LENGTH	25		/**< Maximum opcode length */
-
-#ifndef MAX_OPHASHTABLE
-#define	MAX_OPHASHTABLE	199		/**< 29, 31, 37, 101, ... are common prime numbers for hash functions */
-#endif
-
-/** 
-* @brief Opcode Table data structure
+/**
+* @brief Minimal perfect hash over the case-folded names of a string table.
+* Key k is in slot oHashKey(k, Disp[oHashKey(k, Seed) % Buckets]) % Size.
 */
-typedef struct oTab {
-	char	Name[MAX_OPCODE_LENGTH];	/**< Opcode string */
-	unsigned int	Index;				/**< Matching enum eOp value */
-	struct oTab	*Next;
-} oTab;
-
-typedef struct oTabList {
-	oTab *FirstNode;		/* Points to first node of list; MUST be NULL when initialized */
-	oTab *LastNode;			/* Points to last node of list; MUST be NULL when initialized */
-} oTabList;
-
-oTab *oTabGetNode(char *s, unsigned int n);
-#ifdef __cplusplus
-/* when called from C++ function */
-extern "C" oTab *oTabListAdd(oTabList *list, char *s, unsigned int i);
-#else
-/* when called from C function */
-extern oTab *oTabListAdd(oTabList *list, char *s, unsigned int i);
-#endif
-oTab *oTabListInsertAfter(oTab *p, oTab *newNode);
-oTab *oTabListInsertBeginning(oTabList *list, oTab *newNode);
-void oTabListRemoveAfter(oTabList *list, oTab *p);
-oTab *oTabListRemoveBeginning(oTabList *list);
-void oTabListRemoveAll(oTabList *list);
-oTab *oTabListSearch(oTabList *list, char *s);
-void oTabListPrint(oTabList *list);
+typedef struct oHashTable {
+	unsigned int	Seed;			/**< seed of bucket hash */
+	unsigned int	Buckets;		/**< number of buckets */
+	unsigned int	Size;			/**< number of slots (= number of keys) */
+	const unsigned short	*Disp;	/**< seed of slot hash, per bucket */
+	const unsigned short	*Slot;	/**< index into Names, per slot */
+	const char	**Names;			/**< string table: sOp or sResSym */
+} oHashTable;
+
+/**
+* @brief FNV-1a hash of upper-cased string; shared by mkophash and lookups.
+*
+* @param s Name
+* @param seed Seed
+*
+* @return 32-bit hash
+*/
+static inline unsigned int oHashKey(const char *s, unsigned int seed)
+{
+	unsigned int h = 2166136261U ^ (seed * 0x9E3779B1U);
+
+	for(; *s; s++){
+		unsigned int c = (unsigned char)*s;
+		if(c >= 'a' && c <= 'z') c -= ('a' - 'A');
+		h = (h ^ c) * 16777619U;
+	}
+	return h;
+}
 
-int oTabHashFunction(char *s);
-oTab *oTabHashAdd(oTabList htable[], char *s, unsigned int i);
-void oTabHashPrint(oTabList htable[]);
 #ifdef __cplusplus
 /* when called from C++ function */
-extern "C" oTab *oTabHashSearch(oTabList htable[], char *s);
+extern "C" int oHashSearch(const oHashTable *t, const char *s);
+extern "C" const oHashTable opHash;
+extern "C" const oHashTable resSymHash;
 #else
 /* when called from C function */
-extern oTab *oTabHashSearch(oTabList htable[], char *s);
+extern int oHashSearch(const oHashTable *t, const char *s);
+extern const oHashTable opHash;
+extern const oHashTable resSymHash;
 #endif
-void oTabHashRemoveAll(oTabList htable[]);
-void oTabHashRemoveAfter(oTabList htable[], oTab *p);
-
-void opTableInit(oTabList htable[]);
-
-extern struct oTabList opTable[MAX_OPHASHTABLE]; /**< Opcode Table for iCode's reference */
+void oHashPrint(const oHashTable *t, const char *title);
 
 #endif	/* _OPTAB_H */
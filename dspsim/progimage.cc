@@ -0,0 +1,659 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file progimage.cc
+* @brief Precompiled program image cache (-pc option)
+*
+* After yyparse() and codeScan(), everything the simulator needs from the
+* source is in iCode, symTable, dataMem and secInfo (the same tables the
+* simulation server keeps warm). With -pc these tables are written to
+* "<source>.pim": every node and string is copied into one block whose
+* pointers are laid out for a fixed address, followed by an object table.
+* Instructions with their operands come first, their source-level parts
+* (sICodeSrc) after everything else, as in the program arena.
+*
+* A later run with unchanged source, options and initializer files maps
+* the image (private, copy-on-write) and uses the tables in place; if the
+* kernel does not give the preferred address, the object table is used to
+* relocate all pointers by the difference. Lexing, parsing and codeScan()
+* are skipped. Image nodes are never freed (they live in the mapping).
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "dspsim.h"
+#include "icode.h"
+#include "symtab.h"
+#include "dmem.h"
+#include "secinfo.h"
+#include "memref.h"
+#include "simserver.h"	/* hashBytes(), hashFile() */
+#include "progimage.h"
+#include "asmcache.h"
+#include "bundle.h"
+
+/** preferred image address: an area the loader leaves free */
+#define	PIM_BASE	((sizeof(void *) == 8) ? 0x200000000000ULL : 0x50000000ULL)
+
+int ProgImageMode = FALSE;		/**< -pc: use/write program image cache */
+int ProgImageLoaded = FALSE;	/**< TRUE if current program came from an image */
+
+static void *pimMap = NULL;			/**< mapped image */
+static size_t pimMapLen = 0;		/**< mapped length */
+
+static sPimDep pimDeps[MAX_PIMDEPS];	/**< files read by codeScan() */
+static int pimDepCntr = 0;
+static int pimDepOverflow = FALSE;
+
+/** pointer -> offset map and object list used while writing */
+static void **pimKey = NULL;
+static unsigned int *pimVal = NULL;
+static unsigned int pimMapSize = 0;
+static sPimObj *pimObjs = NULL;
+static void **pimObjPtr = NULL;
+static int pimObjCntr = 0;
+static int pimObjMax = 0;
+static unsigned int pimLen = 0;
+static int pimFailed = FALSE;
+
+/**
+* @brief Hash of everything that changes what parsing and scanning produce.
+*
+* @param asmfile Source filename
+* @param key Hash to return
+*
+* @return FALSE if source cannot be read
+*/
+int progImageKey(char *asmfile, unsigned long long *key)
+{
+	FILE *fp;
+	int opt[17];
+	unsigned long long h;
+
+	if(!(fp = fopen(asmfile, "rb"))) return FALSE;
+	h = hashFile(fp);
+	fclose(fp);
+
+	memset(opt, 0, sizeof(opt));
+	opt[0] = (int)(VERSION * 100);
+	opt[1] = DelaySlotMode;
+	opt[2] = UnalignedMemoryAccessMode;
+	opt[3] = SIMD1Mode;
+	opt[4] = SIMD2Mode;
+	opt[5] = SIMD4Mode;
+	opt[6] = SIMD4ForceMode;
+	opt[7] = SuppressUndefinedDMMode;
+	opt[8] = codeSegAddr;
+	opt[9] = dataSegAddr;
+	opt[10] = NUMDP;
+	opt[11] = MAX_HASHTABLE;
+	opt[12] = sizeof(sICode) + sizeof(sICodeSrc);
+	opt[13] = sizeof(sTab);
+	opt[14] = sizeof(dMem);
+	opt[15] = sizeof(sSecInfo);
+	opt[16] = BundleMode;
+	*key = hashBytes(h, opt, sizeof(opt));
+	return TRUE;
+}
+
+/**
+* @brief Record a file read while scanning (.VAR initializer file).
+* Its content is part of the program image (assembly cache, server cache) validity check.
+*
+* @param fname Filename
+*/
+void progImageAddDep(char *fname)
+{
+	if(!ProgImageMode && !(AssemblerMode && AsmCacheDir) && !ServerPath) return;
+	if(pimDepCntr == MAX_PIMDEPS){
+		pimDepOverflow = TRUE;
+		return;
+	}
+	memset(&pimDeps[pimDepCntr], 0, sizeof(sPimDep));
+	strncpy(pimDeps[pimDepCntr].Name, fname, MAX_LINEBUF-1);
+	pimDepCntr++;
+}
+
+/**
+* @brief Forget recorded files before another program is parsed (server).
+*/
+void progImageDepReset(void)
+{
+	pimDepCntr = 0;
+	pimDepOverflow = FALSE;
+}
+
+/**
+* @brief Content hash of a dependent file.
+*
+* @return FALSE if file cannot be read
+*/
+int progImageDepHash(char *fname, unsigned long long *h)
+{
+	FILE *fp;
+
+	if(!(fp = fopen(fname, "rb"))) return FALSE;
+	*h = hashFile(fp);
+	fclose(fp);
+	return TRUE;
+}
+
+/**
+* @brief Files recorded by progImageAddDep() for the current program.
+*
+* @param deps Pointer to dependent file table to return (Hash not set)
+*
+* @return Number of files, -1 if there were too many to record
+*/
+int progImageDepList(sPimDep **deps)
+{
+	*deps = pimDeps;
+	return pimDepOverflow ? -1 : pimDepCntr;
+}
+
+/**
+* @brief Slot of pointer in pointer -> offset map.
+*/
+static unsigned int pimSlot(void *p)
+{
+	unsigned long long k = (unsigned long long)(size_t)p;
+	unsigned int i = (unsigned int)((k >> 3) * 0x9E3779B1U) & (pimMapSize - 1);
+
+	while(pimKey[i] && pimKey[i] != p){
+		i = (i + 1) & (pimMapSize - 1);
+	}
+	return i;
+}
+
+/**
+* @brief Give an object a place in the image (once).
+*
+* @param p Object
+* @param size Object size in bytes
+* @param type enum ePimObj
+*/
+static void pimReserve(void *p, size_t size, int type)
+{
+	unsigned int i;
+
+	if(!p) return;
+
+	/* keep map at most half full */
+	if(2 * (pimObjCntr + 1) > (int)pimMapSize){
+		void **ok = pimKey;
+		unsigned int *ov = pimVal;
+		unsigned int os = pimMapSize;
+
+		pimMapSize = os ? 2 * os : 4096;
+		pimKey = (void **)calloc(pimMapSize, sizeof(void *));
+		pimVal = (unsigned int *)calloc(pimMapSize, sizeof(unsigned int));
+		for(unsigned int k = 0; k < os; k++){
+			if(ok[k]){
+				i = pimSlot(ok[k]);
+				pimKey[i] = ok[k];
+				pimVal[i] = ov[k];
+			}
+		}
+		free(ok);
+		free(ov);
+	}
+
+	i = pimSlot(p);
+	if(pimKey[i]) return;		/* already placed */
+
+	if(pimObjCntr == pimObjMax){
+		pimObjMax = pimObjMax ? 2 * pimObjMax : 4096;
+		pimObjs = (sPimObj *)realloc(pimObjs, pimObjMax * sizeof(sPimObj));
+		pimObjPtr = (void **)realloc(pimObjPtr, pimObjMax * sizeof(void *));
+	}
+
+	pimLen = (pimLen + 7) & ~7U;
+	pimKey[i] = p;
+	pimVal[i] = pimLen;
+	pimObjs[pimObjCntr].Off = pimLen;
+	pimObjs[pimObjCntr].Type = type;
+	pimObjPtr[pimObjCntr] = p;
+	pimObjCntr++;
+	pimLen += size;
+}
+
+/**
+* @brief Image address of an object placed by pimReserve().
+*
+* @param p Object (NULL allowed)
+*
+* @return Pointer valid at PIM_BASE; NULL if p is NULL or not in image
+*/
+static void *pimAddr(void *p)
+{
+	unsigned int i;
+
+	if(!p) return NULL;
+	if(!pimMapSize){
+		pimFailed = TRUE;
+		return NULL;
+	}
+	i = pimSlot(p);
+	if(!pimKey[i]){
+		pimFailed = TRUE;	/* points outside program tables */
+		return NULL;
+	}
+	return (void *)(size_t)(PIM_BASE + pimVal[i]);
+}
+
+/**
+* @brief Place instruction, its multifunction slots, operands and condition.
+*/
+static void pimReserveICode(sICode *p)
+{
+	int n = sICodeOperandSlots(p);
+
+	pimReserve(p, sizeof(sICode), pICODE);
+	pimReserve(p->Operand, n * sizeof(char *), (n == OPERAND_SLOTS) ? pOPERANDS : pOPERANDSMAX);
+	for(int i = 0; i < n; i++){
+		if(p->Operand[i]) pimReserve(p->Operand[i], strlen(p->Operand[i]) + 1, pSTRING);
+	}
+	if(p->Cond) pimReserve(p->Cond, strlen(p->Cond) + 1, pSTRING);
+	for(int i = 0; i < 2; i++){
+		if(p->Multi[i]) pimReserveICode(p->Multi[i]);
+	}
+}
+
+/**
+* @brief Place source-level part of instruction and its multifunction slots.
+*/
+static void pimReserveICodeSrc(sICode *p)
+{
+	sICodeSrc *s = p->Src;
+
+	pimReserve(s, sizeof(sICodeSrc), pICODESRC);
+	if(s->Line) pimReserve(s->Line, strlen(s->Line) + 1, pSTRING);
+	if(s->Comment) pimReserve(s->Comment, strlen(s->Comment) + 1, pSTRING);
+	if(s->Init) pimReserve(s->Init, strlen(s->Init) + 1, pSTRING);
+	for(int i = 0; i < 2; i++){
+		if(p->Multi[i]) pimReserveICodeSrc(p->Multi[i]);
+	}
+}
+
+/**
+* @brief Convert pointer fields of an object copy to image addresses.
+*
+* @param q Object copy in image buffer
+* @param type enum ePimObj
+*/
+static void pimFix(void *q, int type)
+{
+	switch(type){
+		case pICODE: {
+			sICode *p = (sICode *)q;
+			p->Operand = (char **)pimAddr(p->Operand);
+			p->Cond = (char *)pimAddr(p->Cond);
+			p->Multi[0] = (sICode *)pimAddr(p->Multi[0]);
+			p->Multi[1] = (sICode *)pimAddr(p->Multi[1]);
+			p->BrTarget = (sICode *)pimAddr(p->BrTarget);
+			p->LastExecuted = (sICode *)pimAddr(p->LastExecuted);
+			p->Next = (sICode *)pimAddr(p->Next);
+			p->Src = (sICodeSrc *)pimAddr(p->Src);
+			break;
+		}
+		case pICODESRC: {
+			sICodeSrc *p = (sICodeSrc *)q;
+			p->Sec = (sSecInfo *)pimAddr(p->Sec);
+			p->Line = (char *)pimAddr(p->Line);
+			p->Comment = (char *)pimAddr(p->Comment);
+			p->Init = (char *)pimAddr(p->Init);
+			p->Label = (sTab *)pimAddr(p->Label);
+			break;
+		}
+		case pOPERANDS:
+		case pOPERANDSMAX: {
+			char **p = (char **)q;
+			int n = (type == pOPERANDS) ? OPERAND_SLOTS : OPERAND_SLOTSMAX;
+
+			for(int i = 0; i < n; i++){
+				p[i] = (char *)pimAddr(p[i]);
+			}
+			break;
+		}
+		case pSECINFO: {
+			sSecInfo *p = (sSecInfo *)q;
+			p->Name = (char *)pimAddr(p->Name);
+			p->Next = (sSecInfo *)pimAddr(p->Next);
+			break;
+		}
+		case pTAB: {
+			sTab *p = (sTab *)q;
+			p->Name = (char *)pimAddr(p->Name);
+			p->Next = (sTab *)pimAddr(p->Next);
+			p->Sec = (sSecInfo *)pimAddr(p->Sec);
+			p->MemRefList.FirstNode = (sMemRef *)pimAddr(p->MemRefList.FirstNode);
+			p->MemRefList.LastNode = (sMemRef *)pimAddr(p->MemRefList.LastNode);
+			break;
+		}
+		case pMEMREF: {
+			sMemRef *p = (sMemRef *)q;
+			p->Next = (sMemRef *)pimAddr(p->Next);
+			break;
+		}
+		case pDMEM: {
+			dMem *p = (dMem *)q;
+			p->Next = (dMem *)pimAddr(p->Next);
+			break;
+		}
+		default:
+			break;
+	}
+}
+
+/**
+* @brief Move pointer p by delta if not NULL.
+*/
+#define	PIM_MOVE(p, delta)	do { if(p) *(char **)&(p) += (delta); } while(0)
+
+/**
+* @brief Relocate an image mapped at another address than it was laid out for.
+*
+* @param h Header of mapped image
+* @param delta Mapped address - h->Base
+*/
+static void pimRelocate(sPimHeader *h, long long delta)
+{
+	char *base = (char *)h;
+	sPimObj *obj = (sPimObj *)(base + h->ObjOff);
+
+	PIM_MOVE(h->ICode.FirstNode, delta);
+	PIM_MOVE(h->ICode.LastNode, delta);
+	PIM_MOVE(h->SecInfo.FirstNode, delta);
+	PIM_MOVE(h->SecInfo.LastNode, delta);
+	PIM_MOVE(h->SymTable.FirstNode, delta);
+	PIM_MOVE(h->SymTable.LastNode, delta);
+	for(int i = 0; i < MAX_HASHTABLE; i++){
+		PIM_MOVE(h->DataMem[i].FirstNode, delta);
+		PIM_MOVE(h->DataMem[i].LastNode, delta);
+	}
+
+	for(int k = 0; k < h->ObjCntr; k++){
+		void *q = base + obj[k].Off;
+
+		switch(obj[k].Type){
+			case pICODE: {
+				sICode *p = (sICode *)q;
+				PIM_MOVE(p->Operand, delta);
+				PIM_MOVE(p->Cond, delta);
+				PIM_MOVE(p->Multi[0], delta);
+				PIM_MOVE(p->Multi[1], delta);
+				PIM_MOVE(p->BrTarget, delta);
+				PIM_MOVE(p->LastExecuted, delta);
+				PIM_MOVE(p->Next, delta);
+				PIM_MOVE(p->Src, delta);
+				break;
+			}
+			case pICODESRC: {
+				sICodeSrc *p = (sICodeSrc *)q;
+				PIM_MOVE(p->Sec, delta);
+				PIM_MOVE(p->Line, delta);
+				PIM_MOVE(p->Comment, delta);
+				PIM_MOVE(p->Init, delta);
+				PIM_MOVE(p->Label, delta);
+				break;
+			}
+			case pOPERANDS:
+			case pOPERANDSMAX: {
+				char **p = (char **)q;
+				int n = (obj[k].Type == pOPERANDS) ? OPERAND_SLOTS : OPERAND_SLOTSMAX;
+
+				for(int i = 0; i < n; i++){
+					PIM_MOVE(p[i], delta);
+				}
+				break;
+			}
+			case pSECINFO: {
+				sSecInfo *p = (sSecInfo *)q;
+				PIM_MOVE(p->Name, delta);
+				PIM_MOVE(p->Next, delta);
+				break;
+			}
+			case pTAB: {
+				sTab *p = (sTab *)q;
+				PIM_MOVE(p->Name, delta);
+				PIM_MOVE(p->Next, delta);
+				PIM_MOVE(p->Sec, delta);
+				PIM_MOVE(p->MemRefList.FirstNode, delta);
+				PIM_MOVE(p->MemRefList.LastNode, delta);
+				break;
+			}
+			case pMEMREF:
+				PIM_MOVE(((sMemRef *)q)->Next, delta);
+				break;
+			case pDMEM:
+				PIM_MOVE(((dMem *)q)->Next, delta);
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/**
+* @brief Free writer bookkeeping.
+*/
+static void pimFreeMap(void)
+{
+	free(pimKey);
+	free(pimVal);
+	free(pimObjs);
+	free(pimObjPtr);
+	pimKey = NULL;
+	pimVal = NULL;
+	pimObjs = NULL;
+	pimObjPtr = NULL;
+	pimMapSize = 0;
+	pimObjCntr = pimObjMax = 0;
+	pimLen = 0;
+	pimFailed = FALSE;
+}
+
+/**
+* @brief Write current program tables as image of the source.
+* Called after codeScan() of a program without errors.
+*
+* @param asmfile Source filename
+*/
+void progImageSave(char *asmfile)
+{
+	char pimfile[MAX_LINEBUF];
+	char tmpfile[MAX_LINEBUF+8];
+	sPimHeader h;
+	unsigned long long key;
+	char *buf;
+	FILE *fp;
+
+	if(pimDepOverflow || !progImageKey(asmfile, &key)) return;
+	changeFilenameExt(pimfile, asmfile, "pim");
+
+	/* place all objects: header first */
+	memset(&h, 0, sizeof(h));
+	pimLen = sizeof(sPimHeader);
+
+	sSecInfo *sp = secInfo.FirstNode;
+	while(sp){
+		pimReserve(sp, sizeof(sSecInfo), pSECINFO);
+		if(sp->Name) pimReserve(sp->Name, strlen(sp->Name) + 1, pSTRING);
+		sp = sp->Next;
+	}
+	for(sTab *tp = symTable.FirstNode; tp; tp = tp->Next){
+		pimReserve(tp, sizeof(sTab), pTAB);
+		pimReserve(tp->Name, strlen(tp->Name) + 1, pSTRING);
+		for(sMemRef *mp = tp->MemRefList.FirstNode; mp; mp = mp->Next){
+			pimReserve(mp, sizeof(sMemRef), pMEMREF);
+		}
+	}
+	for(int i = 0; i < MAX_HASHTABLE; i++){
+		for(dMem *dp = dataMem[i].FirstNode; dp; dp = dp->Next){
+			pimReserve(dp, sizeof(dMem), pDMEM);
+		}
+	}
+	for(sICode *p = iCode.FirstNode; p; p = p->Next){
+		pimReserveICode(p);
+	}
+	for(sICode *p = iCode.FirstNode; p; p = p->Next){
+		pimReserveICodeSrc(p);
+	}
+
+	/* dependent files and object table at the end */
+	pimLen = (pimLen + 7) & ~7U;
+	h.DepOff = pimLen;
+	h.DepCntr = pimDepCntr;
+	pimLen += pimDepCntr * sizeof(sPimDep);
+	h.ObjOff = pimLen;
+	h.ObjCntr = pimObjCntr;
+	pimLen += pimObjCntr * sizeof(sPimObj);
+
+	memcpy(h.Magic, PIM_MAGIC, 4);
+	h.Version = PIM_VERSION;
+	h.PtrSize = sizeof(void *);
+	h.Key = key;
+	h.Base = PIM_BASE;
+	h.Len = pimLen;
+
+	h.ICode.FirstNode = (sICode *)pimAddr(iCode.FirstNode);
+	h.ICode.LastNode = (sICode *)pimAddr(iCode.LastNode);
+	h.SecInfo.FirstNode = (sSecInfo *)pimAddr(secInfo.FirstNode);
+	h.SecInfo.LastNode = (sSecInfo *)pimAddr(secInfo.LastNode);
+	h.SymTable.FirstNode = (sTab *)pimAddr(symTable.FirstNode);
+	h.SymTable.LastNode = (sTab *)pimAddr(symTable.LastNode);
+	h.SymTable.Cntr = symTable.Cntr;
+	for(int i = 0; i < MAX_HASHTABLE; i++){
+		h.DataMem[i].FirstNode = (dMem *)pimAddr(dataMem[i].FirstNode);
+		h.DataMem[i].LastNode = (dMem *)pimAddr(dataMem[i].LastNode);
+	}
+
+	/* copy objects and convert their pointers */
+	buf = (char *)calloc(1, pimLen);
+	memcpy(buf, &h, sizeof(h));
+	for(int k = 0; k < pimObjCntr; k++){
+		size_t size;
+
+		switch(pimObjs[k].Type){
+			case pICODE:	size = sizeof(sICode);		break;
+			case pICODESRC:	size = sizeof(sICodeSrc);	break;
+			case pOPERANDS:	size = OPERAND_SLOTS * sizeof(char *);		break;
+			case pOPERANDSMAX:	size = OPERAND_SLOTSMAX * sizeof(char *);	break;
+			case pSECINFO:	size = sizeof(sSecInfo);	break;
+			case pTAB:		size = sizeof(sTab);		break;
+			case pMEMREF:	size = sizeof(sMemRef);		break;
+			case pDMEM:		size = sizeof(dMem);		break;
+			default:		size = strlen((char *)pimObjPtr[k]) + 1;	break;
+		}
+		memcpy(buf + pimObjs[k].Off, pimObjPtr[k], size);
+		pimFix(buf + pimObjs[k].Off, pimObjs[k].Type);
+	}
+	for(int k = 0; k < pimDepCntr; k++){
+		if(!progImageDepHash(pimDeps[k].Name, &pimDeps[k].Hash)) pimFailed = TRUE;
+	}
+	memcpy(buf + h.DepOff, pimDeps, pimDepCntr * sizeof(sPimDep));
+	memcpy(buf + h.ObjOff, pimObjs, pimObjCntr * sizeof(sPimObj));
+
+	/* write under temporary name: concurrent runs never see a partial image */
+	if(!pimFailed){
+		sprintf(tmpfile, "%s.%d", pimfile, (int)getpid());
+		if((fp = fopen(tmpfile, "wb")) != NULL){
+			int ok = (fwrite(buf, 1, pimLen, fp) == pimLen);
+
+			ok = !fclose(fp) && ok;
+			if(ok && !rename(tmpfile, pimfile)){
+				printf("program image (.pim) saved: %s\n", pimfile);
+			}else{
+				unlink(tmpfile);
+			}
+		}
+	}else{
+		printf("Note: program image (.pim) not saved - program tables refer outside themselves\n");
+	}
+
+	free(buf);
+	pimFreeMap();
+}
+
+/**
+* @brief Map image of the source if it matches, and make it the current program.
+*
+* @param asmfile Source filename
+*
+* @return TRUE if program was loaded from image (skip parsing and scanning)
+*/
+int progImageLoad(char *asmfile)
+{
+	char pimfile[MAX_LINEBUF];
+	unsigned long long key, hash;
+	struct stat st;
+	sPimHeader *h;
+	void *m;
+	int fd;
+
+	if(!progImageKey(asmfile, &key)) return FALSE;
+	changeFilenameExt(pimfile, asmfile, "pim");
+
+	if((fd = open(pimfile, O_RDONLY)) < 0) return FALSE;
+	if(fstat(fd, &st) || st.st_size < (off_t)sizeof(sPimHeader)){
+		close(fd);
+		return FALSE;
+	}
+
+	m = mmap((void *)(size_t)PIM_BASE, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(m == MAP_FAILED) return FALSE;
+
+	h = (sPimHeader *)m;
+	if(memcmp(h->Magic, PIM_MAGIC, 4) || h->Version != PIM_VERSION
+		|| h->PtrSize != (int)sizeof(void *) || h->Key != key
+		|| h->Len != (unsigned long long)st.st_size){
+		munmap(m, st.st_size);
+		return FALSE;
+	}
+
+	/* initializer files must be unchanged too */
+	sPimDep *dep = (sPimDep *)((char *)m + h->DepOff);
+	for(int k = 0; k < h->DepCntr; k++){
+		if(!progImageDepHash(dep[k].Name, &hash) || hash != dep[k].Hash){
+			munmap(m, st.st_size);
+			return FALSE;
+		}
+	}
+
+	if((unsigned long long)(size_t)m != h->Base){
+		pimRelocate(h, (long long)((size_t)m - h->Base));
+	}
+
+	iCode = h->ICode;
+	symTable = h->SymTable;
+	sTabHashRebuild(&symTable);		/* index is not in the image */
+	memcpy(dataMem, h->DataMem, sizeof(h->DataMem));
+	secInfo = h->SecInfo;
+
+	pimMap = m;
+	pimMapLen = st.st_size;
+	ProgImageLoaded = TRUE;
+	printf("program image (.pim) loaded: %s\n", pimfile);
+	return TRUE;
+}
+
+/**
+* @brief Unmap image. Program tables must not be used afterwards.
+*/
+void progImageClose(void)
+{
+	if(pimMap) munmap(pimMap, pimMapLen);
+	pimMap = NULL;
+	pimMapLen = 0;
+	ProgImageLoaded = FALSE;
+}
@@ -0,0 +1,81 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file progimage.h
+* @brief Header for precompiled program image cache (-pc option)
+* @date 2026-10-19
+*/
+
+#ifndef	_PROGIMAGE_H
+#define	_PROGIMAGE_H
+
+#include "dspsim.h"
+#include "icode.h"
+#include "symtab.h"
+#include "dmem.h"
+#include "secinfo.h"
+
+#define	PIM_MAGIC		"\177PIM"	/**< program image file magic */
+#define	PIM_VERSION		3			/**< program image format version */
+#define	MAX_PIMDEPS		64			/**< max. number of files read by codeScan() (initializers) */
+
+/**
+* @brief Object types in a program image (pointer fields to relocate).
+*/
+enum ePimObj {
+	pICODE, pSECINFO, pTAB, pMEMREF, pDMEM, pSTRING,
+	pICODESRC, pOPERANDS, pOPERANDSMAX,
+};
+
+/**
+* @brief Object table entry: where an object is and what it is.
+*/
+typedef struct sPimObj {
+	unsigned int	Off;		/**< offset from image start */
+	int		Type;				/**< enum ePimObj */
+} sPimObj;
+
+/**
+* @brief File read while scanning, with content hash at image creation.
+*/
+typedef struct sPimDep {
+	char	Name[MAX_LINEBUF];	/**< filename as given in source */
+	unsigned long long	Hash;	/**< content hash */
+} sPimDep;
+
+/**
+* @brief Program image header. The image is laid out for address Base:
+* all pointers in it are valid as they are if mapped there.
+*/
+typedef struct sPimHeader {
+	char	Magic[4];			/**< PIM_MAGIC */
+	int		Version;			/**< PIM_VERSION */
+	int		PtrSize;			/**< sizeof(void *) of writer */
+	int		Pad;
+	unsigned long long	Key;	/**< hash of source and options */
+	unsigned long long	Base;	/**< address image was laid out for */
+	unsigned long long	Len;	/**< image length in bytes */
+	unsigned int	ObjOff;		/**< offset of sPimObj table */
+	int		ObjCntr;			/**< number of objects */
+	unsigned int	DepOff;		/**< offset of sPimDep table */
+	int		DepCntr;			/**< number of dependent files */
+	sICodeList	ICode;						/**< iCode */
+	sTabList	SymTable;					/**< symTable (list only: index rebuilt on load) */
+	dMemList	DataMem[MAX_HASHTABLE];		/**< initial dataMem */
+	sSecInfoList	SecInfo;				/**< secInfo */
+} sPimHeader;
+
+int progImageLoad(char *asmfile);
+void progImageSave(char *asmfile);
+void progImageAddDep(char *fname);
+int progImageKey(char *asmfile, unsigned long long *key);
+int progImageDepHash(char *fname, unsigned long long *h);
+int progImageDepList(sPimDep **deps);
+void progImageDepReset(void);
+void progImageClose(void);
+
+extern int ProgImageMode;
+extern int ProgImageLoaded;
+
+#endif	/* _PROGIMAGE_H */
@@ -0,0 +1,572 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file region.cc
+* @brief Multi-region data memory load/dump specification (-rf option)
+*
+* A region spec file names any number of data memory regions, one per line:
+*
+*	; dir   where       size  format  lanes  file
+*	load    x0          -     text    all    x0.dat
+*	load    coeff       64    dmi     0      coeff.dmi
+*	dump    y           128   text    0-1    y.dat
+*	iter    0x4000      16    dmi     0,2    trace.dmi
+*	gen     x1          256   iq      all    qam:m=16:snr=20:seed=3
+*	check   y           -     text    0      y_ref.dat   lsb=2
+*
+* - dir: load (before first iteration), dump (after last iteration),
+*   iter (appended after every iteration), gen (test vector generator
+*   written before every iteration; format is real or iq and file is the
+*   generator spec, see testvec.cc) or check (compared with the next frame
+*   of a golden stream after every iteration; an optional 7th field is the
+*   tolerance exact, lsb=N or snr=dB, see golden.cc)
+* - where: .VAR symbol, symbol+offset, or absolute address (0x... for hex)
+* - size: number of addresses; '-' for the .VAR size of the symbol
+* - format: text (as -if/-of, one address per line) or dmi (binary image;
+*   iter regions write a .dmi header followed by one frame per iteration)
+* - lanes: all, a lane number, a range (0-3) or a list (0,2); values in
+*   the file are the selected lanes in order
+*
+* Symbols are resolved through symTable after assembly. All regions of a
+* direction are serviced in one pass over data memory in address order,
+* looking up each address once however many regions cover it.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "dmem.h"
+#include "simsupport.h"
+#include "dmimage.h"
+#include "region.h"
+#include "testvec.h"
+#include "../common/asyncout.h"
+
+sRegion Regions[MAX_REGIONS];	/**< regions in spec file order */
+int RegionCntr = 0;				/**< number of regions */
+int CheckFailCntr = 0;			/**< failed iterations of all check regions */
+
+/**
+* @brief Print spec file error.
+*
+* @param r Region (for line number)
+* @param msg Error message
+*
+* @return FALSE
+*/
+static int regionError(sRegion *r, const char *msg)
+{
+	if(!r->Line){		/* region given on command line */
+		printf("\nError: %s - %s\n", r->Where, msg);
+		return FALSE;
+	}
+	printf("\nError: %s line %d: %s - %s\n", regionFile, r->Line, r->Where, msg);
+	if(dumpErrFP) fprintf(dumpErrFP, "\nError: %s line %d: %s - %s\n", regionFile, r->Line, r->Where, msg);
+	return FALSE;
+}
+
+/**
+* @brief Parse lane selection: all, N, N-M or N,M,...
+*
+* @param s Lane selection string
+*
+* @return Lane mask, 0 if invalid
+*/
+static int regionLaneMask(char *s)
+{
+	int mask = 0;
+	int a, b;
+
+	if(!strcasecmp(s, "all")) return (1 << NUMDP) - 1;
+
+	while(*s){
+		if(!isdigit(*s)) return 0;
+		a = b = strtol(s, &s, 10);
+		if(*s == '-'){
+			s++;
+			if(!isdigit(*s)) return 0;
+			b = strtol(s, &s, 10);
+		}
+		if(a > b || b >= NUMDP) return 0;
+		for(int j = a; j <= b; j++) mask |= (1 << j);
+		if(*s == ',') s++;
+	}
+	return mask;
+}
+
+/**
+* @brief Resolve start address and size through symTable.
+*
+* @param r Region with Where and Size (-1 for .VAR size) set
+*
+* @return TRUE if success
+*/
+static int regionResolve(sRegion *r)
+{
+	char name[MAX_SYM_LENGTH];
+	char *plus;
+	int offset = 0;
+	sTab *sp;
+
+	if(isdigit(r->Where[0])){
+		r->Start = (unsigned int)strtol(r->Where, NULL, 0);
+		if(r->Size < 0) return regionError(r, "size is required for an address");
+	}else{
+		strcpy(name, r->Where);
+		if((plus = strchr(name, '+')) != NULL){
+			*plus = '\0';
+			offset = (int)strtol(plus + 1, NULL, 0);
+		}
+
+		sp = sTabHashSearch(&symTable, name);
+		if(!sp || sp->isConst || (sp->Type == tEXTERN) || (sp->Addr == UNDEFINED)){
+			return regionError(r, "not a data memory variable (.VAR)");
+		}
+		r->Start = sp->Addr + offset;
+		if(r->Size < 0) r->Size = sp->Size - offset;
+	}
+
+	if(r->Size <= 0 || r->Start + r->Size > 0x10000){
+		return regionError(r, "region is out of data memory space");
+	}
+	return TRUE;
+}
+
+/**
+* @brief Read load region data file into r->Buf.
+*
+* @param r Region
+*
+* @return TRUE if success
+*/
+static int regionRead(sRegion *r)
+{
+	FILE *fp;
+	char tstr[MAX_LINEBUF];
+	char *s;
+	int k;
+
+	if(!(fp = fopen(r->File, r->Binary ? "rb" : "r"))){
+		return regionError(r, "cannot open data file");
+	}
+
+	r->Count = 0;
+	if(r->Binary){
+		sDmImage img;
+
+		if(!dmiIsImage(fp) || !dmiLoad(fp, &img)){
+			fclose(fp);
+			return regionError(r, "invalid data memory image");
+		}
+		r->Count = (img.Size < (unsigned int)r->Size) ? img.Size : r->Size;
+		for(int i = 0; i < r->Count; i++){
+			k = 0;
+			for(int j = 0; j < NUMDP; j++){
+				if(!(r->LaneMask & (1 << j))) continue;
+				r->Buf[i].dp[j] = (k < img.Lanes) ? (0xFFF & dmiGet(&img, i, k)) : (0xFFF & UNDEFINED);
+				k++;
+			}
+		}
+		dmiClose(&img);
+	}else{
+		while((r->Count < r->Size) && fgets(tstr, MAX_LINEBUF, fp)){
+			if(tstr[0] == ';') continue;	/* skip comment line */
+
+			s = tstr;
+			for(int j = 0; j < NUMDP; j++){
+				if(!(r->LaneMask & (1 << j))) continue;
+				r->Buf[r->Count].dp[j] = 0xFFF & (int)strtol(s, &s, 10);
+			}
+			r->Count++;
+		}
+	}
+
+	fclose(fp);
+	return TRUE;
+}
+
+/**
+* @brief Write region data (r->Buf) to stream.
+*
+* @param r Region
+* @param fp Output stream
+*/
+static void regionWrite(sRegion *r, FILE *fp)
+{
+	int data;
+
+	for(int i = 0; i < r->Size; i++){
+		for(int j = 0; j < NUMDP; j++){
+			if(!(r->LaneMask & (1 << j))) continue;
+
+			data = r->Buf[i].dp[j];
+			if(data >= 0x800){
+				data -= 0x1000;
+			}
+			if(r->Binary){
+				fputc(data & 0xFF, fp);
+				fputc((data >> 8) & 0xFF, fp);
+			}else{
+				fprintf(fp, "%d ", data);
+			}
+		}
+		if(!r->Binary) fprintf(fp, "\n");
+	}
+}
+
+/**
+* @brief Compare regions by start address (for qsort).
+*/
+static int regionCompare(const void *a, const void *b)
+{
+	unsigned int sa = (*(sRegion **)a)->Start;
+	unsigned int sb = (*(sRegion **)b)->Start;
+
+	return (sa > sb) - (sa < sb);
+}
+
+/**
+* @brief Service all regions of one direction in one pass over data memory.
+* Load regions write selected lanes into memory, dump regions copy memory
+* into their buffers. Each address is looked up once.
+*
+* @param dir enum eRegionDir
+*/
+static void regionPass(int dir)
+{
+	sRegion *list[MAX_REGIONS];
+	int n = 0;
+	unsigned int addr, end;
+	dMem *dp;
+	sint undef;
+	char tnum[16];
+
+	for(int k = 0; k < RegionCntr; k++){
+		if(Regions[k].Dir == dir) list[n++] = &Regions[k];
+	}
+	if(!n) return;
+	qsort(list, n, sizeof(sRegion *), regionCompare);
+
+	for(int j = 0; j < NUMDP; j++) undef.dp[j] = 0x0FFF & UNDEFINED;
+
+	addr = list[0]->Start;
+	end = addr;
+	for(int k = 0; k < n; k++){
+		if(list[k]->Start > addr) addr = list[k]->Start;	/* skip gap */
+		if(list[k]->Start + list[k]->Size > end) end = list[k]->Start + list[k]->Size;
+
+		/* addresses up to next region start are covered by list[0..k] only */
+		for(; addr < end && (k + 1 == n || addr < list[k+1]->Start); addr++){
+			dp = dMemHashSearch(dataMem, addr);
+
+			for(int m = 0; m <= k; m++){
+				sRegion *r = list[m];
+				int i = addr - r->Start;
+
+				if(addr >= r->Start + r->Size) continue;
+
+				if(dir == rLOAD){
+					if(i >= r->Count) continue;
+					if(!dp){
+						dp = dMemHashAdd(dataMem, undef, addr);
+						if(!SuppressUndefinedDMMode){
+							snprintf(tnum, sizeof(tnum), "0x%04X", addr);
+							printRunTimeWarning(lineno, tnum,
+								"Undefined data memory address. Use \".VAR\" to define a new data memory variable.\n");
+						}
+					}
+					for(int j = 0; j < NUMDP; j++){
+						if(r->LaneMask & (1 << j)) dp->Data.dp[j] = r->Buf[i].dp[j];
+					}
+				}else{
+					for(int j = 0; j < NUMDP; j++){
+						r->Buf[i].dp[j] = dp ? (0x0FFF & dp->Data.dp[j]) : (0x0FFF & UNDEFINED);
+					}
+				}
+			}
+		}
+	}
+}
+
+/**
+* @brief Open golden stream of a check region.
+* A .dmi header sets start and size if fromHeader (-gold), else it must match.
+*
+* @param r Check region; r->FP is the open golden file or NULL
+* @param tol Tolerance string
+* @param fromHeader TRUE: region taken from .dmi header
+*
+* @return TRUE if success
+*/
+static int regionOpenGolden(sRegion *r, const char *tol, int fromHeader)
+{
+	FILE *fp;
+
+	if(!r->FP && !(r->FP = fopen(r->File, "rb"))){
+		return regionError(r, "cannot open golden file");
+	}
+
+	r->Gold = (sGolden *)malloc(sizeof(sGolden));
+	fp = r->FP;
+	r->FP = NULL;		/* owned by r->Gold */
+	if(!goldenOpen(r->Gold, fp, r->Where, tol, r->Start, r->Size, r->Lanes, fromHeader)){
+		return FALSE;
+	}
+	r->Gold->Stop = goldStop;
+	r->Start = r->Gold->Start;
+	r->Size = r->Gold->Size;
+	if(r->Start + r->Size > 0x10000){
+		return regionError(r, "region is out of data memory space");
+	}
+
+	if(!r->Buf) r->Buf = (sint *)malloc(sizeof(sint) * r->Size);
+	r->Val = (int *)malloc(sizeof(int) * r->Size * r->Lanes);
+	return TRUE;
+}
+
+/**
+* @brief Parse region spec file, resolve symbols and read load region files.
+*
+* @return TRUE if success, FALSE on spec file or data file error
+*/
+static int regionParse(void)
+{
+	char tstr[MAX_LINEBUF];
+	char dir[MAX_LINEBUF], size[MAX_LINEBUF], format[MAX_LINEBUF], lanes[MAX_LINEBUF];
+	char tol[MAX_LINEBUF];
+	int line = 0;
+	sRegion *r;
+
+	while(fgets(tstr, MAX_LINEBUF, regionFP)){
+		line++;
+		if(tstr[0] == ';' || tstr[0] == '#') continue;		/* comment line */
+		if(sscanf(tstr, "%s", dir) != 1) continue;			/* empty line */
+
+		if(RegionCntr == MAX_REGIONS){
+			printf("\nError: %s line %d - too many regions (max. %d)\n", regionFile, line, MAX_REGIONS);
+			return FALSE;
+		}
+		r = &Regions[RegionCntr];
+		memset(r, 0, sizeof(sRegion));
+		r->Line = line;
+
+		strcpy(tol, "exact");
+		if(sscanf(tstr, "%s %79s %s %s %s %159s %s", dir, r->Where, size, format, lanes, r->File, tol) < 6){
+			strcpy(r->Where, dir);
+			return regionError(r, "expected: dir where size format lanes file [tolerance]");
+		}
+
+		if(!strcasecmp(dir, "load"))		r->Dir = rLOAD;
+		else if(!strcasecmp(dir, "dump"))	r->Dir = rDUMP;
+		else if(!strcasecmp(dir, "iter"))	r->Dir = rITER;
+		else if(!strcasecmp(dir, "gen"))	r->Dir = rGEN;
+		else if(!strcasecmp(dir, "check"))	r->Dir = rCHECK;
+		else return regionError(r, "direction must be load, dump, iter, gen or check");
+
+		if(r->Dir == rGEN){
+			if(strcasecmp(format, "real") && strcasecmp(format, "iq"))
+				return regionError(r, "format must be real or iq");
+		}
+		else if(!strcasecmp(format, "text"))	r->Binary = FALSE;
+		else if(!strcasecmp(format, "dmi"))	r->Binary = TRUE;
+		else return regionError(r, "format must be text or dmi");
+
+		if(!(r->LaneMask = regionLaneMask(lanes))){
+			return regionError(r, "invalid lane selection");
+		}
+		for(int j = 0; j < NUMDP; j++){
+			if(r->LaneMask & (1 << j)) r->Lanes++;
+		}
+
+		r->Size = strcmp(size, "-") ? atoi(size) : -1;
+		if(!regionResolve(r)) return FALSE;
+
+		if((r->Dir == rITER || r->Dir == rCHECK) && SpecJobs > 1){
+			return regionError(r, "iter and check regions cannot be used with parallel iterations (-p)");
+		}
+
+		if(r->Dir == rGEN){
+			char spec[MAX_LINEBUF + 8];
+
+			if(SpecJobs > 1 || LockstepCount){
+				return regionError(r, "gen regions cannot be used with -p or -k");
+			}
+			sprintf(spec, "%s:iq=%d", r->File, !strcasecmp(format, "iq"));
+			if(!genAdd(spec, r->Start, r->Size, r->LaneMask)){
+				return regionError(r, "invalid generator spec");
+			}
+			RegionCntr++;
+			continue;
+		}
+
+		r->Buf = (sint *)malloc(sizeof(sint) * r->Size);
+		RegionCntr++;
+
+		if(r->Dir == rLOAD){
+			if(!regionRead(r)) return FALSE;
+		}else if(r->Dir == rITER){
+			if(!(r->FP = asyncOpen(r->File, r->Binary ? "wb" : "w"))){
+				return regionError(r, "cannot open data file");
+			}
+			if(r->Binary) dmiWriteHeader(r->FP, r->Start, r->Size, r->Lanes);
+		}else if(r->Dir == rCHECK){
+			if(!regionOpenGolden(r, tol, FALSE)) return FALSE;
+			if(r->Gold->Binary != r->Binary){
+				return regionError(r, "format does not match golden file");
+			}
+		}
+	}
+
+	return TRUE;
+}
+
+/**
+* @brief Add check region of -gold option.
+*
+* @return TRUE if success
+*/
+static int regionAddGold(void)
+{
+	sRegion *r;
+
+	if(RegionCntr == MAX_REGIONS){
+		printf("\nError: -gold - too many regions (max. %d)\n", MAX_REGIONS);
+		return FALSE;
+	}
+	if(goldSize <= 0 || goldStart + goldSize > 0x10000){
+		printf("\nError: -gold - region is out of data memory space\n");
+		return FALSE;
+	}
+
+	r = &Regions[RegionCntr];
+	memset(r, 0, sizeof(sRegion));
+	r->Dir = rCHECK;
+	strcpy(r->Where, "-gold");
+	r->Start = goldStart;
+	r->Size = goldSize;
+	r->LaneMask = (1 << NUMDP) - 1;
+	r->Lanes = NUMDP;
+	r->FP = goldFP;
+	goldFP = NULL;		/* closed by goldenClose() */
+	RegionCntr++;
+
+	return regionOpenGolden(r, goldTol, TRUE);
+}
+
+/**
+* @brief Parse region spec file and load all load regions.
+* Called after initDumpIn().
+*
+* @return TRUE if success, FALSE on spec file or data file error
+*/
+int regionInit(void)
+{
+	if((regionFP && !regionParse()) || (goldFP && !regionAddGold())){
+		for(int k = 0; k < RegionCntr; k++){
+			if(Regions[k].FP) fclose(Regions[k].FP);
+			if(Regions[k].Gold){
+				goldenClose(Regions[k].Gold);
+				free(Regions[k].Gold);
+			}
+			free(Regions[k].Buf);
+			free(Regions[k].Val);
+		}
+		RegionCntr = 0;
+		return FALSE;
+	}
+
+	regionPass(rLOAD);
+	return TRUE;
+}
+
+/**
+* @brief Append all iter regions to their files.
+* Called after every iteration.
+*/
+void regionIter(void)
+{
+	regionPass(rITER);
+
+	for(int k = 0; k < RegionCntr; k++){
+		if(Regions[k].Dir == rITER) regionWrite(&Regions[k], Regions[k].FP);
+	}
+}
+
+/**
+* @brief Compare all check regions with their golden streams.
+* Called after every iteration.
+*
+* @return FALSE if an iteration failed and -goldx is given
+*/
+int regionCheck(void)
+{
+	int ok = TRUE;
+	int n, data;
+	sRegion *r;
+
+	regionPass(rCHECK);
+
+	for(int k = 0; k < RegionCntr; k++){
+		r = &Regions[k];
+		if(r->Dir != rCHECK) continue;
+
+		n = 0;
+		for(int i = 0; i < r->Size; i++){
+			for(int j = 0; j < NUMDP; j++){
+				if(!(r->LaneMask & (1 << j))) continue;
+
+				data = r->Buf[i].dp[j];
+				if(data >= 0x800){
+					data -= 0x1000;
+				}
+				r->Val[n++] = data;
+			}
+		}
+
+		n = r->Gold->Failed;
+		if(!goldenCompare(r->Gold, ItrCntr + 1, r->Val)) ok = FALSE;
+		if(r->Gold->Failed > n) CheckFailCntr++;
+	}
+	return ok;
+}
+
+/**
+* @brief Write all dump regions, close files and free buffers.
+* Called from closeDumpOut().
+*/
+void regionClose(void)
+{
+	FILE *fp;
+	sRegion *r;
+
+	regionPass(rDUMP);
+
+	for(int k = 0; k < RegionCntr; k++){
+		r = &Regions[k];
+
+		if(r->Dir == rDUMP){
+			if((fp = asyncOpen(r->File, r->Binary ? "wb" : "w")) != NULL){
+				if(r->Binary) dmiWriteHeader(fp, r->Start, r->Size, r->Lanes);
+				regionWrite(r, fp);
+				fclose(fp);
+			}else{
+				regionError(r, "cannot open data file");
+			}
+		}else if(r->Dir == rCHECK){
+			goldenReport(r->Gold);
+			goldenClose(r->Gold);
+			free(r->Gold);
+			free(r->Val);
+		}else if(r->FP){
+			fclose(r->FP);
+		}
+		free(r->Buf);
+	}
+	RegionCntr = 0;
+}
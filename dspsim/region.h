@@ -0,0 +1,60 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file region.h
+* @brief Header for multi-region data memory load/dump specification (-rf option)
+* @date 2026-10-19
+*/
+
+#ifndef	_REGION_H
+#define	_REGION_H
+
+#include <stdio.h>
+#include "symtab.h"
+#include "simsupport.h"
+#include "golden.h"
+
+#define	MAX_REGIONS		64		/**< maximum number of regions in a spec file */
+
+/**
+* @brief Region direction
+*/
+enum eRegionDir {
+	rLOAD,		/**< load into data memory before first iteration */
+	rDUMP,		/**< dump from data memory after last iteration */
+	rITER,		/**< dump from data memory after every iteration */
+	rGEN,		/**< test vector generator before every iteration (see testvec.cc) */
+	rCHECK,		/**< compare with golden stream after every iteration (see golden.cc) */
+};
+
+/**
+* @brief One region of a spec file.
+*/
+typedef struct sRegion {
+	int		Dir;					/**< enum eRegionDir */
+	char	Where[MAX_SYM_LENGTH];	/**< symbol[+offset] or address as written */
+	unsigned int	Start;			/**< resolved start address */
+	int		Size;					/**< number of addresses */
+	int		Count;					/**< load: number of addresses read from file */
+	int		Binary;					/**< TRUE: .dmi image, FALSE: decimal text */
+	int		LaneMask;				/**< bit j set: lane j selected */
+	int		Lanes;					/**< number of selected lanes */
+	char	File[MAX_LINEBUF];		/**< data file name; rGEN: generator spec */
+	FILE	*FP;					/**< rITER: open output stream */
+	sint	*Buf;					/**< Size words of region data */
+	sGolden	*Gold;					/**< rCHECK: golden stream */
+	int		*Val;					/**< rCHECK: Size * Lanes signed output values */
+	int		Line;					/**< line number in spec file */
+} sRegion;
+
+int regionInit(void);
+void regionIter(void);
+int regionCheck(void);
+void regionClose(void);
+
+extern sRegion Regions[MAX_REGIONS];
+extern int RegionCntr;
+extern int CheckFailCntr;
+
+#endif	/* _REGION_H */
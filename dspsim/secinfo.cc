@@ -15,9 +15,10 @@ All Rights Reserved.
 #include "dspsim.h"
 #include "symtab.h"	//just for eTabID
 #include "secinfo.h"
+#include "arena.h"
 
 /** 
-* @brief Allocate a node dynamically.
+* @brief Allocate a node from the program arena.
 * 
 * @param name Pointer to segment name string
 * @param t enum eSec value (tCODE or tDATA)
@@ -27,10 +28,10 @@ All Rights Reserved.
 sSecInfo *sSecInfoGetNode(char *name, int t)
 {
 	sSecInfo *p;
-	p = (sSecInfo *)calloc(1, sizeof(sSecInfo));
+	p = (sSecInfo *)arenaAlloc(curArena, sizeof(sSecInfo));
 	assert(p != NULL);
 
-	p->Name = strdup(name);
+	p->Name = arenaStrdup(curArena, name);
 	p->Type = t;
 
 	return p;
@@ -114,9 +115,7 @@ void sSecInfoListRemoveAfter(sSecInfoList *list, sSecInfo *p)
 			if(obsoleteNode->Next == NULL){	/* if it is LastNode */
 				list->LastNode = p;		/* update LastNode */
 			}
-			/* free node */
-			if(obsoleteNode->Name) free(obsoleteNode->Name);
-			free(obsoleteNode);
+			/* node and its name stay in program arena until arenaFree() */
 		}
 	}
 }
@@ -132,13 +131,10 @@ sSecInfo *sSecInfoListRemoveBeginning(sSecInfoList *list)
 {
 	if(list != NULL){
 		if(list->FirstNode != NULL){
-			sSecInfo *obsoleteNode = list->FirstNode;
 			list->FirstNode = list->FirstNode->Next;
 			if(list->FirstNode == NULL) list->LastNode = NULL; /* removed last node */
 
-			/* free node */
-			if(obsoleteNode->Name) free(obsoleteNode->Name);
-			free(obsoleteNode);
+			/* node and its name stay in program arena until arenaFree() */
 			return list->FirstNode;	/* return new FirstNode */
 		} else {
 			return NULL;
@@ -148,14 +144,14 @@ sSecInfo *sSecInfoListRemoveBeginning(sSecInfoList *list)
 
 /** 
 * @brief Remove all nodes in the list.
+* * Note: Nodes are freed with the program arena (arenaFree()). 
 * 
 * @param list Pointer to linked list
 */
 void sSecInfoListRemoveAll(sSecInfoList *list)
 {
-	while(list->FirstNode != NULL){
-		sSecInfoListRemoveBeginning(list);
-	}
+	list->FirstNode = NULL;
+	list->LastNode = NULL;
 }
 
 /** 
@@ -22,6 +22,14 @@ All Rights Reserved.
 #include "stack.h"
 #include "secinfo.h"
 #include "dspdef.h"
+#include "dmimage.h"
+#include "framestream.h"
+#include "region.h"
+#include "testvec.h"
+#include "checksum.h"
+#include "progimage.h"
+#include "arena.h"
+#include "oprmatch.h"
 
 #ifdef VHPI
 #include "dsp.h"	/* for vhpi interface */
@@ -65,8 +73,8 @@ int simCore(sICodeList icode)
 				printf("Iteration:%d/%d NextPC:%04X Line:%d Opcode:%s Type:%s\n", 
 					ItrCntr+1, ItrMax, p->PMA, p->LineCntr, (char *)sOp[p->Index], 
 					sType[p->InstType]);
-				if(p->Line){
-					printf("Next>>\t%s\n", p->Line);
+				if(p->Src->Line){
+					printf("Next>>\t%s\n", p->Src->Line);
 				}
 			}
 		}
@@ -388,7 +396,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -416,7 +424,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -452,7 +460,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -467,7 +475,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessALUFunc(p, stemp1, stemp2, Opr0, condMask);
 				} 
 			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -479,7 +487,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT4);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT4);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm4;
 					}
@@ -487,7 +495,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessALUFunc(p, stemp1, stemp2, Opr0, condMask);
 				} 
 			} else if(isACC32(p, Opr0) && isACC32(p, Opr1) && isACC32(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -516,7 +524,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -542,7 +550,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						"Complex constant should be in a pair, e.g. (3, 4)\n");
 					break;
 				}
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -559,8 +567,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						}
 					}
 
-					int imm41 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT4);
-					int imm42 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT4);
+					int imm41 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT4);
+					int imm42 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT4);
 
 					scplx sct2;
 					for(int j = 0; j < NUMDP; j++) {
@@ -571,7 +579,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessALU_CFunc(p, sct1, sct2, Opr0, condMask);
 				}
 			} else if(isACC64(p, Opr0) && isACC64(p, Opr1) && isACC64(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -607,7 +615,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -622,7 +630,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessALUFunc(p, stemp1, stemp2, Opr0, condMask);
 				}
 			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -634,7 +642,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT4);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT4);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm4;
 					}
@@ -655,7 +663,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -682,7 +690,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					break;
 				}
 
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -699,8 +707,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						}
 					}
 
-					int imm41 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT4);
-					int imm42 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT4);
+					int imm41 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT4);
+					int imm42 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT4);
 
 					scplx sct2;
 					for(int j = 0; j < NUMDP; j++) {
@@ -725,7 +733,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -740,7 +748,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessALUFunc(p, stemp1, stemp2, Opr0, condMask);
 				} 
 			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -752,7 +760,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT4);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT4);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm4;
 					}
@@ -775,7 +783,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -796,7 +804,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFTFunc(p, stemp1, stemp2, Opr0, Opr3, condMask);
 				} 
 			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -817,7 +825,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFTFunc(p, stemp1, stemp2, Opr0, Opr3, condMask);
 				} 
 			} else if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -829,7 +837,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -837,7 +845,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFTFunc(p, stemp1, stemp2, Opr0, Opr3, condMask);
 				}
 			} else if(isACC32(p, Opr0) && isACC32(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -849,7 +857,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm6 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT6);
+					int imm6 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT6);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm6;
 					}
@@ -857,7 +865,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFTFunc(p, stemp1, stemp2, Opr0, Opr3, condMask);
 				}
 			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -869,7 +877,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -892,7 +900,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -914,7 +922,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFT_CFunc(p, sct1, sct2, Opr0, Opr3, condMask);
 				}
 			} else if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -936,7 +944,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFT_CFunc(p, sct1, sct2, Opr0, Opr3, condMask);
 				}
 			} else if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -948,7 +956,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					scplx sct1, sct2;
 					sct1 = scRdReg(Opr1);
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -956,7 +964,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFT_CFunc(p, sct1, sct2, Opr0, Opr3, condMask);
 				}
 			} else if(isACC64(p, Opr0) && isACC64(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -968,7 +976,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					scplx sct1, sct2;
 					sct1 = scRdReg(Opr1);
-					int imm6 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT6);
+					int imm6 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT6);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm6;
 					}
@@ -976,7 +984,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sProcessSHIFT_CFunc(p, sct1, sct2, Opr0, Opr3, condMask);
 				}
 			} else if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isInt(Opr2) && Opr3){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -988,7 +996,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					scplx sct1, sct2;
 					sct1 = scRdReg(Opr1);
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -1046,7 +1054,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					}else{					/* if delay slot enabled */
 						stackPush(&PCStack, p->PMA +2);	/* return addr */
 					}
-					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, symTable, Opr0));
+					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, &symTable, Opr0));
 					isBranchTaken = TRUE;
 			
 					if(DelaySlotMode){
@@ -1102,7 +1110,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					}else{					/* if delay slot enabled */
 						stackPush(&PCStack, p->PMA +2);	/* return addr */
 					}
-					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, symTable, Opr0));
+					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, &symTable, Opr0));
 					isBranchTaken = TRUE;
 
 					if(DelaySlotMode){
@@ -1122,7 +1130,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iCLRACC:
 			if(isACC32(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1142,7 +1150,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iCLRACC_C:
 			if(isACC64(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1170,7 +1178,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1183,7 +1191,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sint stemp1 = sRdReg(Opr1);
 					sint stemp2;
 
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT4);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT4);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm4;
 					}
@@ -1201,7 +1209,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
         case    iCLRINT:
             if(isInt(Opr0)) {
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1211,8 +1219,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
                		/* [IF COND] CLRINT Op0 */
                 	p->InstType = t37a;
 
-                	//temp1 = 0x0F & getIntSymAddr(p, symTable, Opr0);
-					int temp1 = getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT4);
+                	//temp1 = 0x0F & getIntSymAddr(p, &symTable, Opr0);
+					int temp1 = getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT4);
 
                 	switch(temp1){
                     	case 0:
@@ -1254,7 +1262,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iCONJ_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1283,7 +1291,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg12(p, Opr0) && isDReg12(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1298,7 +1306,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sWrReg(Opr0, tData, condMask);
 				}
 			} else if(isDReg12(p, Opr0) && isRReg16(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1317,7 +1325,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sWrReg(Opr0, tData, condMask);
 				}
 			} else if(isRReg16(p, Opr0) && isDReg12(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1335,7 +1343,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					}
 				}
 			} else if(isRReg16(p, Opr0) && isRReg16(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1352,7 +1360,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					}
 				}
 			} else if(isACC32(p, Opr0) && isACC32(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1367,7 +1375,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sWrReg(Opr0, tData, condMask);
 				}
 			} else if(isACC32(p, Opr0) && isDReg12(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1394,7 +1402,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isDReg24(p, Opr0) && isDReg24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1408,7 +1416,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					scWrReg(Opr0, sct1.r, sct1.i, condMask);
 				}
 			} else if(isDReg24(p, Opr0) && isRReg16(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1429,7 +1437,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					scWrReg(Opr0, lsbVal, msbVal, condMask);			/* write to complex pairs */
 				}
 			} else if(isRReg16(p, Opr0) && isDReg24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1451,7 +1459,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						sWrReg(Opr0, val, condMask);			/* write to 16-bit register */
 				}
 			} else if(isACC64(p, Opr0) && isACC64(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1472,7 +1480,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iCPXI:
 			if(isDReg12(p, Opr0) && isXReg12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1483,8 +1491,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					p->InstType = t49a;
 
 					//WrReg(Opr0, RdReg(Opr1));
-					int imm2 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT2);
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_UINT4);
+					int imm2 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT2);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_UINT4);
 					sint tData = sRdXReg(Opr1, imm2, imm4);	/* cross-path register read */
 					sWrReg(Opr0, tData, condMask);
 				}
@@ -1496,7 +1504,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iCPXI_C:
 			if(isDReg24(p, Opr0) && isXReg24(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1506,8 +1514,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					/* [IF COND] CPXI.C Opr0,   Opr1,   Opr2,      Opr3      */
 					p->InstType = t49b;
 
-					int imm2 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT2);
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_UINT4);
+					int imm2 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT2);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_UINT4);
 					scplx tData = scRdXReg(Opr1, imm2, imm4);	/* cross-path register read */
 					scWrReg(Opr0, tData.r, tData.i, condMask);
 				}
@@ -1519,7 +1527,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iCPXO:
 			if(isXReg12(p, Opr0) && isDReg12(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1529,8 +1537,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					/* [IF COND] CPXO Opr0,   Opr1,   Opr2,      Opr3      */
 					p->InstType = t49c;
 
-					int imm2 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT2);
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_UINT4);
+					int imm2 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT2);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_UINT4);
 					sint tData = sRdReg(Opr1);	
 					sWrXReg(Opr0, tData, imm2, imm4, condMask);	/* cross-path register write */
 				}
@@ -1542,7 +1550,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iCPXO_C:
 			if(isXReg24(p, Opr0) && isDReg24(p, Opr1) && isInt(Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1552,8 +1560,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					/* [IF COND] CPXO.C Opr0,   Opr1,   Opr2,      Opr3      */
 					p->InstType = t49d;
 
-					int imm2 = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_UINT2);
-					int imm4 = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_UINT4);
+					int imm2 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_UINT2);
+					int imm4 = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_UINT4);
 					scplx tData = scRdReg(Opr1);	
 					scWrXReg(Opr0, tData.r, tData.i, imm2, imm4, condMask);	/* cross-path register write */
 				}
@@ -1568,7 +1576,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iDIS:
 			if(p->OperandCounter){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -1608,7 +1616,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iDIVS:
 			if(isReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1654,7 +1662,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iDIVQ:
 			if(isReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1716,7 +1724,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				p->InstType = t11a;
 
 				int LoopBeginAddr = p->PMA + 1;
-				int LoopEndAddr   = getLabelAddr(p, symTable, Opr1);
+				int LoopEndAddr   = getLabelAddr(p, &symTable, Opr1);
 
 				/* latency restriction: if single-instruction loop-body, DO-UNTIL becomes 2-cycle. */
 				if(LoopBeginAddr == LoopEndAddr) p->LatencyAdded = 1;
@@ -1749,7 +1757,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iDPID:
 			if(isDReg12(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -1770,7 +1778,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iENA:
 			if(p->OperandCounter){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -1812,7 +1820,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iENADP:
 			if(p->OperandCounter){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -1846,7 +1854,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iEXP:
 			/* note: iEXP cannot be used in multifunction instructions */
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && Opr2){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -1945,7 +1953,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iEXP_C:
 			/* note: iEXP_C cannot be used in multifunction instructions */
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && Opr2){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2096,7 +2104,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iEXPADJ:
 			/* note: iEXPADJ cannot be used in multifunction instructions */
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2148,7 +2156,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iEXPADJ_C:
 			/* note: iEXPADJ_C cannot be used in multifunction instructions */
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2221,7 +2229,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
 		case    iIDLE:
-			if(!p->Cond) p->Cond = strdup("TRUE");
+			if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 			/* now p->Cond always exists */
 
 			if(ifCond(p->Cond)){
@@ -2270,7 +2278,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = 3; 	/* 4 cycles if taken */
 					}
 
-					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, symTable, Opr0));
+					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, &symTable, Opr0));
 					isBranchTaken = TRUE;
 
 					if(DelaySlotMode){
@@ -2320,7 +2328,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = 3; 	/* 4 cycles if taken */
 					}
 
-					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, symTable, Opr0));
+					NextCode = sICodeListSearch(&iCode, getLabelAddr(p, &symTable, Opr0));
 					isBranchTaken = TRUE;
 
 					if(DelaySlotMode){
@@ -2345,7 +2353,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 			if(isDReg12(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2360,8 +2368,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					if(lp && (isST(lp) || isST_C(lp) || isSTMulti(lp)))
 						p->LatencyAdded = p->LatencyAdded +1;
 
-					//int tAddr = 0x0FFFF & getIntSymAddr(p, symTable, Opr1);
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr1), eIMM_UINT16);
+					//int tAddr = 0x0FFFF & getIntSymAddr(p, &symTable, Opr1);
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr1), eIMM_UINT16);
 					sint tData = sRdDataMem(tAddr);
 
 #ifdef VHPI
@@ -2398,11 +2406,11 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 				/*
 				p->InstType = t03b;
-				WrReg(Opr0, RdDataMem(0x0FFFF & getIntSymAddr(p, symTable, Opr1)));
+				WrReg(Opr0, RdDataMem(0x0FFFF & getIntSymAddr(p, &symTable, Opr1)));
 				*/
 			} else if(isACC32(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2424,8 +2432,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						break;
 					}
 
-					//int tAddr1 = 0x0FFFF & getIntSymAddr(p, symTable, Opr1);
-					int tAddr1 = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr1), eIMM_UINT16);
+					//int tAddr1 = 0x0FFFF & getIntSymAddr(p, &symTable, Opr1);
+					int tAddr1 = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr1), eIMM_UINT16);
 
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr1, Opr1);
 
@@ -2471,7 +2479,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					"This case should not happen. Please report.\n");
 				break;
 			} else if(isRReg16(p, Opr0) && isInt(Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2487,17 +2495,17 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = p->LatencyAdded +1;
 
 					sint stemp1;
-					int imm16 = getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT16);			
+					int imm16 = getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT16);			
 					for(int j = 0; j < NUMDP; j++) {
 						stemp1.dp[j] = imm16;
 					}
 					if(!isReadOnlyReg(p, Opr0)){
-						//WrReg(Opr0, getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT16));			
+						//WrReg(Opr0, getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT16));			
 						sWrReg(Opr0, stemp1, condMask);
 					}
 				}
 			} else if(isDReg12(p, Opr0) && isInt(Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2513,11 +2521,11 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = p->LatencyAdded +1;
 
 					sint stemp1;
-					int imm12 = getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT12);			
+					int imm12 = getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT12);			
 					for(int j = 0; j < NUMDP; j++) {
 						stemp1.dp[j] = imm12;
 					}
-					//WrReg(Opr0, getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT12));			
+					//WrReg(Opr0, getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT12));			
 					sWrReg(Opr0, stemp1, condMask);
 				}
 			} else if(isACC32(p, Opr0) && isInt(Opr1)){
@@ -2532,7 +2540,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					p->LatencyAdded = p->LatencyAdded +1;
 
 				sint stemp1;
-				int imm24 = getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT24);			
+				int imm24 = getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT24);			
 					for(int j = 0; j < NUMDP; j++) {
 						stemp1.dp[j] = imm24;
 					}
@@ -2540,7 +2548,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				sWrReg(Opr0, stemp1, trueMask);			
 			} else if(isRReg(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isMReg(p, Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2572,7 +2580,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isRReg(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isMReg(p, Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2601,7 +2609,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isDReg12(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2628,15 +2636,15 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					sWrReg(Opr0, tData, condMask);
 
 					/* postmodify: update Ix */
-					//int tOffset = (0x0FF & getIntSymAddr(p, symTable, Opr3));
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT8);
+					//int tOffset = (0x0FF & getIntSymAddr(p, &symTable, Opr3));
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT8);
 
 					tAddr += tOffset;
 					updateIReg(Opr2, tAddr);
 				}
 			} else if(isDReg12(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2652,8 +2660,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = p->LatencyAdded +1;
 
 					/* premodify: don't update Ix */
-					//int tOffset =  (0x0FF & getIntSymAddr(p, symTable, Opr3));
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT8);
+					//int tOffset =  (0x0FF & getIntSymAddr(p, &symTable, Opr3));
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT8);
 
 					int tAddr = 0xFFFF & (RdReg2(p, Opr2) + tOffset);
 					sint tData = sRdDataMem((unsigned int)tAddr);
@@ -2668,7 +2676,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isDReg12(p, Opr0) && isIReg(p, Opr1)
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2715,7 +2723,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 			if(isDReg24(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2730,8 +2738,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					if(lp && (isST(lp) || isST_C(lp) || isSTMulti(lp)))
 						p->LatencyAdded = p->LatencyAdded +1;
 
-					//int tAddr = 0xFFFF & getIntSymAddr(p, symTable, Opr1);
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr1), eIMM_UINT16);
+					//int tAddr = 0xFFFF & getIntSymAddr(p, &symTable, Opr1);
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr1), eIMM_UINT16);
 
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr, Opr1);
 
@@ -2775,7 +2783,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				break;
 			} else if(isACC64(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2797,8 +2805,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						break;
 					}
 
-					//int tAddr1 = 0x0FFFF & getIntSymAddr(p, symTable, Opr1);
-					int tAddr1 = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr1), eIMM_UINT16);
+					//int tAddr1 = 0x0FFFF & getIntSymAddr(p, &symTable, Opr1);
+					int tAddr1 = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr1), eIMM_UINT16);
 
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr1, Opr1);
 
@@ -2878,8 +2886,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					p->LatencyAdded = p->LatencyAdded +1;
 
 				sint stemp1, stemp2;
-				int imm121 = getIntImm(p, getIntSymAddr(p, symTable, Opr1),  eIMM_INT12);			
-				int imm122 = getIntImm(p, getIntSymAddr(p, symTable, Opr2),  eIMM_INT12);			
+				int imm121 = getIntImm(p, getIntSymAddr(p, &symTable, Opr1),  eIMM_INT12);			
+				int imm122 = getIntImm(p, getIntSymAddr(p, &symTable, Opr2),  eIMM_INT12);			
 				for(int j = 0; j < NUMDP; j++) {
 					stemp1.dp[j] = imm121;
 					stemp2.dp[j] = imm122;
@@ -2888,7 +2896,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				scWrReg(Opr0, stemp1, stemp2, trueMask);			
 			} else if(isCReg(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isMReg(p, Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2931,7 +2939,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isCReg(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isMReg(p, Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -2971,7 +2979,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isDReg24(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3009,15 +3017,15 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					scWrReg(Opr0, tData1, tData2, condMask);
 
 					/* postmodify: update Ix */
-					//int tOffset = (0x0FF & getIntSymAddr(p, symTable, Opr3));
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT8);
+					//int tOffset = (0x0FF & getIntSymAddr(p, &symTable, Opr3));
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT8);
 
 					tAddr += tOffset;
 					updateIReg(Opr2, tAddr);
 				}
 			} else if(isDReg24(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3033,8 +3041,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						p->LatencyAdded = p->LatencyAdded +1;
 
 					/* premodify: don't update Ix */
-					//int tOffset = (0x0FF & getIntSymAddr(p, symTable, Opr3));
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr3), eIMM_INT8);
+					//int tOffset = (0x0FF & getIntSymAddr(p, &symTable, Opr3));
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr3), eIMM_INT8);
 
 					int tAddr = 0xFFFF & (RdReg2(p, Opr2) + tOffset);
 
@@ -3060,7 +3068,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isDReg24(p, Opr0) && isIReg(p, Opr1)
 				&& !strcasecmp(Opr2, "DM")){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3126,7 +3134,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3185,7 +3193,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3249,7 +3257,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			}
 
 			if(isACC64(p, Opr0) && isXOP12(p, Opr1) && isXOP24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3306,7 +3314,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iMAG_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3335,7 +3343,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iNOP:
-			if(!p->Cond) p->Cond = strdup("TRUE");
+			if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 			/* now p->Cond always exists */
 
 			if(ifCond(p->Cond)){
@@ -3347,7 +3355,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iPOLAR_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3380,7 +3388,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] POP |PC, LOOP| [, STS] */
 			/* [IF COND] POP Opr0,      [, STS] */
 			if(p->OperandCounter){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -3436,7 +3444,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] PUSH |PC, LOOP| [, STS] */
 			/* [IF COND] PUSH Opr0,      [, STS] */
 			if(p->OperandCounter){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -3473,7 +3481,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iRCCW_C:
 		case	iRCW_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3497,7 +3505,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iRECT_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3526,7 +3534,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iRESET:
-			if(!p->Cond) p->Cond = strdup("TRUE");
+			if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 			/* now p->Cond always exists */
 
 			if(ifCond(p->Cond)){
@@ -3550,7 +3558,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] RNDACC ACC32 */
 			/* [IF COND] RNDACC Op0   */
 			if(isACC32(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3588,7 +3596,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] RNDACC.C ACC64[*] */
 			/* [IF COND] RNDACC.C Op0[*]   */
 			if(isACC64(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3643,7 +3651,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		case	iRTI:
 			/* type 20a */
 			/* [IF COND] RTS/RTI */
-			if(!p->Cond) p->Cond = strdup("TRUE");
+			if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 			/* now p->Cond always exists */
 
 			if(ifCond(p->Cond)){
@@ -3672,7 +3680,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] SATACC ACC32 */
 			/* [IF COND] SATACC Opr0  */
 			if(isACC32(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3710,7 +3718,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			/* [IF COND] SATACC.C ACC64[*] */
 			/* [IF COND] SATACC.C Opr0[*]  */
 			if(isACC64(p, Opr0)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 					/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3763,7 +3771,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iSCR:
 			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3785,7 +3793,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 			break;
 		case	iSCR_C:
 			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3816,7 +3824,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 		///////////////////////////////////////////////////////////////////////////////////////
         case    iSETINT:
             if(isInt(Opr0)) {
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				if(ifCond(p->Cond)){
@@ -3825,8 +3833,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
                 	/* [IF COND] SETINT Op0 */
                 	p->InstType = t37a;
 
-                	//temp1 = 0x0F & getIntSymAddr(p, symTable, Opr0);
-					int temp1 = getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT4);
+                	//temp1 = 0x0F & getIntSymAddr(p, &symTable, Opr0);
+					int temp1 = getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT4);
 
                 	switch(temp1){
                     	case 0:
@@ -3875,7 +3883,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 			if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isDReg12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3885,8 +3893,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					/* [IF COND] ST Op1(Op0),        Op2    */
 					p->InstType = t03f;
 
-					//int tAddr = 0x0FFFF & getIntSymAddr(p, symTable, Opr0);
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT16);
+					//int tAddr = 0x0FFFF & getIntSymAddr(p, &symTable, Opr0);
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT16);
 
 					sint tData = sRdReg(Opr2);
 					sWrDataMem(tData, tAddr, condMask);
@@ -3923,11 +3931,11 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 				/*
 				p->InstType = t03b;
-				WrDataMem(RdReg(Opr2), 0x0FFFF & getIntSymAddr(p, symTable, Opr0));
+				WrDataMem(RdReg(Opr2), 0x0FFFF & getIntSymAddr(p, &symTable, Opr0));
 				*/
 			} else if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isACC32(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -3955,8 +3963,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						tData2.dp[j] = (0x0FFF000 & stemp1.dp[j]) >> 12;	/* get high word of acc */
 					}
 
-					//int tAddr = 0x0FFFF & (getIntSymAddr(p, symTable, Opr0));
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT16);
+					//int tAddr = 0x0FFFF & (getIntSymAddr(p, &symTable, Opr0));
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT16);
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr, Opr0);
 
 					sWrDataMem(tData1, tAddr, condMask);					/* write low word  */
@@ -3987,7 +3995,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				break;
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isRReg(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4013,7 +4021,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isRReg(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4052,7 +4060,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				break;
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg12(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4073,15 +4081,15 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 #endif
 
 					/* postmodify: update Ix */
-					//int tOffset = 0x0FF & getIntSymAddr(p, symTable, Opr2);
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT8);
+					//int tOffset = 0x0FF & getIntSymAddr(p, &symTable, Opr2);
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT8);
 
 					tAddr += tOffset;
 					updateIReg(Opr1, tAddr);
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg12(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4092,8 +4100,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					p->InstType = t29c;
 
 					/* premodify: don't update Ix */
-					//int tOffset = 0x0FF & getIntSymAddr(p, symTable, Opr2);
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT8);
+					//int tOffset = 0x0FF & getIntSymAddr(p, &symTable, Opr2);
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT8);
 
 					int tAddr = 0xFFFF & (RdReg2(p, Opr1) + tOffset);
 					sint tData = sRdReg(Opr4);
@@ -4107,7 +4115,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isIReg(p, Opr0) && !strcasecmp(Opr1, "DM")
 				&& isDReg12(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4129,7 +4137,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isInt(Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4142,7 +4150,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					int tAddr = 0xFFFF & RdReg2(p, Opr1);
 					sint tData;
 
-					int imm12 = getIntImm(p, getIntSymAddr(p, symTable, Opr4), eIMM_INT12);			
+					int imm12 = getIntImm(p, getIntSymAddr(p, &symTable, Opr4), eIMM_INT12);			
 					for(int j = 0; j < NUMDP; j++) {
 						tData.dp[j] = imm12;
 					}
@@ -4160,7 +4168,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isInt(Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4174,7 +4182,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					int tAddr = 0xFFFF & (RdReg2(p, Opr1) + RdReg2(p, Opr2));
 					sint tData;
 
-					int imm12 = getIntImm(p, getIntSymAddr(p, symTable, Opr4), eIMM_INT12);			
+					int imm12 = getIntImm(p, getIntSymAddr(p, &symTable, Opr4), eIMM_INT12);			
 					for(int j = 0; j < NUMDP; j++) {
 						tData.dp[j] = imm12;
 					}
@@ -4215,7 +4223,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 			if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isDReg24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4227,7 +4235,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 					scplx scData;
 					scData = scRdReg(Opr2);
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT16);
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT16);
 
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr, Opr0);
 
@@ -4259,7 +4267,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 
 			} else if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isACC64(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4284,7 +4292,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 						}
 					}
 
-					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, symTable, Opr0), eIMM_UINT16);
+					int tAddr = 0xFFFF & getIntImm(p, getIntSymAddr(p, &symTable, Opr0), eIMM_UINT16);
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr, Opr0);
 
 					scplx scData1, scData2;
@@ -4331,7 +4339,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				break;
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isCReg(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4362,7 +4370,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isCReg(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4390,7 +4398,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg24(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4416,15 +4424,15 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 #endif
 
 					/* postmodify: update Ix */
-					//int tOffset = 0x0FF & getIntSymAddr(p, symTable, Opr2);
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT8);
+					//int tOffset = 0x0FF & getIntSymAddr(p, &symTable, Opr2);
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT8);
 
 					tAddr += tOffset;
 					updateIReg(Opr1, tAddr);
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg24(p, Opr4)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -4437,8 +4445,8 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 					/* premodify: don't update Ix */
 					scplx scData = scRdReg(Opr4);
 					int tAddr = 0xFFFF & RdReg2(p, Opr1);
-					//int tOffset = 0x0FF & getIntSymAddr(p, symTable, Opr2);
-					int tOffset = getIntImm(p, getIntSymAddr(p, symTable, Opr2), eIMM_INT8);
+					//int tOffset = 0x0FF & getIntSymAddr(p, &symTable, Opr2);
+					int tOffset = getIntImm(p, getIntSymAddr(p, &symTable, Opr2), eIMM_INT8);
 					tAddr += tOffset;
 
 					int tAddr2 = checkUnalignedMemoryAccess(p, tAddr, Opr1);
@@ -4455,7 +4463,7 @@ sICode *asmSimOneStep(sICode *p, sICodeList icode)
 				}
 			} else if(isIReg(p, Opr0) && !strcasecmp(Opr1, "DM")
 				&& isDReg24(p, Opr2)){
-				if(!p->Cond) p->Cond = strdup("TRUE");
+				if(!p->Cond) p->Cond = arenaStrdup(curArena, "TRUE");
 				/* now p->Cond always exists */
 
 				//if(ifCond(p->Cond)){
@@ -6014,7 +6022,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6092,7 +6100,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6182,7 +6190,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -6269,7 +6277,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -6363,7 +6371,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6434,7 +6442,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6512,7 +6520,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -6587,7 +6595,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -6674,7 +6682,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6736,7 +6744,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp1 = sRdReg(p->Operand[1]);
 					sint stemp2;
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -6805,7 +6813,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -6867,7 +6875,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT.C operands */
 					scplx sct1 = scRdReg(p->Operand[1]);
 					scplx sct2; 
-					int imm5 = getIntImm(p, getIntSymAddr(p, symTable, p->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(p, &symTable, p->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						sct2.r.dp[j] = sct2.i.dp[j] = imm5;
 					}
@@ -7065,7 +7073,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp3 = sRdReg(m1->Operand[1]);
 					sint stemp4;
-					int imm5 = getIntImm(p, getIntSymAddr(m1, symTable, m1->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(m1, &symTable, m1->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp4.dp[j] = imm5;
 					}
@@ -7145,7 +7153,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp3 = sRdReg(m1->Operand[1]);
 					sint stemp4;
-					int imm5 = getIntImm(p, getIntSymAddr(m1, symTable, m1->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(m1, &symTable, m1->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp2.dp[j] = imm5;
 					}
@@ -7261,7 +7269,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp3 = sRdReg(m1->Operand[1]);
 					sint stemp4;
-					int imm5 = getIntImm(p, getIntSymAddr(m1, symTable, m1->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(m1, &symTable, m1->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp4.dp[j] = imm5;
 					}
@@ -7370,7 +7378,7 @@ sICode *asmSimOneStepMultiFunc(sICode *p)
 					/* read SHIFT operands */
 					sint stemp3 = sRdReg(m1->Operand[1]);
 					sint stemp4;
-					int imm5 = getIntImm(p, getIntSymAddr(m1, symTable, m1->Operand[2]), eIMM_INT5);
+					int imm5 = getIntImm(p, getIntSymAddr(m1, &symTable, m1->Operand[2]), eIMM_INT5);
 					for(int j = 0; j < NUMDP; j++) {
 						stemp4.dp[j] = imm5;
 					}
@@ -8237,7 +8245,41 @@ void initDumpIn(void)
 *	dp0_dec2 dp1_dec2 dp2_dec2 dp3_dec2
 *	...
 *
+* or a binary image (see dmimage.h): start address and size
+* are taken from its header instead of -ia/-is.
+*
 *********************************************************/
+	/* binary image: mapped and copied straight into data memory */
+	if(dumpInFP && dmiIsImage(dumpInFP)){
+		sDmImage img;
+		dMem *dp;
+		char tnum[10];
+
+		if(!dmiLoad(dumpInFP, &img)){
+			printRunTimeError(lineno, "-if", "Invalid data memory image.\n");
+		}
+
+		for(unsigned int k = 0; k < img.Size; k++){
+			for(int j = 0; j < NUMDP; j++){
+				data.dp[j] = (j < img.Lanes) ? (0xFFF & dmiGet(&img, k, j)) : (0xFFF & UNDEFINED);
+			}
+
+			dp = dMemHashSearch(dataMem, img.Start + k);
+			if(dp){
+				dp->Data = data;
+			}else{
+				dMemHashAdd(dataMem, data, img.Start + k);
+				if(!SuppressUndefinedDMMode){
+					sprintf(tnum, "0x%04X", img.Start + k);
+					printRunTimeWarning(lineno, tnum,
+						"Undefined data memory address. Use \".VAR\" to define a new data memory variable.\n");
+				}
+			}
+		}
+		dmiClose(&img);
+		return;
+	}
+
 	/* memory dump input */
 	if(dumpInFP){
 		//if -ad option set (dataSegAddr)
@@ -8276,13 +8318,19 @@ void closeSim(void)
 	int i;
 	int data;
 
+	/* streaming frames: drain output */
+	frameStreamClose();
+	genClose();
+	checksumClose();
+
 	/* memory dump output */
 	closeDumpOut();
 
 	/* close file */
-	fclose(yyin);
+	if(yyin) fclose(yyin);
 	if(dumpInFP)  fclose(dumpInFP);
 	if(dumpOutFP) fclose(dumpOutFP);
+	if(regionFP)  fclose(regionFP);
 	if(dumpBinFP) fclose(dumpBinFP);
 	if(dumpMemFP) fclose(dumpMemFP);
 	if(dumpTxtFP) fclose(dumpTxtFP);
@@ -8299,6 +8347,31 @@ void closeDumpOut(void)
 	int i;
 	sint data;
 
+	/* region spec file: dump regions */
+	if(RegionCntr) regionClose();
+
+	/* binary image: data memory copied straight into mapped file */
+	if(dumpOutFP && dumpOutImage){
+		sDmImage img;
+		dMem *dp;
+		int v;
+
+		if(!dmiCreate(dumpOutFP, &img, dumpOutStart, dumpOutSize, NUMDP)) return;
+
+		for(i = 0; i < dumpOutSize; i++){
+			dp = isValidMemoryAddr(dumpOutStart + i) ? dMemHashSearch(dataMem, dumpOutStart + i) : NULL;
+			for(int j = 0; j < NUMDP; j++){
+				v = 0x0FFF & (dp ? dp->Data.dp[j] : UNDEFINED);
+				if(v >= 0x800){
+					v -= 0x1000;
+				}
+				dmiSet(&img, i, j, v);
+			}
+		}
+		dmiClose(&img);
+		return;
+	}
+
 	/* memory dump output */
 	if(dumpOutFP){
 		//if -ad option set (dataSegAddr)
@@ -8350,6 +8423,98 @@ int codeScan(sICodeList *icode)
 }
 
 
+/** 
+* @brief Write initial values of a .VAR variable into data memory.
+* Initializer (p->Src->Init, cut off by the lexer) is a list of 12-bit numbers 
+* (decimal, 0x hex or B# binary; separated by ',' or blanks) or a quoted 
+* filename of such numbers with ';' comments. Values fill all data paths.
+* 
+* @param p Pointer to .VAR instruction
+* @param sp Symbol of the initialized variable (last one on the line)
+*/
+void codeScanVarInit(sICode *p, sTab *sp)
+{
+	char *text = p->Src->Init;
+	char *buf = NULL;
+	char *s, *e;
+	char fname[MAX_LINEBUF];
+	int n = 0;
+	long v;
+	dMem *dp;
+
+	while(isspace(*text)) text++;
+
+	/* "filename": read whole file, blank out comments */
+	if(*text == '"'){
+		FILE *fp;
+		long len;
+
+		strncpy(fname, text + 1, MAX_LINEBUF-1);
+		fname[MAX_LINEBUF-1] = '\0';
+		if(!(e = strchr(fname, '"'))){
+			printRunTimeError(p->LineCntr, text, "Missing closing quote in initializer filename.\n");
+			return;
+		}
+		*e = '\0';
+
+		if(!(fp = fopen(fname, "r"))){
+			printRunTimeError(p->LineCntr, fname, "Cannot open initializer file.\n");
+			return;
+		}
+		progImageAddDep(fname);		/* part of program image validity */
+		fseek(fp, 0, SEEK_END);
+		len = ftell(fp);
+		rewind(fp);
+		text = buf = (char *)malloc(len + 1);
+		len = fread(text, 1, len, fp);
+		text[len] = '\0';
+		fclose(fp);
+
+		for(s = text; *s; s++){
+			if(*s == ';') while(*s && *s != '\n') *s++ = ' ';
+			if(!*s) break;
+		}
+	}
+
+	for(s = text; *s; s = e){
+		while(isspace(*s) || *s == ',') s++;
+		if(!*s) break;
+
+		e = s + (*s == '-');
+		if(!strncasecmp(e, "0x", 2))		v = strtol(e + 2, &e, 16);
+		else if(!strncasecmp(e, "B#", 2))	v = strtol(e + 2, &e, 2);
+		else if(isdigit(*e))				v = strtol(e, &e, 10);
+		else e = s;
+		if(*s == '-') v = -v;
+
+		if(e == s || (*e && !isspace(*e) && *e != ',')){
+			printRunTimeError(p->LineCntr, s, "Invalid initial value: must be a number.\n");
+			break;
+		}
+		if(v < -2048 || v > 4095){
+			printRunTimeError(p->LineCntr, s, "Initial value is out of 12-bit range.\n");
+			break;
+		}
+		if(n == sp->Size){
+			printRunTimeError(p->LineCntr, sp->Name, "Too many initial values for variable size.\n");
+			break;
+		}
+
+		dp = dMemHashSearch(dataMem, sp->Addr + n);
+		for(int j = 0; j < NUMDP; j++){
+			dp->Data.dp[j] = 0x0FFF & v;
+		}
+		n++;
+	}
+
+	if(!n){
+		printRunTimeError(p->LineCntr, sp->Name, "Initializer has no values.\n");
+	}
+	sp->InitSize = n;
+
+	if(buf) free(buf);
+}
+
 /** 
 * @brief Scan one assembly source line for instruction type resolution
 * 
@@ -8378,17 +8543,17 @@ sICode *codeScanOneInst(sICode *p)
 	}
 
 	/* update pointer to segment info */
-	p->Sec = curSecInfo;
+	p->Src->Sec = curSecInfo;
 	/* update segment address for .DATA segment */
-	p->DMA = curaddr;
+	p->Src->DMA = curaddr;
 
 	/* update program or data memory address */
 	if(VerboseMode){
 		if(!isNotRealInst(p->Index) || (p->Index == i_VAR)){
-			if(p->Sec)
-				printf("Line: %4d - PMA: %04X, DMA: %04X, segment: %s\n", p->LineCntr, p->PMA, p->DMA, p->Sec->Name);
+			if(p->Src->Sec)
+				printf("Line: %4d - PMA: %04X, DMA: %04X, segment: %s\n", p->LineCntr, p->PMA, p->Src->DMA, p->Src->Sec->Name);
 			else
-				printf("Line: %4d - PMA: %04X, DMA: %04X, segment: ----\n", p->LineCntr, p->PMA, p->DMA);
+				printf("Line: %4d - PMA: %04X, DMA: %04X, segment: ----\n", p->LineCntr, p->PMA, p->Src->DMA);
 		}else{
 			printf("Line: %4d - PMA: ----, DMA: ----\n", p->LineCntr);
 		}
@@ -8404,12 +8569,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1)){
-				/* type 9c */
-				/* [IF COND] ABS DREG12, XOP12 */
-				/* [IF COND] ABS Op0,    Op1   */
-				p->InstType = t09c;
-			}
+			oprMatch(p, oprFormABS);
 			break;
 		case	iABS_C:
 		case	iNOT_C:
@@ -8418,12 +8578,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 9d */
-				/* [IF COND] ABS.C DREG24, XOP24[*] */
-				/* [IF COND] ABS.C Op0,    Op1[*]   */
-				p->InstType = t09d;
-			}
+			oprMatch(p, oprFormABS_C);
 			break;
 		case	iADD:
 		case	iSUB:
@@ -8433,24 +8588,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 9c */
-				/* [IF COND] ADD DREG12, XOP12, YOP12 */
-				/* [IF COND] ADD Op0,    Op1,   Op2   */
-				p->InstType = t09c;
-			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(isIntSignedN(p, symTable, Opr2, 4)){
-					/* type 9e */
-					/* [IF COND] ADD DREG12, XOP12, IMM_INT4 */
-					/* [IF COND] ADD Op0,    Op1,   Op2   */
-					p->InstType = t09e;
-				}
-			} else if(isACC32(p, Opr0) && isACC32(p, Opr1) && isACC32(p, Opr2)){
-				/* type 9g */
-				/* [IF COND] ADD ACC32, ACC32, ACC32 */
-				/* [IF COND] ADD Op0,   Op1,   Op2   */
-				p->InstType = t09g;
-			}
+			oprMatch(p, oprFormADD);
 			break;
 		case	iADD_C:
 		case	iSUB_C:
@@ -8472,7 +8610,7 @@ sICode *codeScanOneInst(sICode *p)
 					break;
 				}
 
-				if(isIntSignedN(p, symTable, Opr2, 4) && isIntSignedN(p, symTable, Opr3, 4)){
+				if(isIntSignedN(p, &symTable, Opr2, 4) && isIntSignedN(p, &symTable, Opr3, 4)){
 					/* type 9f */
 					/* [IF COND] ADD.C DREG24, XOP24[*], IMM_COMPLEX8 */
 					/* [IF COND] ADD.C Op0,    Op1[*],    (Op2, Op3)     */
@@ -8493,21 +8631,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 9c */
-				/* [IF COND] ADDC DREG12, XOP12, YOP12 */
-				/* [IF COND] ADDC Op0,    Op1,   Op2   */
-				p->InstType = t09c;
-			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(isIntSignedN(p, symTable, Opr2, 4)){
-					int temp2 = getIntSymAddr(p, symTable, Opr2);
-
-					/* type 9e */
-					/* [IF COND] ADDC DREG12, XOP12, IMM_INT4 */
-					/* [IF COND] ADDC Op0,    Op1,    Op2        */
-					p->InstType = t09e;
-				}
-			} 
+			if(oprMatch(p, oprFormADDC) && p->InstType == t09e){
+				getIntSymAddr(p, &symTable, Opr2);		/* IMM_INT4 */
+			}
 			break;
 		case	iADDC_C:
 		case	iSUBC_C:
@@ -8529,10 +8655,10 @@ sICode *codeScanOneInst(sICode *p)
 					break;
 				}
 
-				if(isIntSignedN(p, symTable, Opr2, 4) && isIntSignedN(p, symTable, Opr3, 4)){
+				if(isIntSignedN(p, &symTable, Opr2, 4) && isIntSignedN(p, &symTable, Opr3, 4)){
 					cplx ct2;
-					ct2.r = getIntSymAddr(p, symTable, Opr2);
-					ct2.i = getIntSymAddr(p, symTable, Opr3);
+					ct2.r = getIntSymAddr(p, &symTable, Opr2);
+					ct2.i = getIntSymAddr(p, &symTable, Opr3);
 
 					/* type 9f */
 					/* [IF COND] ADDC.C DREG24, XOP24[*], IMM_COMPLEX8 */
@@ -8549,19 +8675,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 9c */
-				/* [IF COND] AND DREG12, XOP12, YOP12 */
-				/* [IF COND] AND Op0,    Op1,   Op2   */
-				p->InstType = t09c;
-			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(isIntUnsignedN(p, symTable, Opr2, 4)){
-					/* type 9i */
-					/* [IF COND] AND DREG12, XOP12, IMM_UINT4 */
-					/* [IF COND] AND Op0,    Op1,   Op2        */
-					p->InstType = t09i;
-				}
-			}
+			oprMatch(p, oprFormAND);
 			break;
 		case	iASHIFT:
 		case	iASHIFTOR:
@@ -8572,50 +8686,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				/* type 16a */
-				/* [IF COND] ASHIFT ACC32, XOP12, YOP12 (|HI, LO, HIRND, LORND|) */
-				/* [IF COND] ASHIFT Op0,   Op1,   Op2     Op3                    */
-				p->InstType = t16a;
-			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				/* type 16e */
-				/* [IF COND] ASHIFT DREG12, XOP12, YOP12 (|NORND, RND|) */
-				/* [IF COND] ASHIFT Op0,   Op1,   Op2      Op3          */
-				p->InstType = t16e;
-			} else if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -11, 11)){
-					/* type 15a */
-					/* [IF COND] ASHIFT ACC32, XOP12, IMM_INT5 (|HI, LO, HIRND, LORND|) */
-					/* [IF COND] ASHIFT Op0,   Op1,   Op2        Op3      */
-					p->InstType = t15a;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			} else if(isACC32(p, Opr0) && isACC32(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -31, 31)){
-					/* type 15c */
-					/* [IF COND] ASHIFT ACC32, ACC32, IMM_INT6 (|NORND, RND|) */
-					/* [IF COND] ASHIFT Op0,   Op1,   Op2        Op3          */
-					p->InstType = t15c;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			} else if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -11, 11)){
-					/* type 15e */
-					/* [IF COND] ASHIFT DREG12, XOP12, IMM_INT5 (|NORND, RND|) */
-					/* [IF COND] ASHIFT Op0,   Op1,   Op2        Op3           */
-					p->InstType = t15e;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			}else{
+			if(!oprMatch(p, oprFormASHIFT)){
 				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
 					"Invalid operands! Please check instruction syntax.\n");
 				break;
@@ -8630,50 +8701,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				/* type 16b */
-				/* [IF COND] ASHIFT.C ACC64, XOP24, YOP12 (|HI, LO, HIRND, LORND|) */
-				/* [IF COND] ASHIFT.C Op0,   Op1,   Op2     Op3      */
-				p->InstType = t16b;
-			} else if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2) && Opr3){
-				/* type 16f */
-				/* [IF COND] ASHIFT.C DREG24, XOP24, YOP12 (|NORND, RND|) */
-				/* [IF COND] ASHIFT.C Op0,    Op1,   Op2     Op3                    */
-				p->InstType = t16f;
-			} else if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -11, 11)){
-					/* type 15b */
-					/* [IF COND] ASHIFT.C ACC64, XOP24, IMM_INT5 (|HI, LO, HIRND, LORND|) */
-					/* [IF COND] ASHIFT.C Op0,    Op1,  Op2        Op3      */
-					p->InstType = t15b;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			} else if(isACC64(p, Opr0) && isACC64(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -31, 31)){
-					/* type 15d */
-					/* [IF COND] ASHIFT.C ACC64, ACC64, IMM_INT6 (|NORND, RND|) */
-					/* [IF COND] ASHIFT.C Op0,   Op1,   Op2        Op3 */
-					p->InstType = t15d;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			} else if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isInt(Opr2) && Opr3){
-				if(isIntNM(p, symTable, Opr2, -11, 11)){
-					/* type 15f */
-					/* [IF COND] ASHIFT.C DREG24, XOP24, IMM_INT5 (|NORRND, RND|) */
-					/* [IF COND] ASHIFT.C Op0,    Op1,   Op2        Op3           */
-					p->InstType = t15f;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid shift amount (number of bits)! Please check instruction syntax.\n");
-					break;
-				}
-			}else{
+			if(!oprMatch(p, oprFormASHIFT_C)){
 				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
 					"Invalid operands! Please check instruction syntax.\n");
 				break;
@@ -8703,8 +8731,8 @@ sICode *codeScanOneInst(sICode *p)
 					/* CALL  Opr0       */
 					p->InstType = t10b;
 
-					sTab *sp = sTabHashSearch(symTable, Opr0);
-					getLabelAddr(p, symTable, Opr0);	/* to make extern reference list of this label */
+					sTab *sp = sTabHashSearch(&symTable, Opr0);
+					getLabelAddr(p, &symTable, Opr0);	/* to make extern reference list of this label */
 					if(sp->Type == tEXTERN){
 						p->MemoryRefType = tREL;	/* offset: EXTERN var - current PC */
 					}else
@@ -8737,8 +8765,8 @@ sICode *codeScanOneInst(sICode *p)
 					/* [IF COND] CALL  Opr0       */
 					p->InstType = t10a;
 
-					sTab *sp = sTabHashSearch(symTable, Opr0);
-					getLabelAddr(p, symTable, Opr0);	/* to make extern reference list of this label */
+					sTab *sp = sTabHashSearch(&symTable, Opr0);
+					getLabelAddr(p, &symTable, Opr0);	/* to make extern reference list of this label */
 					if(sp->Type == tEXTERN){
 						p->MemoryRefType = tREL;	/* offset: EXTERN var - current PC */
 					}else
@@ -8755,20 +8783,10 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iCLRACC:
-			if(isACC32(p, Opr0)){
-				/* type 41c */
-				/* [IF COND] CLRACC ACC32 */
-				/* [IF COND] CLRACC Op0   */
-				p->InstType = t41c;
-			}
+			oprMatch(p, oprFormCLRACC);
 			break;
 		case	iCLRACC_C:
-			if(isACC64(p, Opr0)){
-				/* type 41d */
-				/* [IF COND] CLRACC.C ACC64 */
-				/* [IF COND] CLRACC.C Op0   */
-				p->InstType = t41d;
-			}
+			oprMatch(p, oprFormCLRACC_C);
 			break;
 		case	iCLRBIT:
 		case	iSETBIT:
@@ -8779,40 +8797,17 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isInt(Opr2)){
-				if(isIntNM(p, symTable, Opr2, 0, 11)){
-					/* type 9i */
-					/* [IF COND] CLRBIT DREG12, XOP12, IMM_UINT4   */
-					/* [IF COND] CLRBIT Op0,    Op1,   Op2 */
-					p->InstType = t09i;
-				}else{
-					printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-						"Invalid bit position (should be 0 ~ 11)! Please check instruction syntax.\n");
-					break;
-				}
-			}
+			oprMatch(p, oprFormCLRBIT);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
         case    iCLRINT:
-            if(isInt(Opr0)) {
-				if(isIntUnsignedN(p, symTable, Opr0, 4)) {
-               		/* type 37a */
-               		/* [IF COND] CLRINT IMM_UINT4   */
-               	 	/* [IF COND] CLRINT Op0 */
-               	 	p->InstType = t37a;
-				}
-            }
+			oprMatch(p, oprFormSETINT);
             break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iCONJ_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 42b */
-				/* [IF COND] CONJ.C DREG24, XOP24 */
-				/* [IF COND] CONJ.C Op0,    Op1    */
-				p->InstType = t42b;
-			}
+			oprMatch(p, oprFormCONJ_C);
 			break;
 		case	iCP:
 			if(isMultiFunc(p)){
@@ -8820,37 +8815,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg12(p, Opr0) && isDReg12(p, Opr1)){
-				/* type 17a */
-				/* [IF COND] CP DREG12, DREG12 */
-				/* [IF COND] CP Opr0, Opr1 */
-				p->InstType = t17a;
-			} else if(isDReg12(p, Opr0) && isRReg16(p, Opr1)){
-				/* type 17b */
-				/* [IF COND] CP DREG12, RREG16 */
-				/* [IF COND] CP Opr0, Opr1 */
-				p->InstType = t17b;
-			} else if(isRReg16(p, Opr0) && isDReg12(p, Opr1)){
-				/* type 17b */
-				/* [IF COND] CP RREG16, DREG12 */
-				/* [IF COND] CP Opr0, Opr1 */
-				p->InstType = t17b;
-			} else if(isRReg16(p, Opr0) && isRReg16(p, Opr1)){
-				/* type 17g */
-				/* [IF COND] CP RREG16, RREG16 */
-				/* [IF COND] CP Opr0, Opr1 */
-				p->InstType = t17g;
-			} else if(isACC32(p, Opr0) && isACC32(p, Opr1)){
-				/* type 17c */
-				/* [IF COND] CP ACC32, ACC32 */
-				/* [IF COND] CP Opr0,  Opr1 */
-				p->InstType = t17c;
-			} else if(isACC32(p, Opr0) && isDReg12(p, Opr1)){
-				/* type 17h */
-				/* [IF COND] CP ACC32, DReg12 */
-				/* [IF COND] CP Opr0,  Opr1 */
-				p->InstType = t17h;
-			}
+			oprMatch(p, oprFormCP);
 			break;
 		case	iCP_C:
 			if(isMultiFunc(p)){
@@ -8858,27 +8823,7 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isDReg24(p, Opr0) && isDReg24(p, Opr1)){
-				/* type 17d */
-				/* [IF COND] CP.C DREG24, DREG24 */
-				/* [IF COND] CP.C Opr0, Opr1 */
-				p->InstType = t17d;
-			} else if(isDReg24(p, Opr0) && isRReg16(p, Opr1)){
-				/* type 17e */
-				/* [IF COND] CP.C DREG24, RREG16 */
-				/* [IF COND] CP.C Opr0, Opr1 */
-				p->InstType = t17e;
-			} else if(isRReg16(p, Opr0) && isDReg24(p, Opr1)){
-				/* type 17e */
-				/* [IF COND] CP.C RREG16, DREG24 */
-				/* [IF COND] CP.C Opr0, Opr1 */
-				p->InstType = t17e;
-			} else if(isACC64(p, Opr0) && isACC64(p, Opr1)){
-				/* type 17f */
-				/* [IF COND] CP.C ACC64, ACC64 */
-				/* [IF COND] CP.C Opr0,  Opr1 */
-				p->InstType = t17f;
-			}
+			oprMatch(p, oprFormCP_C);
 			break;
 		case	iCPXI:
 			if(isDReg12(p, Opr0) && isXReg12(p, Opr1) && isInt(Opr2) && isIDN(Opr3)){
@@ -8924,20 +8869,10 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iDIVS:
-			if(isReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 23a */
-				/* [IF COND] DIVS REG12, XOP12, YOP12 */
-				/* [IF COND] DIVS Op0,   Op1,   Op2   */
-				p->InstType = t23a;
-			}
+			oprMatch(p, oprFormDIVS);
 			break;
 		case	iDIVQ:
-			if(isReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 23a */
-				/* [IF COND] DIVQ REG12, XOP12, YOP12 */
-				/* [IF COND] DIVQ Op0,   Op1,   Op2   */
-				p->InstType = t23a;
-			}
+			oprMatch(p, oprFormDIVS);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
@@ -8954,10 +8889,10 @@ sICode *codeScanOneInst(sICode *p)
 			/* DO Opr1        UNTIL [Opr0  ] */
 			if(Opr1 != NULL){
 				p->InstType = t11a;	//for type checking
-				if(isIntUnsignedN(p, symTable, Opr1, 12)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 12)){
 					p->InstType = t11a;
-					sTab *sp = sTabHashSearch(symTable, Opr1);
-					getLabelAddr(p, symTable, Opr1);	/* to make extern reference list of this label */
+					sTab *sp = sTabHashSearch(&symTable, Opr1);
+					getLabelAddr(p, &symTable, Opr1);	/* to make extern reference list of this label */
 					if(sp->Type == tEXTERN){
 						p->MemoryRefType = tREL;	/* offset: EXTERN var - current PC */
 					}else
@@ -8970,11 +8905,7 @@ sICode *codeScanOneInst(sICode *p)
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iDPID:
-			/* type 18c */
-			/* [IF COND] DPID DREG12 */
-			if(isDReg12(p, Opr0)){
-				p->InstType = t18c;
-			}
+			oprMatch(p, oprFormDPID);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
@@ -8998,36 +8929,16 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iEXP:
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && Opr2){
-				/* type 16c */
-				/* [IF COND] EXP DREG12, XOP12 (|HIX, HI, LO|) */
-				/* [IF COND] EXP Op0,    Op1,     Op2           */
-				p->InstType = t16c;
-			}
+			oprMatch(p, oprFormEXP);
 			break;
 		case	iEXP_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && Opr2){
-				/* type 16d */
-				/* [IF COND] EXP.C DREG24, XOP24 (|HIX, HI, LO|) */
-				/* [IF COND] EXP.C Op0,    Op1,     Op2           */
-				p->InstType = t16d;
-			}
+			oprMatch(p, oprFormEXP_C);
 			break;
 		case	iEXPADJ:
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1)){
-				/* type 16c */
-				/* [IF COND] EXPADJ DREG12, XOP12 */
-				/* [IF COND] EXPADJ Op0,    Op1    */
-				p->InstType = t16c;
-			}
+			oprMatch(p, oprFormEXPADJ);
 			break;
 		case	iEXPADJ_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 16d */
-				/* [IF COND] EXPADJ.C DREG24, XOP24 */
-				/* [IF COND] EXPADJ.C Op0,    Op1    */
-				p->InstType = t16d;
-			}
+			oprMatch(p, oprFormEXPADJ_C);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
@@ -9061,8 +8972,8 @@ sICode *codeScanOneInst(sICode *p)
 					/* JUMP  Opr0       */
 					p->InstType = t10b;
 
-					sTab *sp = sTabHashSearch(symTable, Opr0);
-					getLabelAddr(p, symTable, Opr0);	/* to make extern reference list of this label */
+					sTab *sp = sTabHashSearch(&symTable, Opr0);
+					getLabelAddr(p, &symTable, Opr0);	/* to make extern reference list of this label */
 					if(sp->Type == tEXTERN){
 						p->MemoryRefType = tREL;	/* offset: EXTERN var - current PC */
 					}else
@@ -9095,8 +9006,8 @@ sICode *codeScanOneInst(sICode *p)
 					/* [IF COND] JUMP  Opr0       */
 					p->InstType = t10a;
 
-					sTab *sp = sTabHashSearch(symTable, Opr0);
-					getLabelAddr(p, symTable, Opr0);	/* to make extern reference list of this label */
+					sTab *sp = sTabHashSearch(&symTable, Opr0);
+					getLabelAddr(p, &symTable, Opr0);	/* to make extern reference list of this label */
 					if(sp->Type == tEXTERN){
 						p->MemoryRefType = tREL;	/* offset: EXTERN var - current PC */
 					}else
@@ -9119,7 +9030,7 @@ sICode *codeScanOneInst(sICode *p)
 
 			if(isDReg12(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3a */
 					/* [IF COND] LD DREG12, DM(IMM_UINT16) */
 					/* [IF COND] LD Op0,    Op2(Op1)        */
@@ -9129,7 +9040,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (Opr2 != NULL)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3) && (Opr4 != NULL) && !strcasecmp(Opr4, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3a */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD DREG12, DM(IMM_UINT16 +   const ) */
@@ -9141,18 +9052,13 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD DREG12, DM(IMM_INT16)            */
 					/* LD Op0,    Op2(Op1)                   */
-					int iop1 = 0xFFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
+					int iop1 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
 	
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
-
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 	
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->Operand[2] = p->Operand[4];
 					p->OperandCounter = 3;
 
@@ -9174,7 +9080,7 @@ sICode *codeScanOneInst(sICode *p)
 				*/
 			} else if(isACC32(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3d */
 					/* [IF COND] LD ACC32, DM(IMM_UINT16) (|HI,LO|) */
 					/* [IF COND] LD Op0,   Op2(Op1)        (Op3)     */
@@ -9192,7 +9098,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3) && (Opr4 != NULL) && !strcasecmp(Opr4, "DM")
 				&& (!strcmp(Opr5, "HI") || !strcmp(Opr5, "LO"))){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3d */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD ACC32, DM(IMM_UINT16 +   const ) (|HI,LO|) */
@@ -9205,19 +9111,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD ACC32, DM(IMM_UINT16) (|HI,LO|)   */
 					/* LD Op0,   Op2(Op1)        (Op3)       */
-					//int iop1 = 0xFFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
-					int iop1 = getIntImm(p, (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
+					//int iop1 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
+					int iop1 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
 
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->Operand[2] = p->Operand[4];
 					p->Operand[3] = p->Operand[5];
 					p->OperandCounter = 4;
@@ -9231,7 +9132,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3)){
 
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 6a */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD RREG16, <IMM_UINT16> +   const  */
@@ -9243,18 +9144,13 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD RREG16, <IMM_INT16> */
 					/* LD Op0,    Op1         */
-					int iop1 = 0xFFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
+					int iop1 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
 	
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
-
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 	
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->OperandCounter = 2;
 
 					/* make unused operands NULL */
@@ -9262,7 +9158,7 @@ sICode *codeScanOneInst(sICode *p)
 					p->Operand[3] = NULL;
 				}
 			} else if(isRReg16(p, Opr0) && isInt(Opr1)){
-				if(isIntSignedN(p, symTable, Opr1, 16)){
+				if(isIntSignedN(p, &symTable, Opr1, 16)){
 					/* type 6a */
 					/* [IF COND] LD RREG16, <IMM_INT16> */
 					/* [IF COND] LD Op0,    Op1         */
@@ -9273,7 +9169,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3)){
 
-				if(isIntUnsignedN(p, symTable, Opr1, 12)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 12)){
 					/* type 6b */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD DREG12, <IMM_UINT12> +   const  */
@@ -9285,18 +9181,13 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD DREG12, <IMM_INT12> */
 					/* LD Op0,    Op1         */
-					int iop1 = 0xFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
+					int iop1 = 0xFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
 	
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
-
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 	
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->OperandCounter = 2;
 
 					/* make unused operands NULL */
@@ -9304,7 +9195,7 @@ sICode *codeScanOneInst(sICode *p)
 					p->Operand[3] = NULL;
 				}
 			} else if(isDReg12(p, Opr0) && isInt(Opr1)){
-				if(isIntSignedN(p, symTable, Opr1, 12)){
+				if(isIntSignedN(p, &symTable, Opr1, 12)){
 					/* type 6b */
 					/* [IF COND] LD DREG12, <IMM_INT12> */
 					/* [IF COND] LD Op0,    Op1         */
@@ -9317,7 +9208,7 @@ sICode *codeScanOneInst(sICode *p)
 					break;
 				}
 
-				if(isIntSignedN(p, symTable, Opr1, 24)){
+				if(isIntSignedN(p, &symTable, Opr1, 24)){
 					/* type 6d */
 					/* LD ACC32, <IMM_INT24> */
 					/* LD Op0,   Op1         */
@@ -9361,7 +9252,7 @@ sICode *codeScanOneInst(sICode *p)
 				*/
 			} else if(isDReg12(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(isIntSignedN(p, symTable, Opr3, 8)){
+				if(isIntSignedN(p, &symTable, Opr3, 8)){
 					/* type 29a */
 					/* [IF COND] LD DREG12, DM(IREG +=  <IMM_INT8>) */
 					/* [IF COND] LD Op0,    Op4(Op2 Op1 Op3) */
@@ -9369,7 +9260,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(isDReg12(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(isIntSignedN(p, symTable, Opr3, 8)){
+				if(isIntSignedN(p, &symTable, Opr3, 8)){
 					/* type 29a */
 					/* [IF COND] LD DREG12, DM(IREG +   <IMM_INT8>) */
 					/* [IF COND] LD Op0,    Op4(Op2 Op1 Op3) */
@@ -9402,7 +9293,7 @@ sICode *codeScanOneInst(sICode *p)
 
 			if(isDReg24(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3c */
 					/* [IF COND] LD.C DREG24, DM(IMM_UINT16) */
 					/* [IF COND] LD.C Op0,    Op2(Op1)        */
@@ -9412,7 +9303,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (Opr2 != NULL)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3) && (Opr4 != NULL) && !strcasecmp(Opr4, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3c */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD.C DREG24, DM(IMM_UINT16 +   const ) */
@@ -9424,19 +9315,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD.C DREG24, DM(IMM_UINT16)          */
 					/* LD.C Op0,    Op2(Op1)                 */
-					//int iop1 = 0xFFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
-					int iop1 = getIntImm(p, (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
+					//int iop1 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
+					int iop1 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
 
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->Operand[2] = p->Operand[4];
 					p->OperandCounter = 3;
 
@@ -9446,7 +9332,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(isACC64(p, Opr0) && isInt(Opr1) && (Opr2 != NULL) 
 				&& !strcasecmp(Opr2, "DM")){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3e */
 					/* [IF COND] LD.C ACC64, DM(IMM_UINT16) (|HI,LO|) */
 					/* [IF COND] LD.C Op0,   Op2(Op1)       (Op3)       */
@@ -9461,7 +9347,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr2, "+") || !strcmp(Opr2, "["))
 				&& isInt(Opr3) && (Opr4 != NULL) && !strcasecmp(Opr4, "DM")
 				&& (!strcmp(Opr5, "HI") || !strcmp(Opr5, "LO"))){
-				if(isIntUnsignedN(p, symTable, Opr1, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr1, 16)){
 					/* type 3e */
 					/* Variation due to .VAR usage */
 					/* [IF COND] LD.C ACC64, DM(IMM_UINT16 +   const ) (|HI,LO|) */
@@ -9477,19 +9363,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* LD.C ACC64, DM(IMM_UINT16) (|HI,LO|) */
 					/* LD.C Op0,   Op2(Op1)        (Op3)       */
-					//int iop1 = 0xFFFF & (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3));
-					int iop1 = getIntImm(p, (getIntSymAddr(p, symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
-					free(p->Operand[3]); 
+					//int iop1 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3));
+					int iop1 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr1) + atoi(Opr3)), eIMM_UINT16);
 
 					char sop1[10];
 					sprintf(sop1, "%d", iop1);
 
 					/* new operands */
-					p->Operand[1] = strdup(sop1);
+					p->Operand[1] = arenaStrdup(curArena, sop1);
 					p->Operand[2] = p->Operand[4];
 					p->Operand[3] = p->Operand[5];
 					p->OperandCounter = 4;
@@ -9552,7 +9433,7 @@ sICode *codeScanOneInst(sICode *p)
 				*/
 			} else if(isDReg24(p, Opr0) && !strcmp(Opr1, "+=") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(isIntSignedN(p, symTable, Opr3, 8)){
+				if(isIntSignedN(p, &symTable, Opr3, 8)){
 					/* type 29b */
 					/* [IF COND] LD.C DREG24, DM(IREG +=  <IMM_INT8>) */
 					/* [IF COND] LD.C Op0,    Op4(Op2 Op1 Op3) */
@@ -9560,7 +9441,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(isDReg24(p, Opr0) && !strcmp(Opr1, "+") && isIReg(p, Opr2)
 				&& isInt(Opr3) && !strcasecmp(Opr4, "DM")){
-				if(isIntSignedN(p, symTable, Opr3, 8)){
+				if(isIntSignedN(p, &symTable, Opr3, 8)){
 					/* type 29b */
 					/* [IF COND] LD.C DREG24, DM(IREG +   <IMM_INT8>) */
 					/* [IF COND] LD.C Op0,    Op4(Op2 Op1 Op3) */
@@ -9595,16 +9476,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 40e */
-				/* [IF COND] MAC ACC32, XOP12, YOP12 (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAC Opr0,  Opr1,  Opr2  (Opr3)                  */
-				p->InstType = t40e;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAC_C:
@@ -9613,16 +9487,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40f */
-				/* [IF COND] MAC.C ACC64, XOP24, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAC.C Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40f;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_C) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAC_RC:
@@ -9631,16 +9498,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP12(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40g */
-				/* [IF COND] MAC.RC ACC64, XOP12, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAC.RC Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40g;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_RC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAS:
@@ -9649,16 +9509,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 40e */
-				/* [IF COND] MAS ACC32, XOP12, YOP12 (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAS Opr0,  Opr1,  Opr2  (Opr3)                  */
-				p->InstType = t40e;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAS_C:
@@ -9667,16 +9520,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40f */
-				/* [IF COND] MAS.C ACC64, XOP24, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAS.C Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40f;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_C) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAS_RC:
@@ -9685,16 +9531,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP12(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40g */
-				/* [IF COND] MAS.RC ACC64, XOP12, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MAS.RC Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40g;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_RC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMPY:
@@ -9703,16 +9542,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC32(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 40e */
-				/* [IF COND] MPY ACC32, XOP12, YOP12 (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MPY Opr0,  Opr1,  Opr2  (Opr3)                  */
-				p->InstType = t40e;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMPY_C:
@@ -9721,16 +9553,9 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40f */
-				/* [IF COND] MPY.C ACC64, XOP24, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MPY.C Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40f;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_C) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMPY_RC:
@@ -9739,25 +9564,13 @@ sICode *codeScanOneInst(sICode *p)
 				break;
 			}
 
-			if(isACC64(p, Opr0) && isXOP12(p, Opr1) && isXOP24(p, Opr2)){
-				/* type 40g */
-				/* [IF COND] MPY.RC ACC64, XOP12, YOP24[*] (|RND, SS, SU, US, UU|) */
-				/* [IF COND] MPY.RC Opr0,  Opr1,  Opr2[*]  (Opr3)                  */
-				p->InstType = t40g;
-
-				if(!Opr3){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-				}
+			if(oprMatch(p, oprFormMAC_RC) && !Opr3){
+				printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
+					"One of these multiplier options must be given.\n");
 			}
 			break;
 		case	iMAG_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 47a */
-				/* [IF COND] MAG.C DREG24, XOP24[*] */
-				/* [IF COND] MAG.C Op0,    Op1[*]   */
-				p->InstType = t47a;
-			}
+			oprMatch(p, oprFormMAG_C);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
@@ -9769,12 +9582,8 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iPOLAR_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 42a */
-				/* [IF COND] POLAR.C DREG24, XOP24[*] */
-				/* [IF COND] POLAR.C Op0,    Op1[*]   */
-				p->InstType = t42a;
-				p->Latency = 8;			
+			if(oprMatch(p, oprFormPOLAR_C)){
+				p->Latency = 8;
 			}
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
@@ -9800,20 +9609,11 @@ sICode *codeScanOneInst(sICode *p)
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iRCCW_C:
 		case	iRCW_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP12(p, Opr2)){
-				/* type 50a */
-				/* [IF COND] RCCW.C DREG24, XOP24, YOP12 */
-				/* [IF COND] RCCW.C Op0,    Op1,   Op2   */
-				p->InstType = t50a;
-			} 
+			oprMatch(p, oprFormRCCW_C);
 			break;
 		case	iRECT_C:
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1)){
-				/* type 42a */
-				/* [IF COND] RECT.C DREG24, XOP24[*] */
-				/* [IF COND] RECT.C Op0,    Op1[*]   */
-				p->InstType = t42a;
-				p->Latency = 8;		
+			if(oprMatch(p, oprFormPOLAR_C)){
+				p->Latency = 8;
 			}
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
@@ -9826,20 +9626,10 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iRNDACC:
-			/* type 41a */
-			/* [IF COND] RNDACC ACC32 */
-			/* [IF COND] RNDACC Op0   */
-			if(isACC32(p, Opr0)){
-				p->InstType = t41a;
-			}
+			oprMatch(p, oprFormRNDACC);
 			break;
 		case	iRNDACC_C:
-			/* type 41b */
-			/* [IF COND] RNDACC.C ACC64[*] */
-			/* [IF COND] RNDACC.C Op0[*]   */
-			if(isACC64(p, Opr0)){
-				p->InstType = t41b;
-			}
+			oprMatch(p, oprFormRNDACC_C);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
@@ -9859,49 +9649,22 @@ sICode *codeScanOneInst(sICode *p)
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iSATACC:
-			/* type 25a */
-			/* [IF COND] SATACC ACC32 */
-			/* [IF COND] SATACC Opr0  */
-			if(isACC32(p, Opr0)){
-				p->InstType = t25a;
-			}
+			oprMatch(p, oprFormSATACC);
 			break;
 		case	iSATACC_C:
-			/* type 25b */
-			/* [IF COND] SATACC.C ACC64[*] */
-			/* [IF COND] SATACC.C Opr0[*]  */
-			if(isACC64(p, Opr0)){
-				p->InstType = t25b;
-			}
+			oprMatch(p, oprFormSATACC_C);
 			break;
 		case	iSCR:
-			/* type 46a */
-			/* [IF COND] SCR DREG12, XOP12, YOP12 */
-			/* [IF COND] SCR Op0,    Op1,   Op2   */
-			if(isDReg12(p, Opr0) && isXOP12(p, Opr1) && isXOP12(p, Opr2)){
-				p->InstType = t46a;
-			}
+			oprMatch(p, oprFormSCR);
 			break;
 		case	iSCR_C:
-			/* type 46b */
-			/* [IF COND] SCR.C DREG24, XOP24, YOP24[*] */
-			/* [IF COND] SCR.C Op0,    Op1,   Op2[*]   */
-			if(isDReg24(p, Opr0) && isXOP24(p, Opr1) && isXOP24(p, Opr2)){
-				p->InstType = t46b;
-			} 
+			oprMatch(p, oprFormSCR_C);
 			break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		// Program Flow Instruction
 		///////////////////////////////////////////////////////////////////////////////////////
         case    iSETINT:
-            if(isInt(Opr0)) {
-				if(isIntUnsignedN(p, symTable, Opr0, 4)) {
-               		/* type 37a */
-					/* [IF COND] SETINT IMM_UINT4   */
-					/* [IF COND] SETINT Op0 */
-					p->InstType = t37a;
-				}
-            }
+			oprMatch(p, oprFormSETINT);
             break;
 		///////////////////////////////////////////////////////////////////////////////////////
 		case	iST:
@@ -9912,7 +9675,7 @@ sICode *codeScanOneInst(sICode *p)
 
 			if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isDReg12(p, Opr2)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3f */
 					/* [IF COND] ST DM(IMM_UINT16), DREG12 */
 					/* [IF COND] ST Op1(Op0),        Op2    */
@@ -9923,7 +9686,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr1, "+") || !strcmp(Opr1, "["))
 				&& isInt(Opr2) && (Opr3 != NULL) && !strcasecmp(Opr3, "DM")
 				&& isDReg12(p, Opr4)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3f */
 					/* Variation due to .VAR usage */
 					/* [IF COND] ST DM(IMM_UINT16 +   const ), DREG12 */
@@ -9935,19 +9698,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* ST DM(IMM_UINT16), DREG12            */
 					/* ST Op1(Op0),        Op2               */
-					//int iop0 = 0xFFFF & (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2));
-					int iop0 = getIntImm(p, (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[0]); 
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
+					//int iop0 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2));
+					int iop0 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
 
 					char sop0[10];
 					sprintf(sop0, "%d", iop0);
 
 					/* new operands */
-					p->Operand[0] = strdup(sop0);
+					p->Operand[0] = arenaStrdup(curArena, sop0);
 					p->Operand[1] = p->Operand[3];
 					p->Operand[2] = p->Operand[4];
 					p->OperandCounter = 3;
@@ -9970,7 +9728,7 @@ sICode *codeScanOneInst(sICode *p)
 				*/
 			} else if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isACC32(p, Opr2)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3h */
 					/* [IF COND] ST DM(IMM_UINT16), ACC32, (|HI,LO|) */
 					/* [IF COND] ST Op1(Op0),        Op2,   (Op3)    */
@@ -9988,7 +9746,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr1, "+") || !strcmp(Opr1, "["))
 				&& isInt(Opr2) && (Opr3 != NULL) && !strcasecmp(Opr3, "DM")
 				&& isACC32(p, Opr4)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3h */
 					/* Variation due to .VAR usage */
 					/* [IF COND] ST DM(IMM_UINT16 +   const ), ACC32, (|HI,LO|) */
@@ -10001,19 +9759,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* ST DM(<IMM_INT16>), ACC32, (|HI,LO|) */
 					/* ST Op1(Op0),        Op2,   (Op3)    */
-					//int iop0 = 0xFFFF & (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2));
-					int iop0 = getIntImm(p, (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[0]); 
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
+					//int iop0 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2));
+					int iop0 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
 
 					char sop0[10];
 					sprintf(sop0, "%d", iop0);
 
 					/* new operands */
-					p->Operand[0] = strdup(sop0);
+					p->Operand[0] = arenaStrdup(curArena, sop0);
 					p->Operand[1] = p->Operand[3];
 					p->Operand[2] = p->Operand[4];
 					p->Operand[3] = p->Operand[5];
@@ -10061,7 +9814,7 @@ sICode *codeScanOneInst(sICode *p)
 				*/
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg12(p, Opr4)){
-				if(isIntSignedN(p, symTable, Opr2, 8)){
+				if(isIntSignedN(p, &symTable, Opr2, 8)){
 					/* type 29c */
 					/* [IF COND] ST DM(IREG += <IMM_INT8>), DREG12 */
 					/* [IF COND] ST Op3(Op1 Op0 Op2      ), Op4    */
@@ -10069,7 +9822,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg12(p, Opr4)){
-				if(isIntSignedN(p, symTable, Opr2, 8)){
+				if(isIntSignedN(p, &symTable, Opr2, 8)){
 					/* type 29c */
 					/* [IF COND] ST DM(IREG + <IMM_INT8>), DREG12 */
 					/* [IF COND] ST Op3(Op1 Op0 Op2     ), Op4    */
@@ -10083,7 +9836,7 @@ sICode *codeScanOneInst(sICode *p)
 				p->InstType = t29c;
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isInt(Opr4)){
-				if(isIntSignedN(p, symTable, Opr4, 12)){
+				if(isIntSignedN(p, &symTable, Opr4, 12)){
 					/* type 22a */
 					/* [IF COND] ST DM(IREG += MREG), <IMM_INT12> */
 					/* [IF COND] ST Op3(Op1 Op0 Op2), Op4         */
@@ -10091,7 +9844,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isMReg(p, Opr2)
 				&& !strcasecmp(Opr3, "DM") && isInt(Opr4)){
-				if(isIntSignedN(p, symTable, Opr4, 12)){
+				if(isIntSignedN(p, &symTable, Opr4, 12)){
 					/* type 22a */
 					/* [IF COND] ST DM(IREG + MREG), <IMM_INT12> */
 					/* [IF COND] ST Op3(Op1 Op0 Op2), Op4         */
@@ -10129,7 +9882,7 @@ sICode *codeScanOneInst(sICode *p)
 
 			if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isDReg24(p, Opr2)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3g */
 					/* [IF COND] ST.C DM(IMM_UINT16), DREG24 */
 					/* [IF COND] ST.C Op1(Op0),        Op2    */
@@ -10140,7 +9893,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr1, "+") || !strcmp(Opr1, "["))
 				&& isInt(Opr2) && (Opr3 != NULL) && !strcasecmp(Opr3, "DM")
 				&& isDReg24(p, Opr4)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3g */
 					/* Variation due to .VAR usage */
 					/* [IF COND] ST.C DM(IMM_UINT16 +   const ), DREG24 */
@@ -10152,19 +9905,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                */
 					/* ST.C DM(<IMM_INT16>), DREG24          */
 					/* ST.C Op1(Op0),        Op2             */
-					//int iop0 = 0xFFFF & (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2));
-					int iop0 = getIntImm(p, (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[0]); 
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
+					//int iop0 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2));
+					int iop0 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
 
 					char sop0[10];
 					sprintf(sop0, "%d", iop0);
 
 					/* new operands */
-					p->Operand[0] = strdup(sop0);
+					p->Operand[0] = arenaStrdup(curArena, sop0);
 					p->Operand[1] = p->Operand[3];
 					p->Operand[2] = p->Operand[4];
 					p->OperandCounter = 3;
@@ -10175,7 +9923,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(isInt(Opr0) && (Opr1 != NULL) && !strcasecmp(Opr1, "DM") 
 				&& (Opr2 != NULL) && isACC64(p, Opr2)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3i */
 					/* [IF COND] ST.C DM(IMM_UINT16), ACC64, (|HI,LO|) */
 					/* [IF COND] ST.C Op1(Op0),        Op2,   (Op3)    */
@@ -10196,7 +9944,7 @@ sICode *codeScanOneInst(sICode *p)
 				&& (!strcmp(Opr1, "+") || !strcmp(Opr1, "["))
 				&& isInt(Opr2) && (Opr3 != NULL) && !strcasecmp(Opr3, "DM")
 				&& isACC64(p, Opr4)){
-				if(isIntUnsignedN(p, symTable, Opr0, 16)){
+				if(isIntUnsignedN(p, &symTable, Opr0, 16)){
 					/* type 3i */
 					/* Variation due to .VAR usage */
 					/* [IF COND] ST.C DM(IMM_UINT16 +   const ), ACC64, (|HI,LO|) */
@@ -10212,19 +9960,14 @@ sICode *codeScanOneInst(sICode *p)
 					/* after:                                 */
 					/* ST.C DM(IMM_UINT16), ACC64, (|HI,LO|) */
 					/* ST.C Op1(Op0),        Op2,   (Op3)     */
-					//int iop0 = 0xFFFF & (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2));
-					int iop0 = getIntImm(p, (getIntSymAddr(p, symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
-
-					/* free operands */
-					free(p->Operand[0]); 
-					free(p->Operand[1]); 
-					free(p->Operand[2]); 
+					//int iop0 = 0xFFFF & (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2));
+					int iop0 = getIntImm(p, (getIntSymAddr(p, &symTable, Opr0) + atoi(Opr2)), eIMM_UINT16);
 
 					char sop0[10];
 					sprintf(sop0, "%d", iop0);
 
 					/* new operands */
-					p->Operand[0] = strdup(sop0);
+					p->Operand[0] = arenaStrdup(curArena, sop0);
 					p->Operand[1] = p->Operand[3];
 					p->Operand[2] = p->Operand[4];
 					p->Operand[3] = p->Operand[5];
@@ -10248,7 +9991,7 @@ sICode *codeScanOneInst(sICode *p)
 				p->InstType = t32d;
 			} else if(!strcmp(Opr0, "+=") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg24(p, Opr4)){
-				if(isIntSignedN(p, symTable, Opr2, 8)){
+				if(isIntSignedN(p, &symTable, Opr2, 8)){
 					/* type 29d */
 					/* [IF COND] ST.C DM(IREG += <IMM_INT8>), DREG24 */
 					/* [IF COND] ST.C Op3(Op1 Op0 Op2      ), Op4    */
@@ -10256,7 +9999,7 @@ sICode *codeScanOneInst(sICode *p)
 				}
 			} else if(!strcmp(Opr0, "+") && isIReg(p, Opr1) && isInt(Opr2)
 				&& !strcasecmp(Opr3, "DM") && isDReg24(p, Opr4)){
-				if(isIntSignedN(p, symTable, Opr2, 8)){
+				if(isIntSignedN(p, &symTable, Opr2, 8)){
 					/* type 29d */
 					/* [IF COND] ST.C DM(IREG + <IMM_INT8>), DREG24 */
 					/* [IF COND] ST.C Op3(Op1 Op0 Op2     ), Op4    */
@@ -10295,15 +10038,9 @@ sICode *codeScanOneInst(sICode *p)
 			/* search entire symbol table and modify its Sec(pointer to secinfo) */
 			/* Since .CODE always after .DATA, 
 			   every symbol (not assigned secinfo by .VAR) belongs to .CODE */
-			for(int i = 0; i < MAX_HASHTABLE; i++){
-				if(symTable[i].FirstNode){
-					sTab *n = symTable[i].FirstNode;
-					while(n != NULL){
-						if(n->Sec == NULL && n->Type != tEXTERN){
-							n->Sec = curSecInfo;
-						}
-						n = n->Next;
-					}
+			for(sTab *n = symTable.FirstNode; n != NULL; n = n->Next){
+				if(n->Sec == NULL && n->Type != tEXTERN){
+					n->Sec = curSecInfo;
 				}
 			}
 
@@ -10334,13 +10071,13 @@ sICode *codeScanOneInst(sICode *p)
 
 				for(int i = 0; i < p->OperandCounter; i++){
 					/* put it in the symTab */
-					sp = sTabHashSearch(symTable, p->Operand[i]);
+					sp = sTabHashSearch(&symTable, p->Operand[i]);
 					sp->Addr = curaddr; 
 					sp->Sec = curSecInfo;	/* attach segment info, in this case, DATA */
 
 					/* reserve data memory */
 					if(p->Operand[i+1] && p->Operand[i+1][0] == '['){		/* if array */
-						arraySize = getIntSymAddr(p, symTable, p->Operand[i+2]);
+						arraySize = getIntSymAddr(p, &symTable, p->Operand[i+2]);
 						if(arraySize < 1){
 							printRunTimeError(p->LineCntr, p->Operand[i+2], 
 								"Array size must be a positive integer number.\n");
@@ -10381,6 +10118,9 @@ sICode *codeScanOneInst(sICode *p)
 					}
 				}
 				curaddr--;	
+
+				/* .VAR varname [ arraysize ] = values */
+				if(p->Src->Init) codeScanVarInit(p, sp);
 			}else{
 				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
 					"Invalid operands! Please check instruction syntax.\n");
@@ -10393,7 +10133,7 @@ sICode *codeScanOneInst(sICode *p)
 			/* .GLOBAL Op0                      */
 			if(p->OperandCounter){
 				for(int i = 0; i < p->OperandCounter; i++){
-					sp = sTabHashSearch(symTable, p->Operand[i]);	/* must already be in the table */
+					sp = sTabHashSearch(&symTable, p->Operand[i]);	/* must already be in the table */
 					sp->Type = tGLOBAL;
 				}
 			}else{
@@ -10408,7 +10148,7 @@ sICode *codeScanOneInst(sICode *p)
 			/* .EXTERN Op0                      */
 			if(p->OperandCounter){
 				for(int i = 0; i < p->OperandCounter; i++){
-					sp = sTabHashSearch(symTable, p->Operand[i]);	/* must be new */
+					sp = sTabHashSearch(&symTable, p->Operand[i]);	/* must be new */
 					sp->Type = tEXTERN;
 					sp->Addr = 0;		/* addr of EXTERN variable: defaults to 0 */
 					sp->Sec = NULL;
@@ -10425,11 +10165,11 @@ sICode *codeScanOneInst(sICode *p)
 			/* .EQU Op0,     Op1             */
 			if(p->OperandCounter == 2){
 				/* put it in the symTab */
-				sp = sTabHashSearch(symTable, p->Operand[0]);
+				sp = sTabHashSearch(&symTable, p->Operand[0]);
 				sp->Sec = sSecInfoListSearch(&secInfo, "CODE");
 				sp->isConst = TRUE;		/* since it's constant, it's ABSOLUTE always */
 				/* attach segment info as CODE (because of 0-size) */
-				sp->Addr = getIntSymAddr(p, symTable, p->Operand[1]);
+				sp->Addr = getIntSymAddr(p, &symTable, p->Operand[1]);
 			}else{
 				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
 					"Invalid operands! Please check instruction syntax.\n");
@@ -10455,7 +10195,9 @@ sICode *codeScanOneInst(sICode *p)
 }
 
 /** 
-* @brief Scan one multifunction assembly source line for instruction type resolution
+* @brief Scan one multifunction assembly source line for instruction type resolution.
+* The opcode combinations and their operand checks are the oprFormMultiFunc[]
+* table (see oprmatch.cc).
 * 
 * @param *p Pointer to current instruction 
 * 
@@ -10463,1760 +10205,7 @@ sICode *codeScanOneInst(sICode *p)
 */
 sICode *codeScanOneInstMultiFunc(sICode *p)
 {
-	sICode *m1, *m2;
-
-	switch(p->MultiCounter){
-		case	1:				/* two-opcode multifunction */
-			m1 = p->Multi[0];
-
-			if(isLD(p) && isLD(m1)){
-				/* type 1a */
-				p->InstType = t01a;
-				/* LD || LD */
-
-				/* read first LD operands */
-				/* LD RREG, DM(IREG +=  MREG) */
-				/* LD Op0,  Op4(Op2 Op1 Op3) */
-				if(!isReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of LD, only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD, only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-
-				if(!isIx(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For IX operand of LD, only I0, I1, I2, I3 registers are allowed.\n");
-					break;
-				}
-				if(!isMx(p, p->Operand[3])){
-					printRunTimeError(p->LineCntr, p->Operand[3], 
-						"For MX operand of LD, only M0, M1, M2, M3 registers are allowed.\n");
-					break;
-				}
-				if(!isIy(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IY operand of LD, only I4, I5, I6, I7 registers are allowed.\n");
-					break;
-				}
-				if(!isMy(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MY operand of LD, only M4, M5, M6, M7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isLD_C(p) && isLD_C(m1)){
-				/* type 1b */
-				p->InstType = t01b;
-				/* LD.C || LD.C */
-				/* LD.C DREG24, DM(IREG +=  MREG) */
-				/* LD.C Op0,    Op4(Op2 Op1 Op3)  */
-				/*            or                  */
-				/* LD.C DREG24, DM(IREG)          */
-				/* LD.C Op0,    Op1(Op0)          */
-
-				if(!isReg24S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of LD.C, only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD.C, only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-
-				if(!isIx(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For IX operand of LD.C, only I0, I1, I2, I3 registers are allowed.\n");
-					break;
-				}
-				if(!isMx(p, p->Operand[3])){
-					printRunTimeError(p->LineCntr, p->Operand[3], 
-						"For MX operand of LD.C, only M0, M1, M2, M3 registers are allowed.\n");
-					break;
-				}
-				if(!isIy(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IY operand of LD.C, only I4, I5, I6, I7 registers are allowed.\n");
-					break;
-				}
-				if(!isMy(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MY operand of LD.C, only M4, M5, M6, M7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isMAC(p) && isLD(m1)){
-				/* type 4a */
-				p->InstType = t04a;
-				/* MAC || LD */
-
-				if(!isACC32S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC instruction, "
-						"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IREG operand of LD, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MREG operand of LD, only M0~7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isALU(p) && isLD(m1)){
-				/* type 4c */
-				p->InstType = t04c;
-				/* ALU || LD */
-
-				if(!isDReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU instruction, "
-						"only R0~R7 and ACC0.L~ACC7.L registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IREG operand of LD, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MREG operand of LD, only M0~7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isMAC_C(p) && isLD_C(m1)){
-				/* type 4b */
-				p->InstType = t04b;
-				/* MAC.C || LD.C */
-
-				if(!isACC64S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC.C instruction, "
-						"only ACC0, ACC2 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IREG operand of LD, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MREG operand of LD, only M0~7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isALU_C(p) && isLD_C(m1)){
-				/* type 4d */
-				p->InstType = t04d;
-				/* ALU.C || LD.C */
-
-				if(!isDReg24S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU.C instruction, "
-						"only R[0/2/4/6] and ACC[0/2/4/6].L registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg24S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU.C instruction, "
-							"only R0, R2, R4, R6 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg24(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IREG operand of LD, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MREG operand of LD, only M0~7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isMAC(p) && isST(m1)){
-				/* type 4e */
-				p->InstType = t04e;
-				/* MAC || ST */
-
-				if(!isACC32S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC instruction, "
-						"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[4])){
-					printRunTimeError(p->LineCntr, m1->Operand[4], 
-						"For destination of ST, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For IREG operand of ST, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For MREG operand of ST, only M0~7 registers are allowed.\n");
-					break;
-				}
-			}else if(isALU(p) && isST(m1)){
-				/* type 4g */
-				p->InstType = t04g;
-				/* ALU || ST */
-
-				if(!isDReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU instruction, "
-						"only R0~R7 and ACC0.L~ACC7.L registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg12(p, m1->Operand[4])){
-					printRunTimeError(p->LineCntr, m1->Operand[4], 
-						"For destination of ST, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For IREG operand of ST, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For MREG operand of ST, only M0~7 registers are allowed.\n");
-					break;
-				}
-			}else if(isMAC_C(p) && isST_C(m1)){
-				/* type 4f */
-				p->InstType = t04f;
-				/* MAC.C || ST.C */
-
-				if(!isACC64S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC.C instruction, "
-						"only ACC0, ACC2 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[4])){
-					printRunTimeError(p->LineCntr, m1->Operand[4], 
-						"For destination of ST.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For IREG operand of ST, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For MREG operand of ST, only M0~7 registers are allowed.\n");
-					break;
-				}
-			}else if(isALU_C(p) && isST_C(m1)){
-				/* type 4h */
-				p->InstType = t04h;
-				/* ALU.C || ST.C */
-
-				if(!isDReg24S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU.C instruction, "
-						"only R[0/2/4/6] and ACC[0/2/4/6].L registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg24S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU.C instruction, "
-							"only R0, R2, R4, R6 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg24(p, m1->Operand[4])){
-					printRunTimeError(p->LineCntr, m1->Operand[4], 
-						"For destination of ST.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isIReg(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For IREG operand of ST, only I0~7 registers are allowed.\n");
-					break;
-				}
-				if(!isMReg(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For MREG operand of ST, only M0~7 registers are allowed.\n");
-					break;
-				}
-			}else if(isMAC(p) && isCP(m1)){
-				/* type 8a */
-				p->InstType = t08a;
-				/* MAC || CP */
-
-				if(!isACC32S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC instruction, "
-						"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of CP, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For source of CP, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isALU(p) && isCP(m1)){
-				/* type 8c */
-				p->InstType = t08c;
-				/* ALU || CP */
-
-				if(!isDReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU instruction, "
-						"only R0~R7 and ACC0.L~ACC7.L registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of CP, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For source of CP, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isMAC_C(p) && isCP_C(m1)){
-				/* type 8b */
-				p->InstType = t08b;
-				/* MAC.C || CP.C */
-
-				if(!isACC64S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC.C instruction, "
-						"only ACC0, ACC2 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of CP.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For source of CP.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isALU_C(p) && isCP_C(m1)){
-				/* type 8d */
-				p->InstType = t08d;
-				/* ALU.C || CP.C */
-
-				if(!isDReg24S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU.C instruction, "
-						"only R[0/2/4/6] and ACC[0/2/4/6].L registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg24S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU.C instruction, "
-							"only R0, R2, R4, R6 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg24(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of CP.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For source of CP.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isSHIFT(p) && isLD(m1)){
-				if(isReg12S(p, p->Operand[1])){
-					/* type 12e */
-					p->InstType = t12e;
-					/* SHIFT || LD */
-					/* SHIFT ACC32S, XOP12S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || LD DREG12, DM(IREG+/+=MREG) */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of LD, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For IREG operand of LD, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For MREG operand of LD, only M0~7 registers are allowed.\n");
-						break;
-					}
-	
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC32S(p, p->Operand[1])){
-					/* type 12m */
-					p->InstType = t12m;
-					/* SHIFT || LD */
-					/* SHIFT ACC32S, ACC32S, IMM_INT5 ( |NORND, RND| ) || LD DREG12, DM(IREG+/+=MREG) */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of LD, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For IREG operand of LD, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For MREG operand of LD, only M0~7 registers are allowed.\n");
-						break;
-					}
-	
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 or R0, R1, ..., R7 registers are allowed.\n");
-						break;
-				}
-			}else if(isSHIFT_C(p) && isLD_C(m1)){
-				if(isReg24S(p, p->Operand[1])){
-					/* type 12f */
-					p->InstType = t12f;
-					/* SHIFT.C || LD.C */
-					/* SHIFT.C ACC64S, XOP24S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || LD.C DREG24, DM(IREG+/+=MREG) */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2, ACC4, ACC6 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of LD.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For IREG operand of LD, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For MREG operand of LD, only M0~7 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC64S(p, p->Operand[1])){
-					/* type 12n */
-					p->InstType = t12n;
-					/* SHIFT.C || LD.C */
-					/* SHIFT.C ACC64S, ACC64S, IMM_INT5 ( |NORND, RND| ) || LD.C DREG24, DM(IREG+/+=MREG) */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2, ACC4, ACC6 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of LD.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For IREG operand of LD, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For MREG operand of LD, only M0~7 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC2, ACC4, ACC6 or R0, R2, R4, R6 registers are allowed.\n");
-						break;
-				}
-			}else if(isSHIFT(p) && isST(m1)){
-				if(isReg12S(p, p->Operand[1])){
-					/* type 12g */
-					p->InstType = t12g;
-					/* SHIFT || ST */
-					/* SHIFT ACC32S, XOP12S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || ST DM(IREG+/+=MREG), DREG12 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[4])){
-						printRunTimeError(p->LineCntr, m1->Operand[4], 
-							"For destination of ST, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For IREG operand of ST, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For MREG operand of ST, only M0~7 registers are allowed.\n");
-						break;
-					}
-				} else if(isACC32S(p, p->Operand[1])){
-					/* type 12o */
-					p->InstType = t12o;
-					/* SHIFT || ST */
-					/* SHIFT ACC32S, ACC32S, IMM_INT5 ( |NORND, RND| ) || ST DM(IREG+/+=MREG), DREG12 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[4])){
-						printRunTimeError(p->LineCntr, m1->Operand[4], 
-							"For destination of ST, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For IREG operand of ST, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For MREG operand of ST, only M0~7 registers are allowed.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 or R0, R1, ..., R7 registers are allowed.\n");
-						break;
-				}
-			}else if(isSHIFT_C(p) && isST_C(m1)){
-				if(isReg24S(p, p->Operand[1])){
-					/* type 12h */
-					p->InstType = t12h;
-					/* SHIFT.C || ST.C */
-					/* SHIFT.C ACC64S, XOP24S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || ST.C DM(IREG+/+=MREG), DREG24 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[4])){
-						printRunTimeError(p->LineCntr, m1->Operand[4], 
-							"For destination of ST.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For IREG operand of ST, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For MREG operand of ST, only M0~7 registers are allowed.\n");
-						break;
-					}
-				} else if(isACC64S(p, p->Operand[1])){
-					/* type 12p */
-					p->InstType = t12p;
-					/* SHIFT.C || ST.C */
-					/* SHIFT.C ACC64S, ACC64S, IMM_INT5 ( |NORND, RND| ) || ST.C DM(IREG+/+=MREG), DREG24 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[4])){
-						printRunTimeError(p->LineCntr, m1->Operand[4], 
-							"For destination of ST.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isIReg(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For IREG operand of ST, only I0~7 registers are allowed.\n");
-						break;
-					}
-					if(!isMReg(p, m1->Operand[2])){
-						printRunTimeError(p->LineCntr, m1->Operand[2], 
-							"For MREG operand of ST, only M0~7 registers are allowed.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC2, ACC4, ACC6 or R0, R2, R4, R6 registers are allowed.\n");
-						break;
-				}
-			}else if(isSHIFT(p) && isCP(m1)){
-				if(isReg12S(p, p->Operand[1])){
-					/* type 14c */
-					p->InstType = t14c;
-					/* SHIFT || CP */
-					/* SHIFT ACC32S, XOP12S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || CP DREG12, DREG12 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of CP, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For source of CP, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC32S(p, p->Operand[1])){
-					/* type 14k */
-					p->InstType = t14k;
-					/* SHIFT || CP */
-					/* SHIFT ACC32S, ACC32S, IMM_INT5 ( |NORND, RND| ) || CP DREG12, DREG12 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of CP, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-					if(!isDReg12(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For source of CP, only R0~R31, "
-							"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 or R0, R1, ..., R7 registers are allowed.\n");
-						break;
-				}
-			}else if(isSHIFT_C(p) && isCP_C(m1)){
-				if(isReg24S(p, p->Operand[1])){
-					/* type 14d */
-					p->InstType = t14d;
-					/* SHIFT.C || CP.C */
-					/* SHIFT.C ACC64S, XOP24S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) || CP.C DREG24, DREG24 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of CP.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For source of CP.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC64S(p, p->Operand[1])){
-					/* type 14l */
-					p->InstType = t14l;
-					/* SHIFT.C || CP.C */
-					/* SHIFT.C ACC64S, ACC64S, IMM_INT5 ( |NORND, RND| ) || CP.C DREG24, DREG24 */
-
-					if(!(p->Operand[3])){
-						printRunTimeError(p->LineCntr, p->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(p->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC64S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of SHIFT.C instruction, "
-							"only ACC0, ACC2 registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of CP.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-					if(!isDReg24(p, m1->Operand[1])){
-						printRunTimeError(p->LineCntr, m1->Operand[1], 
-							"For source of CP.C, only R0, R2, ..., R30,\n"
-							"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of SHIFT instruction, "
-							"only ACC0, ACC2, ACC4, ACC6 or R0, R2, R4, R6 registers are allowed.\n");
-						break;
-				}
-			}else if(isALU(p) && isMAC(m1)){
-				/* type 43a */
-				p->InstType = t43a;
-				/* ALU || MAC */
-
-				if(!isDReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU instruction, "
-						"only R0~R7, ACC0.L~ACC7.L registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isACC32S(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of this MAC instruction, "
-						"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, m1->Operand[1])){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!m1->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isALU_C(p) && isMAC_C(m1)){
-				/* type 43b */
-				//p->InstType = t43b;
-				/* ALU.C || MAC.C */
-				/* this multifunction format is no longer supported: 2008.12.5 */
-				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-					"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-				break;
-			}else if(isALU(p) && isSHIFT(m1)){
-				if(isReg12S(p, m1->Operand[1])){
-					/* type 44b */
-					p->InstType = t44b;
-					/* ALU || SHIFT */
-					/* ALU DREG12S, XOP12S, YOP12S || SHIFT ACC32S, XOP12S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) */
-
-					if(!(m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(m1->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[m1->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isDReg12S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of ALU instruction, "
-							"only R0~R7, ACC0.L~ACC7.L registers are allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[1])){
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(p->Operand[2]){
-						if(!isReg12S(p, p->Operand[2])){
-							printRunTimeError(p->LineCntr, p->Operand[2], 
-								"For source of ALU instruction, "
-								"only R0, R1, ..., R7 registers are allowed.\n");
-							break;
-						}
-					}
-					if(!isACC32S(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC32S(p, m1->Operand[1])){
-					/* type 44d */
-					p->InstType = t44d;
-					/* ALU || SHIFT */
-					/* ALU DREG12S, XOP12S, YOP12S || SHIFT ACC32S, ACC32S, IMM_INT5 ( |NORND, RND| ) */
-
-					if(!(m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(m1->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[m1->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isDReg12S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of ALU instruction, "
-							"only R0~R7, ACC0.L~ACC7.L registers are allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[1])){
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(p->Operand[2]){
-						if(!isReg12S(p, p->Operand[2])){
-							printRunTimeError(p->LineCntr, p->Operand[2], 
-								"For source of ALU instruction, "
-								"only R0, R1, ..., R7 registers are allowed.\n");
-							break;
-						}
-					}
-					if(!isACC32S(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {		/* if NOT XOP12S or ACC32S */
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For 1st source of SHIFT instruction, "
-						"only R0, R1, ..., R7 or ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-			}else if(isMAC(p) && isSHIFT(m1)){
-				if(isReg12S(p, m1->Operand[1])){
-					/* type 45b */
-					p->InstType = t45b;
-					/* MAC || SHIFT */
-					/* MAC ACC32S, XOP12S, YOP12S [( |RND, SS, SU, US, UU| )] || SHIFT ACC32S, XOP12S, IMM_INT5 ( |HI, LO, HIRND, LORND| ) */
-
-					if(!(m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of HI, LO, HIRND, LORND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(m1->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[m1->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of ALU instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(isNONE(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of Multifunction instruction, "
-							"NONE is not allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[1])){
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(!isACC32S(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else if(isACC32S(p, m1->Operand[1])){
-					/* type 45d */
-					p->InstType = t45d;
-					/* MAC || SHIFT */
-					/* MAC ACC32S, XOP12S, YOP12S [( |RND, SS, SU, US, UU| )] || SHIFT ACC32S, ACC32S, IMM_INT5 ( |NORND, RND| ) */
-
-					if(!(m1->Operand[3])){
-						printRunTimeError(p->LineCntr, m1->Operand[3], 
-							"For the SHIFT instruction, "
-							"one of NORND, RND options must be specified.\n");
-						break;
-					}
-
-					if(!isInt(m1->Operand[2])){
-						printRunTimeError(p->LineCntr, (char *)sOp[m1->Index], 
-							"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-						break;
-					}
-
-					if(!isACC32S(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of ALU instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-					if(isNONE(p, p->Operand[0])){
-						printRunTimeError(p->LineCntr, p->Operand[0], 
-							"For destination of Multifunction instruction, "
-							"NONE is not allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[1])){
-						printRunTimeError(p->LineCntr, p->Operand[1], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-					if(!isACC32S(p, m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"For destination of SHIFT instruction, "
-							"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-						break;
-					}
-
-					if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-						printRunTimeError(p->LineCntr, m1->Operand[0], 
-							"Destination registers should not be identical.\n");
-						break;
-					}
-				} else {		/* if NOT XOP12S or ACC32S */
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"For 1st source of SHIFT instruction, "
-						"only R0, R1, ..., R7 or ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-			}
-			break;
-		case	2:			/* three-opcode multifunction */
-			m1 = p->Multi[0];
-			m2 = p->Multi[1];
-
-			if(isALU(p) && isLD(m1) && isLD(m2)){
-				/* type 1c */
-				p->InstType = t01c;
-				/* ALU || LD || LD */
-
-				if(!isDReg12S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of ALU instruction, "
-						"only R0~R7 and ACC0.L~ACC7.L registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of ALU instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(p->Operand[2]){
-					if(!isReg12S(p, p->Operand[2])){
-						printRunTimeError(p->LineCntr, p->Operand[2], 
-							"For source of ALU instruction, "
-							"only R0, R1, ..., R7 registers are allowed.\n");
-						break;
-					}
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isDReg12(p, m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-
-				if(!isIx(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IX operand of LD, only I0, I1, I2, I3 registers are allowed.\n");
-					break;
-				}
-				if(!isMx(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MX operand of LD, only M0, M1, M2, M3 registers are allowed.\n");
-					break;
-				}
-				if(!isIy(p, m2->Operand[2])){
-					printRunTimeError(p->LineCntr, m2->Operand[2], 
-						"For IY operand of LD, only I4, I5, I6, I7 registers are allowed.\n");
-					break;
-				}
-				if(!isMy(p, m2->Operand[3])){
-					printRunTimeError(p->LineCntr, m2->Operand[3], 
-						"For MY operand of LD, only M4, M5, M6, M7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(p->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(m1->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-
-				/* now supports only postmodify */
-				if(!strcmp(m1->Operand[1], "+")){
-					printRunTimeError(p->LineCntr, m1->Operand[1], 
-						"Premodify addressing is not supported in this instruction type.\n");
-					break;
-				}
-				if(!strcmp(m2->Operand[1], "+")){
-					printRunTimeError(p->LineCntr, m2->Operand[1], 
-						"Premodify addressing is not supported in this instruction type.\n");
-					break;
-				}
-
-			}else if(isALU_C(p) && isLD_C(m1) && isLD_C(m2)){
-				/* type 1d */
-				//p->InstType = t01d;
-				/* ALU.C || LD.C || LD.C */
-				/* this multifunction format is no longer supported: 2008.12.5 */
-				printRunTimeError(p->LineCntr, (char *)sOp[p->Index], 
-					"Sorry, this multifuction format is no longer supported. Please check instruction syntax.\n");
-				break;
-			}else if(isMAC(p) && isLD(m1) && isLD(m2)){
-				/* type 1a */
-				p->InstType = t01a;
-				/* MAC || LD || LD */
-
-				if(!isACC32S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC instruction, "
-						"only ACC0, ACC1, ACC2, ACC3 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!isReg12S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC instruction, "
-						"only R0, R1, ..., R7 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg12(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-				if(!isDReg12(p, m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"For destination of LD, only R0~R31, "
-						"ACC0.H/M/L~ACC7.H/M/L registers are allowed.\n");
-					break;
-				}
-
-				if(!isIx(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IX operand of LD, only I0, I1, I2, I3 registers are allowed.\n");
-					break;
-				}
-				if(!isMx(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MX operand of LD, only M0, M1, M2, M3 registers are allowed.\n");
-					break;
-				}
-				if(!isIy(p, m2->Operand[2])){
-					printRunTimeError(p->LineCntr, m2->Operand[2], 
-						"For IY operand of LD, only I4, I5, I6, I7 registers are allowed.\n");
-					break;
-				}
-				if(!isMy(p, m2->Operand[3])){
-					printRunTimeError(p->LineCntr, m2->Operand[3], 
-						"For MY operand of LD, only M4, M5, M6, M7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(p->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(m1->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}else if(isMAC_C(p) && isLD_C(m1) && isLD_C(m2)){
-				/* type 1b */
-				p->InstType = t01b;
-				/* MAC.C || LD.C || LD.C */
-
-				if(!isACC64S(p, p->Operand[0])){
-					printRunTimeError(p->LineCntr, p->Operand[0], 
-						"For destination of this MAC.C instruction, "
-						"only ACC0, ACC2 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[1])){
-					printRunTimeError(p->LineCntr, p->Operand[1], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!isReg24S(p, p->Operand[2])){
-					printRunTimeError(p->LineCntr, p->Operand[2], 
-						"For source of MAC.C instruction, "
-						"only R0, R2, R4, R6 registers are allowed.\n");
-					break;
-				}
-				if(!p->Operand[3]){
-					printRunTimeError(p->LineCntr, "(RND), (SS), (SU), (US), (UU)", 
-						"One of these multiplier options must be given.\n");
-					break;
-				}
-				if(!isDReg24(p, m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"For destination of LD.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-				if(!isDReg24(p, m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"For destination of LD.C, only R0, R2, ..., R30,\n"
-						"ACC[0/2/4/6].[H/M/L] registers are allowed.\n");
-					break;
-				}
-
-				if(!isIx(p, m1->Operand[2])){
-					printRunTimeError(p->LineCntr, m1->Operand[2], 
-						"For IX operand of LD.C, only I0, I1, I2, I3 registers are allowed.\n");
-					break;
-				}
-				if(!isMx(p, m1->Operand[3])){
-					printRunTimeError(p->LineCntr, m1->Operand[3], 
-						"For MX operand of LD.C, only M0, M1, M2, M3 registers are allowed.\n");
-					break;
-				}
-				if(!isIy(p, m2->Operand[2])){
-					printRunTimeError(p->LineCntr, m2->Operand[2], 
-						"For IY operand of LD.C, only I4, I5, I6, I7 registers are allowed.\n");
-					break;
-				}
-				if(!isMy(p, m2->Operand[3])){
-					printRunTimeError(p->LineCntr, m2->Operand[3], 
-						"For MY operand of LD.C, only M4, M5, M6, M7 registers are allowed.\n");
-					break;
-				}
-
-				if(!strcasecmp(p->Operand[0], m1->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(p->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m2->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-				if(!strcasecmp(m1->Operand[0], m2->Operand[0])){
-					printRunTimeError(p->LineCntr, m1->Operand[0], 
-						"Destination registers should not be identical.\n");
-					break;
-				}
-			}
-			break;
-		default:
-			break;
-	}
+	oprMatchMultiFunc(p, oprFormMultiFunc);
 	return p;
 }
 
@@ -20,6 +20,7 @@ void closeSim(void);
 void closeDumpOut(void);        
 int codeScan(sICodeList *icode);
 sICode *codeScanOneInst(sICode *p);
+void codeScanVarInit(sICode *p, sTab *sp);
 sICode *codeScanOneInstMultiFunc(sICode *p);
 
 #endif	/* _SIMCORE_H */
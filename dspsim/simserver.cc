@@ -0,0 +1,639 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file simserver.cc
+* @brief Persistent simulation server with a warm decoded-program cache
+*
+* The server listens on a local (AF_UNIX) stream socket. Each connection
+* carries one job:
+*
+*	<options> filename.asm\n
+*	[input data lines if "-if -" given: exactly -is lines]
+*
+* Supported job options are a subset of the command line:
+* -l, -1, -2, -4, -4f, -u, -x, -ia, -is, -if, -oa, -os, -of.
+* "-if -" reads input data from the connection, "-of -" writes the output
+* dump back to the connection. Any other filename is opened by the server.
+*
+* The reply is the output dump (if "-of -"), followed by the statistics
+* summary and a single "." line. Run-time errors are reported on the same
+* connection instead of the ".err" file.
+*
+* Programs are parsed (yyparse) and scanned (codeScan) once by the server
+* process and kept in an LRU cache keyed by a hash of the source text.
+* Opcode and keyword tables are compiled in (ophash.cc).
+* Every job runs in a forked child, so the cached tables stay pristine
+* (copy-on-write) and up to -jobs jobs run concurrently. The request line
+* is read by the server itself, so a client gets JOB_READ_TIMEOUT seconds
+* to send it before the connection is dropped.
+*
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <signal.h>
+#include <setjmp.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include "dspsim.h"
+#include "symtab.h"
+#include "icode.h"
+#include "dmem.h"
+#include "optab.h"
+#include "secinfo.h"
+#include "simcore.h"
+#include "simsupport.h"
+#include "simserver.h"
+#include "dmimage.h"
+#include "bundle.h"
+#include "progimage.h"
+
+#define	MAX_JOBLINE		1024	/**< max. length of a job request line */
+#define	JOB_READ_TIMEOUT	5		/**< seconds to wait for a job request line */
+
+char	*ServerPath = NULL;					/**< socket path given by -server */
+int		ServerCacheSize = DEF_SERVERCACHE;	/**< number of cache entries: -cache */
+int		ServerMaxJobs = DEF_SERVERJOBS;		/**< concurrent jobs: -jobs */
+
+static sProgCache	*progCache;			/**< program cache entries */
+static int			progCacheUsed;		/**< number of valid entries */
+static long			progCacheClock;		/**< LRU clock */
+
+
+extern char filebuf[MAX_LINEBUF];
+
+/**
+* @brief Server main loop: accept connections and dispatch jobs.
+*
+* @param path Path name of the unix domain socket
+*
+* @return 0 if the server shuts down normally, 1 on socket error
+*/
+int runServer(char *path)
+{
+	int sfd, fd;
+	int running = 0;
+	struct sockaddr_un addr;
+
+	progCache = (sProgCache *)calloc(ServerCacheSize, sizeof(sProgCache));
+	if(progCache == NULL){
+		printf("\nError: server - cannot allocate program cache\n");
+		return 1;
+	}
+
+	signal(SIGPIPE, SIG_IGN);	/* client may disconnect early */
+
+	sfd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if(sfd < 0){
+		perror("socket");
+		return 1;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strncpy(addr.sun_path, path, sizeof(addr.sun_path)-1);
+	unlink(path);				/* remove stale socket */
+
+	if(bind(sfd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(sfd, 4*ServerMaxJobs) < 0){
+		perror(path);
+		close(sfd);
+		return 1;
+	}
+
+	printf("simulation server listening on %s (cache: %d programs, jobs: %d)\n",
+		path, ServerCacheSize, ServerMaxJobs);
+	fflush(stdout);
+
+	while(1){
+		fd = accept(sfd, NULL, NULL);
+		if(fd < 0) continue;
+
+		/* reap finished jobs; block if all job slots are busy */
+		while(running > 0 && waitpid(-1, NULL, WNOHANG) > 0) running--;
+		while(running >= ServerMaxJobs){
+			if(waitpid(-1, NULL, 0) > 0) running--;
+			else running = 0;
+		}
+
+		int ret = processJob(fd);
+		if(ret > 0){
+			running++;
+		}else if(ret < 0){		/* shutdown request */
+			break;
+		}
+	}
+
+	while(running > 0 && waitpid(-1, NULL, 0) > 0) running--;
+
+	/* free cached programs */
+	for(int i = 0; i < progCacheUsed; i++){
+		freeProgram(&progCache[i]);
+	}
+	free(progCache);
+
+	close(sfd);
+	unlink(path);
+	printf("simulation server stopped.\n");
+	return 0;
+}
+
+/**
+* @brief Read one job request from a connection and fork a job process.
+*
+* @param fd Connected socket (closed by this function in the server)
+*
+* @return 1 if a job process was started, 0 if not, -1 on shutdown request
+*/
+int processJob(int fd)
+{
+	char line[MAX_JOBLINE];
+	char errmsg[MAX_LINEBUF];
+	char *argv[MAX_JOBARGS];
+	int argc;
+	char *prog = NULL;
+	sProgCache *c;
+	pid_t pid;
+	struct timeval tv;
+
+	/* a slow client must not stall the accept loop */
+	tv.tv_sec = JOB_READ_TIMEOUT;
+	tv.tv_usec = 0;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+	FILE *in = fdopen(fd, "r");
+	FILE *out = fdopen(dup(fd), "w");
+	if(!in || !out){
+		if(in) fclose(in); else close(fd);
+		if(out) fclose(out);
+		return 0;
+	}
+
+	if(!fgets(line, MAX_JOBLINE, in) || ferror(in)){
+		if(ferror(in)) fprintf(out, "Error: no job request within %d seconds\n.\n", JOB_READ_TIMEOUT);
+		fclose(in);
+		fclose(out);
+		return 0;
+	}
+
+	/* input data of the job ("-if -") is read by the job process at client's pace */
+	tv.tv_sec = 0;
+	setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+	argc = splitJobLine(line, argv, MAX_JOBARGS);
+	if(argc == 1 && !strcmp(argv[0], "shutdown")){
+		fprintf(out, ".\n");
+		fclose(in);
+		fclose(out);
+		return -1;
+	}
+
+	/* find source filename: the only word that is not an option or its argument */
+	for(int i = 0; i < argc; i++){
+		if(!strcmp(argv[i], "-l") || !strcmp(argv[i], "-ia") || !strcmp(argv[i], "-is")
+			|| !strcmp(argv[i], "-if") || !strcmp(argv[i], "-oa") || !strcmp(argv[i], "-os")
+			|| !strcmp(argv[i], "-of")){
+			i++;		/* skip option argument */
+		}else if(argv[i][0] != '-'){
+			prog = argv[i];
+		}
+	}
+
+	if(prog == NULL){
+		fprintf(out, "Error: no input file\n.\n");
+		fclose(in);
+		fclose(out);
+		return 0;
+	}
+
+	c = lookupProgram(prog, errmsg);
+	if(c == NULL){
+		fprintf(out, "Error: %s\n.\n", errmsg);
+		fclose(in);
+		fclose(out);
+		return 0;
+	}
+
+	fflush(stdout);
+	pid = fork();
+	if(pid == 0){			/* job process */
+		activateProgram(c);
+		runJob(in, out, argc, argv);
+		_exit(0);
+	}
+
+	if(pid < 0){
+		perror("fork");
+		fprintf(out, "Error: cannot start job\n.\n");
+	}
+
+	fclose(in);
+	fclose(out);
+	return (pid > 0);
+}
+
+/**
+* @brief Run one job inside the forked job process.
+*
+* @param in Connection stream for input data
+* @param out Connection stream for results
+* @param argc Number of words in job request
+* @param argv Job request words
+*/
+void runJob(FILE *in, FILE *out, int argc, char *argv[])
+{
+	int simResult;
+
+	/* job defaults: continuous, quiet, no file I/O */
+	SimMode = 'C';
+	QuietMode = TRUE;
+	VerboseMode = FALSE;
+	dumpInFP = NULL;
+	dumpOutFP = NULL;
+	dumpOutImage = FALSE;
+	dumpErrFP = out;	/* report run-time errors to client */
+
+	for(int i = 0; i < argc; i++){
+		if(!strcmp(argv[i], "-l") && i+1 < argc){
+			ItrMax = atoi(argv[++i]);
+		}else if(!strcmp(argv[i], "-1")){
+			SIMD1Mode = TRUE; SIMD2Mode = FALSE; SIMD4Mode = FALSE;
+		}else if(!strcmp(argv[i], "-2")){
+			SIMD1Mode = FALSE; SIMD2Mode = TRUE; SIMD4Mode = FALSE;
+		}else if(!strcmp(argv[i], "-4")){
+			SIMD1Mode = FALSE; SIMD2Mode = FALSE; SIMD4Mode = TRUE;
+		}else if(!strcmp(argv[i], "-4f")){
+			SIMD4ForceMode = TRUE;
+		}else if(!strcmp(argv[i], "-u")){
+			UnalignedMemoryAccessMode = TRUE;
+		}else if(!strcmp(argv[i], "-x")){
+			SuppressUndefinedDMMode = TRUE;
+		}else if(!strcmp(argv[i], "-ia") && i+1 < argc){
+			dumpInStart = (int)strtol(argv[++i], NULL, 16);
+		}else if(!strcmp(argv[i], "-is") && i+1 < argc){
+			dumpInSize = atoi(argv[++i]);
+		}else if(!strcmp(argv[i], "-oa") && i+1 < argc){
+			dumpOutStart = (int)strtol(argv[++i], NULL, 16);
+		}else if(!strcmp(argv[i], "-os") && i+1 < argc){
+			dumpOutSize = atoi(argv[++i]);
+		}else if(!strcmp(argv[i], "-if") && i+1 < argc){
+			i++;
+			if(!strcmp(argv[i], "-")){
+				dumpInFP = in;
+			}else if(!(dumpInFP = fopen(argv[i], "r"))){
+				fprintf(out, "Error: cannot open file %s\n.\n", argv[i]);
+				return;
+			}
+		}else if(!strcmp(argv[i], "-of") && i+1 < argc){
+			i++;
+			if(!strcmp(argv[i], "-")){
+				dumpOutFP = out;
+			}else if(!(dumpOutFP = fopen(argv[i],
+				(dumpOutImage = dmiIsImageName(argv[i])) ? "w+b" : "w"))){
+				fprintf(out, "Error: cannot open file %s\n.\n", argv[i]);
+				return;
+			}
+		}else if(argv[i][0] == '-'){
+			fprintf(out, "Error: unsupported job option %s\n.\n", argv[i]);
+			return;
+		}
+	}
+
+	/* simulator chatter is not part of the reply */
+	fflush(stdout);
+	freopen("/dev/null", "w", stdout);
+
+	/* init simulator */
+	InitSimMode = TRUE;
+	initSim();
+	initDumpIn();
+	InitSimMode = FALSE;
+
+	/* simulator main loop */
+	for(ItrCntr = 0; ItrCntr < ItrMax; ItrCntr++){
+		simResult = simCore(iCode);
+		if(simResult){  /* exit simulation loop */
+			break;
+		}
+	}
+
+	/* reply: memory dump, statistics, end marker */
+	closeDumpOut();
+	fprintf(out, "Time: %ld cycles for %d iteration\n", Cycles, ItrMax);
+	fprintf(out, "Overflow: %d %d %d %d times\n",
+		OVCount.dp[0], OVCount.dp[1], OVCount.dp[2], OVCount.dp[3]);
+	fprintf(out, "UMCOUNT: %d %d %d %d\n",
+		rUMCOUNT.dp[0], rUMCOUNT.dp[1], rUMCOUNT.dp[2], rUMCOUNT.dp[3]);
+	fprintf(out, ".\n");
+	fflush(out);
+
+	if(dumpOutFP && dumpOutFP != out) fclose(dumpOutFP);
+	if(dumpInFP && dumpInFP != in) fclose(dumpInFP);
+}
+
+/**
+* @brief Split job request line into words (in place).
+*
+* @param s Job request line
+* @param argv Array to store pointers to words
+* @param max Size of argv
+*
+* @return Number of words
+*/
+int splitJobLine(char *s, char *argv[], int max)
+{
+	int argc = 0;
+
+	while(*s && argc < max){
+		while(*s && isspace(*s)) *s++ = '\0';
+		if(!*s) break;
+		argv[argc++] = s;
+		while(*s && !isspace(*s)) s++;
+	}
+	return argc;
+}
+
+/**
+* @brief Find program in cache; parse and scan it on a miss.
+* Least recently used entry is evicted when the cache is full.
+*
+* @param path Source filename
+* @param errmsg Buffer for error message
+*
+* @return Pointer to cache entry, NULL if the program cannot be loaded
+*/
+sProgCache *lookupProgram(char *path, char *errmsg)
+{
+	FILE *fp;
+	unsigned long long key;
+	sProgCache *c = NULL;
+
+	if(!compareFilenameExt(filebuf, path, "asm")){
+		sprintf(errmsg, "%.100s - input filename extension must be \".asm\"", path);
+		return NULL;
+	}
+
+	if(!(fp = fopen(path, "r"))){
+		sprintf(errmsg, "cannot open %.100s", path);
+		return NULL;
+	}
+	key = hashFile(fp);
+	fclose(fp);
+
+	for(int i = 0; i < progCacheUsed; i++){
+		if(progCache[i].Key == key){
+			if(checkProgramDeps(&progCache[i])){
+				progCache[i].LastUsed = ++progCacheClock;
+				return &progCache[i];		/* hit */
+			}
+			c = &progCache[i];		/* initializer file changed: reload in place */
+			freeProgram(c);
+			break;
+		}
+	}
+
+	/* miss: pick free or least recently used entry */
+	if(c == NULL && progCacheUsed < ServerCacheSize){
+		c = &progCache[progCacheUsed++];
+	}else if(c == NULL){
+		c = &progCache[0];
+		for(int i = 1; i < progCacheUsed; i++){
+			if(progCache[i].LastUsed < c->LastUsed) c = &progCache[i];
+		}
+		freeProgram(c);
+	}
+
+	if(!parseProgram(path)){
+		/* parse failed: release partial tables and the entry */
+		saveProgram(c);
+		freeProgram(c);
+		*c = progCache[--progCacheUsed];
+		sprintf(errmsg, "%.100s - total %d error(s) found", path, AssemblerError);
+		return NULL;
+	}
+
+	saveProgram(c);
+	saveProgramDeps(c);
+	c->Key = key;
+	c->Path = strdup(path);
+	c->LastUsed = ++progCacheClock;
+	return c;
+}
+
+/**
+* @brief Record initializer files read by parseProgram() in a cache entry.
+* An entry whose files cannot be hashed is never hit again.
+*
+* @param c Cache entry
+*/
+void saveProgramDeps(sProgCache *c)
+{
+	sPimDep *deps;
+	int n = progImageDepList(&deps);
+
+	c->Deps = NULL;
+	c->DepCntr = -1;
+	if(n < 0) return;
+	if(n > 0){
+		c->Deps = (sPimDep *)malloc(n * sizeof(sPimDep));
+		if(c->Deps == NULL) return;
+		memcpy(c->Deps, deps, n * sizeof(sPimDep));
+	}
+	for(int k = 0; k < n; k++){
+		if(!progImageDepHash(c->Deps[k].Name, &c->Deps[k].Hash)) return;
+	}
+	c->DepCntr = n;
+}
+
+/**
+* @brief Check that initializer files of a cache entry are unchanged.
+*
+* @param c Cache entry
+*
+* @return TRUE if the entry can be used as it is
+*/
+int checkProgramDeps(sProgCache *c)
+{
+	unsigned long long hash;
+
+	if(c->DepCntr < 0) return FALSE;
+	for(int k = 0; k < c->DepCntr; k++){
+		if(!progImageDepHash(c->Deps[k].Name, &hash) || hash != c->Deps[k].Hash) return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Run yyparse() and codeScan() on a source file into the global tables.
+*
+* @param path Source filename
+*
+* @return TRUE if success, FALSE on assembler error
+*/
+int parseProgram(char *path)
+{
+	/* reset parser state */
+	iCodeInit(&iCode);
+	symTableInit(&symTable);
+	dataMemInit(dataMem);
+	secInfoInit(&secInfo);
+	curSecInfo = NULL;
+	curicode = NULL;
+	curaddr = 0;
+	lineno = 1;
+	condbuf[0] = '\0';
+	isParsingMultiFunc = FALSE;
+	AssemblerError = 0;
+	progImageDepReset();
+
+	if(!(yyin = fopen(path, "r"))) return FALSE;
+	lexOpen(yyin);
+
+	/* printRunTimeError() returns here instead of exit() */
+	RunTimeErrorCatch = TRUE;
+	if(setjmp(RunTimeErrorJmp)){
+		RunTimeErrorCatch = FALSE;
+		lexClose();
+		if(yyin) fclose(yyin);
+		yyin = NULL;
+		AssemblerError++;
+		return FALSE;
+	}
+
+	int ret = yyparse();
+	lexClose();
+	fclose(yyin);
+	yyin = NULL;
+
+	if(ret || AssemblerError){
+		RunTimeErrorCatch = FALSE;
+		if(!AssemblerError) AssemblerError = 1;
+		return FALSE;
+	}
+
+	/* pack instructions into multifunction instructions */
+	if(BundleMode) bundleICode(&iCode);
+
+	/* second pass scan */
+	codeScan(&iCode);
+
+	/* for data segment even-byte patching */
+	changeFilenameExt(filebuf, path, "");
+	sTabSymEvenBytePatch(&symTable, &secInfo, filebuf);
+	RunTimeErrorCatch = FALSE;
+
+	if(ServerPath){
+		printf("server: loaded %s\n", path);
+		fflush(stdout);
+	}
+	return TRUE;
+}
+
+/**
+* @brief Move global program tables into a cache entry.
+*
+* @param c Cache entry
+*/
+void saveProgram(sProgCache *c)
+{
+	c->ICode = iCode;
+	c->SymTable = symTable;
+	memcpy(c->DataMem, dataMem, sizeof(dataMem));
+	c->SecInfo = secInfo;
+	c->Arena = progArena;
+
+	iCodeInit(&iCode);
+	symTableInit(&symTable);
+	dataMemInit(dataMem);
+	secInfoInit(&secInfo);
+	memset(&progArena, 0, sizeof(progArena));
+}
+
+/**
+* @brief Make a cache entry the current program (global tables).
+*
+* @param c Cache entry
+*/
+void activateProgram(sProgCache *c)
+{
+	iCode = c->ICode;
+	symTable = c->SymTable;
+	memcpy(dataMem, c->DataMem, sizeof(dataMem));
+	secInfo = c->SecInfo;
+	curArena = &c->Arena;
+}
+
+/**
+* @brief Release all tables held by a cache entry.
+*
+* @param c Cache entry
+*/
+void freeProgram(sProgCache *c)
+{
+	activateProgram(c);
+	sICodeListRemoveAll(&iCode);
+	sTabHashRemoveAll(&symTable);
+	dMemHashRemoveAll(dataMem);
+	sSecInfoListRemoveAll(&secInfo);
+	arenaFree(&c->Arena);
+	curArena = &progArena;
+
+	iCodeInit(&iCode);
+	symTableInit(&symTable);
+	dataMemInit(dataMem);
+	secInfoInit(&secInfo);
+
+	free(c->Path);
+	c->Path = NULL;
+	c->Key = 0;
+	free(c->Deps);
+	c->Deps = NULL;
+	c->DepCntr = 0;
+}
+
+/**
+* @brief 64-bit FNV-1a hash over a byte buffer.
+*
+* @param h Initial (or running) hash value
+* @param buf Pointer to data
+* @param n Number of bytes
+*
+* @return Updated hash value
+*/
+unsigned long long hashBytes(unsigned long long h, const void *buf, unsigned long n)
+{
+	const unsigned char *p = (const unsigned char *)buf;
+
+	for(unsigned long i = 0; i < n; i++){
+		h ^= p[i];
+		h *= 0x100000001B3ULL;
+	}
+	return h;
+}
+
+/**
+* @brief Hash whole content of a file.
+*
+* @param fp File pointer (read from current position to end)
+*
+* @return 64-bit content hash
+*/
+unsigned long long hashFile(FILE *fp)
+{
+	char buf[4096];
+	size_t n;
+	unsigned long long h = 0xCBF29CE484222325ULL;	/* FNV offset basis */
+
+	while((n = fread(buf, 1, sizeof(buf), fp)) > 0){
+		h = hashBytes(h, buf, n);
+	}
+	return h;
+}
@@ -0,0 +1,59 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file simserver.h
+* @brief Header for persistent simulation server (-server option)
+* @date 2026-10-19
+*/
+
+#ifndef	_SIMSERVER_H
+#define	_SIMSERVER_H
+
+#include "icode.h"
+#include "symtab.h"
+#include "dmem.h"
+#include "secinfo.h"
+#include "arena.h"
+
+#define	DEF_SERVERCACHE		16		/**< default number of cached programs */
+#define	DEF_SERVERJOBS		4		/**< default number of concurrent jobs */
+#define	MAX_SERVERCACHE		256		/**< upper limit for -cache */
+#define	MAX_JOBARGS			64		/**< max. number of words in a job request line */
+
+/**
+* @brief Parsed & scanned program kept warm in the server.
+* Holds everything yyparse() and codeScan() leave in the global tables.
+*/
+typedef struct sProgCache {
+	unsigned long long	Key;				/**< content hash of .asm source */
+	char	*Path;							/**< source path (for messages only) */
+	long	LastUsed;						/**< LRU stamp */
+	sICodeList	ICode;						/**< saved iCode */
+	sTabList	SymTable;					/**< saved symTable */
+	dMemList	DataMem[MAX_HASHTABLE];		/**< saved initial dataMem */
+	sSecInfoList	SecInfo;				/**< saved secInfo */
+	sArena	Arena;							/**< nodes and strings of saved tables */
+	struct sPimDep	*Deps;					/**< .VAR initializer files with content hash */
+	int		DepCntr;						/**< number of Deps, -1 if they cannot be checked */
+} sProgCache;
+
+int runServer(char *path);
+unsigned long long hashFile(FILE *fp);
+unsigned long long hashBytes(unsigned long long h, const void *buf, unsigned long n);
+int parseProgram(char *path);
+void saveProgram(sProgCache *c);
+void activateProgram(sProgCache *c);
+void freeProgram(sProgCache *c);
+void saveProgramDeps(sProgCache *c);
+int checkProgramDeps(sProgCache *c);
+sProgCache *lookupProgram(char *path, char *errmsg);
+int processJob(int fd);
+void runJob(FILE *in, FILE *out, int argc, char *argv[]);
+int splitJobLine(char *s, char *argv[], int max);
+
+extern char	*ServerPath;
+extern int	ServerCacheSize;
+extern int	ServerMaxJobs;
+
+#endif	/* _SIMSERVER_H */
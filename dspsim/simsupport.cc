@@ -21,6 +21,9 @@ All Rights Reserved.
 #include "simcore.h"
 #include "simsupport.h"
 #include "dspdef.h"
+#include "simserver.h"
+#include "lockstep.h"
+#include "specitr.h"
 
 /** Register set definitions */
 sint rR[32];		/**< Rx data registers: 12b */
@@ -98,6 +101,10 @@ sStack LPEVERStack;			/**< LPEVER Stack */
 /** Simulator internal variables */
 int oldPC = UNDEFINED, PC;
 
+int RunTimeErrorCatch = FALSE;	/**< TRUE: printRunTimeError() returns to RunTimeErrorJmp */
+jmp_buf RunTimeErrorJmp;		/**< error return point (server & libn1dsim) */
+int RunTimeWarningLine = -1;	/**< line of last run-time warning: not repeated right after */
+
 /** 
 * @brief Check if RREG16 (Ix, M, Lx, Bx, CNTR, and other 16-bit control registers)
 * 
@@ -886,7 +893,7 @@ int isInt(char *s)
 		if((isdigit(s[0])) || (s[0] == '-')){
 			return TRUE;
 		}else{
-			sp = sTabHashSearch(symTable, s);	/* get symbol table pointer */
+			sp = sTabHashSearch(&symTable, s);	/* get symbol table pointer */
 			if(sp) return TRUE;
 		}
 	}
@@ -904,7 +911,7 @@ int isInt(char *s)
 * 
 * @return 1 if integer in the specified range, 0 if not
 */
-int isIntSignedN(sICode *p, sTabList htable[], char *s, int n)
+int isIntSignedN(sICode *p, sTabList *htable, char *s, int n)
 {
 	int ln = p->LineCntr;
 	//return(isIntNM(p, htable, s, -(1<<(n-1)), (1<<(n-1))-1));
@@ -922,7 +929,7 @@ int isIntSignedN(sICode *p, sTabList htable[], char *s, int n)
 * 
 * @return 1 if integer in the specified range, 0 if not
 */
-int isIntUnsignedN(sICode *p, sTabList htable[], char *s, int n)
+int isIntUnsignedN(sICode *p, sTabList *htable, char *s, int n)
 {
 	int ln = p->LineCntr;
 	return(isIntNM(p, htable, s, 0, (1<<n)-1));
@@ -940,7 +947,7 @@ int isIntUnsignedN(sICode *p, sTabList htable[], char *s, int n)
 * 
 * @return 1 if integer in the specified range, 0 if not
 */
-int isIntNM(sICode *p, sTabList htable[], char *s, int n, int m)
+int isIntNM(sICode *p, sTabList *htable, char *s, int n, int m)
 {
 	int ln = p->LineCntr;
 	int pc_relative = FALSE;
@@ -1206,6 +1213,102 @@ int RdReg(char *s)
 	return val;
 }
 
+/**
+* @brief Register names read by sRdReg()
+*/
+enum eRegName {
+	rnINVALID = 0,
+	rnNONE, rnCNTR, rnPCSTACK, rnLPSTACK, rnLPEVER,
+	rnASTAT_R, rnASTAT_I, rnASTAT_C, rnMSTAT, rnSSTAT, rnDSTAT0, rnDSTAT1,
+	rnUMCOUNT, rnDID, rnICNTL, rnIMASK, rnIRPTL,
+	rnIVEC, rnR, rnACC, rnI, rnM, rnL, rnB
+};
+
+static const struct {
+	const char *Name;
+	int Kind;
+} regNameTable[] = {
+	{ "NONE", rnNONE }, { "_CNTR", rnCNTR }, { "_PCSTACK", rnPCSTACK },
+	{ "_LPSTACK", rnLPSTACK }, { "_LPEVER", rnLPEVER },
+	{ "ASTAT.R", rnASTAT_R }, { "ASTAT.I", rnASTAT_I }, { "ASTAT.C", rnASTAT_C },
+	{ "_MSTAT", rnMSTAT }, { "_SSTAT", rnSSTAT }, { "_DSTAT0", rnDSTAT0 }, { "_DSTAT1", rnDSTAT1 },
+	{ "UMCOUNT", rnUMCOUNT }, { "DID", rnDID }, { "_ICNTL", rnICNTL },
+	{ "_IMASK", rnIMASK }, { "_IRPTL", rnIRPTL },
+};
+
+/** 
+* @brief Parse register number: decimal digits only, less than max.
+* 
+* @param s Digits
+* @param max Number of registers
+* 
+* @return Register number, -1 if invalid
+*/
+static int regNameNumber(const char *s, int max)
+{
+	int n = 0;
+
+	if(!isdigit(*s)) return -1;
+	while(isdigit(*s)){
+		n = n * 10 + (*s++ - '0');
+		if(n >= max) return -1;
+	}
+	return (*s) ? -1 : n;
+}
+
+/** 
+* @brief Parse register name as read by sRdReg(), without messages.
+* 
+* @param s Register name
+* @param n Register number to return (Rx, ACCx, Ix, Mx, Lx, Bx, _IVECx)
+* 
+* @return eRegName value, rnINVALID if s is not a register sRdReg() reads
+*/
+static int regNameParse(const char *s, int *n)
+{
+	*n = 0;
+	switch(s[0]){
+		case 'R': case 'r':
+			return ((*n = regNameNumber(s+1, 32)) < 0) ? rnINVALID : rnR;
+		case 'I': case 'i':
+			return ((*n = regNameNumber(s+1, 8)) < 0) ? rnINVALID : rnI;
+		case 'M': case 'm':
+			return ((*n = regNameNumber(s+1, 8)) < 0) ? rnINVALID : rnM;
+		case 'L': case 'l':
+			return ((*n = regNameNumber(s+1, 8)) < 0) ? rnINVALID : rnL;
+		case 'B': case 'b':
+			return ((*n = regNameNumber(s+1, 8)) < 0) ? rnINVALID : rnB;
+	}
+	if(!strncasecmp(s, "ACC", 3)){		/* ACCx, ACCx.H, ACCx.M, ACCx.L */
+		if(s[3] < '0' || s[3] > '7') return rnINVALID;
+		*n = s[3] - '0';
+		if(!s[4]) return rnACC;
+		if(s[4] == '.' && s[5] && strchr("HMLhml", s[5]) && !s[6]) return rnACC;
+		return rnINVALID;
+	}
+	if(!strncasecmp(s, "_IVEC", 5)){
+		return ((*n = regNameNumber(s+5, 4)) < 0) ? rnINVALID : rnIVEC;
+	}
+	for(unsigned int k = 0; k < sizeof(regNameTable)/sizeof(regNameTable[0]); k++){
+		if(!strcasecmp(s, regNameTable[k].Name)) return regNameTable[k].Kind;
+	}
+	return rnINVALID;
+}
+
+/** 
+* @brief Check register name for sRdReg() without messages.
+* 
+* @param s Register name
+* 
+* @return TRUE if sRdReg() reads this register
+*/
+int isRegName(char *s)
+{
+	int n;
+
+	return (s != NULL) && (regNameParse(s, &n) != rnINVALID);
+}
+
 /** 
 * @brief Read SIMD register data (12-bit x NUMDP)
 * 
@@ -1227,33 +1330,35 @@ sint sRdReg(char *s)
 /*************************************************************************/
 	int val;
 	sint sval;
+	int rn;
+	int kind = regNameParse(s, &rn);
 
-	if(!strcasecmp(s, "NONE")){     /* NONE */
+	if(kind == rnNONE){     /* NONE */
         val = 0;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-    }else if(!strcasecmp(s, "_CNTR")){			/* _CNTR */
+    }else if(kind == rnCNTR){			/* _CNTR */
 		val = rCNTR;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_PCSTACK")){		/* _PCSTACK */
+	}else if(kind == rnPCSTACK){		/* _PCSTACK */
 		val = rPCSTACK;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_LPSTACK")){		/* _LPSTACK */
+	}else if(kind == rnLPSTACK){		/* _LPSTACK */
 		val = rLPSTACK;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_LPEVER")){		/* _LPEVER */
+	}else if(kind == rnLPEVER){		/* _LPEVER */
 		val = rLPEVER;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "ASTAT.R")){	/* ASTAT.R */
+	}else if(kind == rnASTAT_R){	/* ASTAT.R */
 		for(int j = 0; j < NUMDP; j++) {
 			val = 0;
 			val |= rAstatR.UM.dp[j]; val <<= 1;	/* bit 9 */
@@ -1268,7 +1373,7 @@ sint sRdReg(char *s)
 			val |= rAstatR.AZ.dp[j]; 			/* bit 0 */
 			sval.dp[j] = val;
 		}
-	}else if(!strcasecmp(s, "ASTAT.I")){	/* ASTAT.I */
+	}else if(kind == rnASTAT_I){	/* ASTAT.I */
 		for(int j = 0; j < NUMDP; j++) {
 			val = 0;
 			val |= rAstatI.UM.dp[j]; val <<= 1;	/* bit 9 */
@@ -1283,7 +1388,7 @@ sint sRdReg(char *s)
 			val |= rAstatI.AZ.dp[j];			/* bit 0 */
 			sval.dp[j] = val;
 		}
-	}else if(!strcasecmp(s, "ASTAT.C")){	/* ASTAT.C */
+	}else if(kind == rnASTAT_C){	/* ASTAT.C */
 		for(int j = 0; j < NUMDP; j++) {
 			val = 0;
 			val |= rAstatC.UM.dp[j]; val <<= 1;	/* bit 9 */
@@ -1298,7 +1403,7 @@ sint sRdReg(char *s)
 			val |= rAstatC.AZ.dp[j];			/* bit 0 */
 			sval.dp[j] = val;
 		}
-	}else if(!strcasecmp(s, "_MSTAT")){	/* _MSTAT */
+	}else if(kind == rnMSTAT){	/* _MSTAT */
 		val = 0;
 		val |= rMstat.MB; val <<= 1;	/* bit 7: different from ADSP-219x */
 		val |= rMstat.SD; val <<= 1;	/* bit 6 */
@@ -1311,7 +1416,7 @@ sint sRdReg(char *s)
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_SSTAT")){	/* _SSTAT */
+	}else if(kind == rnSSTAT){	/* _SSTAT */
 		val = 0;
 		val |= rSstat.SOV; val <<= 1;	/* bit 7 */
 		val |= rSstat.SSE; val <<= 1;	/* bit 6 */
@@ -1324,27 +1429,27 @@ sint sRdReg(char *s)
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_DSTAT0")){	/* _DSTAT0 */
+	}else if(kind == rnDSTAT0){	/* _DSTAT0 */
 		val = rDstat0;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_DSTAT1")){	/* _DSTAT1 */
+	}else if(kind == rnDSTAT1){	/* _DSTAT1 */
 		val = rDstat1;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "UMCOUNT")){	/* UMCOUNT */
+	}else if(kind == rnUMCOUNT){	/* UMCOUNT */
 		//val = rUMCOUNT;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = rUMCOUNT.dp[j];
-	}else if(!strcasecmp(s, "DID")){			/* DID */
+	}else if(kind == rnDID){			/* DID */
 		//val = rDID;
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = rDID.dp[j];
-	}else if(!strcasecmp(s, "_ICNTL")){	/* _ICNTL */
+	}else if(kind == rnICNTL){	/* _ICNTL */
 		val = 0;
 		val <<= 1;	/* bit 7 */
 		val <<= 1;	/* bit 6 */
@@ -1353,7 +1458,7 @@ sint sRdReg(char *s)
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_IMASK")){  /* _IMASK */
+	}else if(kind == rnIMASK){  /* _IMASK */
         val = 0;
         for(int i = 0; i < 12; i++){
             val |= rIMASK.UserDef[11-i]; val <<= 1; /* bit 15-i */
@@ -1365,7 +1470,7 @@ sint sRdReg(char *s)
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strcasecmp(s, "_IRPTL")){  /* _IRPTL */
+	}else if(kind == rnIRPTL){  /* _IRPTL */
         val = 0;
         for(int i = 0; i < 12; i++){
             val |= rIRPTL.UserDef[11-i]; val <<= 1; /* bit 15-i */
@@ -1377,21 +1482,20 @@ sint sRdReg(char *s)
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(!strncasecmp(s, "_IVEC", 5)) {	/* _IVECx register */
-		int rn = atoi(s+5);
+	}else if(kind == rnIVEC) {	/* _IVECx register */
 		val = rIVEC[rn];
 
 		for(int j = 0; j < NUMDP; j++) 
 			sval.dp[j] = val;
-	}else if(s[0] == 'R' || s[0] == 'r') {		/* Rx register */
+	}else if(kind == rnR) {		/* Rx register */
 		for(int j = 0; j < NUMDP; j++) {
-			val = rR[atoi(s+1)].dp[j];
+			val = rR[rn].dp[j];
 			if(isNeg12b(val))	val |= 0xFFFFF000;
 
 			sval.dp[j] = val;
 		}
-	}else if(!strncasecmp(s, "ACC", 3)) {	/* Accumulator */
-		int x = (int)(s[3] - '0');
+	}else if(kind == rnACC) {	/* Accumulator */
+		int x = rn;
 		if(s[4] == '.'){	/* ACCx.H, M, L */
 			switch(s[5]){
 				case 'H':
@@ -1432,29 +1536,25 @@ sint sRdReg(char *s)
 			}
 		}
 
-	}else if(s[0] == 'I' || s[0] == 'i') {		/* Ix register */
-		int rn = atoi(s+1);
+	}else if(kind == rnI) {		/* Ix register */
 		val = rI[rn];
 
 		for(int j = 0; j < NUMDP; j++) {
 			sval.dp[j] = val;
 		}
-	}else if(s[0] == 'M' || s[0] == 'm') {		/* Mx register */
-		int rn = atoi(s+1);
+	}else if(kind == rnM) {		/* Mx register */
 		val = rM[rn];
 
 		for(int j = 0; j < NUMDP; j++) {
 			sval.dp[j] = val;
 		}
-	}else if(s[0] == 'L' || s[0] == 'l') {		/* Lx register */
-		int rn = atoi(s+1);
+	}else if(kind == rnL) {		/* Lx register */
 		val = rL[rn];
 
 		for(int j = 0; j < NUMDP; j++) {
 			sval.dp[j] = val;
 		}
-	}else if(s[0] == 'B' || s[0] == 'b') {		/* Bx register */
-		int rn = atoi(s+1);
+	}else if(kind == rnB) {		/* Bx register */
 		val = rB[rn];
 
 		for(int j = 0; j < NUMDP; j++) {
@@ -1747,7 +1847,7 @@ sint sRdXReg(char *s, int id_offset, int active_dp)
 * @param s Name of register to write
 * @param data Data to write (12-bit)
 */
-void WrReg(char *s, int data)
+void WrReg(const char *s, int data)
 {
 	if(!strcasecmp(s, "NONE")){     /* NONE */
         ;   /* do nothing */
@@ -1929,6 +2029,9 @@ void WrReg(char *s, int data)
 */
 void sWrReg(char *s, sint data, sint mask)
 {
+	/* lockstep instances must agree on values written to shared registers */
+	if(LockstepCount && isScalarRegName(s)) lockstepCheckScalar(s, data, mask);
+
 	if(!strcasecmp(s, "NONE")){     /* NONE */
         return;   /* do nothing */
     }else if(!strcasecmp(s, "_CNTR")){			/* _CNTR */
@@ -3063,6 +3166,7 @@ void sFlagEffect(int type, sint z, sint n, sint v, sint c, sint mask)
 					rSstat.LSE = stackEmpty(&LoopBeginStack);
 					rSstat.LSF = stackFull(&LoopBeginStack);
 					rSstat.SSE = sStackEmpty(&ASTATStack[0]);
+					if(SpecTracking) specTrackStackCount();
 					rSstat.SOV = PCStack.Overflow + PCStack.Underflow
 						+ LoopBeginStack.Overflow + LoopBeginStack.Underflow
 						+ ASTATStack[0].Overflow + ASTATStack[0].Underflow;
@@ -3077,6 +3181,7 @@ void sFlagEffect(int type, sint z, sint n, sint v, sint c, sint mask)
 					rSstat.PCF = stackFull(&PCStack);
 					rSstat.PCL = stackCheckLevel(&PCStack);
 					rSstat.SSE = sStackEmpty(&ASTATStack[0]);
+					if(SpecTracking) specTrackStackCount();
 					rSstat.SOV = PCStack.Overflow + PCStack.Underflow
 						+ LoopBeginStack.Overflow + LoopBeginStack.Underflow
 						+ ASTATStack[0].Overflow + ASTATStack[0].Underflow;
@@ -3124,6 +3229,7 @@ void sFlagEffect(int type, sint z, sint n, sint v, sint c, sint mask)
 					rSstat.PCE = stackEmpty(&PCStack);
 					rSstat.PCF = stackFull(&PCStack);
 					rSstat.PCL = stackCheckLevel(&PCStack);
+					if(SpecTracking) specTrackStackCount();
 					rSstat.SOV = PCStack.Overflow + PCStack.Underflow
 						+ LoopBeginStack.Overflow + LoopBeginStack.Underflow
 						+ ASTATStack[0].Overflow + ASTATStack[0].Underflow;
@@ -3694,7 +3800,7 @@ void dumpRegister(sICode *p)
 * 
 * @return Address of the symbol
 */
-int getLabelAddr(sICode *p, sTabList htable[], char *s)
+int getLabelAddr(sICode *p, sTabList *htable, char *s)
 {
 	sTab *sp;
 	int addr = UNDEFINED;
@@ -3708,7 +3814,7 @@ int getLabelAddr(sICode *p, sTabList htable[], char *s)
 			/* add to extern reference list */
 			if(!sMemRefListSearch(&(sp->MemRefList), p->PMA)){
 				sMemRefListAdd(&(sp->MemRefList), p->PMA);
-				p->MemoryRefExtern = TRUE;
+				p->Src->MemoryRefExtern = TRUE;
 			}
 
 			/* give warning */
@@ -3733,7 +3839,7 @@ int getLabelAddr(sICode *p, sTabList htable[], char *s)
 * 
 * @return Address of the symbol or integer value
 */
-int getIntSymAddr(sICode *p, sTabList htable[], char *s)
+int getIntSymAddr(sICode *p, sTabList *htable, char *s)
 {
 	sTab *sp;
 	int addr = UNDEFINED;
@@ -3742,7 +3848,7 @@ int getIntSymAddr(sICode *p, sTabList htable[], char *s)
 		if((isdigit(s[0])) || (s[0] == '-')){
 			addr = atoi(s);
 
-			if(p->MemoryRefExtern == TRUE){
+			if(p->Src->MemoryRefExtern == TRUE){
 				/* give warning */
 
 				char *symname = sTabSymNameSearchByReferredAddr(htable, p->PMA);
@@ -3765,7 +3871,7 @@ int getIntSymAddr(sICode *p, sTabList htable[], char *s)
 					/* add to extern reference list */
 					if(!sMemRefListSearch(&(sp->MemRefList), p->PMA)){
 						sMemRefListAdd(&(sp->MemRefList), p->PMA);
-						p->MemoryRefExtern = TRUE;
+						p->Src->MemoryRefExtern = TRUE;
 					}
 
 					/* give warning */
@@ -4568,6 +4674,55 @@ int satCheck12b(int ov, int c)
 //	return data;
 //}
 
+/** 
+* Read data memory through a mapped host buffer (see dMemMapAdd()).
+* Lanes not present in the buffer read as undefined.
+* 
+* @param addr Address
+* @param data Pointer to store data value (12-bit x NUMDP)
+* 
+* @return TRUE if addr is mapped, FALSE if not
+*/
+int rdDataMemMap(unsigned int addr, sint *data)
+{
+	dMemMap *m = dMemMapSearch(addr);
+
+	if(!m) return FALSE;
+
+	short *w = m->Buf + (addr - m->Start) * m->Lanes;
+	for(int j = 0; j < NUMDP; j++) {
+		data->dp[j] = 0x0FFF & ((j < m->Lanes) ? w[j] : UNDEFINED);
+		if(VerboseMode) printf("RdDataMem: (addr: 0x%04X, data 0x%03X)\n", addr, data->dp[j]);
+	}
+	return TRUE;
+}
+
+/** 
+* Write data memory through a mapped host buffer (see dMemMapAdd()).
+* Data is stored sign-extended to 16 bits; lanes not present in the buffer are dropped.
+* 
+* @param data Data to write
+* @param addr Address
+* @param mask Write enable per data path
+* 
+* @return TRUE if addr is mapped, FALSE if not
+*/
+int wrDataMemMap(sint data, unsigned int addr, sint mask)
+{
+	dMemMap *m = dMemMapSearch(addr);
+
+	if(!m) return FALSE;
+
+	short *w = m->Buf + (addr - m->Start) * m->Lanes;
+	for(int j = 0; j < m->Lanes; j++) {
+		if((rDPENA.dp[j] || InitSimMode) && mask.dp[j]){
+			w[j] = (short)(((0x0FFF & data.dp[j]) ^ 0x800) - 0x800);
+			if(VerboseMode) printf("WrDataMem: (addr: 0x%04X, data 0x%03X)\n", addr, 0x0FFF & data.dp[j]);
+		}
+	}
+	return TRUE;
+}
+
 /** 
 * Read SIMD data from data memory (12-bit x NUMDP). If undefined, add to dMem as a new entry.
 * 
@@ -4603,6 +4758,9 @@ sint sRdDataMem(unsigned int addr)
 		return data;
 	}
 
+	if(dataMemMapCntr && rdDataMemMap(addr, &data)) return data;
+	if(SpecTracking) specTrackRead(addr);
+
 	dp = dMemHashSearch(dataMem, addr);
 	if(dp == NULL){	/* if not found */
 		char tnum[10];
@@ -4709,6 +4867,9 @@ sint sBriefRdDataMem(unsigned int addr)
 		return data;
 	}
 
+	if(dataMemMapCntr && rdDataMemMap(addr, &data)) return data;
+	if(SpecTracking) specTrackRead(addr);
+
 	dp = dMemHashSearch(dataMem, addr);
 	if(dp == NULL){	/* if not found */
 		//dMemHashAdd(dataMem, 0x0FFF & UNDEFINED, addr);
@@ -4795,7 +4956,10 @@ void sWrDataMem(sint data, unsigned int addr, sint mask)
 		return;
 	}
 
+	if(dataMemMapCntr && wrDataMemMap(data, addr, mask)) return;
+
 	dp = dMemHashSearch(dataMem, addr);
+	if(SpecTracking) specTrackWrite(addr, dp == NULL, mask);
 	if(dp == NULL){	/* if not found: make new var */
 		char tnum[10];
 		sprintf(tnum, "0x%04X", addr);
@@ -5064,7 +5228,7 @@ int isBreakpoint(sICode *p)
 
 
 /** 
-* @brief Check given condition code
+* @brief Check given condition code on MASTER data path
 * 
 * @param s Condition code string
 * 
@@ -5073,6 +5237,8 @@ int isBreakpoint(sICode *p)
 int	ifCond(char *s)
 {
 	int j;
+	int c;
+
 	/* first, find MASTER data path */
 	for(j = 0; j < NUMDP; j++) {
 		if(rDPMST.dp[j]){
@@ -5080,6 +5246,23 @@ int	ifCond(char *s)
 		}
 	}
 
+	c = ifCondDP(s, j);
+
+	/* lockstep instances must agree on control flow */
+	if(LockstepCount) lockstepCheckCond(s, c);
+	return c;
+}
+
+/** 
+* @brief Check given condition code on one data path
+* 
+* @param s Condition code string
+* @param j Data path number
+* 
+* @return TRUE or FALSE
+*/
+int	ifCondDP(const char *s, int j)
+{
 	/* EQ ~ TRUE: checks only ASTAT.R */
 	if(!strcasecmp("EQ", s)) {				/* 00000 */
 		if(rAstatR.AZ.dp[j])	return TRUE;
@@ -5834,14 +6017,13 @@ int isSTMulti(sICode *p)
 * @param s Pointer to warning string
 * @param msg Warning message
 */
-void printRunTimeWarning(int ln, char *s, char *msg)
+void printRunTimeWarning(int ln, const char *s, const char *msg)
 {
-	static int lastLn = -1;
-	if(lastLn != ln) {
+	if(RunTimeWarningLine != ln) {
 		sprintf(msgbuf, "\nLine %d: Warning: %s - %s", ln, s, msg);
 		printf("\nLine %d: Warning: %s - %s", ln, s, msg);
 		fprintf(dumpErrFP, "\nLine %d: Warning: %s - %s", ln, s, msg);
-		lastLn = ln;
+		RunTimeWarningLine = ln;
 	}
 }
 
@@ -5852,7 +6034,7 @@ void printRunTimeWarning(int ln, char *s, char *msg)
 * @param s Pointer to error string
 * @param msg Error message
 */
-void printRunTimeError(int ln, char *s, char *msg)
+void printRunTimeError(int ln, const char *s, const char *msg)
 {
 	static int lastLn = -1;
 	if(lastLn != ln) {	
@@ -5873,6 +6055,9 @@ void printRunTimeError(int ln, char *s, char *msg)
 	fprintf(dumpErrFP, "\n----\nRun-Time Error: Program ended unexpectedly.\n");
 	fprintf(dumpErrFP, "Line %d: %s - %s\n\n", ln, s, msg);
 
+	/* simulation server or libn1dsim: return to caller instead of exit() */
+	if(RunTimeErrorCatch) longjmp(RunTimeErrorJmp, 1);
+
 	closeSim();
 	exit(1);
 }
@@ -10161,7 +10346,7 @@ int checkUnalignedMemoryAccess(sICode *p, int addr, char *opr)
 {
 	int raddr = addr+1;									//default: return address of (addr+1)
 
-	if((addr & 0x01) && (!(p->MemoryRefExtern))){		//if not aligned
+	if((addr & 0x01) && (!(p->Src->MemoryRefExtern))){		//if not aligned
 
 		for(int j = 0; j < NUMDP; j++) {
 			rAstatC.UM.dp[j] = 1;
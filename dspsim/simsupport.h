@@ -10,6 +10,7 @@ All Rights Reserved.
 #ifndef	_SIMSUPPORT_H
 #define	_SIMSUPPORT_H
 
+#include <setjmp.h>
 #include "dspsim.h"
 #include "stack.h"
 #include "cordic.h"
@@ -175,6 +176,10 @@ extern int oldPC, PC;
 
 extern sint OVCount;
 
+extern int RunTimeErrorCatch;		/**< TRUE: printRunTimeError() longjmp()s to RunTimeErrorJmp */
+extern jmp_buf RunTimeErrorJmp;		/**< error return point (server & libn1dsim) */
+extern int RunTimeWarningLine;		/**< line of last run-time warning: not repeated right after */
+
 int isRReg16(sICode *p, char *s);
 int isRReg(sICode *p, char *s);
 int isCReg(sICode *p, char *s);
@@ -198,9 +203,9 @@ int isACC64(sICode *p, char *s);
 int isACC64S(sICode *p, char *s);
 int isSysCtlReg(char *s);
 int isInt(char *s);
-int isIntSignedN(sICode *p, sTabList htable[], char *s, int n);
-int isIntUnsignedN(sICode *p, sTabList htable[], char *s, int n);
-int isIntNM(sICode *p, sTabList htable[], char *s, int n, int m);
+int isIntSignedN(sICode *p, sTabList *htable, char *s, int n);
+int isIntUnsignedN(sICode *p, sTabList *htable, char *s, int n);
+int isIntNM(sICode *p, sTabList *htable, char *s, int n, int m);
 int isIntNumNM(sICode *p, int x, int n, int m);
 int isIReg(sICode *p, char *s);
 int isIx(sICode *p, char *s);
@@ -213,12 +218,13 @@ int isNONE(sICode *p, char *s);
 int isXReg12(sICode *p, char *s);
 int isXReg24(sICode *p, char *s);
 int isIDN(char *s);
+int isRegName(char *s);
 
 int RdReg(char *reg);
 sint sRdReg(char *reg);
 int RdReg2(sICode *p, char *reg);
 sint sRdXReg(char *reg, int id_offset, int active_dp);
-void WrReg(char *reg, int data);
+void WrReg(const char *reg, int data);
 //void sWrReg(char *reg, sint data);
 void sWrReg(char *reg, sint data, sint mask);
 //void sWrXReg(char *reg, sint data, int id_offset, int active_dp);
@@ -244,8 +250,8 @@ void sFlagEffect(int type, sint z, sint n, sint v, sint c, sint mask);
 void scFlagEffect(int type, scplx z, scplx n, scplx v, scplx c, sint mask);
 void dumpRegister(sICode *p);
 
-int getLabelAddr(sICode *p, sTabList htable[], char *s);
-int getIntSymAddr(sICode *p, sTabList htable[], char *s);
+int getLabelAddr(sICode *p, sTabList *htable, char *s);
+int getIntSymAddr(sICode *p, sTabList *htable, char *s);
 int getIntImm(sICode *p, int fval, int immtype);
 cplx getCplxImm(sICode *p, int fval, int immtype);
 sICode *updatePC(sICode *p, sICode *n);
@@ -273,6 +279,8 @@ sint sBriefRdDataMem(unsigned int addr);
 //void WrDataMem(int data, unsigned int addr);
 //void sWrDataMem(sint data, unsigned int addr);
 void sWrDataMem(sint data, unsigned int addr, sint mask);
+int rdDataMemMap(unsigned int addr, sint *data);
+int wrDataMemMap(sint data, unsigned int addr, sint mask);
 unsigned int getBitReversedAddr(unsigned int addr);
 //int RdProgMem(unsigned int addr);
 //void WrProgMem(int data, unsigned int addr);
@@ -281,6 +289,7 @@ int isValidMemoryAddr(int addr);
 int isScratchPadMemoryAddr(int addr);
 int isBreakpoint(sICode *p);
 int	ifCond(char *s);
+int	ifCondDP(const char *s, int j);
 int sIfCond(char *s, sint *mask);
 
 int isMultiFunc(sICode *p);
@@ -302,8 +311,8 @@ int isLDSTMulti(sICode *p);
 int isLDMulti(sICode *p);
 int isSTMulti(sICode *p);
 
-void printRunTimeError(int ln, char *s, char *msg);
-void printRunTimeWarning(int ln, char *s, char *msg);
+void printRunTimeError(int ln, const char *s, const char *msg);
+void printRunTimeWarning(int ln, const char *s, const char *msg);
 void printRunTimeMessage(void);
 int getCodeDReg12(char *ret, char *s);
 int getCodeXOP12(char *ret, char *s);
@@ -0,0 +1,560 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file specitr.cc
+* @brief Speculative parallel execution of -l iterations (-p option)
+*
+* A batch of up to SpecJobs iterations is started at once, each in a
+* forked worker that begins from the current machine state; fork() gives
+* every worker a copy-on-write image of data memory. Workers record which
+* addresses they read before writing and which they wrote. Iterations are
+* then committed in order: iteration k of a batch is kept only if
+* iterations 0 ~ k-1 left the machine state as it was at batch start and
+* wrote nothing it read. The first rejected iteration starts the next
+* batch, so the result is always the same as a sequential run.
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "dspsim.h"
+#include "icode.h"
+#include "dmem.h"
+#include "simcore.h"
+#include "simsupport.h"
+#include "specitr.h"
+
+int SpecTracking = FALSE;		/**< TRUE in worker: record read & write sets */
+
+static unsigned char specRead[SPEC_MEMSIZE];	/**< worker: read before written */
+static unsigned char specWrite[SPEC_MEMSIZE];	/**< worker: written */
+static unsigned char specBatchWrite[SPEC_MEMSIZE];	/**< committed writes in this batch */
+static int specStkCntRead = FALSE;		/**< worker: _SSTAT.SOV computed from stack counters */
+
+/** Stacks with overflow/underflow counters, besides ASTATStack[3] */
+static sStack *specStacks[] = {
+	&PCStack, &LoopBeginStack, &LoopEndStack, &LoopCounterStack, &MSTATStack, &LPEVERStack
+};
+#define	SPEC_NSSTACKS	(int)(sizeof(specStacks) / sizeof(specStacks[0]))
+
+/**
+* @brief Write time stamp relative to current Cycles, saturated.
+*
+* @param t Cycles value when register was written
+*
+* @return Cycles - t, at most SPEC_STAMP_WINDOW
+*/
+static int specStamp(int t)
+{
+	long d = Cycles - t;
+	return (d > SPEC_STAMP_WINDOW || d < 0) ? SPEC_STAMP_WINDOW : (int)d;
+}
+
+/**
+* @brief Copy architectural state into s.
+*
+* @param s State buffer
+*/
+void specSaveState(sMachineState *s)
+{
+	memset(s, 0, sizeof(sMachineState));
+
+	memcpy(s->R, rR, sizeof(rR));
+	memcpy(s->Acc, rAcc, sizeof(rAcc));
+	memcpy(s->I, rI, sizeof(rI));
+	memcpy(s->M, rM, sizeof(rM));
+	memcpy(s->L, rL, sizeof(rL));
+	memcpy(s->B, rB, sizeof(rB));
+	memcpy(s->bI, rbI, sizeof(rbI));
+	memcpy(s->bM, rbM, sizeof(rbM));
+	memcpy(s->bL, rbL, sizeof(rbL));
+	memcpy(s->bB, rbB, sizeof(rbB));
+	for(int i = 0; i < 8; i++){
+		s->LAIx[i] = specStamp(LastAccessIx[i]);
+		s->LAMx[i] = specStamp(LastAccessMx[i]);
+		s->LALx[i] = specStamp(LastAccessLx[i]);
+		s->LABx[i] = specStamp(LastAccessBx[i]);
+		for(int k = 0; k < 2; k++){
+			s->LAbIx[i][k] = specStamp(LAbIx[i][k]);
+			s->LAbMx[i][k] = specStamp(LAbMx[i][k]);
+			s->LAbLx[i][k] = specStamp(LAbLx[i][k]);
+			s->LAbBx[i][k] = specStamp(LAbBx[i][k]);
+		}
+	}
+	s->LPSTACK = rLPSTACK;
+	s->PCSTACK = rPCSTACK;
+	s->ICNTL = rICNTL;
+	s->IMASK = rIMASK;
+	s->IRPTL = rIRPTL;
+	memcpy(s->IVEC, rIVEC, sizeof(rIVEC));
+	s->AstatR = rAstatR;
+	s->AstatI = rAstatI;
+	s->AstatC = rAstatC;
+	s->Mstat = rMstat;
+	s->bMstat = rbMstat;
+	s->Sstat = rSstat;
+	s->Dstat0 = rDstat0;
+	s->Dstat1 = rDstat1;
+	s->DPENA = rDPENA;
+	s->DPMST = rDPMST;
+	s->CNTR = rCNTR;
+	s->bCNTR = rbCNTR;
+	s->LPEVER = rLPEVER;
+	s->LAMstat = specStamp(LastAccessMstat);
+	s->LACNTR = specStamp(LastAccessCNTR);
+	s->PCStk = PCStack;
+	s->LoopBeginStk = LoopBeginStack;
+	s->LoopEndStk = LoopEndStack;
+	s->LoopCounterStk = LoopCounterStack;
+	s->MSTATStk = MSTATStack;
+	s->LPEVERStk = LPEVERStack;
+	memcpy(s->ASTATStk, ASTATStack, sizeof(ASTATStack));
+	s->WarnLine = RunTimeWarningLine;
+
+	/* counters are carried by sStackCount, not compared */
+	s->PCStk.Overflow = s->PCStk.Underflow = 0;
+	s->LoopBeginStk.Overflow = s->LoopBeginStk.Underflow = 0;
+	s->LoopEndStk.Overflow = s->LoopEndStk.Underflow = 0;
+	s->LoopCounterStk.Overflow = s->LoopCounterStk.Underflow = 0;
+	s->MSTATStk.Overflow = s->MSTATStk.Underflow = 0;
+	s->LPEVERStk.Overflow = s->LPEVERStk.Underflow = 0;
+	for(int k = 0; k < 3; k++){
+		s->ASTATStk[k].Overflow = s->ASTATStk[k].Underflow = 0;
+	}
+}
+
+/**
+* @brief Restore architectural state from s; time stamps are rebased on current Cycles.
+*
+* @param s State buffer
+*/
+void specLoadState(sMachineState *s)
+{
+	sStackCount cnt, zero;
+
+	specSaveStackCount(&cnt);		/* not part of s */
+	memcpy(rR, s->R, sizeof(rR));
+	memcpy(rAcc, s->Acc, sizeof(rAcc));
+	memcpy(rI, s->I, sizeof(rI));
+	memcpy(rM, s->M, sizeof(rM));
+	memcpy(rL, s->L, sizeof(rL));
+	memcpy(rB, s->B, sizeof(rB));
+	memcpy(rbI, s->bI, sizeof(rbI));
+	memcpy(rbM, s->bM, sizeof(rbM));
+	memcpy(rbL, s->bL, sizeof(rbL));
+	memcpy(rbB, s->bB, sizeof(rbB));
+	for(int i = 0; i < 8; i++){
+		LastAccessIx[i] = Cycles - s->LAIx[i];
+		LastAccessMx[i] = Cycles - s->LAMx[i];
+		LastAccessLx[i] = Cycles - s->LALx[i];
+		LastAccessBx[i] = Cycles - s->LABx[i];
+		for(int k = 0; k < 2; k++){
+			LAbIx[i][k] = Cycles - s->LAbIx[i][k];
+			LAbMx[i][k] = Cycles - s->LAbMx[i][k];
+			LAbLx[i][k] = Cycles - s->LAbLx[i][k];
+			LAbBx[i][k] = Cycles - s->LAbBx[i][k];
+		}
+	}
+	rLPSTACK = s->LPSTACK;
+	rPCSTACK = s->PCSTACK;
+	rICNTL = s->ICNTL;
+	rIMASK = s->IMASK;
+	rIRPTL = s->IRPTL;
+	memcpy(rIVEC, s->IVEC, sizeof(rIVEC));
+	rAstatR = s->AstatR;
+	rAstatI = s->AstatI;
+	rAstatC = s->AstatC;
+	rMstat = s->Mstat;
+	rbMstat = s->bMstat;
+	rSstat = s->Sstat;
+	rDstat0 = s->Dstat0;
+	rDstat1 = s->Dstat1;
+	rDPENA = s->DPENA;
+	rDPMST = s->DPMST;
+	rCNTR = s->CNTR;
+	rbCNTR = s->bCNTR;
+	rLPEVER = s->LPEVER;
+	LastAccessMstat = Cycles - s->LAMstat;
+	LastAccessCNTR = Cycles - s->LACNTR;
+	PCStack = s->PCStk;
+	LoopBeginStack = s->LoopBeginStk;
+	LoopEndStack = s->LoopEndStk;
+	LoopCounterStack = s->LoopCounterStk;
+	MSTATStack = s->MSTATStk;
+	LPEVERStack = s->LPEVERStk;
+	memcpy(ASTATStack, s->ASTATStk, sizeof(ASTATStack));
+	RunTimeWarningLine = s->WarnLine;
+
+	memset(&zero, 0, sizeof(zero));		/* counters in s are zero: put current ones back */
+	specAddStackCount(&cnt, &zero);
+}
+
+/**
+* @brief Compare two machine states.
+*
+* @param a State
+* @param b State
+*
+* @return TRUE if identical
+*/
+int specSameState(sMachineState *a, sMachineState *b)
+{
+	return !memcmp(a, b, sizeof(sMachineState));
+}
+
+/**
+* @brief Record data memory read (worker only).
+* Lanes not written by this iteration yet come from batch start.
+*
+* @param addr Address
+*/
+void specTrackRead(unsigned int addr)
+{
+	if(specWrite[addr] != SPEC_ALLLANES) specRead[addr] = 1;
+}
+
+/**
+* @brief Record data memory write (worker only), before sWrDataMem() writes.
+*
+* @param addr Address
+* @param created TRUE if the address is not defined yet: sWrDataMem() adds it
+* @param mask Lanes to write, besides data path enable
+*/
+void specTrackWrite(unsigned int addr, int created, sint mask)
+{
+	if(created){
+		/* whether it exists depends on the iterations before */
+		specTrackRead(addr);
+		specWrite[addr] = SPEC_ALLLANES;
+		return;
+	}
+	for(int j = 0; j < NUMDP; j++){
+		if((rDPENA.dp[j] || InitSimMode) && mask.dp[j]) specWrite[addr] |= 1 << j;
+	}
+}
+
+/**
+* @brief Record that _SSTAT.SOV was computed from stack counters (worker only).
+*/
+void specTrackStackCount(void)
+{
+	specStkCntRead = TRUE;
+}
+
+/**
+* @brief Copy overflow/underflow counters of all stacks into c.
+*
+* @param c Counters
+*/
+void specSaveStackCount(sStackCount *c)
+{
+	for(int k = 0; k < SPEC_NSSTACKS; k++){
+		c->Overflow[k] = specStacks[k]->Overflow;
+		c->Underflow[k] = specStacks[k]->Underflow;
+	}
+	for(int k = 0; k < 3; k++){
+		c->Overflow[SPEC_NSSTACKS + k] = ASTATStack[k].Overflow;
+		c->Underflow[SPEC_NSSTACKS + k] = ASTATStack[k].Underflow;
+	}
+}
+
+/**
+* @brief Add counter increments of an iteration to all stacks.
+*
+* @param end Counters at end of iteration
+* @param start Counters at start of iteration
+*/
+void specAddStackCount(sStackCount *end, sStackCount *start)
+{
+	for(int k = 0; k < SPEC_NSSTACKS; k++){
+		specStacks[k]->Overflow += end->Overflow[k] - start->Overflow[k];
+		specStacks[k]->Underflow += end->Underflow[k] - start->Underflow[k];
+	}
+	for(int k = 0; k < 3; k++){
+		ASTATStack[k].Overflow += end->Overflow[SPEC_NSSTACKS + k] - start->Overflow[SPEC_NSSTACKS + k];
+		ASTATStack[k].Underflow += end->Underflow[SPEC_NSSTACKS + k] - start->Underflow[SPEC_NSSTACKS + k];
+	}
+}
+
+/**
+* @brief Run all iterations, SpecJobs at a time, committing in order.
+*
+* @return 0 if the simulation successfully ends, 1 if stopped
+*/
+int specRun(void)
+{
+	sSpecJob jobs[MAX_SPECJOBS];
+	sMachineState start, now;
+	sStackCount stk0, stk;
+	int done = 0;
+	int n;
+
+	while(done < ItrMax){
+		n = (ItrMax - done < SpecJobs) ? ItrMax - done : SpecJobs;
+
+		/* start a batch from current state */
+		fflush(NULL);
+		for(int k = 0; k < n; k++){
+			if(specStartJob(&jobs[k], done + k) < 0){
+				perror("fork");
+				specFreeJob(&jobs[k]);
+				n = k;
+				break;
+			}
+		}
+		if(n == 0) return 1;
+
+		for(int k = 0; k < n; k++){
+			int status;
+			waitpid(jobs[k].Pid, &status, 0);
+			jobs[k].Status = (WIFEXITED(status) && !WEXITSTATUS(status)) ? 0 : 1;
+			if(!jobs[k].Status && !specReadResult(&jobs[k])) jobs[k].Status = 1;
+		}
+
+		/* commit in order */
+		specSaveState(&start);
+		memset(specBatchWrite, 0, sizeof(specBatchWrite));
+		long cycles0 = Cycles;
+		sint ov0 = OVCount, um0 = rUMCOUNT;
+		int k;
+
+		specSaveStackCount(&stk0);
+
+		for(k = 0; k < n; k++){
+			sSpecJob *j = &jobs[k];
+
+			if(j->Status) break;	/* error or quit: rerun here */
+
+			if(k > 0){
+				int conflict = FALSE;
+
+				specSaveState(&now);
+				if(!specSameState(&now, &start)) conflict = TRUE;
+				for(int r = 0; !conflict && r < j->NRead; r++){
+					if(specBatchWrite[j->Read[r]]) conflict = TRUE;
+				}
+				if(j->StkCntRead){
+					specSaveStackCount(&stk);
+					if(memcmp(&stk, &stk0, sizeof(stk))) conflict = TRUE;
+				}
+				if(conflict){
+					if(VerboseMode) printf("Speculation: iteration %d re-executed\n", j->Itr+1);
+					break;
+				}
+			}
+
+			/* replay output of this iteration */
+			char buf[MAX_LINEBUF];
+			size_t len;
+			rewind(j->Out);
+			while((len = fread(buf, 1, sizeof(buf), j->Out)) > 0){
+				fwrite(buf, 1, len, stdout);
+			}
+			rewind(j->Err);
+			while((len = fread(buf, 1, sizeof(buf), j->Err)) > 0){
+				fwrite(buf, 1, len, dumpErrFP);
+			}
+
+			Cycles += j->Cycles - cycles0;		/* before rebasing time stamps */
+			specCommit(j);
+			for(int d = 0; d < NUMDP; d++){
+				OVCount.dp[d] += j->OV.dp[d] - ov0.dp[d];
+				rUMCOUNT.dp[d] += j->UM.dp[d] - um0.dp[d];
+			}
+			specAddStackCount(&j->StkCnt, &stk0);
+			done++;
+		}
+
+		for(int m = 0; m < n; m++){
+			specFreeJob(&jobs[m]);
+		}
+
+		/* first iteration of the batch failed: run it here to report the error */
+		if(k == 0){
+			printf("Iteration %d of %d:\n", done+1, ItrMax);
+			ItrCntr = done;
+			int ret = simCore(iCode);
+			printf("\n");
+			done++;
+			if(ret) return 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+* @brief Fork worker for one iteration.
+*
+* @param j Job
+* @param itr Iteration number
+*
+* @return Process ID, -1 on failure
+*/
+pid_t specStartJob(sSpecJob *j, int itr)
+{
+	memset(j, 0, sizeof(sSpecJob));
+	j->Itr = itr;
+	j->Out = tmpfile();
+	j->Err = tmpfile();
+	j->Res = tmpfile();
+	if(!j->Out || !j->Err || !j->Res) return -1;
+
+	j->Pid = fork();
+	if(j->Pid == 0){
+		specWorker(j);	/* never returns */
+	}
+	return j->Pid;
+}
+
+/**
+* @brief Worker process: run one iteration, write results, exit.
+*
+* @param j Job
+*/
+void specWorker(sSpecJob *j)
+{
+	int ret;
+
+	/* output goes to job files; parent writes memory dump */
+	dup2(fileno(j->Out), 1);
+	dumpErrFP = j->Err;
+	dumpOutFP = NULL;
+
+	memset(specRead, 0, sizeof(specRead));
+	memset(specWrite, 0, sizeof(specWrite));
+	specStkCntRead = FALSE;
+	SpecTracking = TRUE;
+
+	RunTimeErrorCatch = TRUE;
+	if(setjmp(RunTimeErrorJmp)){
+		fflush(NULL);
+		_exit(1);
+	}
+
+	ItrCntr = j->Itr;
+	printf("Iteration %d of %d:\n", ItrCntr+1, ItrMax);
+	ret = simCore(iCode);
+	printf("\n");
+	SpecTracking = FALSE;
+
+	/* results */
+	sMachineState s;
+	sStackCount stk;
+	int nr = 0, nw = 0;
+
+	specSaveState(&s);
+	specSaveStackCount(&stk);
+	for(unsigned int a = 0; a < SPEC_MEMSIZE; a++){
+		nr += specRead[a];
+		nw += specWrite[a];
+	}
+	fwrite(&Cycles, sizeof(Cycles), 1, j->Res);
+	fwrite(&OVCount, sizeof(OVCount), 1, j->Res);
+	fwrite(&rUMCOUNT, sizeof(rUMCOUNT), 1, j->Res);
+	fwrite(&stk, sizeof(stk), 1, j->Res);
+	fwrite(&specStkCntRead, sizeof(specStkCntRead), 1, j->Res);
+	fwrite(&oldPC, sizeof(oldPC), 1, j->Res);
+	fwrite(&PC, sizeof(PC), 1, j->Res);
+	fwrite(&s, sizeof(s), 1, j->Res);
+	fwrite(&nr, sizeof(nr), 1, j->Res);
+	fwrite(&nw, sizeof(nw), 1, j->Res);
+	for(unsigned int a = 0; a < SPEC_MEMSIZE; a++){
+		if(specRead[a]) fwrite(&a, sizeof(a), 1, j->Res);
+	}
+	for(unsigned int a = 0; a < SPEC_MEMSIZE; a++){
+		if(specWrite[a]){
+			dMem *dp = dMemHashSearch(dataMem, a);
+			fwrite(&a, sizeof(a), 1, j->Res);
+			fwrite(&dp->Data, sizeof(sint), 1, j->Res);
+			fwrite(&specWrite[a], 1, 1, j->Res);
+		}
+	}
+
+	fflush(NULL);
+	_exit(ret ? 1 : 0);
+}
+
+/**
+* @brief Load worker results.
+*
+* @param j Job
+*
+* @return TRUE if success
+*/
+int specReadResult(sSpecJob *j)
+{
+	rewind(j->Res);
+	if(fread(&j->Cycles, sizeof(j->Cycles), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->OV, sizeof(j->OV), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->UM, sizeof(j->UM), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->StkCnt, sizeof(j->StkCnt), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->StkCntRead, sizeof(int), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->OldPC, sizeof(int), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->PC, sizeof(int), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->State, sizeof(j->State), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->NRead, sizeof(int), 1, j->Res) != 1) return FALSE;
+	if(fread(&j->NWrite, sizeof(int), 1, j->Res) != 1) return FALSE;
+
+	j->Read = (unsigned int *)malloc((j->NRead + 1) * sizeof(unsigned int));
+	j->WrAddr = (unsigned int *)malloc((j->NWrite + 1) * sizeof(unsigned int));
+	j->WrData = (sint *)malloc((j->NWrite + 1) * sizeof(sint));
+	j->WrMask = (unsigned char *)malloc(j->NWrite + 1);
+
+	if(fread(j->Read, sizeof(unsigned int), j->NRead, j->Res) != (size_t)j->NRead) return FALSE;
+	for(int i = 0; i < j->NWrite; i++){
+		if(fread(&j->WrAddr[i], sizeof(unsigned int), 1, j->Res) != 1) return FALSE;
+		if(fread(&j->WrData[i], sizeof(sint), 1, j->Res) != 1) return FALSE;
+		if(fread(&j->WrMask[i], 1, 1, j->Res) != 1) return FALSE;
+	}
+	return TRUE;
+}
+
+/**
+* @brief Apply iteration results: end state and written data memory.
+*
+* @param j Job
+*/
+void specCommit(sSpecJob *j)
+{
+	specLoadState(&j->State);
+	oldPC = j->OldPC;
+	PC = j->PC;
+
+	for(int i = 0; i < j->NWrite; i++){
+		unsigned int a = j->WrAddr[i];
+		dMem *dp = dMemHashSearch(dataMem, a);
+
+		if(dp){		/* only lanes this iteration wrote */
+			for(int d = 0; d < NUMDP; d++){
+				if(j->WrMask[i] & (1 << d)) dp->Data.dp[d] = j->WrData[i].dp[d];
+			}
+		}else{
+			dMemHashAdd(dataMem, j->WrData[i], a);
+		}
+		specBatchWrite[a] = 1;
+	}
+}
+
+/**
+* @brief Release job files and buffers.
+*
+* @param j Job
+*/
+void specFreeJob(sSpecJob *j)
+{
+	if(j->Out) fclose(j->Out);
+	if(j->Err) fclose(j->Err);
+	if(j->Res) fclose(j->Res);
+	free(j->Read);
+	free(j->WrAddr);
+	free(j->WrData);
+	free(j->WrMask);
+	memset(j, 0, sizeof(sSpecJob));
+}
@@ -0,0 +1,106 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file specitr.h
+* @brief Header for speculative parallel execution of -l iterations (-p option)
+* @date 2026-10-19
+*/
+
+#ifndef	_SPECITR_H
+#define	_SPECITR_H
+
+#include <stdio.h>
+#include <sys/types.h>
+#include "simsupport.h"
+
+#define	MAX_SPECJOBS		64			/**< upper limit for -p */
+#define	SPEC_MEMSIZE		0x10000		/**< data memory address space */
+#define	SPEC_STAMP_WINDOW	3			/**< LastAccessXX older than this: no latency effect */
+#define	SPEC_ALLLANES		((1 << NUMDP) - 1)	/**< write mask: all data paths */
+#define	SPEC_NSTACKS		9			/**< PC, loop begin/end/counter, MSTAT, LPEVER, 3 ASTAT stacks */
+
+/**
+* @brief Architectural state carried from one iteration to the next.
+* Write time stamps are kept relative to Cycles (see SPEC_STAMP_WINDOW).
+* Cycles, OVCount and UMCOUNT are statistics and handled as deltas.
+* The line of the last run-time warning is carried too, so that warnings
+* are printed as in a sequential run.
+*/
+typedef struct sMachineState {
+	sint	R[32];
+	sAcc	Acc[8];
+	int		I[8], M[8], L[8], B[8];
+	int		bI[8][2], bM[8][2], bL[8][2], bB[8][2];
+	int		LAIx[8], LAMx[8], LALx[8], LABx[8];
+	int		LAbIx[8][2], LAbMx[8][2], LAbLx[8][2], LAbBx[8][2];
+	int		LPSTACK, PCSTACK;
+	sIcntl	ICNTL;
+	sIrptl	IMASK, IRPTL;
+	int		IVEC[4];
+	sAstat	AstatR, AstatI, AstatC;
+	sMstat	Mstat, bMstat;
+	sSstat	Sstat;
+	int		Dstat0, Dstat1;
+	sint	DPENA, DPMST;
+	int		CNTR, bCNTR, LPEVER;
+	int		LAMstat, LACNTR;
+	sStack	PCStk, LoopBeginStk, LoopEndStk, LoopCounterStk, MSTATStk, LPEVERStk;
+	ssStack	ASTATStk[3];
+	int		WarnLine;		/**< RunTimeWarningLine: decides if the next warning is printed */
+} sMachineState;
+
+/**
+* @brief Overflow/underflow counters of the stacks. They only go up, so
+* they are left out of sMachineState (zero there) and carried as deltas
+* like OVCount. _SSTAT.SOV is computed from them: an iteration that did so
+* is kept only if the counters were unchanged by the iterations before it.
+*/
+typedef struct sStackCount {
+	unsigned char	Overflow[SPEC_NSTACKS];
+	unsigned char	Underflow[SPEC_NSTACKS];
+} sStackCount;
+
+/**
+* @brief One speculatively executed iteration.
+*/
+typedef struct sSpecJob {
+	int		Itr;			/**< iteration number (ItrCntr) */
+	pid_t	Pid;			/**< worker process */
+	FILE	*Out;			/**< captured stdout of worker */
+	FILE	*Err;			/**< captured messages to dumpErrFP (.err) of worker */
+	FILE	*Res;			/**< result: state, statistics, read & write sets */
+	int		Status;			/**< 0 if iteration ended normally */
+	long	Cycles;			/**< Cycles at end of iteration */
+	sint	OV;				/**< OVCount at end of iteration */
+	sint	UM;				/**< UMCOUNT at end of iteration */
+	sStackCount	StkCnt;		/**< stack counters at end of iteration */
+	int		StkCntRead;		/**< TRUE if _SSTAT.SOV was computed from stack counters */
+	int		OldPC, PC;		/**< oldPC, PC at end of iteration */
+	sMachineState	State;	/**< state at end of iteration */
+	int		NRead;			/**< number of addresses read before written */
+	int		NWrite;			/**< number of addresses written */
+	unsigned int	*Read;	/**< read set */
+	unsigned int	*WrAddr;	/**< write set */
+	sint	*WrData;		/**< final data of write set */
+	unsigned char	*WrMask;	/**< lanes written (bit j: data path j) */
+} sSpecJob;
+
+void specSaveState(sMachineState *s);
+void specLoadState(sMachineState *s);
+int specSameState(sMachineState *a, sMachineState *b);
+void specTrackRead(unsigned int addr);
+void specTrackWrite(unsigned int addr, int created, sint mask);
+void specTrackStackCount(void);
+void specSaveStackCount(sStackCount *c);
+void specAddStackCount(sStackCount *end, sStackCount *start);
+int specRun(void);
+pid_t specStartJob(sSpecJob *j, int itr);
+void specWorker(sSpecJob *j);
+int specReadResult(sSpecJob *j);
+void specCommit(sSpecJob *j);
+void specFreeJob(sSpecJob *j);
+
+extern int SpecTracking;
+
+#endif	/* _SPECITR_H */
@@ -3,11 +3,14 @@ All Rights Reserved.
 */
 /** 
 * @file symtab.cc
-* Symbol table (sTab) linked list and hashing table implementation
+* Symbol table (sTab) implementation
 *
-* Reference 1: http://faculty.ycp.edu/~dhovemey/spring2007/cs201/info/hashTables.html
-*
-* Reference 2: http://en.wikipedia.org/wiki/Linked_list
+* Symbols are kept in a list in definition order and found through an
+* open addressing hash index (linear probing, doubled when half full), so
+* lookups stay O(1) for programs with tens of thousands of labels. Each
+* name is interned once in the program arena; a node refers to it and
+* carries its hash. Dumps sorted by address are built with qsort() over
+* the list (sTabSortedView).
 * @date 2008-09-22
 */
 
@@ -18,13 +21,14 @@ All Rights Reserved.
 #include <ctype.h>
 #include "symtab.h"
 #include "memref.h"
+#include "arena.h"
 #include "dspsim.h"
 #include "dmem.h"
 
 /** 
-* @brief Allocate a node dynamically.
+* @brief Allocate a node from the current arena.
 * 
-* @param s Symbol name for new node
+* @param s Symbol name for new node (interned: copied once into the arena)
 * @param n Symbol address for new node
 * 
 * @return Returns pointer to newly allocated node.
@@ -32,174 +36,21 @@ All Rights Reserved.
 sTab *sTabGetNode(char *s, unsigned int n)
 {
 	sTab *p;
-	p = (sTab *)malloc(sizeof(sTab));
+	p = (sTab *)arenaAlloc(curArena, sizeof(sTab));
 	assert(p != NULL);
-	strcpy(p->Name, s);
+	p->Name = arenaStrdup(curArena, s);
+	p->Hash = sTabHashFunction(s);
 	p->Addr = n;
+	p->InitSize = 0;
 
 	memRefInit(&(p->MemRefList));	/* init memory reference list */
 	return p;
 }
 
 /** 
-* Check for data duplication and add new node to the END(LastNode) of the list.
-* * Note: Before adding first node (empty list), FirstNode MUST be NULL.
-* 
-* @param list Pointer to linked list
-* @param s Symbol name for new node
-* @param i Symbol address for new node
-* 
-* @return Returns pointer to newly allocated node.
-*/
-sTab *sTabListAdd(sTabList *list, char *s, unsigned int i)
-{
-	sTab *p;
-
-	if(s == NULL) return NULL;
-
-	sTab *n = sTabGetNode(s, i);
-	if(n == NULL) return NULL;
-
-	if(list->FirstNode != NULL){ /* if FistNode is not NULL, 
-										LastNode is also not NULL */
-
-		p = sTabListSearch(list, s);	/* check for duplication */
-		if(p == NULL)	/* if not duplicated */
-			list->LastNode = sTabListInsertAfter(list->LastNode, n);
-		else{	/* if duplicated */
-			if(p->Addr = UNDEFINED)
-				p->Addr = n->Addr;	/* update addr */
-			free(n);	/* no longer needed */ 
-			return p;	/* return registered node */
-		}
-	} else {	/* FirstNode == NULL (list empty) */
-		list->LastNode = sTabListInsertBeginning(list, n); 
-	}
-
-	return n;	/* return new node (= LastNode) */
-}
-
-/** 
-* Insert new node after 'previous' node - No data duplication check.
-* * Note: LastNode should be updated outside. 
-* 
-* @param p Pointer to 'previous' node
-* @param newNode Pointer to new node to be added
-* 
-* @return Returns pointer to new node.
-*/
-sTab *sTabListInsertAfter(sTab *p, sTab *newNode)	
-{
-	newNode->Next = p->Next;
-	p->Next = newNode;
-
-	return newNode;	/* return new node */
-}
-
-/** 
-* Insert new node before the FIRST node - No data duplication check.
-* * Note: LastNode should be updated outside if FirstNode was NULL.
-* 
-* @param list Pointer to linked list
-* @param newNode Pointer to new node to be inserted
-* 
-* @return Returns pointer to new node.
-*/
-sTab *sTabListInsertBeginning(sTabList *list, sTab *newNode)	
-{
-	newNode->Next = list->FirstNode;
-	list->FirstNode = newNode;
-
-	return newNode;	/* return new node (= first node) */
-}
-
-/** 
-* @brief Remove node past given node. 
-* * Note: Not the given node itself, it's the one right next to that!! 
+* @brief Print all nodes in definition order.
 * 
-* @param list Pointer to linked list
- @param p Pointer to the node just before the one to be removed
-*/
-void sTabListRemoveAfter(sTabList *list, sTab *p)	
-{
-	if(p != NULL){
-		if(p->Next != NULL){
-			sTab *obsoleteNode = p->Next;
-			p->Next = p->Next->Next;
-
-			if(obsoleteNode->Next == NULL){	/* if it is LastNode */
-				list->LastNode = p;		/* update LastNode */
-			}
-
-			sMemRefListRemoveAll(&(obsoleteNode->MemRefList));
-			free(obsoleteNode);
-		}
-	}
-}
-
-/** 
-* @brief Remove FIRST node of the list.
-* 
-* @param list Pointer to linked list
-* 
-* @return Returns updated FirstNode 
-*/
-sTab *sTabListRemoveBeginning(sTabList *list)	
-{
-	if(list != NULL){
-		if(list->FirstNode != NULL){
-			sTab *obsoleteNode = list->FirstNode;
-			list->FirstNode = list->FirstNode->Next;
-			if(list->FirstNode == NULL) list->LastNode = NULL; /* removed last node */
-
-			sMemRefListRemoveAll(&(obsoleteNode->MemRefList));
-			free(obsoleteNode);
-			return list->FirstNode;	/* return new FirstNode */
-		} else {
-			return NULL;
-		}
-	}
-}
-
-/** 
-* @brief Remove all nodes in the list.
-* 
-* @param list Pointer to linked list
-*/
-void sTabListRemoveAll(sTabList *list)
-{
-	while(list->FirstNode != NULL){
-		sTabListRemoveBeginning(list);
-	}
-}
-
-/** 
-* @brief Search entire list matching given data value.
-* 
-* @param list Pointer to linked list
-* @param s symbol name to be matched
-* 
-* @return Returns pointer to the matched node or NULL.
-*/
-sTab *sTabListSearch(sTabList *list, char *s)
-{
-	sTab *n = list->FirstNode;
-
-	while(n != NULL) {
-		if(!strcasecmp(n->Name, s)){	/* match found */
-			return n;
-		}
-		n = n->Next;
-	}
-
-	/* match not found */
-	return NULL;
-}
-
-/** 
-* @brief Print all nodes in the linked list.
-* 
-* @param list Pointer to linked list
+* @param list Pointer to symbol table
 */
 void sTabListPrint(sTabList *list)
 {
@@ -255,25 +106,60 @@ void sTabListPrintType(char *s, int type)
 }
 
 /** 
-* @brief Simple hash function for integer input data.
+* @brief FNV-1a hash of upper-cased name (symbols are case-insensitive).
 * 
 * @param s Input string 
 * 
-* @return Returns index to hashing table.
+* @return Returns 32-bit hash.
+*/
+unsigned int sTabHashFunction(const char *s)
+{
+	unsigned int h = 2166136261U;
+
+	for(; *s; s++){
+		h = (h ^ (unsigned int)toupper((unsigned char)*s)) * 16777619U;
+	}
+	return h;
+}
+
+/** 
+* @brief Find slot of name: slot holding it, or free slot where it belongs.
+* 
+* @param htable Symbol table (Size > 0)
+* @param s Symbol name
+* @param h sTabHashFunction(s)
+* 
+* @return Returns pointer to slot.
 */
-int sTabHashFunction(char *s)
+static sTab **sTabHashSlot(sTabList *htable, const char *s, unsigned int h)
 {
-	int i, key;
-	int len;
+	unsigned int mask = htable->Size - 1;
+	unsigned int i = h & mask;
 
-	len = strlen(s);
+	while(htable->Slot[i]){
+		sTab *n = htable->Slot[i];
 
-	key = (int)s[0];
-	for(i = 1; i < len; i++){
-		key = key ^ (int)s[i];
+		if(n->Hash == h && !strcasecmp(n->Name, s)) break;	/* match found */
+		i = (i + 1) & mask;
 	}
+	return &htable->Slot[i];
+}
+
+/** 
+* @brief Allocate index of given size and enter all symbols.
+* Old slot arrays stay in the arena until arenaFree().
+* 
+* @param htable Symbol table
+* @param size Number of slots (power of 2)
+*/
+static void sTabHashResize(sTabList *htable, unsigned int size)
+{
+	htable->Slot = (sTab **)arenaAlloc(curArena, size * sizeof(sTab *));
+	htable->Size = size;
 
-	return (key % MAX_HASHTABLE);
+	for(sTab *n = htable->FirstNode; n != NULL; n = n->Next){
+		*sTabHashSlot(htable, n->Name, n->Hash) = n;
+	}
 }
 
 /** 
@@ -285,12 +171,39 @@ int sTabHashFunction(char *s)
 * 
 * @return Returns pointer to the newly added node.
 */
-extern "C" sTab *sTabHashAdd(sTabList htable[], char *s, unsigned int i)
+extern "C" sTab *sTabHashAdd(sTabList *htable, char *s, unsigned int i)
 {
-	int hindex;
-	hindex = sTabHashFunction(s);
-	if(VerboseMode) printf("> Hash Index: %d\n", hindex); 
-	return(sTabListAdd(&htable[hindex], s, i));
+	sTab **slot;
+	sTab *p;
+
+	if(s == NULL) return NULL;
+
+	/* keep index at most half full */
+	if(2 * (htable->Cntr + 1) > htable->Size){
+		sTabHashResize(htable, htable->Size ? 2 * htable->Size : SYMTAB_MINSLOTS);
+	}
+
+	slot = sTabHashSlot(htable, s, sTabHashFunction(s));
+	if(VerboseMode) printf("> Hash Index: %d\n", (int)(slot - htable->Slot)); 
+
+	if((p = *slot) != NULL){	/* if duplicated */
+		if(p->Addr = UNDEFINED)
+			p->Addr = i;	/* update addr */
+		return p;	/* return registered node */
+	}
+
+	p = sTabGetNode(s, i);
+	p->Id = htable->Cntr++;
+	*slot = p;
+
+	if(htable->FirstNode != NULL){
+		htable->LastNode->Next = p;
+	} else {	/* FirstNode == NULL (list empty) */
+		htable->FirstNode = p;
+	}
+	htable->LastNode = p;
+
+	return p;	/* return new node (= LastNode) */
 }
 
 /** 
@@ -298,108 +211,110 @@ extern "C" sTab *sTabHashAdd(sTabList htable[], char *s, unsigned int i)
 * 
 * @param htable Hash table data structure
 */
-void sTabHashPrint(sTabList htable[])
+void sTabHashPrint(sTabList *htable)
 {
-	int i;
-
 	printf("\n------------------------------\n");
 	printf("** DUMP: Symbol Table ** \n");
 	printf("------------------------------\n");
+	printf("%u symbols, %u slots\n", htable->Cntr, htable->Size);
 
-	for(i = 0; i < MAX_HASHTABLE; i++){
-		if(htable[i].FirstNode){
-			printf("\nHash Index: %d\n", i);
-			sTabListPrint(&htable[i]);
-		}
-	}
+	sTabListPrint(htable);
 }
 
 /** 
-* @brief Search entire hash table matching given data value.
+* @brief Search hash table for given name (case-insensitive).
 * 
 * @param htable Hash table data structure
 * @param s symbol name to be matched
 * 
 * @return Returns pointer to the matched node or NULL.
 */
-extern "C" sTab *sTabHashSearch(sTabList htable[], char *s)
+extern "C" sTab *sTabHashSearch(sTabList *htable, char *s)
 {
-	int hindex;
-	hindex = sTabHashFunction(s);
-	return(sTabListSearch(&htable[hindex], s));
+	if(!htable->Size) return NULL;
+	return *sTabHashSlot(htable, s, sTabHashFunction(s));
 }
 
 /** 
-* @brief Remove node past given node. 
-* * Note: Not the given node itself, it's the one right next to that!! 
+* @brief Remove all nodes in the hash table.
+* * Note: Nodes and index are freed with their arena (arenaFree()). 
 * 
 * @param htable Hash table data structure
-* @param p Pointer to the node just before the one to be removed
 */
-void sTabHashRemoveAfter(sTabList htable[], sTab *p)
+void sTabHashRemoveAll(sTabList *htable)
 {
-	sTab *n; 
-	int hindex;
-
-	hindex = sTabHashFunction(p->Name);
-	n = sTabHashSearch(htable, p->Name);
-
-	if(n != NULL){
-		sTabListRemoveAfter(&htable[hindex], n);
-	}
+	memset(htable, 0, sizeof(sTabList));
 }
 
 /** 
-* @brief Remove all nodes in the hash table.
+* @brief Build index of a table that only has its symbol list
+* (program image: list is mapped, index is not stored).
 * 
 * @param htable Hash table data structure
 */
-void sTabHashRemoveAll(sTabList htable[])
+void sTabHashRebuild(sTabList *htable)
 {
-	int i;
+	unsigned int size = SYMTAB_MINSLOTS;
 
-	for(i = 0; i < MAX_HASHTABLE; i++){
-		sTabListRemoveAll(&htable[i]);
-	}
+	while(2 * htable->Cntr > size) size *= 2;
+	sTabHashResize(htable, size);
 }
 
 
 /** 
-* @brief Initialize symTable[]
+* @brief Initialize symTable
 * 
 * @param htable sTabList data structure 
 */
-void symTableInit(sTabList htable[])
+void symTableInit(sTabList *htable)
 {
-	int i;
-
-	for(i = 0; i < MAX_HASHTABLE; i++){
-		htable[i].FirstNode = NULL;
-		htable[i].LastNode  = NULL;
-	}
+	memset(htable, 0, sizeof(sTabList));
 }
 
 
 /** 
-* @brief Initialize resSymTable[] - to contain reserved keywords
+* @brief Sorted view filters: which symbols go to which dump.
+*/
+static int sTabIsGlobal(sTab *n)	{ return (n->Type == tGLOBAL); }
+static int sTabIsExtern(sTab *n)	{ return (n->Type == tEXTERN); }
+static int sTabIsLabel(sTab *n)		{ return (n->Sec && n->Sec->Type == tCODE); }
+static int sTabIsVar(sTab *n)		{ return (n->Sec && n->Sec->Type == tDATA); }
+static int sTabIsUndef(sTab *n)		{ return (!(n->Sec) || n->Sec->Type == tNONE); }
+
+/** 
+* @brief qsort() comparison: by address, then definition order.
+*/
+static int sTabAddrCompare(const void *a, const void *b)
+{
+	const sTab *p = *(const sTab **)a;
+	const sTab *q = *(const sTab **)b;
+
+	if(p->Addr != q->Addr) return (p->Addr < q->Addr) ? -1 : 1;
+	return (p->Id < q->Id) ? -1 : (p->Id > q->Id);
+}
+
+/** 
+* @brief Symbols selected by filter, sorted by address (O(n log n)).
 * 
-* @param htable sTabList data structure 
+* @param htable Symbol table data structure
+* @param filter Returns nonzero for symbols to include
+* @param cntr Number of symbols in returned array
+* 
+* @return Array of symbols; caller frees it.
 */
-void resSymTableInit(sTabList htable[])
+sTab **sTabSortedView(sTabList *htable, sTabFilter filter, int *cntr)
 {
-	int i;
+	sTab **list = (sTab **)malloc((htable->Cntr + 1) * sizeof(sTab *));
+	int j = 0;
 
-	for(i = 0; i < MAX_HASHTABLE; i++){
-		htable[i].FirstNode = NULL;
-		htable[i].LastNode  = NULL;
+	assert(list != NULL);
+	for(sTab *n = htable->FirstNode; n != NULL; n = n->Next){
+		if(filter(n)) list[j++] = n;
 	}
+	qsort(list, j, sizeof(sTab *), sTabAddrCompare);
 
-	/* list-up reserved keywords */
-	/* purpose: e.g., "CNTR" must not be used instead of "_CNTR". */
-	i = 0;
-	while(sResSym[i] != NULL){
-		sTabHashAdd(htable, (char *)sResSym[i++], UNDEFINED);
-	}
+	*cntr = j;
+	return list;
 }
 
 
@@ -408,7 +323,7 @@ void resSymTableInit(sTabList htable[])
 * 
 * @param htable Symbol table data structure
 */
-void sTabSymDump(sTabList htable[])
+void sTabSymDump(sTabList *htable)
 {
 	char stype[10];
 	int tabID;
@@ -427,40 +342,8 @@ void sTabSymDump(sTabList htable[])
 
 	tabID = tGlobal;
 
-    /* get number of global symbols */
-    int globalCntr = 0;
-
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Type == tGLOBAL){
-               		globalCntr++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    /* initialize pointer array to be sorted */
-    int j = 0;
-    sTab **sortedGlobal = (sTab **)malloc(globalCntr*sizeof(sTab *));
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Type == tGLOBAL){
-                	sortedGlobal[j] = n;
-                	j++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    bubbleSort(sortedGlobal, globalCntr);
+	int globalCntr;
+	sTab **sortedGlobal = sTabSortedView(htable, sTabIsGlobal, &globalCntr);
 
 	for(int i = 0; i < globalCntr; i++){
 		sTab *n = sortedGlobal[i];
@@ -493,21 +376,30 @@ void sTabSymDump(sTabList htable[])
 	fprintf(dumpSymFP, "; ID Addr Name Size Type Segment EQU\n");
 
 	tabID = tSymbol;
-	for(int i = 0; i < MAX_HASHTABLE; i++){
-		if(htable[i].FirstNode){
-			sTab *n = htable[i].FirstNode;
-
-			while(n != NULL){
-				sTabListPrintType(stype, n->Type);
-				if(n->Sec){
-					fprintf(dumpSymFP, "%d %04X %s %d %s %s %d\n", tabID, n->Addr, 
-						n->Name, n->Size, stype, n->Sec->Name, n->isConst);
-				}else{
-					fprintf(dumpSymFP, "%d %04X %s %d %s ---- %d\n", tabID, n->Addr, 
-						n->Name, n->Size, stype, n->isConst);
-				}
-				n = n->Next;
-			}
+	for(sTab *n = htable->FirstNode; n != NULL; n = n->Next){
+		sTabListPrintType(stype, n->Type);
+		if(n->Sec){
+			fprintf(dumpSymFP, "%d %04X %s %d %s %s %d\n", tabID, n->Addr, 
+				n->Name, n->Size, stype, n->Sec->Name, n->isConst);
+		}else{
+			fprintf(dumpSymFP, "%d %04X %s %d %s ---- %d\n", tabID, n->Addr, 
+				n->Name, n->Size, stype, n->isConst);
+		}
+	}
+	fprintf(dumpSymFP, "%d\n", tEnd);
+
+	/* dump initial values of data variables to .sym file: one word per line */
+	fprintf(dumpSymFP, ";-----------------------------------------------------------\n");
+	fprintf(dumpSymFP, "; Initialized Data: DATA Segment\n");
+	fprintf(dumpSymFP, ";-----------------------------------------------------------\n");
+	fprintf(dumpSymFP, "; ID Addr Data\n");
+
+	tabID = tInitData;
+	for(sTab *n = htable->FirstNode; n != NULL; n = n->Next){
+		for(int k = 0; k < n->InitSize; k++){
+			dMem *dp = dMemHashSearch(dataMem, n->Addr + k);
+			fprintf(dumpSymFP, "%d %04X %03X\n", tabID, n->Addr + k, 
+				dp ? (0x0FFF & dp->Data.dp[0]) : (0x0FFF & UNDEFINED));
 		}
 	}
 	fprintf(dumpSymFP, "%d\n", tEnd);
@@ -518,40 +410,8 @@ void sTabSymDump(sTabList htable[])
 	fprintf(dumpLstFP, ";-----------------------------------------------------------\n");
 	fprintf(dumpLstFP, "; Addr Name Type Segment EQU\n");
 
-    /* get number of labels */
-    int labelCntr = 0;
-
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Sec && n->Sec->Type == tCODE){
-               		labelCntr++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    /* initialize pointer array to be sorted */
-    j = 0;
-    sTab **sortedLabel = (sTab **)malloc(labelCntr*sizeof(sTab *));
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Sec && n->Sec->Type == tCODE){
-                	sortedLabel[j] = n;
-                	j++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    bubbleSort(sortedLabel, labelCntr);
+	int labelCntr;
+	sTab **sortedLabel = sTabSortedView(htable, sTabIsLabel, &labelCntr);
 
 	for(int i = 0; i < labelCntr; i++){
 		sTab *n = sortedLabel[i];
@@ -575,40 +435,8 @@ void sTabSymDump(sTabList htable[])
 	fprintf(dumpLstFP, ";-----------------------------------------------------------\n");
 	fprintf(dumpLstFP, "; Addr Name Size Type Segment\n");
 
-    /* get number of variables */
-    int varCntr = 0;
-
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Sec && n->Sec->Type == tDATA){
-               		varCntr++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    /* initialize pointer array to be sorted */
-    j = 0;
-    sTab **sortedVar = (sTab **)malloc(varCntr*sizeof(sTab *));
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Sec && n->Sec->Type == tDATA){
-                	sortedVar[j] = n;
-                	j++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    bubbleSort(sortedVar, varCntr);
+	int varCntr;
+	sTab **sortedVar = sTabSortedView(htable, sTabIsVar, &varCntr);
 
 	for(int i = 0; i < varCntr; i++){
 		sTab *n = sortedVar[i];
@@ -632,40 +460,8 @@ void sTabSymDump(sTabList htable[])
 	fprintf(dumpLstFP, ";-----------------------------------------------------------\n");
 	fprintf(dumpLstFP, "; Addr Name Size Type Segment\n");
 
-    /* get number of extern & undefined symbols */
-    int undefCntr = 0;
-
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(!(n->Sec) || n->Sec->Type == tNONE){
-               		undefCntr++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-   	/* initialize pointer array to be sorted */
-   	j = 0;
-	sTab **sortedUndef = (sTab **)malloc(undefCntr*sizeof(sTab *));
-   	for(int i = 0; i < MAX_HASHTABLE; i++){
-       	if(htable[i].FirstNode){
-           	sTab *n = htable[i].FirstNode;
-
-           	while(n != NULL){
-				if(!(n->Sec) || n->Sec->Type == tNONE){
-               		sortedUndef[j] = n;
-               		j++;
-				}
-               	n = n->Next;
-           	}
-       	}
-   	}
-
-   	bubbleSort(sortedUndef, undefCntr);
+	int undefCntr;
+	sTab **sortedUndef = sTabSortedView(htable, sTabIsUndef, &undefCntr);
 
 	for(int i = 0; i < undefCntr; i++){
 		sTab *n = sortedUndef[i];
@@ -689,7 +485,7 @@ void sTabSymDump(sTabList htable[])
 * 
 * @param htable Symbol table data structure
 */
-void sTabExternSymRefDump(sTabList htable[])
+void sTabExternSymRefDump(sTabList *htable)
 {
 	char stype[10];
 	int tabID;
@@ -708,40 +504,8 @@ void sTabExternSymRefDump(sTabList htable[])
 
 	tabID = tExtern;
 
-    /* get number of extern symbols */
-    int externCntr = 0;
-
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Type == tEXTERN){
-               		externCntr++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    /* initialize pointer array to be sorted */
-    int j = 0;
-    sTab **sortedExtern = (sTab **)malloc(externCntr*sizeof(sTab *));
-    for(int i = 0; i < MAX_HASHTABLE; i++){
-        if(htable[i].FirstNode){
-            sTab *n = htable[i].FirstNode;
-
-            while(n != NULL){
-				if(n->Type == tEXTERN){
-                	sortedExtern[j] = n;
-                	j++;
-				}
-                n = n->Next;
-            }
-        }
-    }
-
-    bubbleSort(sortedExtern, externCntr);
+	int externCntr;
+	sTab **sortedExtern = sTabSortedView(htable, sTabIsExtern, &externCntr);
 
 	for(int i = 0; i < externCntr; i++){
 		sTab *n = sortedExtern[i];
@@ -772,59 +536,20 @@ void sTabExternSymRefDump(sTabList htable[])
 * 
 * @return Pointer to symbol name
 */
-char *sTabSymNameSearchByReferredAddr(sTabList htable[], int addr)
+char *sTabSymNameSearchByReferredAddr(sTabList *htable, int addr)
 {
-	for(int i = 0; i < MAX_HASHTABLE; i++){
-		if(htable[i].FirstNode){
-			sTab *n = htable[i].FirstNode;
-
-			while(n != NULL){
-				if(n->Type == tEXTERN){
-					sMemRef *mp = n->MemRefList.FirstNode;
-					if(mp){	/* if reference list not empty */
-						while(mp != NULL){
-							if(mp->Addr == addr){ /* match found */
-								return (n->Name);
-							}
-							mp = mp->Next;
-						}
-					}
+	for(sTab *n = htable->FirstNode; n != NULL; n = n->Next){
+		if(n->Type == tEXTERN){
+			for(sMemRef *mp = n->MemRefList.FirstNode; mp != NULL; mp = mp->Next){
+				if(mp->Addr == addr){ /* match found */
+					return (n->Name);
 				}
-				n = n->Next;
 			}
 		}
 	}
 	return NULL;
 }
 
-
-/**
-* @brief Bubble sort implementation of (sTab *) type array
-*
-* @param list Symbol table array to be sorted
-* @param cntr Number of elements in the list
-*/
-void bubbleSort(sTab **list, int cntr)
-{
-    int swapped;
-    int n = cntr;
-
-    do{
-        swapped = FALSE;
-        n = n-1;
-        for(int i = 0; i < n; i++){
-            if((list[i]->Addr) > (list[i+1]->Addr)){
-                /* swap */
-                sTab *temp = list[i];
-                list[i] = list[i+1];
-                list[i+1] = temp;
-
-                swapped = TRUE;
-            }
-        }
-    } while (swapped);
-}
-
 /** 
 * @brief If total size of data segment is odd number, insert dummy variable to make it even.
 * 
@@ -832,7 +557,7 @@ void bubbleSort(sTab **list, int cntr)
 * @param list Pointer to secinfo linked list
 * @param s Filename without .asm extension
 */
-void sTabSymEvenBytePatch(sTabList htable[], sSecInfoList *list, char *s)
+void sTabSymEvenBytePatch(sTabList *htable, sSecInfoList *list, char *s)
 {
 	int isOdd = FALSE;
 	char ts[MAX_SYM_LENGTH];	/* temp. string buffer */
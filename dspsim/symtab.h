@@ -3,8 +3,8 @@ All Rights Reserved.
 */
 /** 
 * @file symtab.h
-* Header for sTab linked list and hashing table for symbol table
-* - ref: http://faculty.ycp.edu/~dhovemey/spring2007/cs201/info/hashTables.html
+* Header for symbol table: sTab list in definition order with open
+* addressing hash index
 * @date 2008-09-22
 */
 
@@ -21,6 +21,8 @@ All Rights Reserved.
 #define	MAX_HASHTABLE	199		/**< 29, 31, 37, 101, ... are common prime numbers for hash functions */
 #endif
 
+#define	SYMTAB_MINSLOTS	256		/**< initial number of symbol table slots (power of 2) */
+
 #ifndef	UNDEFINED
 #define	UNDEFINED	0xFFFF
 #endif
@@ -36,62 +38,69 @@ enum eSym {
 * @brief Table ID (for .sym output)
 */
 enum eTabID {
-	tSecInfo, tGlobal, tExtern, tSymbol, tEnd = 9,
+	tSecInfo, tGlobal, tExtern, tSymbol, tInitData = 7, tEnd = 9,
 };
 
 /** 
 * @brief Symbol Table data structure
 */
 typedef struct sTab {
-	char	Name[MAX_SYM_LENGTH];
+	char	*Name;				/* interned name: one copy per symbol, in arena */
+	unsigned int	Hash;		/* sTabHashFunction(Name) */
+	unsigned int	Id;			/* definition order (0, 1, ...); ties in sorted dumps */
 	unsigned int	Addr;		/* sequential address in A file */
-	struct sTab	*Next;
+	struct sTab	*Next;			/* next symbol in definition order */
 	int	Type;					/* enum eSym: tLOCAL, tGLOBAL, or tEXTERN */
 	int Size;					/* size for data variable (.VAR) */
+	int InitSize;				/* number of initialized words (.VAR x[n] = ...) */
 	int Defined;				/* for LABEL: if it's defined */
 	int	isConst;				/* for EQU constants: to indicate it's alway ABSOLUTE */
 	sSecInfo *Sec;				/* pointer to segment info linked list */
 	sMemRefList	MemRefList;			/* pointer to memory reference linked list */
 } sTab;
 
+/** 
+* @brief Symbol table: all symbols in definition order, indexed by an
+* open addressing hash (linear probing) that doubles when half full.
+* MUST be all zero when initialized (symTableInit).
+*/
 typedef struct sTabList {
 	sTab *FirstNode;		/* Points to first node of list; MUST be NULL when initialized */
 	sTab *LastNode;			/* Points to last node of list; MUST be NULL when initialized */
+	sTab **Slot;			/* hash index: Size entries, NULL if free */
+	unsigned int Size;		/* number of slots (power of 2, 0 if no index yet) */
+	unsigned int Cntr;		/* number of symbols */
 } sTabList;
 
+/** 
+* @brief Selects symbols for a sorted view (sTabSortedView).
+*/
+typedef int (*sTabFilter)(sTab *n);
+
 sTab *sTabGetNode(char *s, unsigned int n);
-sTab *sTabListAdd(sTabList *list, char *s, unsigned int i);
-sTab *sTabListInsertAfter(sTab *p, sTab *newNode);
-sTab *sTabListInsertBeginning(sTabList *list, sTab *newNode);
-void sTabListRemoveAfter(sTabList *list, sTab *p);
-sTab *sTabListRemoveBeginning(sTabList *list);
-void sTabListRemoveAll(sTabList *list);
-sTab *sTabListSearch(sTabList *list, char *s);
 void sTabListPrint(sTabList *list);
 void sTabListPrintType(char *s, int type);
 
-int sTabHashFunction(char *s);
+unsigned int sTabHashFunction(const char *s);
 #ifdef __cplusplus
 /* when called from C++ function */
-extern "C" sTab *sTabHashAdd(sTabList htable[], char *s, unsigned int i);
-extern "C" sTab *sTabHashSearch(sTabList htable[], char *s);
+extern "C" sTab *sTabHashAdd(sTabList *htable, char *s, unsigned int i);
+extern "C" sTab *sTabHashSearch(sTabList *htable, char *s);
 #else
 /* when called from C function */
-extern sTab *sTabHashAdd(sTabList htable[], char *s, unsigned int i);
-extern sTab *sTabHashSearch(sTabList htable[], char *s);
+extern sTab *sTabHashAdd(sTabList *htable, char *s, unsigned int i);
+extern sTab *sTabHashSearch(sTabList *htable, char *s);
 #endif
-void sTabHashPrint(sTabList htable[]);
-void sTabHashRemoveAll(sTabList htable[]);
-void sTabHashRemoveAfter(sTabList htable[], sTab *p);
-void symTableInit(sTabList htable[]);
-void resSymTableInit(sTabList htable[]);
-void sTabSymDump(sTabList htable[]);
-void sTabExternSymRefDump(sTabList htable[]);
-char *sTabSymNameSearchByReferredAddr(sTabList htable[], int addr);
-void bubbleSort(sTab **list, int cntr);
-void sTabSymEvenBytePatch(sTabList htable[], sSecInfoList *list, char *s);
+void sTabHashPrint(sTabList *htable);
+void sTabHashRemoveAll(sTabList *htable);
+void sTabHashRebuild(sTabList *htable);
+void symTableInit(sTabList *htable);
+void sTabSymDump(sTabList *htable);
+void sTabExternSymRefDump(sTabList *htable);
+char *sTabSymNameSearchByReferredAddr(sTabList *htable, int addr);
+sTab **sTabSortedView(sTabList *htable, sTabFilter filter, int *cntr);
+void sTabSymEvenBytePatch(sTabList *htable, sSecInfoList *list, char *s);
 
-extern struct sTabList symTable[MAX_HASHTABLE]; 	/**< Symbol Table to store labels */
-extern struct sTabList resSymTable[MAX_HASHTABLE]; 	/**< Symbol Table to store reserved keywords */
+extern struct sTabList symTable; 	/**< Symbol Table to store labels */
 
 #endif	/* _SYMTAB_H */
@@ -0,0 +1,335 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file testvec.cc
+* @brief In-process test vector generators (-g option, gen regions)
+*
+* Generators write quantized 12-bit samples straight into data memory
+* before every iteration, so large regressions need no input files and
+* are reproducible from a seed. A generator spec is a name followed by
+* colon-separated parameters:
+*
+*	tone:f=0.01:a=0.5:ph=0
+*	chirp:f0=0:f1=0.25:len=4096:a=0.5
+*	qam:m=16:a=0.3:seed=7
+*	ofdm:n=64:cp=16:m=4:a=0.25
+*	awgn:a=0.1
+*
+* Common parameters: a (amplitude or noise rms, 1.0 = full scale),
+* snr (add AWGN at this SNR in dB), seed, iq (1: interleaved I,Q words,
+* default for qam/ofdm; 0: real part only, default for tone/chirp/awgn).
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "dspsim.h"
+#include "simsupport.h"
+#include "testvec.h"
+
+sGen Gens[MAX_GENS];	/**< generators */
+int GenCntr = 0;		/**< number of generators */
+
+/**
+* @brief xorshift64* random number generator.
+*
+* @param s State (never 0)
+*
+* @return Uniform random number in [0, 1)
+*/
+static double genUniform(unsigned long long *s)
+{
+	*s ^= *s >> 12;
+	*s ^= *s << 25;
+	*s ^= *s >> 27;
+	return ((*s * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+* @brief Standard normal random number (Box-Muller).
+*
+* @param s Random state
+*
+* @return Gaussian random number, zero mean, unit variance
+*/
+static double genGauss(unsigned long long *s)
+{
+	double u1 = genUniform(s);
+	double u2 = genUniform(s);
+
+	if(u1 < 1e-300) u1 = 1e-300;
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/**
+* @brief Random QAM symbol with unit average power.
+*
+* @param g Generator
+* @param s Random state
+* @param re Real part
+* @param im Imaginary part
+*/
+static void genQamSymbol(sGen *g, unsigned long long *s, double *re, double *im)
+{
+	int k = (int)(sqrt((double)g->M) + 0.5);		/* levels per axis */
+	double norm = sqrt(2.0 * (g->M - 1) / 3.0);
+
+	*re = (2 * (int)(genUniform(s) * k) - k + 1) / norm;
+	*im = (2 * (int)(genUniform(s) * k) - k + 1) / norm;
+}
+
+/**
+* @brief Make next OFDM symbol with cyclic prefix for one lane.
+* All subcarriers except DC carry random QAM symbols; unit average power.
+*
+* @param g Generator
+* @param j Lane
+*/
+static void genOfdmSymbol(sGen *g, int j)
+{
+	double X[2*MAX_OFDMSIZE];
+	double *x = g->Ofdm[j] + 2 * g->CP;
+	double scale = 1.0 / sqrt((double)(g->N - 1));
+
+	X[0] = X[1] = 0.0;
+	for(int k = 1; k < g->N; k++){
+		genQamSymbol(g, &g->Rng[j], &X[2*k], &X[2*k+1]);
+	}
+
+	/* inverse DFT */
+	for(int t = 0; t < g->N; t++){
+		double re = 0.0, im = 0.0;
+		for(int k = 1; k < g->N; k++){
+			double w = 2.0 * M_PI * (double)((k * t) % g->N) / g->N;
+			re += X[2*k] * cos(w) - X[2*k+1] * sin(w);
+			im += X[2*k] * sin(w) + X[2*k+1] * cos(w);
+		}
+		x[2*t] = re * scale;
+		x[2*t+1] = im * scale;
+	}
+
+	/* cyclic prefix: last CP samples */
+	memcpy(g->Ofdm[j], x + 2 * (g->N - g->CP), sizeof(double) * 2 * g->CP);
+	g->OfdmPos[j] = 0;
+}
+
+/**
+* @brief Next complex sample of one lane (before amplitude and noise).
+*
+* @param g Generator
+* @param j Lane
+* @param re Real part
+* @param im Imaginary part
+*/
+static void genSample(sGen *g, int j, double *re, double *im)
+{
+	long n = g->Sample[j]++;
+	double ph;
+
+	switch(g->Type){
+		case gTONE:
+			ph = 2.0 * M_PI * g->F * n + g->Phase;
+			*re = cos(ph);
+			*im = sin(ph);
+			break;
+		case gCHIRP:
+			ph = g->ChirpPhase[j];
+			*re = cos(ph);
+			*im = sin(ph);
+			g->ChirpPhase[j] = fmod(ph + 2.0 * M_PI * (g->F0 + (g->F1 - g->F0) * (n % g->Len) / g->Len),
+				2.0 * M_PI);
+			break;
+		case gQAM:
+			genQamSymbol(g, &g->Rng[j], re, im);
+			break;
+		case gOFDM:
+			if(g->OfdmPos[j] == g->N + g->CP) genOfdmSymbol(g, j);
+			*re = g->Ofdm[j][2 * g->OfdmPos[j]];
+			*im = g->Ofdm[j][2 * g->OfdmPos[j] + 1];
+			g->OfdmPos[j]++;
+			break;
+		case gAWGN:
+		default:
+			*re = genGauss(&g->Rng[j]);
+			*im = genGauss(&g->Rng[j]);
+			if(!g->IQ) *im = 0.0;
+			break;
+	}
+}
+
+/**
+* @brief Quantize to 12-bit lane format with saturation.
+*
+* @param x Sample (1.0 = full scale)
+*
+* @return 12-bit two's complement value
+*/
+static int genQuantize(double x)
+{
+	long q = lround(x * GEN_FULLSCALE);
+
+	if(q > 2047) q = 2047;
+	if(q < -2048) q = -2048;
+	return (int)(q & 0xFFF);
+}
+
+/**
+* @brief Parse generator spec and add a generator.
+*
+* @param spec Generator spec, e.g. "qam:m=16:a=0.3:seed=7"
+* @param start First data memory address
+* @param size Number of words written per iteration
+* @param laneMask Lanes to write (bit j: lane j)
+*
+* @return TRUE if success, FALSE if invalid spec (message printed)
+*/
+int genAdd(char *spec, unsigned int start, int size, int laneMask)
+{
+	char buf[MAX_GENSPEC];
+	char *name, *tok, *val;
+	sGen *g;
+
+	if(GenCntr == MAX_GENS){
+		printf("\nError: %s - too many generators (max. %d)\n", spec, MAX_GENS);
+		return FALSE;
+	}
+	g = &Gens[GenCntr];
+	memset(g, 0, sizeof(sGen));
+
+	strncpy(buf, spec, MAX_GENSPEC-1);
+	buf[MAX_GENSPEC-1] = '\0';
+	name = strtok(buf, ":");
+
+	if(!name){
+		printf("\nError: %s - empty generator spec\n", spec);
+		return FALSE;
+	}else if(!strcasecmp(name, "tone"))	g->Type = gTONE;
+	else if(!strcasecmp(name, "chirp"))	g->Type = gCHIRP;
+	else if(!strcasecmp(name, "qam"))	g->Type = gQAM;
+	else if(!strcasecmp(name, "ofdm"))	g->Type = gOFDM;
+	else if(!strcasecmp(name, "awgn"))	g->Type = gAWGN;
+	else {
+		printf("\nError: %s - unknown generator (tone, chirp, qam, ofdm or awgn)\n", spec);
+		return FALSE;
+	}
+
+	/* defaults */
+	g->Start = start;
+	g->Size = size;
+	g->LaneMask = laneMask;
+	g->IQ = (g->Type == gQAM || g->Type == gOFDM);
+	g->F = 0.01;
+	g->F0 = 0.0;
+	g->F1 = 0.25;
+	g->Amp = (g->Type == gAWGN) ? 0.1 : 0.5;
+	g->NoiseOff = TRUE;
+	g->Len = size;
+	g->M = 4;
+	g->N = 64;
+	g->CP = 16;
+	g->Seed = 1;
+
+	while((tok = strtok(NULL, ":")) != NULL){
+		if(!(val = strchr(tok, '='))){
+			printf("\nError: %s - parameter %s needs a value\n", spec, tok);
+			return FALSE;
+		}
+		*val++ = '\0';
+
+		if(!strcmp(tok, "f"))			g->F = atof(val);
+		else if(!strcmp(tok, "f0"))		g->F0 = atof(val);
+		else if(!strcmp(tok, "f1"))		g->F1 = atof(val);
+		else if(!strcmp(tok, "a"))		g->Amp = atof(val);
+		else if(!strcmp(tok, "ph"))		g->Phase = atof(val);
+		else if(!strcmp(tok, "snr"))	{ g->Snr = atof(val); g->NoiseOff = FALSE; }
+		else if(!strcmp(tok, "len"))	g->Len = atoi(val);
+		else if(!strcmp(tok, "m"))		g->M = atoi(val);
+		else if(!strcmp(tok, "n"))		g->N = atoi(val);
+		else if(!strcmp(tok, "cp"))		g->CP = atoi(val);
+		else if(!strcmp(tok, "seed"))	g->Seed = strtoull(val, NULL, 0);
+		else if(!strcmp(tok, "iq"))		g->IQ = atoi(val);
+		else {
+			printf("\nError: %s - unknown parameter %s\n", spec, tok);
+			return FALSE;
+		}
+	}
+
+	if((g->M != 4 && g->M != 16 && g->M != 64 && g->M != 256)
+		|| (g->N < 2) || (g->N > MAX_OFDMSIZE) || (g->CP < 0) || (g->CP > g->N) || (g->Len < 1)){
+		printf("\nError: %s - parameter out of range\n", spec);
+		return FALSE;
+	}
+
+	for(int j = 0; j < NUMDP; j++){
+		g->Rng[j] = (g->Seed + j) * 0x9E3779B97F4A7C15ULL + 1;	/* never 0 */
+		if(g->Type == gOFDM){
+			g->Ofdm[j] = (double *)malloc(sizeof(double) * 2 * (g->N + g->CP));
+			g->OfdmPos[j] = g->N + g->CP;		/* make first symbol on first sample */
+		}
+	}
+
+	GenCntr++;
+	return TRUE;
+}
+
+/**
+* @brief Write next block of every generator into data memory.
+* Called before every iteration.
+*/
+void genIter(void)
+{
+	sint data;
+	sint mask;
+	double re, im, sigma;
+	int save = InitSimMode;
+
+	InitSimMode = TRUE;		/* written regardless of data path enable */
+	for(int k = 0; k < GenCntr; k++){
+		sGen *g = &Gens[k];
+		double ps = g->IQ ? g->Amp * g->Amp : g->Amp * g->Amp / 2.0;	/* nominal signal power */
+
+		sigma = g->NoiseOff ? 0.0 : sqrt(ps / pow(10.0, g->Snr / 10.0) / (g->IQ ? 2.0 : 1.0));
+		for(int j = 0; j < NUMDP; j++){
+			mask.dp[j] = (g->LaneMask >> j) & 1;
+		}
+
+		for(int i = 0; i < g->Size; i += (g->IQ ? 2 : 1)){
+			sint qdata;
+
+			for(int j = 0; j < NUMDP; j++){
+				if(!mask.dp[j]) continue;
+
+				genSample(g, j, &re, &im);
+				re *= g->Amp;
+				im *= g->Amp;
+				if(sigma > 0.0){
+					re += sigma * genGauss(&g->Rng[j]);
+					im += sigma * genGauss(&g->Rng[j]);
+				}
+				data.dp[j] = genQuantize(re);
+				qdata.dp[j] = genQuantize(im);
+			}
+
+			sWrDataMem(data, g->Start + i, mask);
+			if(g->IQ && i + 1 < g->Size) sWrDataMem(qdata, g->Start + i + 1, mask);
+		}
+	}
+	InitSimMode = save;
+}
+
+/**
+* @brief Free generator buffers.
+*/
+void genClose(void)
+{
+	for(int k = 0; k < GenCntr; k++){
+		for(int j = 0; j < NUMDP; j++){
+			if(Gens[k].Ofdm[j]) free(Gens[k].Ofdm[j]);
+		}
+	}
+	GenCntr = 0;
+}
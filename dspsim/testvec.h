@@ -0,0 +1,62 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file testvec.h
+* @brief Header for in-process test vector generators (-g option, gen regions)
+* @date 2026-10-19
+*/
+
+#ifndef	_TESTVEC_H
+#define	_TESTVEC_H
+
+#include "simsupport.h"
+
+#define	MAX_GENS		16			/**< maximum number of generators */
+#define	MAX_GENSPEC		160			/**< maximum generator spec length */
+#define	MAX_OFDMSIZE	1024		/**< maximum OFDM FFT size */
+#define	GEN_FULLSCALE	2047.0		/**< 12-bit full scale for amplitude 1.0 */
+
+/**
+* @brief Generator type
+*/
+enum eGen {
+	gTONE, gCHIRP, gQAM, gOFDM, gAWGN,
+};
+
+/**
+* @brief One generator: writes Size words at Start before every iteration.
+* Samples continue across iterations; lane j is seeded with Seed + j.
+*/
+typedef struct sGen {
+	int		Type;				/**< enum eGen */
+	unsigned int	Start;		/**< first data memory address */
+	int		Size;				/**< number of words per iteration */
+	int		LaneMask;			/**< bit j set: lane j written */
+	int		IQ;					/**< TRUE: interleaved I,Q words; FALSE: real part only */
+	double	F, F0, F1;			/**< tone frequency, chirp start/end frequency (cycles/sample) */
+	double	Amp;				/**< amplitude (1.0: full scale) */
+	double	Phase;				/**< tone start phase (rad) */
+	double	Snr;				/**< AWGN added at this SNR (dB); no noise if NoiseOff */
+	int		NoiseOff;			/**< TRUE if snr not given */
+	int		Len;				/**< chirp sweep length in samples */
+	int		M;					/**< QAM order (4, 16, 64, 256) */
+	int		N, CP;				/**< OFDM FFT size and cyclic prefix */
+	unsigned long long	Seed;	/**< random seed */
+
+	/* per-lane state */
+	long	Sample[NUMDP];				/**< samples generated so far */
+	double	ChirpPhase[NUMDP];			/**< accumulated chirp phase */
+	unsigned long long	Rng[NUMDP];		/**< xorshift64* state */
+	double	*Ofdm[NUMDP];				/**< current OFDM symbol (N+CP complex samples) */
+	int		OfdmPos[NUMDP];				/**< next sample in OFDM symbol */
+} sGen;
+
+int genAdd(char *spec, unsigned int start, int size, int laneMask);
+void genIter(void);
+void genClose(void);
+
+extern sGen Gens[MAX_GENS];
+extern int GenCntr;
+
+#endif	/* _TESTVEC_H */
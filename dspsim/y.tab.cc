@@ -23,8 +23,9 @@ static int yygrowstack();
 #include "optab.h"
 #include "simsupport.h"
 #include "dspdef.h"
+#include "arena.h"
 
-#line 14 "dspsim.y"
+#line 15 "dspsim.y"
 typedef union {
     struct sTab *symp;	/* symbol table pointer */
 	int	ival;			/* integer value */
@@ -32,7 +33,7 @@ typedef union {
 	int	op;				/* opcode */
 	char *tstr;			/* string */
 } YYSTYPE;
-#line 36 "y.tab.cc"
+#line 37 "y.tab.cc"
 #define YYERRCODE 256
 #define LABEL 257
 #define COMMENT 258
@@ -504,7 +505,7 @@ short *yyss;
 short *yysslim;
 YYSTYPE *yyvs;
 int yystacksize;
-#line 562 "dspsim.y"
+#line 563 "dspsim.y"
 
 int addOperand(char *s)
 {
@@ -516,7 +517,16 @@ int addOperand(char *s)
 		exit(1);
 	}
 
-	curicode->Operand[t] = strdup(s);
+	/* operand vector: small one first, bigger one for long lists */
+	if(t == 0){
+		curicode->Operand = (char **)arenaAlloc(curArena, OPERAND_SLOTS * sizeof(char *));
+	}else if(t == OPERAND_SLOTS-2){
+		char **v = (char **)arenaAlloc(curArena, OPERAND_SLOTSMAX * sizeof(char *));
+
+		memcpy(v, curicode->Operand, t * sizeof(char *));
+		curicode->Operand = v;
+	}
+	curicode->Operand[t] = arenaStrdup(curArena, s);
 	if(VerboseMode) printf("Operand[%d]:\t%s\n", t, curicode->Operand[t]);
 
 	return t;
@@ -526,7 +536,7 @@ void addConjugate(void)
 {
 	curicode->Conj = TRUE;
 }
-#line 530 "y.tab.cc"
+#line 540 "y.tab.cc"
 /* allocate initial stack or double stack size, up to YYMAXDEPTH */
 static int yygrowstack()
 {
@@ -722,7 +732,7 @@ yyreduce:
     switch (yyn)
     {
 case 2:
-#line 101 "dspsim.y"
+#line 102 "dspsim.y"
 {
 				lineno++;			/**< increment line counter */
 				curicode = NULL;	/**< this is end of processing 1 line */
@@ -730,7 +740,7 @@ case 2:
 			}
 break;
 case 3:
-#line 109 "dspsim.y"
+#line 110 "dspsim.y"
 {	
 				if(!curicode) 	/* when statment is null(blank): iLABEL */
 				{
@@ -745,7 +755,7 @@ case 3:
 
 					char linebuf2[MAX_LINEBUF];
 					sprintf(linebuf2, "%s:", yyvsp[-2].symp->Name);
-					curicode->Line = strdup(linebuf2);
+					curicode->Src->Line = arenaStrdupCold(curArena, linebuf2);
 				}else{		/* when statement is not blank */
 					if(yyvsp[-2].symp->Addr != curaddr){		/* happens just after multifunction */
 						/* example:
@@ -761,7 +771,7 @@ case 3:
 
 				if(VerboseMode) printf("> LINE2:\t%s\n", linebuf); 
 
-				curicode->Label = yyvsp[-2].symp;
+				curicode->Src->Label = yyvsp[-2].symp;
 
 				if(VerboseMode) printf("LABEL:\t%s(0x%04X) %p\n", yyvsp[-2].symp->Name, yyvsp[-2].symp->Addr, yyvsp[-2].symp); 
 				if(VerboseMode) printf("curaddr = %X\n", curaddr);
@@ -770,56 +780,56 @@ case 3:
 			}
 break;
 case 4:
-#line 147 "dspsim.y"
+#line 148 "dspsim.y"
 {	if(VerboseMode) printf("** line: %d\n\n", lineno);	}
 break;
 case 6:
-#line 152 "dspsim.y"
+#line 153 "dspsim.y"
 {
-				curicode->Comment = yyvsp[0].tstr;	
+				curicode->Src->Comment = yyvsp[0].tstr;	
 			}
 break;
 case 8:
-#line 157 "dspsim.y"
+#line 158 "dspsim.y"
 {
 				curicode = sICodeListAdd(&iCode, iCOMMENT, curaddr, lineno);
-				curicode->Comment = yyvsp[0].tstr;	
+				curicode->Src->Comment = yyvsp[0].tstr;	
 			}
 break;
 case 9:
-#line 162 "dspsim.y"
+#line 163 "dspsim.y"
 {
 				if(VerboseMode) printf("MULTIFUNC1:\n");
 			}
 break;
 case 10:
-#line 166 "dspsim.y"
+#line 167 "dspsim.y"
 {
-				curicode->Comment = yyvsp[0].tstr;	
+				curicode->Src->Comment = yyvsp[0].tstr;	
 				if(VerboseMode) printf("MULTIFUNC3:\n");
 				if(VerboseMode) printf("COMMENT4: %s at PMA %04X\n", yyvsp[0].tstr, curicode->PMA);
 			}
 break;
 case 11:
-#line 172 "dspsim.y"
+#line 173 "dspsim.y"
 {
 				if(VerboseMode) printf("MULTIFUNC2:\n");
 			}
 break;
 case 12:
-#line 176 "dspsim.y"
+#line 177 "dspsim.y"
 {
-				curicode->Comment = yyvsp[0].tstr;	
+				curicode->Src->Comment = yyvsp[0].tstr;	
 				if(VerboseMode) printf("MULTIFUNC4:\n");
 				if(VerboseMode) printf("COMMENT6: %s at PMA %04X\n", yyvsp[0].tstr, curicode->PMA);
 			}
 break;
 case 13:
-#line 183 "dspsim.y"
+#line 184 "dspsim.y"
 {}
 break;
 case 14:
-#line 187 "dspsim.y"
+#line 188 "dspsim.y"
 {	
 				addOperand(yyvsp[-1].symp->Name);
 
@@ -835,71 +845,71 @@ case 14:
 			}
 break;
 case 15:
-#line 201 "dspsim.y"
+#line 202 "dspsim.y"
 {	if(VerboseMode) printf("OPCODE:\t%s\n", sOp[yyvsp[-1].op]); }
 break;
 case 16:
-#line 203 "dspsim.y"
+#line 204 "dspsim.y"
 {	if(VerboseMode) printf("OPCODE:\t%s\n", sOp[yyvsp[0].op]); }
 break;
 case 17:
-#line 207 "dspsim.y"
+#line 208 "dspsim.y"
 { 
 				strcpy(condbuf, "");
 			}
 break;
 case 18:
-#line 211 "dspsim.y"
+#line 212 "dspsim.y"
 {
 				strcpy(condbuf, yyvsp[0].tstr);
 				if(VerboseMode) printf("CCODE: %s\n", yyvsp[0].tstr);	
 			}
 break;
 case 47:
-#line 248 "dspsim.y"
+#line 249 "dspsim.y"
 {	
 			}
 break;
 case 48:
-#line 253 "dspsim.y"
+#line 254 "dspsim.y"
 {
 				/*addOperand($1->Name);*/
 			}
 break;
 case 49:
-#line 258 "dspsim.y"
+#line 259 "dspsim.y"
 {	yyval.op = yyvsp[0].op; }
 break;
 case 50:
-#line 262 "dspsim.y"
+#line 263 "dspsim.y"
 {	
 				addOperand("FOREVER");
 				if(VerboseMode) printf("TERM: FOREVER\n");
 			}
 break;
 case 51:
-#line 267 "dspsim.y"
+#line 268 "dspsim.y"
 {	
 				addOperand(yyvsp[0].tstr);
 				if(VerboseMode) printf("TERM: CE\n");	
 			}
 break;
 case 52:
-#line 272 "dspsim.y"
+#line 273 "dspsim.y"
 {	
 				addOperand(yyvsp[0].tstr);
 				if(VerboseMode) printf("TERM: FOREVER\n");
 			}
 break;
 case 55:
-#line 283 "dspsim.y"
+#line 284 "dspsim.y"
 {	
 				addOperand(yyvsp[-1].tstr);
 				if(VerboseMode) printf("REGISTER:\t%s\n", yyvsp[-1].tstr); 
 			}
 break;
 case 56:
-#line 288 "dspsim.y"
+#line 289 "dspsim.y"
 {	
 				char s[MAX_LINEBUF]; 
 				sprintf(s, "%d", yyvsp[0].ival);
@@ -908,130 +918,130 @@ case 56:
 			}
 break;
 case 57:
-#line 295 "dspsim.y"
+#line 296 "dspsim.y"
 {
 				addOperand(yyvsp[0].tstr);
 				if(VerboseMode) printf("KEYWORDS: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 58:
-#line 300 "dspsim.y"
+#line 301 "dspsim.y"
 {
 			}
 break;
 case 59:
-#line 303 "dspsim.y"
+#line 304 "dspsim.y"
 {
 			}
 break;
 case 60:
-#line 306 "dspsim.y"
+#line 307 "dspsim.y"
 {
 			}
 break;
 case 61:
-#line 311 "dspsim.y"
+#line 312 "dspsim.y"
 {
 				addOperand("SR");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 62:
-#line 316 "dspsim.y"
+#line 317 "dspsim.y"
 {
 				addOperand("BR");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 63:
-#line 321 "dspsim.y"
+#line 322 "dspsim.y"
 {
 				addOperand("OL");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 64:
-#line 326 "dspsim.y"
+#line 327 "dspsim.y"
 {
 				addOperand("AS");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 65:
-#line 331 "dspsim.y"
+#line 332 "dspsim.y"
 {
 				addOperand("MM");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 66:
-#line 336 "dspsim.y"
+#line 337 "dspsim.y"
 {
 				addOperand("TI");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 67:
-#line 341 "dspsim.y"
+#line 342 "dspsim.y"
 {
 				addOperand("SD");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 68:
-#line 346 "dspsim.y"
+#line 347 "dspsim.y"
 {
 				addOperand("MB");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 69:
-#line 351 "dspsim.y"
+#line 352 "dspsim.y"
 {
 				addOperand("INT");
 				if(VerboseMode) printf("ENA: %s\n", yyvsp[0].tstr); 
 			}
 break;
 case 70:
-#line 357 "dspsim.y"
+#line 358 "dspsim.y"
 { }
 break;
 case 71:
-#line 359 "dspsim.y"
+#line 360 "dspsim.y"
 {
 				addConjugate();
 				if(VerboseMode) printf("CONJUGATE: *\n"); 
 			}
 break;
 case 72:
-#line 366 "dspsim.y"
+#line 367 "dspsim.y"
 { 
 				addOperand("DM");
 			}
 break;
 case 73:
-#line 370 "dspsim.y"
+#line 371 "dspsim.y"
 { 
 				addOperand("PM");
 			}
 break;
 case 74:
-#line 374 "dspsim.y"
+#line 375 "dspsim.y"
 {
 			}
 break;
 case 75:
-#line 379 "dspsim.y"
+#line 380 "dspsim.y"
 {
 			}
 break;
 case 76:
-#line 382 "dspsim.y"
+#line 383 "dspsim.y"
 {
 			}
 break;
 case 77:
-#line 385 "dspsim.y"
+#line 386 "dspsim.y"
 {
 				char s[MAX_LINEBUF]; 
 				sprintf(s, "%d", yyvsp[0].ival);
@@ -1043,7 +1053,7 @@ case 77:
 			}
 break;
 case 78:
-#line 397 "dspsim.y"
+#line 398 "dspsim.y"
 {	
 				addOperand(yyvsp[-2].tstr);
 				if(VerboseMode) printf("DAG: %s\n", yyvsp[-2].tstr); 
@@ -1055,7 +1065,7 @@ case 78:
 			}
 break;
 case 79:
-#line 407 "dspsim.y"
+#line 408 "dspsim.y"
 {	
 				char s[MAX_LINEBUF]; 
 				addOperand(yyvsp[-2].tstr);
@@ -1069,7 +1079,7 @@ case 79:
 			}
 break;
 case 80:
-#line 419 "dspsim.y"
+#line 420 "dspsim.y"
 {	
 				addOperand(yyvsp[0].tstr);
 				if(VerboseMode) printf("DAG: %s\n", yyvsp[0].tstr); 
@@ -1079,7 +1089,7 @@ case 80:
 			}
 break;
 case 81:
-#line 428 "dspsim.y"
+#line 429 "dspsim.y"
 {
 				char s[MAX_LINEBUF]; 
 
@@ -1097,7 +1107,7 @@ case 81:
 			}
 break;
 case 82:
-#line 444 "dspsim.y"
+#line 445 "dspsim.y"
 {
 				/* this syntax is only for .VAR */
 				char s[MAX_LINEBUF]; 
@@ -1116,7 +1126,7 @@ case 82:
 			}
 break;
 case 83:
-#line 461 "dspsim.y"
+#line 462 "dspsim.y"
 {	
 				int t = addOperand(yyvsp[0].symp->Name);
 
@@ -1125,19 +1135,19 @@ case 83:
 			}
 break;
 case 87:
-#line 475 "dspsim.y"
+#line 476 "dspsim.y"
 {	addOperand(yyvsp[0].tstr); }
 break;
 case 88:
-#line 477 "dspsim.y"
+#line 478 "dspsim.y"
 {	addOperand(yyvsp[0].tstr); }
 break;
 case 89:
-#line 480 "dspsim.y"
+#line 481 "dspsim.y"
 { yyval.tstr = NULL; }
 break;
 case 90:
-#line 482 "dspsim.y"
+#line 483 "dspsim.y"
 { 
 				addOperand(yyvsp[-1].tstr);
 				if(VerboseMode) printf("Option: %s\n", yyvsp[-1].tstr); 
@@ -1145,7 +1155,7 @@ case 90:
 			}
 break;
 case 91:
-#line 490 "dspsim.y"
+#line 491 "dspsim.y"
 {
 				char sr[MAX_LINEBUF]; 
 				char si[MAX_LINEBUF]; 
@@ -1157,29 +1167,29 @@ case 91:
 			}
 break;
 case 121:
-#line 532 "dspsim.y"
+#line 533 "dspsim.y"
 {
 			}
 break;
 case 132:
-#line 547 "dspsim.y"
+#line 548 "dspsim.y"
 {
 				yyval.tstr = yyvsp[0].tstr;
 			}
 break;
 case 133:
-#line 552 "dspsim.y"
+#line 553 "dspsim.y"
 { yyval.ival = -yyvsp[0].ival; }
 break;
 case 134:
-#line 553 "dspsim.y"
+#line 554 "dspsim.y"
 { yyval.ival = yyvsp[-1].ival; }
 break;
 case 135:
-#line 554 "dspsim.y"
+#line 555 "dspsim.y"
 { yyval.ival = yyvsp[0].ival; }
 break;
-#line 1183 "y.tab.cc"
+#line 1193 "y.tab.cc"
     }
     yyssp -= yym;
     yystate = *yyssp;
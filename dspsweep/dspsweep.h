@@ -0,0 +1,89 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file dspsweep.h
+* @brief Common header file for dspsweep project
+* @date 2026-10-19
+*/
+
+#ifndef _DSPSWEEP_H
+#define _DSPSWEEP_H
+
+#define VERSION 1.0
+#define AUTHOR  ""
+#define	COPYRIGHT1 "Copyright (C), 2008-2026\n"
+#define COPYRIGHT2 "All Rights Reserved.\n"
+#define	TARGET	"dspsweep"
+
+#ifndef TRUE
+#define FALSE 0
+#define TRUE 1
+#endif
+
+#include <stdio.h>
+#include <sys/types.h>
+
+#define	MAX_LINEBUF		512		/**< maximum number of characters in one line */
+#define	MAX_AXIS		16		/**< maximum number of values per sweep axis */
+#define	MAX_SIMARGS		64		/**< maximum number of simulator arguments */
+
+/**
+* @brief One point of the configuration matrix and its results.
+*/
+typedef struct sSweepJob {
+	int		Id;					/**< job number (table row) */
+	int		Mode;				/**< SIMD mode: 1, 2, 4 (dspsim only) */
+	int		Unaligned;			/**< TRUE if -u */
+	int		DelaySlot;			/**< TRUE if -d (binsim only) */
+	int		Itr;				/**< -l value */
+	char	*Input;				/**< -if file (absolute path) or NULL */
+
+	pid_t	Pid;				/**< simulator process */
+	char	Dir[MAX_LINEBUF];	/**< private working directory */
+
+	int		Done;				/**< TRUE if simulator finished */
+	int		Status;				/**< simulator exit status */
+	long	Cycles;				/**< "Time:" line */
+	long	Overflow;			/**< "Overflow:" line */
+	long	UMCount;			/**< "Unaligned memory access:" line, -1 if n/a */
+	unsigned int	Checksum;	/**< CRC-32 of output memory dump */
+} sSweepJob;
+
+extern int	VerboseMode;
+extern char	*progFile;
+extern char	*simPath;
+extern int	isBinary;
+extern int	maxJobs;
+extern FILE	*tableFP;
+
+extern int	modeAxis[MAX_AXIS];
+extern int	modeCntr;
+extern int	uAxis[MAX_AXIS];
+extern int	uCntr;
+extern int	dAxis[MAX_AXIS];
+extern int	dCntr;
+extern int	lAxis[MAX_AXIS];
+extern int	lCntr;
+extern char	*inAxis[MAX_AXIS];
+extern int	inCntr;
+extern char	*fixedArgs[MAX_SIMARGS];
+extern int	fixedCntr;
+
+int processArg(int argc, char *argv[]);
+void printHelp(char *s);
+void printArgError(char *prog, char *opt);
+int parseIntAxis(int axis[], char *s);
+int parseStrAxis(char *axis[], char *s);
+
+int buildJobs(sSweepJob **jobs);
+void runJobs(sSweepJob *jobs, int n);
+pid_t startJob(sSweepJob *job);
+void finishJob(sSweepJob *job, int status);
+void parseSimLog(sSweepJob *job, FILE *fp);
+unsigned int crc32File(char *filename);
+void printTable(sSweepJob *jobs, int n);
+void removeJobDir(sSweepJob *job);
+void removeDir(char *dir);
+
+#endif  /* _DSPSWEEP_H */
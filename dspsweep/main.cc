@@ -0,0 +1,275 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file main.cc
+* @brief Parallel configuration sweep driver for dspsim/binsim
+* @date 2026-10-19
+*/
+
+#include <stdio.h>	/* perror() */
+#include <stdlib.h>	/* strtol(), exit() */
+#include <string.h>	/* strcpy() */
+#include <ctype.h>
+#include <unistd.h>	/* sysconf() */
+#include "dspsweep.h"
+
+int VerboseMode = FALSE;
+char *progFile = NULL;		/* .asm (dspsim) or .out (binsim) */
+char *simPath = NULL;		/* simulator executable */
+int isBinary = FALSE;		/* TRUE if .out given */
+int maxJobs = 0;			/* concurrent simulator processes */
+FILE *tableFP = NULL;		/* result table */
+
+int modeAxis[MAX_AXIS] = { 1 };		/* -m: SIMD modes */
+int modeCntr = 1;
+int uAxis[MAX_AXIS] = { 0 };		/* -u: unaligned access off/on */
+int uCntr = 1;
+int dAxis[MAX_AXIS] = { 0 };		/* -d: delay slot off/on */
+int dCntr = 1;
+int lAxis[MAX_AXIS] = { 1 };		/* -l: iterations */
+int lCntr = 1;
+char *inAxis[MAX_AXIS] = { NULL };	/* -i: input data sets */
+int inCntr = 1;
+char *fixedArgs[MAX_SIMARGS];		/* passed to every run */
+int fixedCntr = 0;
+
+/**
+* @brief Program entry point
+*
+* @param argc
+* @param argv
+*
+* @return
+*/
+int main(int argc, char *argv[])
+{
+	sSweepJob *jobs;
+	int n;
+
+	tableFP = stdout;
+	if(!processArg(argc, argv)) return 0;
+
+	if(!maxJobs){
+		maxJobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+		if(maxJobs < 1) maxJobs = 1;
+	}
+
+	n = buildJobs(&jobs);
+	if(VerboseMode) printf("%d configurations, %d parallel jobs\n", n, maxJobs);
+
+	runJobs(jobs, n);
+	printTable(jobs, n);
+
+	int failed = 0;
+	for(int i = 0; i < n; i++){
+		if(jobs[i].Status) failed++;
+		free(jobs[i].Input);
+	}
+	free(jobs);
+
+	if(tableFP != stdout) fclose(tableFP);
+	exit(failed ? 1 : 0);
+}
+
+/**
+* @brief Process input command arguments
+*
+* @param argc Number of input arguments
+* @param argv Pointer to input argument strings
+*
+* @return TRUE if success
+*/
+int processArg(int argc, char *argv[])
+{
+	int i;
+
+	if(argc == 1){	/* if no arguments given */
+		printHelp(argv[0]);
+		return FALSE;	/* early exit */
+	}
+
+	for(i = 1; i < argc; i++){
+		if(!strcmp("--help", argv[i]) || !strcmp("-h", argv[i])){	/* command help */
+			printHelp(argv[0]);
+			return FALSE;	/* early exit */
+		} else if(!strcmp("--version", argv[i])){	/* version info */
+			printf("%s: OFDM DSP Configuration Sweep Driver %g\n", argv[0], VERSION);
+			printf(COPYRIGHT1);
+			printf(COPYRIGHT2);
+			printf("Last Built: %s %s\n", __DATE__, __TIME__);
+			return FALSE;	/* early exit */
+		} else if(!strcmp("-v", argv[i]) || !strcmp("--verbose", argv[i])){
+			VerboseMode = TRUE;
+		} else if(!strcmp("-m", argv[i]) || !strcmp("-u", argv[i]) || !strcmp("-d", argv[i])
+			|| !strcmp("-l", argv[i])){
+			/* integer sweep axes */
+			char opt = argv[i][1];
+			i++;
+			if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			if(opt == 'm') modeCntr = parseIntAxis(modeAxis, argv[i]);
+			else if(opt == 'u') uCntr = parseIntAxis(uAxis, argv[i]);
+			else if(opt == 'd') dCntr = parseIntAxis(dAxis, argv[i]);
+			else lCntr = parseIntAxis(lAxis, argv[i]);
+
+			if(opt == 'm'){
+				for(int k = 0; k < modeCntr; k++){
+					if(modeAxis[k] != 1 && modeAxis[k] != 2 && modeAxis[k] != 4){
+						printf("\nError: %s - SIMD mode must be 1, 2 or 4\n", argv[0]);
+						return FALSE;
+					}
+				}
+			}
+		} else if(!strcmp("-i", argv[i])){
+			/* input data sets */
+			i++;
+			if(argv[i] == NULL){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			inCntr = parseStrAxis(inAxis, argv[i]);
+		} else if(!strcmp("-ia", argv[i]) || !strcmp("-is", argv[i])
+			|| !strcmp("-oa", argv[i]) || !strcmp("-os", argv[i])){
+			/* fixed memory dump options */
+			if((argv[i+1] == NULL) || (fixedCntr + 2 > MAX_SIMARGS)){	/* error check */
+				printArgError(argv[0], argv[i]);
+				return FALSE;
+			}
+			fixedArgs[fixedCntr++] = argv[i];
+			fixedArgs[fixedCntr++] = argv[++i];
+		} else if(!strcmp("-x", argv[i])){
+			/* passed to simulator as is */
+			if(fixedCntr + 1 > MAX_SIMARGS) return FALSE;
+			fixedArgs[fixedCntr++] = argv[i];
+		} else if(!strcmp("-j", argv[i])){
+			/* number of parallel jobs */
+			i++;
+			if((argv[i] == NULL) || !isdigit(argv[i][0])){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			maxJobs = atoi(argv[i]);
+		} else if(!strcmp("-o", argv[i])){
+			/* result table filename */
+			i++;
+			if(argv[i] == NULL){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			if(!(tableFP = fopen(argv[i], "w"))){
+				printf("\nError: %s - cannot open file %s\n", argv[0], argv[i]);
+				return FALSE;
+			}
+		} else if(!strcmp("-sim", argv[i])){
+			/* simulator executable */
+			i++;
+			if(argv[i] == NULL){	/* error check */
+				printArgError(argv[0], argv[i-1]);
+				return FALSE;
+			}
+			simPath = argv[i];
+		} else if(argv[i][0] == '-'){	/* cannot understand this command */
+			printHelp(argv[0]);
+			return FALSE;	/* early exit */
+		} else {	/* if not command, must be filename */
+			progFile = argv[i];
+		}
+	}
+
+	if(!progFile){
+		printf("\nError: %s - no input file\n", argv[0]);
+		return FALSE;
+	}
+
+	int len = strlen(progFile);
+	if(len > 4 && !strcasecmp(progFile+len-4, ".out")){
+		isBinary = TRUE;
+	}else if(!(len > 4 && !strcasecmp(progFile+len-4, ".asm"))){
+		printf("\nError: %s - input filename extension must be \".asm\" or \".out\"\n", progFile);
+		return FALSE;
+	}
+
+	if(!simPath) simPath = (char *)(isBinary ? "binsim" : "dspsim");
+	return TRUE;
+}
+
+/**
+* @brief Parse comma separated integer list, e.g. "1,2,4".
+*
+* @param axis Array to store values
+* @param s Input string
+*
+* @return Number of values
+*/
+int parseIntAxis(int axis[], char *s)
+{
+	int n = 0;
+	char *tok = strtok(s, ",");
+
+	while(tok && n < MAX_AXIS){
+		axis[n++] = atoi(tok);
+		tok = strtok(NULL, ",");
+	}
+	return n;
+}
+
+/**
+* @brief Parse comma separated string list, e.g. "a.dat,b.dat".
+*
+* @param axis Array to store pointers to strings
+* @param s Input string (modified)
+*
+* @return Number of values
+*/
+int parseStrAxis(char *axis[], char *s)
+{
+	int n = 0;
+	char *tok = strtok(s, ",");
+
+	while(tok && n < MAX_AXIS){
+		axis[n++] = tok;
+		tok = strtok(NULL, ",");
+	}
+	return n;
+}
+
+/**
+* @brief Give command line help
+*
+* @param s Name of program
+*/
+void printHelp(char *s)
+{
+	printf("Usage: %s [option(s)] filename (.asm or .out)\n", s);
+	printf("Options:\n");
+	printf("\t-h [--help]   \tdisplay this help and exit\n");
+	printf("\t--version     \toutput version information and exit\n");
+	printf("\t-v [--verbose]\tprint extra information\n");
+	printf("\t-m list       \tSIMD data path modes to sweep, e.g. 1,2,4 (dspsim) [default: 1]\n");
+	printf("\t-u list       \tunaligned memory access off/on, e.g. 0,1 [default: 0]\n");
+	printf("\t-d list       \tdelay slot off/on, e.g. 0,1 (binsim) [default: 0]\n");
+	printf("\t-l list       \tnumbers of loop iterations, e.g. 1,16 [default: 1]\n");
+	printf("\t-i list       \tinput data files for -if, e.g. a.dat,b.dat\n");
+	printf("\t-ia/-is/-oa/-os\tmemory dump options passed to every run\n");
+	printf("\t-x            \tsuppress undefined data memory message mode\n");
+	printf("\t-j number     \tnumber of parallel simulations [default: online CPUs]\n");
+	printf("\t-o filename   \twrite result table into file [default: stdout]\n");
+	printf("\t-sim path     \tsimulator executable [default: dspsim or binsim]\n");
+	printf("\n");
+	printf("Report bugs to %s.\n", AUTHOR);
+}
+
+/**
+* @brief Print error message during argument processing
+*
+* @param prog Name of program
+* @param opt Option string
+*/
+void printArgError(char *prog, char *opt)
+{
+	printf("\nError: %s - argument to '%s' is missing\n", prog, opt);
+}
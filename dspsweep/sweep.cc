@@ -0,0 +1,364 @@
+/*
+All Rights Reserved.
+*/
+
+/**
+* @file sweep.cc
+* @brief Build the configuration matrix, run simulators in parallel and
+* collect cycles, overflow/UMCOUNT statistics and output checksums.
+*
+* Every run gets a private working directory holding a symbolic link to
+* the program (and its .ldi), so the .err/.dis files written next to the
+* program by each simulator do not collide.
+*
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <ftw.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "dspsweep.h"
+
+#define	SIMLOG	"sim.log"		/* simulator stdout in job directory */
+#define	SIMIN	"in.dat"		/* memory dump input in job directory */
+#define	SIMOUT	"out.dat"		/* memory dump output in job directory */
+
+/**
+* @brief Build all combinations of the sweep axes.
+*
+* @param jobs Pointer to store newly allocated job array
+*
+* @return Number of jobs
+*/
+int buildJobs(sSweepJob **jobs)
+{
+	int n = 0;
+	int modes = isBinary ? 1 : modeCntr;		/* binsim has no SIMD modes & -u */
+	int us = isBinary ? 1 : uCntr;
+	int ds = isBinary ? dCntr : 1;				/* dspsim has no -d */
+	int total = modes * us * ds * lCntr * inCntr;
+	char path[PATH_MAX];
+
+	*jobs = (sSweepJob *)calloc(total, sizeof(sSweepJob));
+
+	for(int m = 0; m < modes; m++)
+	for(int u = 0; u < us; u++)
+	for(int d = 0; d < ds; d++)
+	for(int l = 0; l < lCntr; l++)
+	for(int k = 0; k < inCntr; k++){
+		sSweepJob *j = &(*jobs)[n];
+
+		j->Id = n;
+		j->Mode = isBinary ? 1 : modeAxis[m];
+		j->Unaligned = isBinary ? 0 : uAxis[u];
+		j->DelaySlot = isBinary ? dAxis[d] : 0;
+		j->Itr = lAxis[l];
+		if(inAxis[k]){
+			if(realpath(inAxis[k], path)) j->Input = strdup(path);
+			else j->Input = strdup(inAxis[k]);	/* simulator reports the error */
+		}
+		j->UMCount = -1;
+		n++;
+	}
+
+	return n;
+}
+
+/**
+* @brief Run all jobs with at most maxJobs simulator processes at a time.
+*
+* @param jobs Job array
+* @param n Number of jobs
+*/
+void runJobs(sSweepJob *jobs, int n)
+{
+	int next = 0, running = 0;
+	int status;
+	pid_t pid;
+
+	while(next < n || running > 0){
+		/* fill free slots */
+		while(next < n && running < maxJobs){
+			if(startJob(&jobs[next]) > 0){
+				running++;
+			}else{
+				jobs[next].Done = TRUE;
+				jobs[next].Status = -1;
+			}
+			next++;
+		}
+
+		if(running == 0) break;
+
+		pid = wait(&status);
+		if(pid < 0) break;
+
+		for(int i = 0; i < next; i++){
+			if(jobs[i].Pid == pid && !jobs[i].Done){
+				finishJob(&jobs[i], status);
+				running--;
+				break;
+			}
+		}
+	}
+}
+
+/**
+* @brief Prepare job directory and start a simulator process.
+*
+* @param job Job to start
+*
+* @return Process ID, or -1 on failure
+*/
+pid_t startJob(sSweepJob *job)
+{
+	char src[PATH_MAX], dst[PATH_MAX], sim[PATH_MAX], base[PATH_MAX];
+	char num[16];
+	char *args[MAX_SIMARGS + 16];
+	int argc = 0;
+	const char *tmp = getenv("TMPDIR");
+
+	sprintf(job->Dir, "%s/dspsweep.XXXXXX", tmp ? tmp : "/tmp");
+	if(!mkdtemp(job->Dir)){
+		perror(job->Dir);
+		return -1;
+	}
+
+	/* link program (and loading info) into job directory */
+	if(!realpath(progFile, src)){
+		perror(progFile);
+		removeDir(job->Dir);
+		return -1;
+	}
+	strcpy(base, strrchr(src, '/') + 1);
+	if(snprintf(dst, sizeof(dst), "%s/%s", job->Dir, base) >= (int)sizeof(dst)){
+		printf("Error: %s/%s - path too long\n", job->Dir, base);
+		removeDir(job->Dir);
+		return -1;
+	}
+	symlink(src, dst);
+	if(isBinary){
+		strcpy(src + strlen(src) - 3, "ldi");
+		strcpy(dst + strlen(dst) - 3, "ldi");
+		symlink(src, dst);
+	}
+
+	/* simulator path: absolute if not searched in PATH */
+	if(strchr(simPath, '/') && realpath(simPath, sim)) ;
+	else strcpy(sim, simPath);
+
+	sprintf(num, "%d", job->Itr);
+	args[argc++] = sim;
+	args[argc++] = (char *)"-c";
+	args[argc++] = (char *)"-q";
+	args[argc++] = (char *)"-l";
+	args[argc++] = num;
+	if(!isBinary){
+		args[argc++] = (char *)(job->Mode == 4 ? "-4" : (job->Mode == 2 ? "-2" : "-1"));
+	}
+	if(job->Unaligned) args[argc++] = (char *)"-u";
+	if(job->DelaySlot) args[argc++] = (char *)"-d";
+	if(job->Input){		/* simulators want a plain relative filename */
+		snprintf(dst, sizeof(dst), "%s/%s", job->Dir, SIMIN);
+		symlink(job->Input, dst);
+		args[argc++] = (char *)"-if";
+		args[argc++] = (char *)SIMIN;
+	}
+	for(int i = 0; i < fixedCntr; i++){
+		args[argc++] = fixedArgs[i];
+	}
+	args[argc++] = (char *)"-of";
+	args[argc++] = (char *)SIMOUT;
+	args[argc++] = base;
+	args[argc] = NULL;
+
+	fflush(stdout);
+	job->Pid = fork();
+	if(job->Pid == 0){		/* simulator process */
+		if(chdir(job->Dir) < 0) _exit(127);
+
+		int fd = open(SIMLOG, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		int nul = open("/dev/null", O_RDONLY);
+		if(fd >= 0){
+			dup2(fd, 1);
+			dup2(fd, 2);
+			close(fd);
+		}
+		if(nul >= 0){		/* never wait for interactive input */
+			dup2(nul, 0);
+			close(nul);
+		}
+
+		execvp(sim, args);
+		perror(sim);
+		_exit(127);
+	}
+
+	if(job->Pid < 0){
+		perror("fork");
+		removeDir(job->Dir);
+	}else if(VerboseMode){
+		printf("job %d started:", job->Id);
+		for(int i = 0; i < argc; i++) printf(" %s", args[i]);
+		printf("\n");
+	}
+
+	return job->Pid;
+}
+
+/**
+* @brief Collect results of a finished simulator process.
+*
+* @param job Finished job
+* @param status Status returned by wait()
+*/
+void finishJob(sSweepJob *job, int status)
+{
+	char path[PATH_MAX];
+	FILE *fp;
+
+	job->Done = TRUE;
+	job->Status = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+
+	sprintf(path, "%s/%s", job->Dir, SIMLOG);
+	if((fp = fopen(path, "r"))){
+		parseSimLog(job, fp);
+		fclose(fp);
+	}
+
+	sprintf(path, "%s/%s", job->Dir, SIMOUT);
+	job->Checksum = crc32File(path);
+
+	if(VerboseMode) printf("job %d finished: status %d\n", job->Id, job->Status);
+
+	removeJobDir(job);
+}
+
+/**
+* @brief Pick statistics summary lines out of simulator output.
+*
+* @param job Job to update
+* @param fp Simulator output
+*/
+void parseSimLog(sSweepJob *job, FILE *fp)
+{
+	char line[MAX_LINEBUF];
+	long v;
+	int summary = FALSE;
+
+	while(fgets(line, MAX_LINEBUF, fp)){
+		if(sscanf(line, "Time: %ld cycles", &v) == 1){
+			job->Cycles = v;
+			summary = TRUE;
+		}
+		else if(sscanf(line, "Overflow: %ld times", &v) == 1) job->Overflow = v;
+		else if(sscanf(line, "Unaligned memory access: %ld times", &v) == 1) job->UMCount = v;
+		else if(!strncmp(line, "Run-Time Error", 14) && !job->Status) job->Status = 1;
+	}
+
+	/* no statistics summary: simulator rejected the options or the program */
+	if(!summary && !job->Status) job->Status = 1;
+}
+
+/**
+* @brief CRC-32 (IEEE 802.3) of a whole file.
+*
+* @param filename File to read
+*
+* @return CRC value, 0 if the file cannot be read
+*/
+unsigned int crc32File(char *filename)
+{
+	static unsigned int table[256];
+	unsigned char buf[4096];
+	unsigned int crc = 0xFFFFFFFF;
+	size_t n;
+	FILE *fp;
+
+	if(!table[1]){
+		for(unsigned int i = 0; i < 256; i++){
+			unsigned int c = i;
+			for(int k = 0; k < 8; k++){
+				c = (c & 1) ? (0xEDB88320 ^ (c >> 1)) : (c >> 1);
+			}
+			table[i] = c;
+		}
+	}
+
+	if(!(fp = fopen(filename, "rb"))) return 0;
+	while((n = fread(buf, 1, sizeof(buf), fp)) > 0){
+		for(size_t i = 0; i < n; i++){
+			crc = table[(crc ^ buf[i]) & 0xFF] ^ (crc >> 8);
+		}
+	}
+	fclose(fp);
+
+	return crc ^ 0xFFFFFFFF;
+}
+
+/**
+* @brief Write result table, one line per configuration.
+*
+* @param jobs Job array
+* @param n Number of jobs
+*/
+void printTable(sSweepJob *jobs, int n)
+{
+	fprintf(tableFP, "; %s sweep of %s\n", TARGET, progFile);
+	fprintf(tableFP, "%-4s %-4s %-2s %-2s %-6s %-24s %12s %9s %9s %-8s %s\n",
+		"#", "SIMD", "u", "d", "l", "input", "cycles", "overflow", "umcount", "checksum", "status");
+
+	for(int i = 0; i < n; i++){
+		sSweepJob *j = &jobs[i];
+		const char *in = "-";
+
+		if(j->Input) in = strrchr(j->Input, '/') ? strrchr(j->Input, '/') + 1 : j->Input;
+
+		fprintf(tableFP, "%-4d %-4d %-2d %-2d %-6d %-24s %12ld %9ld ",
+			j->Id, j->Mode, j->Unaligned, j->DelaySlot, j->Itr, in, j->Cycles, j->Overflow);
+		if(j->UMCount >= 0) fprintf(tableFP, "%9ld ", j->UMCount);
+		else fprintf(tableFP, "%9s ", "-");
+		fprintf(tableFP, "%08X %s\n", j->Checksum, j->Status ? "FAIL" : "ok");
+	}
+}
+
+/**
+* @brief Remove job working directory and its files.
+*
+* @param job Finished job
+*/
+void removeJobDir(sSweepJob *job)
+{
+	if(VerboseMode){	/* keep files for inspection */
+		printf("job %d files kept in %s\n", job->Id, job->Dir);
+		return;
+	}
+	removeDir(job->Dir);
+}
+
+/**
+* @brief nftw() callback: remove one file or (emptied) directory.
+*/
+static int removeDirEntry(const char *path, const struct stat *, int, struct FTW *)
+{
+	remove(path);
+	return 0;		/* continue with the rest */
+}
+
+/**
+* @brief Remove directory and everything in it. Symbolic links are
+* removed, not followed.
+*
+* @param dir Directory
+*/
+void removeDir(char *dir)
+{
+	nftw(dir, removeDirEntry, 16, FTW_DEPTH | FTW_PHYS);
+}
@@ -0,0 +1,58 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+; This is a test assembly input file for DSP simulator
+;
+; Note: this is to test the -bundle option against load-use latency
+;	1. run with and without -bundle: data memory dumps must be the same
+;	   (see "make bundlecheck" in dspsim/makefile).
+;	2. Ix/Mx read 1 or 2 cycles after LD uses a backup value; bundling
+;	   must not move a read closer to its load, also across a loop end.
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+	.DATA
+	.VAR	xa[16] = 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16
+	.VAR	ya[16] = 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1
+	.VAR	za[16]
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+	.CODE
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+; register initializations
+	LD	I0, xa
+	LD	I4, ya
+	LD	I1, za
+	LD	M1, 1
+;
+; M4 loaded 3 cycles before LD R2: LD R0 || LD R2 would read it after 2
+	LD	M0, 1
+	LD	M4, 1
+	NOP
+	LD	R0, DM(I0 += M0)
+	LD	R2, DM(I4 += M4)
+	MPY	ACC0, R0, R2 (SS)
+	LD	R1, DM(I0 += M0)
+	LD	R3, DM(I4 += M4)
+	MAC	ACC0, R1, R3 (SS)
+	LD	R0, DM(I0 += M0)
+	LD	R2, DM(I4 += M4)
+	MAC	ACC0, R0, R2 (SS)
+	ST	DM(I1 += M1), ACC0.L
+;
+; M4 loaded near the loop end: read again at the loop start
+	LD	M4, 2
+	LD	_CNTR, 3
+	NOP
+	DO	lp1	UNTIL CE
+	LD	R0, DM(I0 += M0)
+	LD	R2, DM(I4 += M4)
+	MPY	ACC1, R0, R2 (SS)
+	ST	DM(I1 += M1), ACC1.L
+	NOP
+	LD	M4, 1
+lp1:	NOP
+;
+; independent loads: bundled
+	LD	R0, DM(I0 += M0)
+	LD	R2, DM(I4 += M4)
+	MPY	ACC2, R0, R2 (SS)
+	ST	DM(I1 += M1), ACC2.L
+	ST	DM(I1 += M1), R0
+	ST	DM(I1 += M1), R2
+	NOP
@@ -0,0 +1,32 @@
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+; This is a test assembly input file for DSP simulator
+;
+; Note: this is to test the -p option with a DO loop kernel
+;	1. run with -l 16 and -l 16 -p 4: data memory dumps must be the same
+;	   (see "make speccheck" in dspsim/makefile).
+;	2. once the Mx backup values have settled (first 3 iterations), every
+;	   iteration leaves the same machine state (loop stack overflow and
+;	   underflow counters aside), so all speculative iterations after
+;	   them must be committed.
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+	.DATA
+	.VAR	xa[8] = 1, 2, 3, 4, 5, 6, 7, 8
+	.VAR	ya[8]
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+	.CODE
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+; register initializations
+	LD	I0, xa
+	LD	I1, ya
+	LD	M0, 1
+	LD	_CNTR, 8
+	NOP
+	NOP
+;
+; ya[i] = 2 * xa[i]
+	DO	lp1	UNTIL CE
+	LD	R0, DM(I0 += M0)
+	ADD	R1, R0, R0
+	ST	DM(I1 += M0), R1
+lp1:	NOP
+	NOP
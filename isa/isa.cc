@@ -0,0 +1,3416 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file isa.cc
+* Instruction encoding tables and decoders - generated by mkisa from n1d.isa, do not edit
+*/
+
+#include "isa.h"
+
+/** 
+* @brief Instruction type mnemonics; use eType for array indexing
+*/
+const char *sType[] = 
+{
+	"---",
+	"01a", "01b", "01c",
+	"03a", "03c", "03d", "03e", "03f", "03g", "03h", "03i",
+	"04a", "04b", "04c", "04d", "04e", "04f", "04g", "04h",
+	"06a", "06b", "06c", "06d",
+	"08a", "08b", "08c", "08d",
+	"09c", "09d", "09e", "09f", "09g", "09h", "09i",
+	"10a", "10b",
+	"11a",
+	"12e", "12f", "12g", "12h", "12m", "12n", "12o", "12p",
+	"14c", "14d", "14k", "14l",
+	"15a", "15b", "15c", "15d", "15e", "15f",
+	"16a", "16b", "16c", "16d", "16e", "16f",
+	"17a", "17b", "17c", "17d", "17e", "17f", "17g", "17h",
+	"18a", "18b", "18c",
+	"19a",
+	"20a",
+	"22a",
+	"23a",
+	"25a", "25b",
+	"26a",
+	"29a", "29b", "29c", "29d",
+	"30a",
+	"31a",
+	"32a", "32b", "32c", "32d",
+	"37a",
+	"40e", "40f", "40g",
+	"41a", "41b", "41c", "41d",
+	"42a", "42b",
+	"43a",
+	"44b", "44d",
+	"45b", "45d",
+	"46a", "46b",
+	"47a",
+	"48a",
+	"49a", "49b", "49c", "49d",
+	"50a",
+	NULL
+};
+
+/** 
+* @brief Instruction Field mnemonics; use eField for array indexing
+*/
+const char *sField[] = 
+{
+	"OpcodeType", "AMF", "SF", "SF2", "AF",
+	"MF", "YZ", "DSTA", "SRCA1", "SRCA2",
+	"DSTM", "SRCM1", "SRCM2", "DSTS", "SRCS1",
+	"SRCS2", "DSTLS", "SRCLS", "DSTC", "SRCC",
+	"DSTB", "DSTID", "TERM", "INTN", "U",
+	"U2", "S", "T", "LPP", "PPP",
+	"SPP", "C", "CONJ", "ENA", "POLAR",
+	"DD", "PD", "DC", "LSF", "DF",
+	"MN", "IDE", "IDM", "IDR", "IDN",
+	"CW", "Reserved", "COND", "PMM", "PMI",
+	"DMM", "DMI",
+	NULL
+};
+
+/** 
+* Binary Opcode mapping; use eType for array indexing
+*/
+const sBinMapping sBinOp[] = 
+{
+	{ NULL                              ,  0 },
+	{ "0010"                            ,  4 }, /* 01a */
+	{ "11100000"                        ,  8 }, /* 01b */
+	{ "0011"                            ,  4 }, /* 01c */
+	{ "01010"                           ,  5 }, /* 03a */
+	{ "101000"                          ,  6 }, /* 03c */
+	{ "1100100"                         ,  7 }, /* 03d */
+	{ "11100001"                        ,  8 }, /* 03e */
+	{ "01011"                           ,  5 }, /* 03f */
+	{ "101001"                          ,  6 }, /* 03g */
+	{ "1100101"                         ,  7 }, /* 03h */
+	{ "11100010"                        ,  8 }, /* 03i */
+	{ "1100110"                         ,  7 }, /* 04a */
+	{ "1110111100"                      , 10 }, /* 04b */
+	{ "01100"                           ,  5 }, /* 04c */
+	{ "111010010"                       ,  9 }, /* 04d */
+	{ "1100111"                         ,  7 }, /* 04e */
+	{ "1110111101"                      , 10 }, /* 04f */
+	{ "01101"                           ,  5 }, /* 04g */
+	{ "111010011"                       ,  9 }, /* 04h */
+	{ "01110"                           ,  5 }, /* 06a */
+	{ "111010100"                       ,  9 }, /* 06b */
+	{ "000"                             ,  3 }, /* 06c */
+	{ "01111"                           ,  5 }, /* 06d */
+	{ "11100011"                        ,  8 }, /* 08a */
+	{ "111100010100"                    , 12 }, /* 08b */
+	{ "101010"                          ,  6 }, /* 08c */
+	{ "11110000100"                     , 11 }, /* 08d */
+	{ "1101000"                         ,  7 }, /* 09c */
+	{ "111010101"                       ,  9 }, /* 09d */
+	{ "11100100"                        ,  8 }, /* 09e */
+	{ "10000"                           ,  5 }, /* 09f */
+	{ "1111000110010"                   , 13 }, /* 09g */
+	{ "111100011100010"                 , 15 }, /* 09h */
+	{ "1101001"                         ,  7 }, /* 09i */
+	{ "1111000110011"                   , 13 }, /* 10a */
+	{ "111100011100011"                 , 15 }, /* 10b */
+	{ "1111000111010010"                , 16 }, /* 11a */
+	{ "10001"                           ,  5 }, /* 12e */
+	{ "1101010"                         ,  7 }, /* 12f */
+	{ "10010"                           ,  5 }, /* 12g */
+	{ "1101011"                         ,  7 }, /* 12h */
+	{ "101011"                          ,  6 }, /* 12m */
+	{ "1101100"                         ,  7 }, /* 12n */
+	{ "101100"                          ,  6 }, /* 12o */
+	{ "1101101"                         ,  7 }, /* 12p */
+	{ "101101"                          ,  6 }, /* 14c */
+	{ "111010110"                       ,  9 }, /* 14d */
+	{ "1101110"                         ,  7 }, /* 14k */
+	{ "111010111"                       ,  9 }, /* 14l */
+	{ "111011000"                       ,  9 }, /* 15a */
+	{ "11110000101"                     , 11 }, /* 15b */
+	{ "1110111110"                      , 10 }, /* 15c */
+	{ "111100010101"                    , 12 }, /* 15d */
+	{ "101110"                          ,  6 }, /* 15e */
+	{ "11100101"                        ,  8 }, /* 15f */
+	{ "111011001"                       ,  9 }, /* 16a */
+	{ "11110000110"                     , 11 }, /* 16b */
+	{ "11110000111"                     , 11 }, /* 16c */
+	{ "1111000110100"                   , 13 }, /* 16d */
+	{ "101111"                          ,  6 }, /* 16e */
+	{ "11100110"                        ,  8 }, /* 16f */
+	{ "111100011100100"                 , 15 }, /* 17a */
+	{ "11110001101100"                  , 14 }, /* 17b */
+	{ "111100011101010110000"           , 21 }, /* 17c */
+	{ "11110001110101000"               , 17 }, /* 17d */
+	{ "111100011100101"                 , 15 }, /* 17e */
+	{ "11110001110101011010010"         , 23 }, /* 17f */
+	{ "111100011100110"                 , 15 }, /* 17g */
+	{ "111100011101010100"              , 18 }, /* 17h */
+	{ "111011010"                       ,  9 }, /* 18a */
+	{ "111100011101010110001"           , 21 }, /* 18b */
+	{ "111100011101010110010"           , 21 }, /* 18c */
+	{ "11110001110101011010011"         , 23 }, /* 19a */
+	{ "11110001110101011010110110"      , 26 }, /* 20a */
+	{ "11100111"                        ,  8 }, /* 22a */
+	{ "11110001000"                     , 11 }, /* 23a */
+	{ "111100011101010110101000"        , 24 }, /* 25a */
+	{ "111100011101010110101001"        , 24 }, /* 25b */
+	{ "111100011101010110011"           , 21 }, /* 26a */
+	{ "111011011"                       ,  9 }, /* 29a */
+	{ "1110111111"                      , 10 }, /* 29b */
+	{ "111011100"                       ,  9 }, /* 29c */
+	{ "1111000000"                      , 10 }, /* 29d */
+	{ "111100011101010110101101110"     , 27 }, /* 30a */
+	{ "111100011101010110101101111"     , 27 }, /* 31a */
+	{ "11110001101101"                  , 14 }, /* 32a */
+	{ "111100011100111"                 , 15 }, /* 32b */
+	{ "11110001101110"                  , 14 }, /* 32c */
+	{ "111100011101000"                 , 15 }, /* 32d */
+	{ "1111000111010101101000"          , 22 }, /* 37a */
+	{ "11101000"                        ,  8 }, /* 40e */
+	{ "1111000001"                      , 10 }, /* 40f */
+	{ "111011101"                       ,  9 }, /* 40g */
+	{ "111100011101010110101010"        , 24 }, /* 41a */
+	{ "111100011101010110101011"        , 24 }, /* 41b */
+	{ "111100011101010110101100"        , 24 }, /* 41c */
+	{ "1111000111010101101011010"       , 25 }, /* 41d */
+	{ "1111000111010011"                , 16 }, /* 42a */
+	{ "111100011101010101"              , 18 }, /* 42b */
+	{ "110000"                          ,  6 }, /* 43a */
+	{ "0100"                            ,  4 }, /* 44b */
+	{ "10011"                           ,  5 }, /* 44d */
+	{ "110001"                          ,  6 }, /* 45b */
+	{ "1101111"                         ,  7 }, /* 45d */
+	{ "11110001001"                     , 11 }, /* 46a */
+	{ "1111000110101"                   , 13 }, /* 46b */
+	{ "11110001110101001"               , 17 }, /* 47a */
+	{ "111100011101010110101110000"     , 27 }, /* 48a */
+	{ "111100010110"                    , 12 }, /* 49a */
+	{ "11110001101111"                  , 14 }, /* 49b */
+	{ "111100010111"                    , 12 }, /* 49c */
+	{ "11110001110000"                  , 14 }, /* 49d */
+	{ "111100011000"                    , 12 }, /* 50a */
+};
+
+/** 
+* Instruction format: use eType for array indexing
+*/
+const sInstFormat sInstFormatTable[] = 
+{
+	{ {}, {} },		/* NULL */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fU, fU2, fDD, fPD, fPMM, fPMI, fDMM, fDMI, 0, },
+		{  4, 4, 2, 3, 3, 1, 1, 3, 3, 2, 2, 2, 2, 0, }
+	}, /* 01a */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fU, fU2, fDD, fPD, fPMM, fPMI, fDMM, fDMI, 0, },
+		{  8, 4, 2, 2, 2, 1, 1, 2, 2, 2, 2, 2, 2, 0, }
+	}, /* 01b */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fDD, fPD, fPMM, fPMI, fDMM, fDMI, 0, },
+		{  4, 4, 4, 3, 3, 3, 3, 2, 2, 2, 2, 0, }
+	}, /* 01c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  5, 6, 16, 5, 0, }
+	}, /* 03a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  6, 5, 16, 5, 0, }
+	}, /* 03c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fLSF, fCOND, 0, },
+		{  7, 3, 16, 1, 5, 0, }
+	}, /* 03d */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fLSF, fCOND, 0, },
+		{  8, 2, 16, 1, 5, 0, }
+	}, /* 03e */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  5, 6, 16, 5, 0, }
+	}, /* 03f */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  6, 5, 16, 5, 0, }
+	}, /* 03g */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fLSF, fCOND, 0, },
+		{  7, 3, 16, 1, 5, 0, }
+	}, /* 03h */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fLSF, fCOND, 0, },
+		{  8, 2, 16, 1, 5, 0, }
+	}, /* 03i */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 3, 3, 6, 1, 3, 3, 0, }
+	}, /* 04a */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{ 10, 4, 2, 2, 2, 5, 1, 3, 3, 0, }
+	}, /* 04b */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  5, 4, 4, 3, 3, 6, 1, 3, 3, 0, }
+	}, /* 04c */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  9, 4, 3, 2, 2, 5, 1, 3, 3, 0, }
+	}, /* 04d */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 3, 3, 6, 1, 3, 3, 0, }
+	}, /* 04e */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{ 10, 4, 2, 2, 2, 5, 1, 3, 3, 0, }
+	}, /* 04f */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  5, 4, 4, 3, 3, 6, 1, 3, 3, 0, }
+	}, /* 04g */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  9, 4, 3, 2, 2, 5, 1, 3, 3, 0, }
+	}, /* 04h */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  5, 6, 16, 5, 0, }
+	}, /* 06a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{  9, 6, 12, 5, 0, }
+	}, /* 06b */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, 0, },
+		{  3, 5, 24, 0, }
+	}, /* 06c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, 0, },
+		{  5, 3, 24, 0, }
+	}, /* 06d */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fDSTLS, fSRCLS, 0, },
+		{  8, 4, 2, 3, 3, 6, 6, 0, }
+	}, /* 08a */
+	{ 
+		{ fOpcodeType, fMF, fDSTM, fSRCM1, fSRCM2, fDSTLS, fSRCLS, 0, },
+		{ 12, 4, 2, 2, 2, 5, 5, 0, }
+	}, /* 08b */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fDSTLS, fSRCLS, 0, },
+		{  6, 4, 4, 3, 3, 6, 6, 0, }
+	}, /* 08c */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fDSTLS, fSRCLS, 0, },
+		{ 11, 4, 3, 2, 2, 5, 5, 0, }
+	}, /* 08d */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fCOND, 0, },
+		{  7, 4, 6, 5, 5, 5, 0, }
+	}, /* 09c */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fCONJ, fCOND, 0, },
+		{  9, 4, 5, 4, 4, 1, 5, 0, }
+	}, /* 09d */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fCOND, 0, },
+		{  8, 4, 6, 5, 4, 5, 0, }
+	}, /* 09e */
+	{ 
+		{ fOpcodeType, fAF, fDSTA, fSRCA1, fSRCA2, fCONJ, fCOND, 0, },
+		{  5, 4, 5, 4, 8, 1, 5, 0, }
+	}, /* 09f */
+	{ 
+		{ fOpcodeType, fAMF, fDSTM, fSRCM1, fSRCM2, fCOND, 0, },
+		{ 13, 5, 3, 3, 3, 5, 0, }
+	}, /* 09g */
+	{ 
+		{ fOpcodeType, fAMF, fDSTM, fSRCM1, fSRCM2, fCONJ, fCOND, 0, },
+		{ 15, 5, 2, 2, 2, 1, 5, 0, }
+	}, /* 09h */
+	{ 
+		{ fOpcodeType, fAF, fYZ, fDSTA, fSRCA1, fSRCA2, fCOND, 0, },
+		{  7, 4, 1, 6, 5, 4, 5, 0, }
+	}, /* 09i */
+	{ 
+		{ fOpcodeType, fDSTB, fS, fCOND, 0, },
+		{ 13, 13, 1, 5, 0, }
+	}, /* 10a */
+	{ 
+		{ fOpcodeType, fDSTB, fS, 0, },
+		{ 15, 16, 1, 0, }
+	}, /* 10b */
+	{ 
+		{ fOpcodeType, fDSTB, fTERM, 0, },
+		{ 16, 12, 4, 0, }
+	}, /* 11a */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  5, 4, 2, 3, 5, 6, 1, 3, 3, 0, }
+	}, /* 12e */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 2, 5, 5, 1, 3, 3, 0, }
+	}, /* 12f */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  5, 4, 2, 3, 5, 6, 1, 3, 3, 0, }
+	}, /* 12g */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 2, 5, 5, 1, 3, 3, 0, }
+	}, /* 12h */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  6, 4, 2, 2, 5, 6, 1, 3, 3, 0, }
+	}, /* 12m */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 2, 5, 5, 1, 3, 3, 0, }
+	}, /* 12n */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  6, 4, 2, 2, 5, 6, 1, 3, 3, 0, }
+	}, /* 12o */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fSRCLS, fU, fDMM, fDMI, 0, },
+		{  7, 4, 2, 2, 5, 5, 1, 3, 3, 0, }
+	}, /* 12p */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fSRCLS, 0, },
+		{  6, 4, 2, 3, 5, 6, 6, 0, }
+	}, /* 14c */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fSRCLS, 0, },
+		{  9, 4, 2, 2, 5, 5, 5, 0, }
+	}, /* 14d */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fSRCLS, 0, },
+		{  7, 4, 2, 2, 5, 6, 6, 0, }
+	}, /* 14k */
+	{ 
+		{ fOpcodeType, fSF2, fDSTS, fSRCS1, fSRCS2, fDSTLS, fSRCLS, 0, },
+		{  9, 4, 2, 2, 5, 5, 5, 0, }
+	}, /* 14l */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  9, 5, 3, 5, 5, 5, 0, }
+	}, /* 15a */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{ 11, 5, 2, 4, 5, 5, 0, }
+	}, /* 15b */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{ 10, 5, 3, 3, 6, 5, 0, }
+	}, /* 15c */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{ 12, 5, 2, 2, 6, 5, 0, }
+	}, /* 15d */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  6, 5, 6, 5, 5, 5, 0, }
+	}, /* 15e */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  8, 5, 5, 4, 5, 5, 0, }
+	}, /* 15f */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  9, 5, 3, 5, 5, 5, 0, }
+	}, /* 16a */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{ 11, 5, 2, 4, 5, 5, 0, }
+	}, /* 16b */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fCOND, 0, },
+		{ 11, 5, 6, 5, 5, 0, }
+	}, /* 16c */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fCOND, 0, },
+		{ 13, 5, 5, 4, 5, 0, }
+	}, /* 16d */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  6, 5, 6, 5, 5, 5, 0, }
+	}, /* 16e */
+	{ 
+		{ fOpcodeType, fSF, fDSTS, fSRCS1, fSRCS2, fCOND, 0, },
+		{  8, 5, 5, 4, 5, 5, 0, }
+	}, /* 16f */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 15, 6, 6, 5, 0, }
+	}, /* 17a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fDC, fCOND, 0, },
+		{ 14, 6, 6, 1, 5, 0, }
+	}, /* 17b */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 21, 3, 3, 5, 0, }
+	}, /* 17c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 17, 5, 5, 5, 0, }
+	}, /* 17d */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fDC, fCOND, 0, },
+		{ 15, 5, 6, 1, 5, 0, }
+	}, /* 17e */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 23, 2, 2, 5, 0, }
+	}, /* 17f */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 15, 6, 6, 5, 0, }
+	}, /* 17g */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fCOND, 0, },
+		{ 18, 3, 6, 5, 0, }
+	}, /* 17h */
+	{ 
+		{ fOpcodeType, fENA, fCOND, 0, },
+		{  9, 18, 5, 0, }
+	}, /* 18a */
+	{ 
+		{ fOpcodeType, fIDE, fIDM, fCOND, 0, },
+		{ 21, 4, 2, 5, 0, }
+	}, /* 18b */
+	{ 
+		{ fOpcodeType, fDSTID, fCOND, 0, },
+		{ 21, 6, 5, 0, }
+	}, /* 18c */
+	{ 
+		{ fOpcodeType, fS, fCOND, fDMI, 0, },
+		{ 23, 1, 5, 3, 0, }
+	}, /* 19a */
+	{ 
+		{ fOpcodeType, fT, fCOND, 0, },
+		{ 26, 1, 5, 0, }
+	}, /* 20a */
+	{ 
+		{ fOpcodeType, fDSTLS, fU, fCOND, fDMM, fDMI, 0, },
+		{  8, 12, 1, 5, 3, 3, 0, }
+	}, /* 22a */
+	{ 
+		{ fOpcodeType, fDSTA, fSRCA1, fSRCA2, fDF, fCOND, 0, },
+		{ 11, 5, 5, 5, 1, 5, 0, }
+	}, /* 23a */
+	{ 
+		{ fOpcodeType, fDSTM, fCOND, 0, },
+		{ 24, 3, 5, 0, }
+	}, /* 25a */
+	{ 
+		{ fOpcodeType, fDSTM, fCONJ, fCOND, 0, },
+		{ 24, 2, 1, 5, 0, }
+	}, /* 25b */
+	{ 
+		{ fOpcodeType, fLPP, fPPP, fSPP, fCOND, 0, },
+		{ 21, 2, 2, 2, 5, 0, }
+	}, /* 26a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fU, fCOND, fDMI, 0, },
+		{  9, 6, 8, 1, 5, 3, 0, }
+	}, /* 29a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fU, fCOND, fDMI, 0, },
+		{ 10, 5, 8, 1, 5, 3, 0, }
+	}, /* 29b */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fU, fCOND, fDMI, 0, },
+		{  9, 6, 8, 1, 5, 3, 0, }
+	}, /* 29c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fU, fCOND, fDMI, 0, },
+		{ 10, 5, 8, 1, 5, 3, 0, }
+	}, /* 29d */
+	{ 
+		{ fOpcodeType, fCOND, 0, },
+		{ 27, 5, 0, }
+	}, /* 30a */
+	{ 
+		{ fOpcodeType, fCOND, 0, },
+		{ 27, 5, 0, }
+	}, /* 31a */
+	{ 
+		{ fOpcodeType, fDSTLS, fU, fCOND, fDMM, fDMI, 0, },
+		{ 14, 6, 1, 5, 3, 3, 0, }
+	}, /* 32a */
+	{ 
+		{ fOpcodeType, fDSTLS, fU, fCOND, fDMM, fDMI, 0, },
+		{ 15, 5, 1, 5, 3, 3, 0, }
+	}, /* 32b */
+	{ 
+		{ fOpcodeType, fDSTLS, fU, fCOND, fDMM, fDMI, 0, },
+		{ 14, 6, 1, 5, 3, 3, 0, }
+	}, /* 32c */
+	{ 
+		{ fOpcodeType, fDSTLS, fU, fCOND, fDMM, fDMI, 0, },
+		{ 15, 5, 1, 5, 3, 3, 0, }
+	}, /* 32d */
+	{ 
+		{ fOpcodeType, fINTN, fC, fCOND, 0, },
+		{ 22, 4, 1, 5, 0, }
+	}, /* 37a */
+	{ 
+		{ fOpcodeType, fAMF, fDSTM, fSRCM1, fSRCM2, fMN, fCOND, 0, },
+		{  8, 5, 3, 5, 5, 1, 5, 0, }
+	}, /* 40e */
+	{ 
+		{ fOpcodeType, fAMF, fDSTM, fSRCM1, fSRCM2, fCONJ, fMN, fCOND, 0, },
+		{ 10, 5, 2, 4, 4, 1, 1, 5, 0, }
+	}, /* 40f */
+	{ 
+		{ fOpcodeType, fAMF, fDSTM, fSRCM1, fSRCM2, fCONJ, fMN, fCOND, 0, },
+		{  9, 5, 2, 5, 4, 1, 1, 5, 0, }
+	}, /* 40g */
+	{ 
+		{ fOpcodeType, fDSTM, fCOND, 0, },
+		{ 24, 3, 5, 0, }
+	}, /* 41a */
+	{ 
+		{ fOpcodeType, fDSTM, fCONJ, fCOND, 0, },
+		{ 24, 2, 1, 5, 0, }
+	}, /* 41b */
+	{ 
+		{ fOpcodeType, fDSTM, fCOND, 0, },
+		{ 24, 3, 5, 0, }
+	}, /* 41c */
+	{ 
+		{ fOpcodeType, fDSTM, fCOND, 0, },
+		{ 25, 2, 5, 0, }
+	}, /* 41d */
+	{ 
+		{ fOpcodeType, fDSTC, fSRCC, fCONJ, fPOLAR, fCOND, 0, },
+		{ 16, 5, 4, 1, 1, 5, 0, }
+	}, /* 42a */
+	{ 
+		{ fOpcodeType, fDSTC, fSRCC, fCOND, 0, },
+		{ 18, 5, 4, 5, 0, }
+	}, /* 42b */
+	{ 
+		{ fOpcodeType, fAF, fMF, fDSTA, fSRCA1, fSRCA2, fDSTM, fSRCM1, fSRCM2, 0, },
+		{  6, 4, 4, 4, 3, 3, 2, 3, 3, 0, }
+	}, /* 43a */
+	{ 
+		{ fOpcodeType, fSF2, fAF, fDSTA, fSRCA1, fSRCA2, fDSTS, fSRCS1, fSRCS2, 0, },
+		{  4, 4, 4, 4, 3, 3, 2, 3, 5, 0, }
+	}, /* 44b */
+	{ 
+		{ fOpcodeType, fSF2, fAF, fDSTA, fSRCA1, fSRCA2, fDSTS, fSRCS1, fSRCS2, 0, },
+		{  5, 4, 4, 4, 3, 3, 2, 2, 5, 0, }
+	}, /* 44d */
+	{ 
+		{ fOpcodeType, fSF2, fMF, fDSTM, fSRCM1, fSRCM2, fDSTS, fSRCS1, fSRCS2, 0, },
+		{  6, 4, 4, 2, 3, 3, 2, 3, 5, 0, }
+	}, /* 45b */
+	{ 
+		{ fOpcodeType, fSF2, fMF, fDSTM, fSRCM1, fSRCM2, fDSTS, fSRCS1, fSRCS2, 0, },
+		{  7, 4, 4, 2, 3, 3, 2, 2, 5, 0, }
+	}, /* 45d */
+	{ 
+		{ fOpcodeType, fDSTA, fSRCA1, fSRCA2, fCOND, 0, },
+		{ 11, 6, 5, 5, 5, 0, }
+	}, /* 46a */
+	{ 
+		{ fOpcodeType, fDSTA, fSRCA1, fSRCA2, fCONJ, fCOND, 0, },
+		{ 13, 5, 4, 4, 1, 5, 0, }
+	}, /* 46b */
+	{ 
+		{ fOpcodeType, fDSTC, fSRCC, fCONJ, fCOND, 0, },
+		{ 17, 5, 4, 1, 5, 0, }
+	}, /* 47a */
+	{ 
+		{ fOpcodeType, fCOND, 0, },
+		{ 27, 5, 0, }
+	}, /* 48a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fIDR, fIDN, fCOND, 0, },
+		{ 12, 6, 3, 2, 4, 5, 0, }
+	}, /* 49a */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fIDR, fIDN, fCOND, 0, },
+		{ 14, 5, 2, 2, 4, 5, 0, }
+	}, /* 49b */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fIDR, fIDN, fCOND, 0, },
+		{ 12, 3, 6, 2, 4, 5, 0, }
+	}, /* 49c */
+	{ 
+		{ fOpcodeType, fDSTLS, fSRCLS, fIDR, fIDN, fCOND, 0, },
+		{ 14, 2, 5, 2, 4, 5, 0, }
+	}, /* 49d */
+	{ 
+		{ fOpcodeType, fDSTA, fSRCA1, fSRCA2, fCW, fCOND, 0, },
+		{ 12, 5, 4, 5, 1, 5, 0, }
+	}, /* 50a */
+};
+
+/** 
+* @brief Decode instruction type from opcode bits.
+* 
+* @param w Instruction word (MSB: first bit of opcode)
+* 
+* @return eType value, or 0 if no type matches
+*/
+int isaDecode(unsigned int w)
+{
+	switch((w >> 24) & 0xFF){
+		case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07:
+		case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F:
+		case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+		case 0x18: case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F:
+			return t06c;
+		case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+		case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F:
+			return t01a;
+		case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+		case 0x38: case 0x39: case 0x3A: case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F:
+			return t01c;
+		case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+		case 0x48: case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F:
+			return t44b;
+		case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+			return t03a;
+		case 0x58: case 0x59: case 0x5A: case 0x5B: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+			return t03f;
+		case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+			return t04c;
+		case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+			return t04g;
+		case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+			return t06a;
+		case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D: case 0x7E: case 0x7F:
+			return t06d;
+		case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:
+			return t09f;
+		case 0x88: case 0x89: case 0x8A: case 0x8B: case 0x8C: case 0x8D: case 0x8E: case 0x8F:
+			return t12e;
+		case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:
+			return t12g;
+		case 0x98: case 0x99: case 0x9A: case 0x9B: case 0x9C: case 0x9D: case 0x9E: case 0x9F:
+			return t44d;
+		case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+			return t03c;
+		case 0xA4: case 0xA5: case 0xA6: case 0xA7:
+			return t03g;
+		case 0xA8: case 0xA9: case 0xAA: case 0xAB:
+			return t08c;
+		case 0xAC: case 0xAD: case 0xAE: case 0xAF:
+			return t12m;
+		case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+			return t12o;
+		case 0xB4: case 0xB5: case 0xB6: case 0xB7:
+			return t14c;
+		case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+			return t15e;
+		case 0xBC: case 0xBD: case 0xBE: case 0xBF:
+			return t16e;
+		case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+			return t43a;
+		case 0xC4: case 0xC5: case 0xC6: case 0xC7:
+			return t45b;
+		case 0xC8: case 0xC9:
+			return t03d;
+		case 0xCA: case 0xCB:
+			return t03h;
+		case 0xCC: case 0xCD:
+			return t04a;
+		case 0xCE: case 0xCF:
+			return t04e;
+		case 0xD0: case 0xD1:
+			return t09c;
+		case 0xD2: case 0xD3:
+			return t09i;
+		case 0xD4: case 0xD5:
+			return t12f;
+		case 0xD6: case 0xD7:
+			return t12h;
+		case 0xD8: case 0xD9:
+			return t12n;
+		case 0xDA: case 0xDB:
+			return t12p;
+		case 0xDC: case 0xDD:
+			return t14k;
+		case 0xDE: case 0xDF:
+			return t45d;
+		case 0xE0:
+			return t01b;
+		case 0xE1:
+			return t03e;
+		case 0xE2:
+			return t03i;
+		case 0xE3:
+			return t08a;
+		case 0xE4:
+			return t09e;
+		case 0xE5:
+			return t15f;
+		case 0xE6:
+			return t16f;
+		case 0xE7:
+			return t22a;
+		case 0xE8:
+			return t40e;
+		case 0xE9:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t04d;
+				case 0x01:
+					return t04h;
+				default:
+					return 0;
+			}
+		case 0xEA:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t06b;
+				case 0x01:
+					return t09d;
+				default:
+					return 0;
+			}
+		case 0xEB:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t14d;
+				case 0x01:
+					return t14l;
+				default:
+					return 0;
+			}
+		case 0xEC:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t15a;
+				case 0x01:
+					return t16a;
+				default:
+					return 0;
+			}
+		case 0xED:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t18a;
+				case 0x01:
+					return t29a;
+				default:
+					return 0;
+			}
+		case 0xEE:
+			switch((w >> 23) & 0x1){
+				case 0x00:
+					return t29c;
+				case 0x01:
+					return t40g;
+				default:
+					return 0;
+			}
+		case 0xEF:
+			switch((w >> 22) & 0x3){
+				case 0x00:
+					return t04b;
+				case 0x01:
+					return t04f;
+				case 0x02:
+					return t15c;
+				case 0x03:
+					return t29b;
+				default:
+					return 0;
+			}
+		case 0xF0:
+			switch((w >> 21) & 0x7){
+				case 0x00: case 0x01:
+					return t29d;
+				case 0x02: case 0x03:
+					return t40f;
+				case 0x04:
+					return t08d;
+				case 0x05:
+					return t15b;
+				case 0x06:
+					return t16b;
+				case 0x07:
+					return t16c;
+				default:
+					return 0;
+			}
+		case 0xF1:
+			switch((w >> 16) & 0xFF){
+				case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07:
+				case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F:
+				case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+				case 0x18: case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F:
+					return t23a;
+				case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+				case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F:
+				case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+				case 0x38: case 0x39: case 0x3A: case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F:
+					return t46a;
+				case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+				case 0x48: case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F:
+					return t08b;
+				case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+				case 0x58: case 0x59: case 0x5A: case 0x5B: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+					return t15d;
+				case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+				case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+					return t49a;
+				case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+				case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D: case 0x7E: case 0x7F:
+					return t49c;
+				case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:
+				case 0x88: case 0x89: case 0x8A: case 0x8B: case 0x8C: case 0x8D: case 0x8E: case 0x8F:
+					return t50a;
+				case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:
+					return t09g;
+				case 0x98: case 0x99: case 0x9A: case 0x9B: case 0x9C: case 0x9D: case 0x9E: case 0x9F:
+					return t10a;
+				case 0xA0: case 0xA1: case 0xA2: case 0xA3: case 0xA4: case 0xA5: case 0xA6: case 0xA7:
+					return t16d;
+				case 0xA8: case 0xA9: case 0xAA: case 0xAB: case 0xAC: case 0xAD: case 0xAE: case 0xAF:
+					return t46b;
+				case 0xB0: case 0xB1: case 0xB2: case 0xB3:
+					return t17b;
+				case 0xB4: case 0xB5: case 0xB6: case 0xB7:
+					return t32a;
+				case 0xB8: case 0xB9: case 0xBA: case 0xBB:
+					return t32c;
+				case 0xBC: case 0xBD: case 0xBE: case 0xBF:
+					return t49b;
+				case 0xC0: case 0xC1: case 0xC2: case 0xC3:
+					return t49d;
+				case 0xC4: case 0xC5:
+					return t09h;
+				case 0xC6: case 0xC7:
+					return t10b;
+				case 0xC8: case 0xC9:
+					return t17a;
+				case 0xCA: case 0xCB:
+					return t17e;
+				case 0xCC: case 0xCD:
+					return t17g;
+				case 0xCE: case 0xCF:
+					return t32b;
+				case 0xD0: case 0xD1:
+					return t32d;
+				case 0xD2:
+					return t11a;
+				case 0xD3:
+					return t42a;
+				case 0xD4:
+					switch((w >> 15) & 0x1){
+						case 0x00:
+							return t17d;
+						case 0x01:
+							return t47a;
+						default:
+							return 0;
+					}
+				case 0xD5:
+					switch((w >> 8) & 0xFF){
+						case 0x00: case 0x01: case 0x02: case 0x03: case 0x04: case 0x05: case 0x06: case 0x07:
+						case 0x08: case 0x09: case 0x0A: case 0x0B: case 0x0C: case 0x0D: case 0x0E: case 0x0F:
+						case 0x10: case 0x11: case 0x12: case 0x13: case 0x14: case 0x15: case 0x16: case 0x17:
+						case 0x18: case 0x19: case 0x1A: case 0x1B: case 0x1C: case 0x1D: case 0x1E: case 0x1F:
+						case 0x20: case 0x21: case 0x22: case 0x23: case 0x24: case 0x25: case 0x26: case 0x27:
+						case 0x28: case 0x29: case 0x2A: case 0x2B: case 0x2C: case 0x2D: case 0x2E: case 0x2F:
+						case 0x30: case 0x31: case 0x32: case 0x33: case 0x34: case 0x35: case 0x36: case 0x37:
+						case 0x38: case 0x39: case 0x3A: case 0x3B: case 0x3C: case 0x3D: case 0x3E: case 0x3F:
+							return t17h;
+						case 0x40: case 0x41: case 0x42: case 0x43: case 0x44: case 0x45: case 0x46: case 0x47:
+						case 0x48: case 0x49: case 0x4A: case 0x4B: case 0x4C: case 0x4D: case 0x4E: case 0x4F:
+						case 0x50: case 0x51: case 0x52: case 0x53: case 0x54: case 0x55: case 0x56: case 0x57:
+						case 0x58: case 0x59: case 0x5A: case 0x5B: case 0x5C: case 0x5D: case 0x5E: case 0x5F:
+						case 0x60: case 0x61: case 0x62: case 0x63: case 0x64: case 0x65: case 0x66: case 0x67:
+						case 0x68: case 0x69: case 0x6A: case 0x6B: case 0x6C: case 0x6D: case 0x6E: case 0x6F:
+						case 0x70: case 0x71: case 0x72: case 0x73: case 0x74: case 0x75: case 0x76: case 0x77:
+						case 0x78: case 0x79: case 0x7A: case 0x7B: case 0x7C: case 0x7D: case 0x7E: case 0x7F:
+							return t42b;
+						case 0x80: case 0x81: case 0x82: case 0x83: case 0x84: case 0x85: case 0x86: case 0x87:
+							return t17c;
+						case 0x88: case 0x89: case 0x8A: case 0x8B: case 0x8C: case 0x8D: case 0x8E: case 0x8F:
+							return t18b;
+						case 0x90: case 0x91: case 0x92: case 0x93: case 0x94: case 0x95: case 0x96: case 0x97:
+							return t18c;
+						case 0x98: case 0x99: case 0x9A: case 0x9B: case 0x9C: case 0x9D: case 0x9E: case 0x9F:
+							return t26a;
+						case 0xA0: case 0xA1: case 0xA2: case 0xA3:
+							return t37a;
+						case 0xA4: case 0xA5:
+							return t17f;
+						case 0xA6: case 0xA7:
+							return t19a;
+						case 0xA8:
+							return t25a;
+						case 0xA9:
+							return t25b;
+						case 0xAA:
+							return t41a;
+						case 0xAB:
+							return t41b;
+						case 0xAC:
+							return t41c;
+						case 0xAD:
+							switch((w >> 5) & 0x7){
+								case 0x00: case 0x01: case 0x02: case 0x03:
+									return t41d;
+								case 0x04: case 0x05:
+									return t20a;
+								case 0x06:
+									return t30a;
+								case 0x07:
+									return t31a;
+								default:
+									return 0;
+							}
+						case 0xAE:
+							return (((w >> 5) & 0x7) == 0x0) ? t48a : 0;
+						default:
+							return 0;
+					}
+				default:
+					return 0;
+			}
+		default:
+			return 0;
+	}
+}
+
+/** 
+* @brief Extract a field of an instruction word.
+* 
+* @param type eType value of the instruction
+* @param field eField value
+* @param w Instruction word
+* 
+* @return Field value, or ISA_NO_FIELD if type has no such field
+*/
+int isaGetField(int type, int field, unsigned int w)
+{
+	switch(type){
+		case t01a:
+			switch(field){
+				case fOpcodeType:	return w >> 28;
+				case fMF:	return (w >> 24) & 0xF;
+				case fDSTM:	return (w >> 22) & 0x3;
+				case fSRCM1:	return (w >> 19) & 0x7;
+				case fSRCM2:	return (w >> 16) & 0x7;
+				case fU:	return (w >> 15) & 0x1;
+				case fU2:	return (w >> 14) & 0x1;
+				case fDD:	return (w >> 11) & 0x7;
+				case fPD:	return (w >> 8) & 0x7;
+				case fPMM:	return (w >> 6) & 0x3;
+				case fPMI:	return (w >> 4) & 0x3;
+				case fDMM:	return (w >> 2) & 0x3;
+				case fDMI:	return (w >> 0) & 0x3;
+			}
+			break;
+		case t01b:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fMF:	return (w >> 20) & 0xF;
+				case fDSTM:	return (w >> 18) & 0x3;
+				case fSRCM1:	return (w >> 16) & 0x3;
+				case fSRCM2:	return (w >> 14) & 0x3;
+				case fU:	return (w >> 13) & 0x1;
+				case fU2:	return (w >> 12) & 0x1;
+				case fDD:	return (w >> 10) & 0x3;
+				case fPD:	return (w >> 8) & 0x3;
+				case fPMM:	return (w >> 6) & 0x3;
+				case fPMI:	return (w >> 4) & 0x3;
+				case fDMM:	return (w >> 2) & 0x3;
+				case fDMI:	return (w >> 0) & 0x3;
+			}
+			break;
+		case t01c:
+			switch(field){
+				case fOpcodeType:	return w >> 28;
+				case fAF:	return (w >> 24) & 0xF;
+				case fDSTA:	return (w >> 20) & 0xF;
+				case fSRCA1:	return (w >> 17) & 0x7;
+				case fSRCA2:	return (w >> 14) & 0x7;
+				case fDD:	return (w >> 11) & 0x7;
+				case fPD:	return (w >> 8) & 0x7;
+				case fPMM:	return (w >> 6) & 0x3;
+				case fPMI:	return (w >> 4) & 0x3;
+				case fDMM:	return (w >> 2) & 0x3;
+				case fDMI:	return (w >> 0) & 0x3;
+			}
+			break;
+		case t03a:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fDSTLS:	return (w >> 21) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0xFFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03c:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fDSTLS:	return (w >> 21) & 0x1F;
+				case fSRCLS:	return (w >> 5) & 0xFFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03d:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fDSTLS:	return (w >> 22) & 0x7;
+				case fSRCLS:	return (w >> 6) & 0xFFFF;
+				case fLSF:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03e:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fDSTLS:	return (w >> 22) & 0x3;
+				case fSRCLS:	return (w >> 6) & 0xFFFF;
+				case fLSF:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03f:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fDSTLS:	return (w >> 21) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0xFFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03g:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fDSTLS:	return (w >> 21) & 0x1F;
+				case fSRCLS:	return (w >> 5) & 0xFFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03h:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fDSTLS:	return (w >> 22) & 0x7;
+				case fSRCLS:	return (w >> 6) & 0xFFFF;
+				case fLSF:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t03i:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fDSTLS:	return (w >> 22) & 0x3;
+				case fSRCLS:	return (w >> 6) & 0xFFFF;
+				case fLSF:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t04a:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fMF:	return (w >> 21) & 0xF;
+				case fDSTM:	return (w >> 19) & 0x3;
+				case fSRCM1:	return (w >> 16) & 0x7;
+				case fSRCM2:	return (w >> 13) & 0x7;
+				case fDSTLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04b:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fMF:	return (w >> 18) & 0xF;
+				case fDSTM:	return (w >> 16) & 0x3;
+				case fSRCM1:	return (w >> 14) & 0x3;
+				case fSRCM2:	return (w >> 12) & 0x3;
+				case fDSTLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04c:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fAF:	return (w >> 23) & 0xF;
+				case fDSTA:	return (w >> 19) & 0xF;
+				case fSRCA1:	return (w >> 16) & 0x7;
+				case fSRCA2:	return (w >> 13) & 0x7;
+				case fDSTLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04d:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fAF:	return (w >> 19) & 0xF;
+				case fDSTA:	return (w >> 16) & 0x7;
+				case fSRCA1:	return (w >> 14) & 0x3;
+				case fSRCA2:	return (w >> 12) & 0x3;
+				case fDSTLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04e:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fMF:	return (w >> 21) & 0xF;
+				case fDSTM:	return (w >> 19) & 0x3;
+				case fSRCM1:	return (w >> 16) & 0x7;
+				case fSRCM2:	return (w >> 13) & 0x7;
+				case fSRCLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04f:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fMF:	return (w >> 18) & 0xF;
+				case fDSTM:	return (w >> 16) & 0x3;
+				case fSRCM1:	return (w >> 14) & 0x3;
+				case fSRCM2:	return (w >> 12) & 0x3;
+				case fSRCLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04g:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fAF:	return (w >> 23) & 0xF;
+				case fDSTA:	return (w >> 19) & 0xF;
+				case fSRCA1:	return (w >> 16) & 0x7;
+				case fSRCA2:	return (w >> 13) & 0x7;
+				case fSRCLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t04h:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fAF:	return (w >> 19) & 0xF;
+				case fDSTA:	return (w >> 16) & 0x7;
+				case fSRCA1:	return (w >> 14) & 0x3;
+				case fSRCA2:	return (w >> 12) & 0x3;
+				case fSRCLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t06a:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fDSTLS:	return (w >> 21) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0xFFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t06b:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fDSTLS:	return (w >> 17) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0xFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t06c:
+			switch(field){
+				case fOpcodeType:	return w >> 29;
+				case fDSTLS:	return (w >> 24) & 0x1F;
+				case fSRCLS:	return (w >> 0) & 0xFFFFFF;
+			}
+			break;
+		case t06d:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fDSTLS:	return (w >> 24) & 0x7;
+				case fSRCLS:	return (w >> 0) & 0xFFFFFF;
+			}
+			break;
+		case t08a:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fMF:	return (w >> 20) & 0xF;
+				case fDSTM:	return (w >> 18) & 0x3;
+				case fSRCM1:	return (w >> 15) & 0x7;
+				case fSRCM2:	return (w >> 12) & 0x7;
+				case fDSTLS:	return (w >> 6) & 0x3F;
+				case fSRCLS:	return (w >> 0) & 0x3F;
+			}
+			break;
+		case t08b:
+			switch(field){
+				case fOpcodeType:	return w >> 20;
+				case fMF:	return (w >> 16) & 0xF;
+				case fDSTM:	return (w >> 14) & 0x3;
+				case fSRCM1:	return (w >> 12) & 0x3;
+				case fSRCM2:	return (w >> 10) & 0x3;
+				case fDSTLS:	return (w >> 5) & 0x1F;
+				case fSRCLS:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t08c:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fAF:	return (w >> 22) & 0xF;
+				case fDSTA:	return (w >> 18) & 0xF;
+				case fSRCA1:	return (w >> 15) & 0x7;
+				case fSRCA2:	return (w >> 12) & 0x7;
+				case fDSTLS:	return (w >> 6) & 0x3F;
+				case fSRCLS:	return (w >> 0) & 0x3F;
+			}
+			break;
+		case t08d:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fAF:	return (w >> 17) & 0xF;
+				case fDSTA:	return (w >> 14) & 0x7;
+				case fSRCA1:	return (w >> 12) & 0x3;
+				case fSRCA2:	return (w >> 10) & 0x3;
+				case fDSTLS:	return (w >> 5) & 0x1F;
+				case fSRCLS:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09c:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fAF:	return (w >> 21) & 0xF;
+				case fDSTA:	return (w >> 15) & 0x3F;
+				case fSRCA1:	return (w >> 10) & 0x1F;
+				case fSRCA2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09d:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fAF:	return (w >> 19) & 0xF;
+				case fDSTA:	return (w >> 14) & 0x1F;
+				case fSRCA1:	return (w >> 10) & 0xF;
+				case fSRCA2:	return (w >> 6) & 0xF;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09e:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fAF:	return (w >> 20) & 0xF;
+				case fDSTA:	return (w >> 14) & 0x3F;
+				case fSRCA1:	return (w >> 9) & 0x1F;
+				case fSRCA2:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09f:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fAF:	return (w >> 23) & 0xF;
+				case fDSTA:	return (w >> 18) & 0x1F;
+				case fSRCA1:	return (w >> 14) & 0xF;
+				case fSRCA2:	return (w >> 6) & 0xFF;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09g:
+			switch(field){
+				case fOpcodeType:	return w >> 19;
+				case fAMF:	return (w >> 14) & 0x1F;
+				case fDSTM:	return (w >> 11) & 0x7;
+				case fSRCM1:	return (w >> 8) & 0x7;
+				case fSRCM2:	return (w >> 5) & 0x7;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09h:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fAMF:	return (w >> 12) & 0x1F;
+				case fDSTM:	return (w >> 10) & 0x3;
+				case fSRCM1:	return (w >> 8) & 0x3;
+				case fSRCM2:	return (w >> 6) & 0x3;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t09i:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fAF:	return (w >> 21) & 0xF;
+				case fYZ:	return (w >> 20) & 0x1;
+				case fDSTA:	return (w >> 14) & 0x3F;
+				case fSRCA1:	return (w >> 9) & 0x1F;
+				case fSRCA2:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t10a:
+			switch(field){
+				case fOpcodeType:	return w >> 19;
+				case fDSTB:	return (w >> 6) & 0x1FFF;
+				case fS:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t10b:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTB:	return (w >> 1) & 0xFFFF;
+				case fS:	return (w >> 0) & 0x1;
+			}
+			break;
+		case t11a:
+			switch(field){
+				case fOpcodeType:	return w >> 16;
+				case fDSTB:	return (w >> 4) & 0xFFF;
+				case fTERM:	return (w >> 0) & 0xF;
+			}
+			break;
+		case t12e:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fSF2:	return (w >> 23) & 0xF;
+				case fDSTS:	return (w >> 21) & 0x3;
+				case fSRCS1:	return (w >> 18) & 0x7;
+				case fSRCS2:	return (w >> 13) & 0x1F;
+				case fDSTLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12f:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fDSTS:	return (w >> 19) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x3;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fDSTLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12g:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fSF2:	return (w >> 23) & 0xF;
+				case fDSTS:	return (w >> 21) & 0x3;
+				case fSRCS1:	return (w >> 18) & 0x7;
+				case fSRCS2:	return (w >> 13) & 0x1F;
+				case fSRCLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12h:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fDSTS:	return (w >> 19) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x3;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fSRCLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12m:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF2:	return (w >> 22) & 0xF;
+				case fDSTS:	return (w >> 20) & 0x3;
+				case fSRCS1:	return (w >> 18) & 0x3;
+				case fSRCS2:	return (w >> 13) & 0x1F;
+				case fDSTLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12n:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fDSTS:	return (w >> 19) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x3;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fDSTLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12o:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF2:	return (w >> 22) & 0xF;
+				case fDSTS:	return (w >> 20) & 0x3;
+				case fSRCS1:	return (w >> 18) & 0x3;
+				case fSRCS2:	return (w >> 13) & 0x1F;
+				case fSRCLS:	return (w >> 7) & 0x3F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t12p:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fDSTS:	return (w >> 19) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x3;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fSRCLS:	return (w >> 7) & 0x1F;
+				case fU:	return (w >> 6) & 0x1;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t14c:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF2:	return (w >> 22) & 0xF;
+				case fDSTS:	return (w >> 20) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x7;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fDSTLS:	return (w >> 6) & 0x3F;
+				case fSRCLS:	return (w >> 0) & 0x3F;
+			}
+			break;
+		case t14d:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fSF2:	return (w >> 19) & 0xF;
+				case fDSTS:	return (w >> 17) & 0x3;
+				case fSRCS1:	return (w >> 15) & 0x3;
+				case fSRCS2:	return (w >> 10) & 0x1F;
+				case fDSTLS:	return (w >> 5) & 0x1F;
+				case fSRCLS:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t14k:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fDSTS:	return (w >> 19) & 0x3;
+				case fSRCS1:	return (w >> 17) & 0x3;
+				case fSRCS2:	return (w >> 12) & 0x1F;
+				case fDSTLS:	return (w >> 6) & 0x3F;
+				case fSRCLS:	return (w >> 0) & 0x3F;
+			}
+			break;
+		case t14l:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fSF2:	return (w >> 19) & 0xF;
+				case fDSTS:	return (w >> 17) & 0x3;
+				case fSRCS1:	return (w >> 15) & 0x3;
+				case fSRCS2:	return (w >> 10) & 0x1F;
+				case fDSTLS:	return (w >> 5) & 0x1F;
+				case fSRCLS:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15a:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fSF:	return (w >> 18) & 0x1F;
+				case fDSTS:	return (w >> 15) & 0x7;
+				case fSRCS1:	return (w >> 10) & 0x1F;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15b:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fSF:	return (w >> 16) & 0x1F;
+				case fDSTS:	return (w >> 14) & 0x3;
+				case fSRCS1:	return (w >> 10) & 0xF;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15c:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fSF:	return (w >> 17) & 0x1F;
+				case fDSTS:	return (w >> 14) & 0x7;
+				case fSRCS1:	return (w >> 11) & 0x7;
+				case fSRCS2:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15d:
+			switch(field){
+				case fOpcodeType:	return w >> 20;
+				case fSF:	return (w >> 15) & 0x1F;
+				case fDSTS:	return (w >> 13) & 0x3;
+				case fSRCS1:	return (w >> 11) & 0x3;
+				case fSRCS2:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15e:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF:	return (w >> 21) & 0x1F;
+				case fDSTS:	return (w >> 15) & 0x3F;
+				case fSRCS1:	return (w >> 10) & 0x1F;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t15f:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fSF:	return (w >> 19) & 0x1F;
+				case fDSTS:	return (w >> 14) & 0x1F;
+				case fSRCS1:	return (w >> 10) & 0xF;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16a:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fSF:	return (w >> 18) & 0x1F;
+				case fDSTS:	return (w >> 15) & 0x7;
+				case fSRCS1:	return (w >> 10) & 0x1F;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16b:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fSF:	return (w >> 16) & 0x1F;
+				case fDSTS:	return (w >> 14) & 0x3;
+				case fSRCS1:	return (w >> 10) & 0xF;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16c:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fSF:	return (w >> 16) & 0x1F;
+				case fDSTS:	return (w >> 10) & 0x3F;
+				case fSRCS1:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16d:
+			switch(field){
+				case fOpcodeType:	return w >> 19;
+				case fSF:	return (w >> 14) & 0x1F;
+				case fDSTS:	return (w >> 9) & 0x1F;
+				case fSRCS1:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16e:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF:	return (w >> 21) & 0x1F;
+				case fDSTS:	return (w >> 15) & 0x3F;
+				case fSRCS1:	return (w >> 10) & 0x1F;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t16f:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fSF:	return (w >> 19) & 0x1F;
+				case fDSTS:	return (w >> 14) & 0x1F;
+				case fSRCS1:	return (w >> 10) & 0xF;
+				case fSRCS2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17a:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTLS:	return (w >> 11) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17b:
+			switch(field){
+				case fOpcodeType:	return w >> 18;
+				case fDSTLS:	return (w >> 12) & 0x3F;
+				case fSRCLS:	return (w >> 6) & 0x3F;
+				case fDC:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17c:
+			switch(field){
+				case fOpcodeType:	return w >> 11;
+				case fDSTLS:	return (w >> 8) & 0x7;
+				case fSRCLS:	return (w >> 5) & 0x7;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17d:
+			switch(field){
+				case fOpcodeType:	return w >> 15;
+				case fDSTLS:	return (w >> 10) & 0x1F;
+				case fSRCLS:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17e:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTLS:	return (w >> 12) & 0x1F;
+				case fSRCLS:	return (w >> 6) & 0x3F;
+				case fDC:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17f:
+			switch(field){
+				case fOpcodeType:	return w >> 9;
+				case fDSTLS:	return (w >> 7) & 0x3;
+				case fSRCLS:	return (w >> 5) & 0x3;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17g:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTLS:	return (w >> 11) & 0x3F;
+				case fSRCLS:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t17h:
+			switch(field){
+				case fOpcodeType:	return w >> 14;
+				case fDSTLS:	return (w >> 11) & 0x7;
+				case fSRCLS:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t18a:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fENA:	return (w >> 5) & 0x3FFFF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t18b:
+			switch(field){
+				case fOpcodeType:	return w >> 11;
+				case fIDE:	return (w >> 7) & 0xF;
+				case fIDM:	return (w >> 5) & 0x3;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t18c:
+			switch(field){
+				case fOpcodeType:	return w >> 11;
+				case fDSTID:	return (w >> 5) & 0x3F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t19a:
+			switch(field){
+				case fOpcodeType:	return w >> 9;
+				case fS:	return (w >> 8) & 0x1;
+				case fCOND:	return (w >> 3) & 0x1F;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t20a:
+			switch(field){
+				case fOpcodeType:	return w >> 6;
+				case fT:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t22a:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fDSTLS:	return (w >> 12) & 0xFFF;
+				case fU:	return (w >> 11) & 0x1;
+				case fCOND:	return (w >> 6) & 0x1F;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t23a:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fDSTA:	return (w >> 16) & 0x1F;
+				case fSRCA1:	return (w >> 11) & 0x1F;
+				case fSRCA2:	return (w >> 6) & 0x1F;
+				case fDF:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t25a:
+			switch(field){
+				case fOpcodeType:	return w >> 8;
+				case fDSTM:	return (w >> 5) & 0x7;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t25b:
+			switch(field){
+				case fOpcodeType:	return w >> 8;
+				case fDSTM:	return (w >> 6) & 0x3;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t26a:
+			switch(field){
+				case fOpcodeType:	return w >> 11;
+				case fLPP:	return (w >> 9) & 0x3;
+				case fPPP:	return (w >> 7) & 0x3;
+				case fSPP:	return (w >> 5) & 0x3;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t29a:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fDSTLS:	return (w >> 17) & 0x3F;
+				case fSRCLS:	return (w >> 9) & 0xFF;
+				case fU:	return (w >> 8) & 0x1;
+				case fCOND:	return (w >> 3) & 0x1F;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t29b:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fDSTLS:	return (w >> 17) & 0x1F;
+				case fSRCLS:	return (w >> 9) & 0xFF;
+				case fU:	return (w >> 8) & 0x1;
+				case fCOND:	return (w >> 3) & 0x1F;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t29c:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fDSTLS:	return (w >> 17) & 0x3F;
+				case fSRCLS:	return (w >> 9) & 0xFF;
+				case fU:	return (w >> 8) & 0x1;
+				case fCOND:	return (w >> 3) & 0x1F;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t29d:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fDSTLS:	return (w >> 17) & 0x1F;
+				case fSRCLS:	return (w >> 9) & 0xFF;
+				case fU:	return (w >> 8) & 0x1;
+				case fCOND:	return (w >> 3) & 0x1F;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t30a:
+			switch(field){
+				case fOpcodeType:	return w >> 5;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t31a:
+			switch(field){
+				case fOpcodeType:	return w >> 5;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t32a:
+			switch(field){
+				case fOpcodeType:	return w >> 18;
+				case fDSTLS:	return (w >> 12) & 0x3F;
+				case fU:	return (w >> 11) & 0x1;
+				case fCOND:	return (w >> 6) & 0x1F;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t32b:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTLS:	return (w >> 12) & 0x1F;
+				case fU:	return (w >> 11) & 0x1;
+				case fCOND:	return (w >> 6) & 0x1F;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t32c:
+			switch(field){
+				case fOpcodeType:	return w >> 18;
+				case fDSTLS:	return (w >> 12) & 0x3F;
+				case fU:	return (w >> 11) & 0x1;
+				case fCOND:	return (w >> 6) & 0x1F;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t32d:
+			switch(field){
+				case fOpcodeType:	return w >> 17;
+				case fDSTLS:	return (w >> 12) & 0x1F;
+				case fU:	return (w >> 11) & 0x1;
+				case fCOND:	return (w >> 6) & 0x1F;
+				case fDMM:	return (w >> 3) & 0x7;
+				case fDMI:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t37a:
+			switch(field){
+				case fOpcodeType:	return w >> 10;
+				case fINTN:	return (w >> 6) & 0xF;
+				case fC:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t40e:
+			switch(field){
+				case fOpcodeType:	return w >> 24;
+				case fAMF:	return (w >> 19) & 0x1F;
+				case fDSTM:	return (w >> 16) & 0x7;
+				case fSRCM1:	return (w >> 11) & 0x1F;
+				case fSRCM2:	return (w >> 6) & 0x1F;
+				case fMN:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t40f:
+			switch(field){
+				case fOpcodeType:	return w >> 22;
+				case fAMF:	return (w >> 17) & 0x1F;
+				case fDSTM:	return (w >> 15) & 0x3;
+				case fSRCM1:	return (w >> 11) & 0xF;
+				case fSRCM2:	return (w >> 7) & 0xF;
+				case fCONJ:	return (w >> 6) & 0x1;
+				case fMN:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t40g:
+			switch(field){
+				case fOpcodeType:	return w >> 23;
+				case fAMF:	return (w >> 18) & 0x1F;
+				case fDSTM:	return (w >> 16) & 0x3;
+				case fSRCM1:	return (w >> 11) & 0x1F;
+				case fSRCM2:	return (w >> 7) & 0xF;
+				case fCONJ:	return (w >> 6) & 0x1;
+				case fMN:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t41a:
+			switch(field){
+				case fOpcodeType:	return w >> 8;
+				case fDSTM:	return (w >> 5) & 0x7;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t41b:
+			switch(field){
+				case fOpcodeType:	return w >> 8;
+				case fDSTM:	return (w >> 6) & 0x3;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t41c:
+			switch(field){
+				case fOpcodeType:	return w >> 8;
+				case fDSTM:	return (w >> 5) & 0x7;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t41d:
+			switch(field){
+				case fOpcodeType:	return w >> 7;
+				case fDSTM:	return (w >> 5) & 0x3;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t42a:
+			switch(field){
+				case fOpcodeType:	return w >> 16;
+				case fDSTC:	return (w >> 11) & 0x1F;
+				case fSRCC:	return (w >> 7) & 0xF;
+				case fCONJ:	return (w >> 6) & 0x1;
+				case fPOLAR:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t42b:
+			switch(field){
+				case fOpcodeType:	return w >> 14;
+				case fDSTC:	return (w >> 9) & 0x1F;
+				case fSRCC:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t43a:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fAF:	return (w >> 22) & 0xF;
+				case fMF:	return (w >> 18) & 0xF;
+				case fDSTA:	return (w >> 14) & 0xF;
+				case fSRCA1:	return (w >> 11) & 0x7;
+				case fSRCA2:	return (w >> 8) & 0x7;
+				case fDSTM:	return (w >> 6) & 0x3;
+				case fSRCM1:	return (w >> 3) & 0x7;
+				case fSRCM2:	return (w >> 0) & 0x7;
+			}
+			break;
+		case t44b:
+			switch(field){
+				case fOpcodeType:	return w >> 28;
+				case fSF2:	return (w >> 24) & 0xF;
+				case fAF:	return (w >> 20) & 0xF;
+				case fDSTA:	return (w >> 16) & 0xF;
+				case fSRCA1:	return (w >> 13) & 0x7;
+				case fSRCA2:	return (w >> 10) & 0x7;
+				case fDSTS:	return (w >> 8) & 0x3;
+				case fSRCS1:	return (w >> 5) & 0x7;
+				case fSRCS2:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t44d:
+			switch(field){
+				case fOpcodeType:	return w >> 27;
+				case fSF2:	return (w >> 23) & 0xF;
+				case fAF:	return (w >> 19) & 0xF;
+				case fDSTA:	return (w >> 15) & 0xF;
+				case fSRCA1:	return (w >> 12) & 0x7;
+				case fSRCA2:	return (w >> 9) & 0x7;
+				case fDSTS:	return (w >> 7) & 0x3;
+				case fSRCS1:	return (w >> 5) & 0x3;
+				case fSRCS2:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t45b:
+			switch(field){
+				case fOpcodeType:	return w >> 26;
+				case fSF2:	return (w >> 22) & 0xF;
+				case fMF:	return (w >> 18) & 0xF;
+				case fDSTM:	return (w >> 16) & 0x3;
+				case fSRCM1:	return (w >> 13) & 0x7;
+				case fSRCM2:	return (w >> 10) & 0x7;
+				case fDSTS:	return (w >> 8) & 0x3;
+				case fSRCS1:	return (w >> 5) & 0x7;
+				case fSRCS2:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t45d:
+			switch(field){
+				case fOpcodeType:	return w >> 25;
+				case fSF2:	return (w >> 21) & 0xF;
+				case fMF:	return (w >> 17) & 0xF;
+				case fDSTM:	return (w >> 15) & 0x3;
+				case fSRCM1:	return (w >> 12) & 0x7;
+				case fSRCM2:	return (w >> 9) & 0x7;
+				case fDSTS:	return (w >> 7) & 0x3;
+				case fSRCS1:	return (w >> 5) & 0x3;
+				case fSRCS2:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t46a:
+			switch(field){
+				case fOpcodeType:	return w >> 21;
+				case fDSTA:	return (w >> 15) & 0x3F;
+				case fSRCA1:	return (w >> 10) & 0x1F;
+				case fSRCA2:	return (w >> 5) & 0x1F;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t46b:
+			switch(field){
+				case fOpcodeType:	return w >> 19;
+				case fDSTA:	return (w >> 14) & 0x1F;
+				case fSRCA1:	return (w >> 10) & 0xF;
+				case fSRCA2:	return (w >> 6) & 0xF;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t47a:
+			switch(field){
+				case fOpcodeType:	return w >> 15;
+				case fDSTC:	return (w >> 10) & 0x1F;
+				case fSRCC:	return (w >> 6) & 0xF;
+				case fCONJ:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t48a:
+			switch(field){
+				case fOpcodeType:	return w >> 5;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t49a:
+			switch(field){
+				case fOpcodeType:	return w >> 20;
+				case fDSTLS:	return (w >> 14) & 0x3F;
+				case fSRCLS:	return (w >> 11) & 0x7;
+				case fIDR:	return (w >> 9) & 0x3;
+				case fIDN:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t49b:
+			switch(field){
+				case fOpcodeType:	return w >> 18;
+				case fDSTLS:	return (w >> 13) & 0x1F;
+				case fSRCLS:	return (w >> 11) & 0x3;
+				case fIDR:	return (w >> 9) & 0x3;
+				case fIDN:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t49c:
+			switch(field){
+				case fOpcodeType:	return w >> 20;
+				case fDSTLS:	return (w >> 17) & 0x7;
+				case fSRCLS:	return (w >> 11) & 0x3F;
+				case fIDR:	return (w >> 9) & 0x3;
+				case fIDN:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t49d:
+			switch(field){
+				case fOpcodeType:	return w >> 18;
+				case fDSTLS:	return (w >> 16) & 0x3;
+				case fSRCLS:	return (w >> 11) & 0x1F;
+				case fIDR:	return (w >> 9) & 0x3;
+				case fIDN:	return (w >> 5) & 0xF;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+		case t50a:
+			switch(field){
+				case fOpcodeType:	return w >> 20;
+				case fDSTA:	return (w >> 15) & 0x1F;
+				case fSRCA1:	return (w >> 11) & 0xF;
+				case fSRCA2:	return (w >> 6) & 0x1F;
+				case fCW:	return (w >> 5) & 0x1;
+				case fCOND:	return (w >> 0) & 0x1F;
+			}
+			break;
+	}
+	return ISA_NO_FIELD;
+}
+
+/** 
+* @brief Store a field into an instruction word.
+* 
+* @param type eType value of the instruction
+* @param field eField value
+* @param w Instruction word
+* @param v Field value, truncated to the field width
+* 
+* @return Updated instruction word; w if type has no such field
+*/
+unsigned int isaSetField(int type, int field, unsigned int w, unsigned int v)
+{
+	switch(type){
+		case t01a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0FFFFFFFU) | ((v & 0xF) << 28);
+				case fMF:	return (w & 0xF0FFFFFFU) | ((v & 0xF) << 24);
+				case fDSTM:	return (w & 0xFF3FFFFFU) | ((v & 0x3) << 22);
+				case fSRCM1:	return (w & 0xFFC7FFFFU) | ((v & 0x7) << 19);
+				case fSRCM2:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fU:	return (w & 0xFFFF7FFFU) | ((v & 0x1) << 15);
+				case fU2:	return (w & 0xFFFFBFFFU) | ((v & 0x1) << 14);
+				case fDD:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fPD:	return (w & 0xFFFFF8FFU) | ((v & 0x7) << 8);
+				case fPMM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fPMI:	return (w & 0xFFFFFFCFU) | ((v & 0x3) << 4);
+				case fDMM:	return (w & 0xFFFFFFF3U) | ((v & 0x3) << 2);
+				case fDMI:	return (w & 0xFFFFFFFCU) | ((v & 0x3) << 0);
+			}
+			break;
+		case t01b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fMF:	return (w & 0xFF0FFFFFU) | ((v & 0xF) << 20);
+				case fDSTM:	return (w & 0xFFF3FFFFU) | ((v & 0x3) << 18);
+				case fSRCM1:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCM2:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fU:	return (w & 0xFFFFDFFFU) | ((v & 0x1) << 13);
+				case fU2:	return (w & 0xFFFFEFFFU) | ((v & 0x1) << 12);
+				case fDD:	return (w & 0xFFFFF3FFU) | ((v & 0x3) << 10);
+				case fPD:	return (w & 0xFFFFFCFFU) | ((v & 0x3) << 8);
+				case fPMM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fPMI:	return (w & 0xFFFFFFCFU) | ((v & 0x3) << 4);
+				case fDMM:	return (w & 0xFFFFFFF3U) | ((v & 0x3) << 2);
+				case fDMI:	return (w & 0xFFFFFFFCU) | ((v & 0x3) << 0);
+			}
+			break;
+		case t01c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0FFFFFFFU) | ((v & 0xF) << 28);
+				case fAF:	return (w & 0xF0FFFFFFU) | ((v & 0xF) << 24);
+				case fDSTA:	return (w & 0xFF0FFFFFU) | ((v & 0xF) << 20);
+				case fSRCA1:	return (w & 0xFFF1FFFFU) | ((v & 0x7) << 17);
+				case fSRCA2:	return (w & 0xFFFE3FFFU) | ((v & 0x7) << 14);
+				case fDD:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fPD:	return (w & 0xFFFFF8FFU) | ((v & 0x7) << 8);
+				case fPMM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fPMI:	return (w & 0xFFFFFFCFU) | ((v & 0x3) << 4);
+				case fDMM:	return (w & 0xFFFFFFF3U) | ((v & 0x3) << 2);
+				case fDMI:	return (w & 0xFFFFFFFCU) | ((v & 0x3) << 0);
+			}
+			break;
+		case t03a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fDSTLS:	return (w & 0xF81FFFFFU) | ((v & 0x3F) << 21);
+				case fSRCLS:	return (w & 0xFFE0001FU) | ((v & 0xFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fDSTLS:	return (w & 0xFC1FFFFFU) | ((v & 0x1F) << 21);
+				case fSRCLS:	return (w & 0xFFE0001FU) | ((v & 0xFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fDSTLS:	return (w & 0xFE3FFFFFU) | ((v & 0x7) << 22);
+				case fSRCLS:	return (w & 0xFFC0003FU) | ((v & 0xFFFF) << 6);
+				case fLSF:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fDSTLS:	return (w & 0xFF3FFFFFU) | ((v & 0x3) << 22);
+				case fSRCLS:	return (w & 0xFFC0003FU) | ((v & 0xFFFF) << 6);
+				case fLSF:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fDSTLS:	return (w & 0xF81FFFFFU) | ((v & 0x3F) << 21);
+				case fSRCLS:	return (w & 0xFFE0001FU) | ((v & 0xFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fDSTLS:	return (w & 0xFC1FFFFFU) | ((v & 0x1F) << 21);
+				case fSRCLS:	return (w & 0xFFE0001FU) | ((v & 0xFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03h:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fDSTLS:	return (w & 0xFE3FFFFFU) | ((v & 0x7) << 22);
+				case fSRCLS:	return (w & 0xFFC0003FU) | ((v & 0xFFFF) << 6);
+				case fLSF:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t03i:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fDSTLS:	return (w & 0xFF3FFFFFU) | ((v & 0x3) << 22);
+				case fSRCLS:	return (w & 0xFFC0003FU) | ((v & 0xFFFF) << 6);
+				case fLSF:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t04a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fMF:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTM:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCM1:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCM2:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fDSTLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fMF:	return (w & 0xFFC3FFFFU) | ((v & 0xF) << 18);
+				case fDSTM:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCM1:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCM2:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fDSTLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fAF:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fDSTA:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fSRCA1:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCA2:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fDSTLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fAF:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTA:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCA1:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCA2:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fDSTLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fMF:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTM:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCM1:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCM2:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fSRCLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fMF:	return (w & 0xFFC3FFFFU) | ((v & 0xF) << 18);
+				case fDSTM:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCM1:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCM2:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fSRCLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fAF:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fDSTA:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fSRCA1:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCA2:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fSRCLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t04h:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fAF:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTA:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCA1:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCA2:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fSRCLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t06a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fDSTLS:	return (w & 0xF81FFFFFU) | ((v & 0x3F) << 21);
+				case fSRCLS:	return (w & 0xFFE0001FU) | ((v & 0xFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t06b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fDSTLS:	return (w & 0xFF81FFFFU) | ((v & 0x3F) << 17);
+				case fSRCLS:	return (w & 0xFFFE001FU) | ((v & 0xFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t06c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x1FFFFFFFU) | ((v & 0x7) << 29);
+				case fDSTLS:	return (w & 0xE0FFFFFFU) | ((v & 0x1F) << 24);
+				case fSRCLS:	return (w & 0xFF000000U) | ((v & 0xFFFFFF) << 0);
+			}
+			break;
+		case t06d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fDSTLS:	return (w & 0xF8FFFFFFU) | ((v & 0x7) << 24);
+				case fSRCLS:	return (w & 0xFF000000U) | ((v & 0xFFFFFF) << 0);
+			}
+			break;
+		case t08a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fMF:	return (w & 0xFF0FFFFFU) | ((v & 0xF) << 20);
+				case fDSTM:	return (w & 0xFFF3FFFFU) | ((v & 0x3) << 18);
+				case fSRCM1:	return (w & 0xFFFC7FFFU) | ((v & 0x7) << 15);
+				case fSRCM2:	return (w & 0xFFFF8FFFU) | ((v & 0x7) << 12);
+				case fDSTLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fSRCLS:	return (w & 0xFFFFFFC0U) | ((v & 0x3F) << 0);
+			}
+			break;
+		case t08b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000FFFFFU) | ((v & 0xFFF) << 20);
+				case fMF:	return (w & 0xFFF0FFFFU) | ((v & 0xF) << 16);
+				case fDSTM:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCM1:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fSRCM2:	return (w & 0xFFFFF3FFU) | ((v & 0x3) << 10);
+				case fDSTLS:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fSRCLS:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t08c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fAF:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fDSTA:	return (w & 0xFFC3FFFFU) | ((v & 0xF) << 18);
+				case fSRCA1:	return (w & 0xFFFC7FFFU) | ((v & 0x7) << 15);
+				case fSRCA2:	return (w & 0xFFFF8FFFU) | ((v & 0x7) << 12);
+				case fDSTLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fSRCLS:	return (w & 0xFFFFFFC0U) | ((v & 0x3F) << 0);
+			}
+			break;
+		case t08d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fAF:	return (w & 0xFFE1FFFFU) | ((v & 0xF) << 17);
+				case fDSTA:	return (w & 0xFFFE3FFFU) | ((v & 0x7) << 14);
+				case fSRCA1:	return (w & 0xFFFFCFFFU) | ((v & 0x3) << 12);
+				case fSRCA2:	return (w & 0xFFFFF3FFU) | ((v & 0x3) << 10);
+				case fDSTLS:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fSRCLS:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fAF:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTA:	return (w & 0xFFE07FFFU) | ((v & 0x3F) << 15);
+				case fSRCA1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCA2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fAF:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTA:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fSRCA1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCA2:	return (w & 0xFFFFFC3FU) | ((v & 0xF) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fAF:	return (w & 0xFF0FFFFFU) | ((v & 0xF) << 20);
+				case fDSTA:	return (w & 0xFFF03FFFU) | ((v & 0x3F) << 14);
+				case fSRCA1:	return (w & 0xFFFFC1FFU) | ((v & 0x1F) << 9);
+				case fSRCA2:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fAF:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fDSTA:	return (w & 0xFF83FFFFU) | ((v & 0x1F) << 18);
+				case fSRCA1:	return (w & 0xFFFC3FFFU) | ((v & 0xF) << 14);
+				case fSRCA2:	return (w & 0xFFFFC03FU) | ((v & 0xFF) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0007FFFFU) | ((v & 0x1FFF) << 19);
+				case fAMF:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fDSTM:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fSRCM1:	return (w & 0xFFFFF8FFU) | ((v & 0x7) << 8);
+				case fSRCM2:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09h:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fAMF:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fDSTM:	return (w & 0xFFFFF3FFU) | ((v & 0x3) << 10);
+				case fSRCM1:	return (w & 0xFFFFFCFFU) | ((v & 0x3) << 8);
+				case fSRCM2:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t09i:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fAF:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fYZ:	return (w & 0xFFEFFFFFU) | ((v & 0x1) << 20);
+				case fDSTA:	return (w & 0xFFF03FFFU) | ((v & 0x3F) << 14);
+				case fSRCA1:	return (w & 0xFFFFC1FFU) | ((v & 0x1F) << 9);
+				case fSRCA2:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t10a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0007FFFFU) | ((v & 0x1FFF) << 19);
+				case fDSTB:	return (w & 0xFFF8003FU) | ((v & 0x1FFF) << 6);
+				case fS:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t10b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTB:	return (w & 0xFFFE0001U) | ((v & 0xFFFF) << 1);
+				case fS:	return (w & 0xFFFFFFFEU) | ((v & 0x1) << 0);
+			}
+			break;
+		case t11a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000FFFFU) | ((v & 0xFFFF) << 16);
+				case fDSTB:	return (w & 0xFFFF000FU) | ((v & 0xFFF) << 4);
+				case fTERM:	return (w & 0xFFFFFFF0U) | ((v & 0xF) << 0);
+			}
+			break;
+		case t12e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fSF2:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fDSTS:	return (w & 0xFF9FFFFFU) | ((v & 0x3) << 21);
+				case fSRCS1:	return (w & 0xFFE3FFFFU) | ((v & 0x7) << 18);
+				case fSRCS2:	return (w & 0xFFFC1FFFU) | ((v & 0x1F) << 13);
+				case fDSTLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTS:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCS1:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fDSTLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fSF2:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fDSTS:	return (w & 0xFF9FFFFFU) | ((v & 0x3) << 21);
+				case fSRCS1:	return (w & 0xFFE3FFFFU) | ((v & 0x7) << 18);
+				case fSRCS2:	return (w & 0xFFFC1FFFU) | ((v & 0x1F) << 13);
+				case fSRCLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12h:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTS:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCS1:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fSRCLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12m:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF2:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fDSTS:	return (w & 0xFFCFFFFFU) | ((v & 0x3) << 20);
+				case fSRCS1:	return (w & 0xFFF3FFFFU) | ((v & 0x3) << 18);
+				case fSRCS2:	return (w & 0xFFFC1FFFU) | ((v & 0x1F) << 13);
+				case fDSTLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12n:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTS:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCS1:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fDSTLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12o:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF2:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fDSTS:	return (w & 0xFFCFFFFFU) | ((v & 0x3) << 20);
+				case fSRCS1:	return (w & 0xFFF3FFFFU) | ((v & 0x3) << 18);
+				case fSRCS2:	return (w & 0xFFFC1FFFU) | ((v & 0x1F) << 13);
+				case fSRCLS:	return (w & 0xFFFFE07FU) | ((v & 0x3F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t12p:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTS:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCS1:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fSRCLS:	return (w & 0xFFFFF07FU) | ((v & 0x1F) << 7);
+				case fU:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t14c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF2:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fDSTS:	return (w & 0xFFCFFFFFU) | ((v & 0x3) << 20);
+				case fSRCS1:	return (w & 0xFFF1FFFFU) | ((v & 0x7) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fDSTLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fSRCLS:	return (w & 0xFFFFFFC0U) | ((v & 0x3F) << 0);
+			}
+			break;
+		case t14d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fSF2:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTS:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS1:	return (w & 0xFFFE7FFFU) | ((v & 0x3) << 15);
+				case fSRCS2:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fDSTLS:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fSRCLS:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t14k:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fDSTS:	return (w & 0xFFE7FFFFU) | ((v & 0x3) << 19);
+				case fSRCS1:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS2:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fDSTLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fSRCLS:	return (w & 0xFFFFFFC0U) | ((v & 0x3F) << 0);
+			}
+			break;
+		case t14l:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fSF2:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTS:	return (w & 0xFFF9FFFFU) | ((v & 0x3) << 17);
+				case fSRCS1:	return (w & 0xFFFE7FFFU) | ((v & 0x3) << 15);
+				case fSRCS2:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fDSTLS:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fSRCLS:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fSF:	return (w & 0xFF83FFFFU) | ((v & 0x1F) << 18);
+				case fDSTS:	return (w & 0xFFFC7FFFU) | ((v & 0x7) << 15);
+				case fSRCS1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fSF:	return (w & 0xFFE0FFFFU) | ((v & 0x1F) << 16);
+				case fDSTS:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCS1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fSF:	return (w & 0xFFC1FFFFU) | ((v & 0x1F) << 17);
+				case fDSTS:	return (w & 0xFFFE3FFFU) | ((v & 0x7) << 14);
+				case fSRCS1:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fSRCS2:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000FFFFFU) | ((v & 0xFFF) << 20);
+				case fSF:	return (w & 0xFFF07FFFU) | ((v & 0x1F) << 15);
+				case fDSTS:	return (w & 0xFFFF9FFFU) | ((v & 0x3) << 13);
+				case fSRCS1:	return (w & 0xFFFFE7FFU) | ((v & 0x3) << 11);
+				case fSRCS2:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF:	return (w & 0xFC1FFFFFU) | ((v & 0x1F) << 21);
+				case fDSTS:	return (w & 0xFFE07FFFU) | ((v & 0x3F) << 15);
+				case fSRCS1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t15f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fSF:	return (w & 0xFF07FFFFU) | ((v & 0x1F) << 19);
+				case fDSTS:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fSRCS1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fSF:	return (w & 0xFF83FFFFU) | ((v & 0x1F) << 18);
+				case fDSTS:	return (w & 0xFFFC7FFFU) | ((v & 0x7) << 15);
+				case fSRCS1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fSF:	return (w & 0xFFE0FFFFU) | ((v & 0x1F) << 16);
+				case fDSTS:	return (w & 0xFFFF3FFFU) | ((v & 0x3) << 14);
+				case fSRCS1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fSF:	return (w & 0xFFE0FFFFU) | ((v & 0x1F) << 16);
+				case fDSTS:	return (w & 0xFFFF03FFU) | ((v & 0x3F) << 10);
+				case fSRCS1:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0007FFFFU) | ((v & 0x1FFF) << 19);
+				case fSF:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fDSTS:	return (w & 0xFFFFC1FFU) | ((v & 0x1F) << 9);
+				case fSRCS1:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF:	return (w & 0xFC1FFFFFU) | ((v & 0x1F) << 21);
+				case fDSTS:	return (w & 0xFFE07FFFU) | ((v & 0x3F) << 15);
+				case fSRCS1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t16f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fSF:	return (w & 0xFF07FFFFU) | ((v & 0x1F) << 19);
+				case fDSTS:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fSRCS1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCS2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTLS:	return (w & 0xFFFE07FFU) | ((v & 0x3F) << 11);
+				case fSRCLS:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0003FFFFU) | ((v & 0x3FFF) << 18);
+				case fDSTLS:	return (w & 0xFFFC0FFFU) | ((v & 0x3F) << 12);
+				case fSRCLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fDC:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000007FFU) | ((v & 0x1FFFFF) << 11);
+				case fDSTLS:	return (w & 0xFFFFF8FFU) | ((v & 0x7) << 8);
+				case fSRCLS:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00007FFFU) | ((v & 0x1FFFF) << 15);
+				case fDSTLS:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCLS:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTLS:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fSRCLS:	return (w & 0xFFFFF03FU) | ((v & 0x3F) << 6);
+				case fDC:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000001FFU) | ((v & 0x7FFFFF) << 9);
+				case fDSTLS:	return (w & 0xFFFFFE7FU) | ((v & 0x3) << 7);
+				case fSRCLS:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTLS:	return (w & 0xFFFE07FFU) | ((v & 0x3F) << 11);
+				case fSRCLS:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t17h:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00003FFFU) | ((v & 0x3FFFF) << 14);
+				case fDSTLS:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fSRCLS:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t18a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fENA:	return (w & 0xFF80001FU) | ((v & 0x3FFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t18b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000007FFU) | ((v & 0x1FFFFF) << 11);
+				case fIDE:	return (w & 0xFFFFF87FU) | ((v & 0xF) << 7);
+				case fIDM:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t18c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000007FFU) | ((v & 0x1FFFFF) << 11);
+				case fDSTID:	return (w & 0xFFFFF81FU) | ((v & 0x3F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t19a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000001FFU) | ((v & 0x7FFFFF) << 9);
+				case fS:	return (w & 0xFFFFFEFFU) | ((v & 0x1) << 8);
+				case fCOND:	return (w & 0xFFFFFF07U) | ((v & 0x1F) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t20a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000003FU) | ((v & 0x3FFFFFF) << 6);
+				case fT:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t22a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fDSTLS:	return (w & 0xFF000FFFU) | ((v & 0xFFF) << 12);
+				case fU:	return (w & 0xFFFFF7FFU) | ((v & 0x1) << 11);
+				case fCOND:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t23a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fDSTA:	return (w & 0xFFE0FFFFU) | ((v & 0x1F) << 16);
+				case fSRCA1:	return (w & 0xFFFF07FFU) | ((v & 0x1F) << 11);
+				case fSRCA2:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDF:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t25a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000000FFU) | ((v & 0xFFFFFF) << 8);
+				case fDSTM:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t25b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000000FFU) | ((v & 0xFFFFFF) << 8);
+				case fDSTM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t26a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000007FFU) | ((v & 0x1FFFFF) << 11);
+				case fLPP:	return (w & 0xFFFFF9FFU) | ((v & 0x3) << 9);
+				case fPPP:	return (w & 0xFFFFFE7FU) | ((v & 0x3) << 7);
+				case fSPP:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t29a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fDSTLS:	return (w & 0xFF81FFFFU) | ((v & 0x3F) << 17);
+				case fSRCLS:	return (w & 0xFFFE01FFU) | ((v & 0xFF) << 9);
+				case fU:	return (w & 0xFFFFFEFFU) | ((v & 0x1) << 8);
+				case fCOND:	return (w & 0xFFFFFF07U) | ((v & 0x1F) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t29b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fDSTLS:	return (w & 0xFFC1FFFFU) | ((v & 0x1F) << 17);
+				case fSRCLS:	return (w & 0xFFFE01FFU) | ((v & 0xFF) << 9);
+				case fU:	return (w & 0xFFFFFEFFU) | ((v & 0x1) << 8);
+				case fCOND:	return (w & 0xFFFFFF07U) | ((v & 0x1F) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t29c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fDSTLS:	return (w & 0xFF81FFFFU) | ((v & 0x3F) << 17);
+				case fSRCLS:	return (w & 0xFFFE01FFU) | ((v & 0xFF) << 9);
+				case fU:	return (w & 0xFFFFFEFFU) | ((v & 0x1) << 8);
+				case fCOND:	return (w & 0xFFFFFF07U) | ((v & 0x1F) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t29d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fDSTLS:	return (w & 0xFFC1FFFFU) | ((v & 0x1F) << 17);
+				case fSRCLS:	return (w & 0xFFFE01FFU) | ((v & 0xFF) << 9);
+				case fU:	return (w & 0xFFFFFEFFU) | ((v & 0x1) << 8);
+				case fCOND:	return (w & 0xFFFFFF07U) | ((v & 0x1F) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t30a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000001FU) | ((v & 0x7FFFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t31a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000001FU) | ((v & 0x7FFFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t32a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0003FFFFU) | ((v & 0x3FFF) << 18);
+				case fDSTLS:	return (w & 0xFFFC0FFFU) | ((v & 0x3F) << 12);
+				case fU:	return (w & 0xFFFFF7FFU) | ((v & 0x1) << 11);
+				case fCOND:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t32b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTLS:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fU:	return (w & 0xFFFFF7FFU) | ((v & 0x1) << 11);
+				case fCOND:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t32c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0003FFFFU) | ((v & 0x3FFF) << 18);
+				case fDSTLS:	return (w & 0xFFFC0FFFU) | ((v & 0x3F) << 12);
+				case fU:	return (w & 0xFFFFF7FFU) | ((v & 0x1) << 11);
+				case fCOND:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t32d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0001FFFFU) | ((v & 0x7FFF) << 17);
+				case fDSTLS:	return (w & 0xFFFE0FFFU) | ((v & 0x1F) << 12);
+				case fU:	return (w & 0xFFFFF7FFU) | ((v & 0x1) << 11);
+				case fCOND:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fDMM:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fDMI:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t37a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000003FFU) | ((v & 0x3FFFFF) << 10);
+				case fINTN:	return (w & 0xFFFFFC3FU) | ((v & 0xF) << 6);
+				case fC:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t40e:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00FFFFFFU) | ((v & 0xFF) << 24);
+				case fAMF:	return (w & 0xFF07FFFFU) | ((v & 0x1F) << 19);
+				case fDSTM:	return (w & 0xFFF8FFFFU) | ((v & 0x7) << 16);
+				case fSRCM1:	return (w & 0xFFFF07FFU) | ((v & 0x1F) << 11);
+				case fSRCM2:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fMN:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t40f:
+			switch(field){
+				case fOpcodeType:	return (w & 0x003FFFFFU) | ((v & 0x3FF) << 22);
+				case fAMF:	return (w & 0xFFC1FFFFU) | ((v & 0x1F) << 17);
+				case fDSTM:	return (w & 0xFFFE7FFFU) | ((v & 0x3) << 15);
+				case fSRCM1:	return (w & 0xFFFF87FFU) | ((v & 0xF) << 11);
+				case fSRCM2:	return (w & 0xFFFFF87FU) | ((v & 0xF) << 7);
+				case fCONJ:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fMN:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t40g:
+			switch(field){
+				case fOpcodeType:	return (w & 0x007FFFFFU) | ((v & 0x1FF) << 23);
+				case fAMF:	return (w & 0xFF83FFFFU) | ((v & 0x1F) << 18);
+				case fDSTM:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCM1:	return (w & 0xFFFF07FFU) | ((v & 0x1F) << 11);
+				case fSRCM2:	return (w & 0xFFFFF87FU) | ((v & 0xF) << 7);
+				case fCONJ:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fMN:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t41a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000000FFU) | ((v & 0xFFFFFF) << 8);
+				case fDSTM:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t41b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000000FFU) | ((v & 0xFFFFFF) << 8);
+				case fDSTM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t41c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000000FFU) | ((v & 0xFFFFFF) << 8);
+				case fDSTM:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t41d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000007FU) | ((v & 0x1FFFFFF) << 7);
+				case fDSTM:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t42a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000FFFFU) | ((v & 0xFFFF) << 16);
+				case fDSTC:	return (w & 0xFFFF07FFU) | ((v & 0x1F) << 11);
+				case fSRCC:	return (w & 0xFFFFF87FU) | ((v & 0xF) << 7);
+				case fCONJ:	return (w & 0xFFFFFFBFU) | ((v & 0x1) << 6);
+				case fPOLAR:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t42b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00003FFFU) | ((v & 0x3FFFF) << 14);
+				case fDSTC:	return (w & 0xFFFFC1FFU) | ((v & 0x1F) << 9);
+				case fSRCC:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t43a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fAF:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fMF:	return (w & 0xFFC3FFFFU) | ((v & 0xF) << 18);
+				case fDSTA:	return (w & 0xFFFC3FFFU) | ((v & 0xF) << 14);
+				case fSRCA1:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fSRCA2:	return (w & 0xFFFFF8FFU) | ((v & 0x7) << 8);
+				case fDSTM:	return (w & 0xFFFFFF3FU) | ((v & 0x3) << 6);
+				case fSRCM1:	return (w & 0xFFFFFFC7U) | ((v & 0x7) << 3);
+				case fSRCM2:	return (w & 0xFFFFFFF8U) | ((v & 0x7) << 0);
+			}
+			break;
+		case t44b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0FFFFFFFU) | ((v & 0xF) << 28);
+				case fSF2:	return (w & 0xF0FFFFFFU) | ((v & 0xF) << 24);
+				case fAF:	return (w & 0xFF0FFFFFU) | ((v & 0xF) << 20);
+				case fDSTA:	return (w & 0xFFF0FFFFU) | ((v & 0xF) << 16);
+				case fSRCA1:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fSRCA2:	return (w & 0xFFFFE3FFU) | ((v & 0x7) << 10);
+				case fDSTS:	return (w & 0xFFFFFCFFU) | ((v & 0x3) << 8);
+				case fSRCS1:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fSRCS2:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t44d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x07FFFFFFU) | ((v & 0x1F) << 27);
+				case fSF2:	return (w & 0xF87FFFFFU) | ((v & 0xF) << 23);
+				case fAF:	return (w & 0xFF87FFFFU) | ((v & 0xF) << 19);
+				case fDSTA:	return (w & 0xFFF87FFFU) | ((v & 0xF) << 15);
+				case fSRCA1:	return (w & 0xFFFF8FFFU) | ((v & 0x7) << 12);
+				case fSRCA2:	return (w & 0xFFFFF1FFU) | ((v & 0x7) << 9);
+				case fDSTS:	return (w & 0xFFFFFE7FU) | ((v & 0x3) << 7);
+				case fSRCS1:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fSRCS2:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t45b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x03FFFFFFU) | ((v & 0x3F) << 26);
+				case fSF2:	return (w & 0xFC3FFFFFU) | ((v & 0xF) << 22);
+				case fMF:	return (w & 0xFFC3FFFFU) | ((v & 0xF) << 18);
+				case fDSTM:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCM1:	return (w & 0xFFFF1FFFU) | ((v & 0x7) << 13);
+				case fSRCM2:	return (w & 0xFFFFE3FFU) | ((v & 0x7) << 10);
+				case fDSTS:	return (w & 0xFFFFFCFFU) | ((v & 0x3) << 8);
+				case fSRCS1:	return (w & 0xFFFFFF1FU) | ((v & 0x7) << 5);
+				case fSRCS2:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t45d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x01FFFFFFU) | ((v & 0x7F) << 25);
+				case fSF2:	return (w & 0xFE1FFFFFU) | ((v & 0xF) << 21);
+				case fMF:	return (w & 0xFFE1FFFFU) | ((v & 0xF) << 17);
+				case fDSTM:	return (w & 0xFFFE7FFFU) | ((v & 0x3) << 15);
+				case fSRCM1:	return (w & 0xFFFF8FFFU) | ((v & 0x7) << 12);
+				case fSRCM2:	return (w & 0xFFFFF1FFU) | ((v & 0x7) << 9);
+				case fDSTS:	return (w & 0xFFFFFE7FU) | ((v & 0x3) << 7);
+				case fSRCS1:	return (w & 0xFFFFFF9FU) | ((v & 0x3) << 5);
+				case fSRCS2:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t46a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x001FFFFFU) | ((v & 0x7FF) << 21);
+				case fDSTA:	return (w & 0xFFE07FFFU) | ((v & 0x3F) << 15);
+				case fSRCA1:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCA2:	return (w & 0xFFFFFC1FU) | ((v & 0x1F) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t46b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0007FFFFU) | ((v & 0x1FFF) << 19);
+				case fDSTA:	return (w & 0xFFF83FFFU) | ((v & 0x1F) << 14);
+				case fSRCA1:	return (w & 0xFFFFC3FFU) | ((v & 0xF) << 10);
+				case fSRCA2:	return (w & 0xFFFFFC3FU) | ((v & 0xF) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t47a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x00007FFFU) | ((v & 0x1FFFF) << 15);
+				case fDSTC:	return (w & 0xFFFF83FFU) | ((v & 0x1F) << 10);
+				case fSRCC:	return (w & 0xFFFFFC3FU) | ((v & 0xF) << 6);
+				case fCONJ:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t48a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0000001FU) | ((v & 0x7FFFFFF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t49a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000FFFFFU) | ((v & 0xFFF) << 20);
+				case fDSTLS:	return (w & 0xFFF03FFFU) | ((v & 0x3F) << 14);
+				case fSRCLS:	return (w & 0xFFFFC7FFU) | ((v & 0x7) << 11);
+				case fIDR:	return (w & 0xFFFFF9FFU) | ((v & 0x3) << 9);
+				case fIDN:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t49b:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0003FFFFU) | ((v & 0x3FFF) << 18);
+				case fDSTLS:	return (w & 0xFFFC1FFFU) | ((v & 0x1F) << 13);
+				case fSRCLS:	return (w & 0xFFFFE7FFU) | ((v & 0x3) << 11);
+				case fIDR:	return (w & 0xFFFFF9FFU) | ((v & 0x3) << 9);
+				case fIDN:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t49c:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000FFFFFU) | ((v & 0xFFF) << 20);
+				case fDSTLS:	return (w & 0xFFF1FFFFU) | ((v & 0x7) << 17);
+				case fSRCLS:	return (w & 0xFFFE07FFU) | ((v & 0x3F) << 11);
+				case fIDR:	return (w & 0xFFFFF9FFU) | ((v & 0x3) << 9);
+				case fIDN:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t49d:
+			switch(field){
+				case fOpcodeType:	return (w & 0x0003FFFFU) | ((v & 0x3FFF) << 18);
+				case fDSTLS:	return (w & 0xFFFCFFFFU) | ((v & 0x3) << 16);
+				case fSRCLS:	return (w & 0xFFFF07FFU) | ((v & 0x1F) << 11);
+				case fIDR:	return (w & 0xFFFFF9FFU) | ((v & 0x3) << 9);
+				case fIDN:	return (w & 0xFFFFFE1FU) | ((v & 0xF) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+		case t50a:
+			switch(field){
+				case fOpcodeType:	return (w & 0x000FFFFFU) | ((v & 0xFFF) << 20);
+				case fDSTA:	return (w & 0xFFF07FFFU) | ((v & 0x1F) << 15);
+				case fSRCA1:	return (w & 0xFFFF87FFU) | ((v & 0xF) << 11);
+				case fSRCA2:	return (w & 0xFFFFF83FU) | ((v & 0x1F) << 6);
+				case fCW:	return (w & 0xFFFFFFDFU) | ((v & 0x1) << 5);
+				case fCOND:	return (w & 0xFFFFFFE0U) | ((v & 0x1F) << 0);
+			}
+			break;
+	}
+	return w;
+}
+
+/** 
+* @brief Instruction word with the opcode of a type and all fields 0.
+* 
+* @param type eType value
+* 
+* @return Opcode bits at their position, 0 if type is unknown
+*/
+unsigned int isaOpcode(int type)
+{
+	switch(type){
+		case t01a:	return 0x20000000U;
+		case t01b:	return 0xE0000000U;
+		case t01c:	return 0x30000000U;
+		case t03a:	return 0x50000000U;
+		case t03c:	return 0xA0000000U;
+		case t03d:	return 0xC8000000U;
+		case t03e:	return 0xE1000000U;
+		case t03f:	return 0x58000000U;
+		case t03g:	return 0xA4000000U;
+		case t03h:	return 0xCA000000U;
+		case t03i:	return 0xE2000000U;
+		case t04a:	return 0xCC000000U;
+		case t04b:	return 0xEF000000U;
+		case t04c:	return 0x60000000U;
+		case t04d:	return 0xE9000000U;
+		case t04e:	return 0xCE000000U;
+		case t04f:	return 0xEF400000U;
+		case t04g:	return 0x68000000U;
+		case t04h:	return 0xE9800000U;
+		case t06a:	return 0x70000000U;
+		case t06b:	return 0xEA000000U;
+		case t06c:	return 0x00000000U;
+		case t06d:	return 0x78000000U;
+		case t08a:	return 0xE3000000U;
+		case t08b:	return 0xF1400000U;
+		case t08c:	return 0xA8000000U;
+		case t08d:	return 0xF0800000U;
+		case t09c:	return 0xD0000000U;
+		case t09d:	return 0xEA800000U;
+		case t09e:	return 0xE4000000U;
+		case t09f:	return 0x80000000U;
+		case t09g:	return 0xF1900000U;
+		case t09h:	return 0xF1C40000U;
+		case t09i:	return 0xD2000000U;
+		case t10a:	return 0xF1980000U;
+		case t10b:	return 0xF1C60000U;
+		case t11a:	return 0xF1D20000U;
+		case t12e:	return 0x88000000U;
+		case t12f:	return 0xD4000000U;
+		case t12g:	return 0x90000000U;
+		case t12h:	return 0xD6000000U;
+		case t12m:	return 0xAC000000U;
+		case t12n:	return 0xD8000000U;
+		case t12o:	return 0xB0000000U;
+		case t12p:	return 0xDA000000U;
+		case t14c:	return 0xB4000000U;
+		case t14d:	return 0xEB000000U;
+		case t14k:	return 0xDC000000U;
+		case t14l:	return 0xEB800000U;
+		case t15a:	return 0xEC000000U;
+		case t15b:	return 0xF0A00000U;
+		case t15c:	return 0xEF800000U;
+		case t15d:	return 0xF1500000U;
+		case t15e:	return 0xB8000000U;
+		case t15f:	return 0xE5000000U;
+		case t16a:	return 0xEC800000U;
+		case t16b:	return 0xF0C00000U;
+		case t16c:	return 0xF0E00000U;
+		case t16d:	return 0xF1A00000U;
+		case t16e:	return 0xBC000000U;
+		case t16f:	return 0xE6000000U;
+		case t17a:	return 0xF1C80000U;
+		case t17b:	return 0xF1B00000U;
+		case t17c:	return 0xF1D58000U;
+		case t17d:	return 0xF1D40000U;
+		case t17e:	return 0xF1CA0000U;
+		case t17f:	return 0xF1D5A400U;
+		case t17g:	return 0xF1CC0000U;
+		case t17h:	return 0xF1D50000U;
+		case t18a:	return 0xED000000U;
+		case t18b:	return 0xF1D58800U;
+		case t18c:	return 0xF1D59000U;
+		case t19a:	return 0xF1D5A600U;
+		case t20a:	return 0xF1D5AD80U;
+		case t22a:	return 0xE7000000U;
+		case t23a:	return 0xF1000000U;
+		case t25a:	return 0xF1D5A800U;
+		case t25b:	return 0xF1D5A900U;
+		case t26a:	return 0xF1D59800U;
+		case t29a:	return 0xED800000U;
+		case t29b:	return 0xEFC00000U;
+		case t29c:	return 0xEE000000U;
+		case t29d:	return 0xF0000000U;
+		case t30a:	return 0xF1D5ADC0U;
+		case t31a:	return 0xF1D5ADE0U;
+		case t32a:	return 0xF1B40000U;
+		case t32b:	return 0xF1CE0000U;
+		case t32c:	return 0xF1B80000U;
+		case t32d:	return 0xF1D00000U;
+		case t37a:	return 0xF1D5A000U;
+		case t40e:	return 0xE8000000U;
+		case t40f:	return 0xF0400000U;
+		case t40g:	return 0xEE800000U;
+		case t41a:	return 0xF1D5AA00U;
+		case t41b:	return 0xF1D5AB00U;
+		case t41c:	return 0xF1D5AC00U;
+		case t41d:	return 0xF1D5AD00U;
+		case t42a:	return 0xF1D30000U;
+		case t42b:	return 0xF1D54000U;
+		case t43a:	return 0xC0000000U;
+		case t44b:	return 0x40000000U;
+		case t44d:	return 0x98000000U;
+		case t45b:	return 0xC4000000U;
+		case t45d:	return 0xDE000000U;
+		case t46a:	return 0xF1200000U;
+		case t46b:	return 0xF1A80000U;
+		case t47a:	return 0xF1D48000U;
+		case t48a:	return 0xF1D5AE00U;
+		case t49a:	return 0xF1600000U;
+		case t49b:	return 0xF1BC0000U;
+		case t49c:	return 0xF1700000U;
+		case t49d:	return 0xF1C00000U;
+		case t50a:	return 0xF1800000U;
+	}
+	return 0;
+}
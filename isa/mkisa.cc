@@ -0,0 +1,444 @@
+/*
+All Rights Reserved.
+*/
+/**
+* @file mkisa.cc
+* Generate isa.h and isa.cc from the instruction set description (n1d.isa)
+*
+* isa.h: eType, eField and the table declarations shared by dspsim,
+* dsplnk and binsim. isa.cc: sType, sField, sBinOp, sInstFormatTable,
+* a decoder switching on opcode bits (at most 8 bits per level), and
+* per-type field extractors and encoders with constant shifts and masks.
+* Usage: "mkisa -h n1d.isa > isa.h", "mkisa n1d.isa > isa.cc" (see makefile).
+* @date 2026-10-19
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define	ISA_WORD		32			/**< instruction word width */
+#define	MAX_ISATYPES	256			/**< max. number of instruction types */
+#define	MAX_ISAFIELDS	64			/**< max. number of field names */
+#define	MAX_FIELD		15			/**< max. number of fields per type, OpcodeType included */
+#define	MAX_DECODEBITS	8			/**< opcode bits per decoder switch */
+#define	MAX_ISALINE		1024
+
+/**
+* @brief Instruction type read from the description
+*/
+typedef struct sIsaType {
+	char	Name[16];				/**< type mnemonic, e.g. "01a" */
+	char	Bits[ISA_WORD+1];		/**< opcode bits, MSB first */
+	int		Width;					/**< opcode width */
+	int		FieldCntr;				/**< fields after the opcode */
+	int		Field[MAX_FIELD];		/**< index into isaField[] */
+	int		FieldWidth[MAX_FIELD];
+	int		FieldPos[MAX_FIELD];	/**< bit position of field MSB; 0: word MSB */
+} sIsaType;
+
+static char isaField[MAX_ISAFIELDS][32];
+static int isaFieldCntr = 0;
+static sIsaType isaType[MAX_ISATYPES];
+static int isaTypeCntr = 0;
+
+/**
+* @brief Print error message with line number and exit.
+*/
+static void isaError(const char *file, int line, const char *msg, const char *s)
+{
+	fprintf(stderr, "mkisa: %s, line %d: %s%s%s\n", file, line, msg, s ? ": " : "", s ? s : "");
+	exit(1);
+}
+
+/**
+* @brief Index of field name, -1 if unknown.
+*/
+static int findField(const char *s)
+{
+	for(int i = 0; i < isaFieldCntr; i++){
+		if(!strcmp(isaField[i], s)) return i;
+	}
+	return -1;
+}
+
+/**
+* @brief Read and check the instruction set description.
+*
+* @param file Description filename
+*/
+static void readIsa(const char *file)
+{
+	char linebuf[MAX_ISALINE];
+	int line = 0;
+	FILE *fp;
+
+	if(!(fp = fopen(file, "r"))){
+		perror(file);
+		exit(1);
+	}
+
+	while(fgets(linebuf, sizeof(linebuf), fp)){
+		char *s, *c;
+
+		line++;
+		if((c = strchr(linebuf, '#')) != NULL) *c = '\0';
+		if(!(s = strtok(linebuf, " \t\r\n"))) continue;
+
+		if(!strcmp(s, "field")){
+			while((s = strtok(NULL, " \t\r\n")) != NULL){
+				if(isaFieldCntr == MAX_ISAFIELDS) isaError(file, line, "too many fields", NULL);
+				if(findField(s) >= 0) isaError(file, line, "duplicate field", s);
+				strncpy(isaField[isaFieldCntr++], s, sizeof(isaField[0]) - 1);
+			}
+			continue;
+		}
+
+		/* <type> <opcode> <field>:<width> ... */
+		if(isaTypeCntr == MAX_ISATYPES) isaError(file, line, "too many types", NULL);
+		sIsaType *t = &isaType[isaTypeCntr];
+
+		strncpy(t->Name, s, sizeof(t->Name) - 1);
+		if(!(s = strtok(NULL, " \t\r\n")) || strlen(s) > ISA_WORD || strspn(s, "01") != strlen(s))
+			isaError(file, line, "bad opcode", t->Name);
+		strcpy(t->Bits, s);
+		t->Width = strlen(s);
+
+		int pos = t->Width;
+		while((s = strtok(NULL, " \t\r\n")) != NULL){
+			char *w = strchr(s, ':');
+			int f;
+
+			if(!w) isaError(file, line, "missing field width", s);
+			*w++ = '\0';
+			if((f = findField(s)) < 1) isaError(file, line, "unknown field", s);
+			for(int i = 0; i < t->FieldCntr; i++){
+				if(t->Field[i] == f) isaError(file, line, "field used twice", s);
+			}
+			if(t->FieldCntr == MAX_FIELD - 2) isaError(file, line, "too many fields", t->Name);
+			t->Field[t->FieldCntr] = f;
+			t->FieldWidth[t->FieldCntr] = atoi(w);
+			t->FieldPos[t->FieldCntr] = pos;
+			if(t->FieldWidth[t->FieldCntr] < 1) isaError(file, line, "bad field width", s);
+			pos += t->FieldWidth[t->FieldCntr++];
+		}
+		if(pos != ISA_WORD) isaError(file, line, "type does not fill the instruction word", t->Name);
+
+		for(int i = 0; i < isaTypeCntr; i++){
+			int n = (isaType[i].Width < t->Width) ? isaType[i].Width : t->Width;
+
+			if(!strcmp(isaType[i].Name, t->Name)) isaError(file, line, "duplicate type", t->Name);
+			if(!strncmp(isaType[i].Bits, t->Bits, n)) isaError(file, line, "opcode prefix of", isaType[i].Name);
+		}
+		isaTypeCntr++;
+	}
+	fclose(fp);
+
+	if(!isaFieldCntr || strcmp(isaField[0], "OpcodeType")) isaError(file, line, "first field must be OpcodeType", NULL);
+	if(!isaTypeCntr) isaError(file, line, "no instruction types", NULL);
+}
+
+/**
+* @brief Mask of width bits.
+*/
+static unsigned int isaMask(int width)
+{
+	return (width >= ISA_WORD) ? 0xFFFFFFFFU : ((1U << width) - 1);
+}
+
+/**
+* @brief Value of opcode bits [pos, pos+width) of a type.
+*/
+static unsigned int opcodeBits(sIsaType *t, int pos, int width)
+{
+	unsigned int v = 0;
+
+	for(int i = pos; i < pos + width; i++) v = (v << 1) | (t->Bits[i] == '1');
+	return v;
+}
+
+static void indent(int n)
+{
+	for(int i = 0; i < n; i++) putchar('\t');
+}
+
+/**
+* @brief Print decoder for a set of types sharing their first pos opcode bits.
+* Each level switches on the next MAX_DECODEBITS bits (fewer if no type
+* of the set is that long); a type whose opcode ends within them takes
+* all the case values it matches.
+*
+* @param set Indices into isaType[]
+* @param n Number of types in set
+* @param pos Opcode bits decoded so far
+* @param level Indentation
+*/
+static void genDecode(int *set, int n, int pos, int level)
+{
+	if(n == 1){
+		sIsaType *t = &isaType[set[0]];
+		int rest = t->Width - pos;
+
+		indent(level);
+		if(rest <= 0){
+			printf("return t%s;\n", t->Name);
+		}else{
+			printf("return (((w >> %d) & 0x%X) == 0x%X) ? t%s : 0;\n",
+				ISA_WORD - t->Width, isaMask(rest), opcodeBits(t, pos, rest), t->Name);
+		}
+		return;
+	}
+
+	int k = 0;
+	for(int i = 0; i < n; i++){
+		if(isaType[set[i]].Width - pos > k) k = isaType[set[i]].Width - pos;
+	}
+	if(k > MAX_DECODEBITS) k = MAX_DECODEBITS;
+
+	/* members matching each case value: match[v*n + i] */
+	int cases = 1 << k;
+	char *match = (char *)calloc(cases * n, 1);
+	int *sub = (int *)malloc(n * sizeof(int));
+
+	for(int v = 0; v < cases; v++){
+		for(int i = 0; i < n; i++){
+			sIsaType *t = &isaType[set[i]];
+			int r = (t->Width - pos < k) ? t->Width - pos : k;
+
+			match[v*n + i] = (opcodeBits(t, pos, r) == ((unsigned int)v >> (k - r)));
+		}
+	}
+
+	indent(level);
+	printf("switch((w >> %d) & 0x%X){\n", ISA_WORD - pos - k, isaMask(k));
+	for(int v = 0; v < cases; v++){
+		int m = 0, printed = 0;
+
+		for(int i = 0; i < n; i++) m += match[v*n + i];
+		if(!m) continue;
+		for(int u = 0; u < v && !printed; u++){
+			printed = !memcmp(match + u*n, match + v*n, n);
+		}
+		if(printed) continue;
+
+		/* all case values with the same members share one body */
+		int labels = 0;
+		for(int u = v; u < cases; u++){
+			if(!memcmp(match + u*n, match + v*n, n)){
+				if(!(labels % 8)){
+					if(labels) putchar('\n');
+					indent(level + 1);
+				}else{
+					putchar(' ');
+				}
+				printf("case 0x%02X:", u);
+				labels++;
+			}
+		}
+		putchar('\n');
+		m = 0;
+		for(int i = 0; i < n; i++){
+			if(match[v*n + i]) sub[m++] = set[i];
+		}
+		genDecode(sub, m, pos + k, level + 2);
+	}
+	indent(level + 1);
+	printf("default:\n");
+	indent(level + 2);
+	printf("return 0;\n");
+	indent(level);
+	printf("}\n");
+
+	free(match);
+	free(sub);
+}
+
+/**
+* @brief Print isa.h
+*/
+static void genHeader(void)
+{
+	printf("/*\nAll Rights Reserved.\n*/\n");
+	printf("/**\n* @file isa.h\n");
+	printf("* Instruction types, fields and encoding tables - generated by mkisa from n1d.isa, do not edit\n*/\n\n");
+	printf("#ifndef\t_ISA_H\n#define\t_ISA_H\n\n");
+	printf("#include <stdio.h>\t\t\t/* for NULL */\n\n");
+	printf("#define MAX_FIELD\t%d\t\t/* max number of fields within a instruction format */\n", MAX_FIELD);
+	printf("#define\tISA_NO_FIELD\t(-1)\t/* isaGetField(): type has no such field */\n\n");
+
+	printf("/** \n* Instruction type - Each instruction can have different type even \n* with the same opcode.\n*/\n");
+	printf("enum eType {");
+	for(int i = 0; i < isaTypeCntr; i++){
+		if(!i || strncmp(isaType[i].Name, isaType[i-1].Name, 2)) printf("\n\t");
+		printf("t%s%s, ", isaType[i].Name, i ? "" : " = 1");
+	}
+	printf("\n\teTypeEnd,\n};\n\n");
+
+	printf("/** \n* @brief Every Instruction Field is an eField enum value after parsing.\n*/\n");
+	printf("enum eField {");
+	for(int i = 0; i < isaFieldCntr; i++){
+		printf("%sf%s,", (i % 5) ? " " : "\n\t", isaField[i]);
+	}
+	printf("\n};\n\n");
+
+	printf("typedef struct sBinMapping {\n");
+	printf("\tchar *bits; /* pointer to binary opcode string */\n");
+	printf("\tint width;  /* number of bits */\n");
+	printf("} sBinMapping;\n\n");
+	printf("typedef struct sInstFormat {\n");
+	printf("\tint fields[MAX_FIELD];\t\t/* fields (eField enum values) */\n");
+	printf("\tint widths[MAX_FIELD];\t\t/* field widths */\n");
+	printf("} sInstFormat;\n\n");
+
+	printf("extern const char *sType[];\t\t\t\t\t\t/**< Instruction type mnemonics */\n");
+	printf("extern const char *sField[];\t\t\t\t\t/**< Instruction field mnemonics */\n");
+	printf("extern const sInstFormat sInstFormatTable[];\t/**< Instruction format table */\n");
+	printf("extern const sBinMapping sBinOp[];\t\t\t\t/**< Binary opcode mapping table */\n\n");
+
+	printf("int isaDecode(unsigned int w);\n");
+	printf("int isaGetField(int type, int field, unsigned int w);\n");
+	printf("unsigned int isaSetField(int type, int field, unsigned int w, unsigned int v);\n");
+	printf("unsigned int isaOpcode(int type);\n\n");
+	printf("#endif\t/* _ISA_H */\n");
+}
+
+/**
+* @brief Print isa.cc
+*/
+static void genSource(void)
+{
+	printf("/*\nAll Rights Reserved.\n*/\n");
+	printf("/**\n* @file isa.cc\n");
+	printf("* Instruction encoding tables and decoders - generated by mkisa from n1d.isa, do not edit\n*/\n\n");
+	printf("#include \"isa.h\"\n\n");
+
+	/* tables */
+	printf("/** \n* @brief Instruction type mnemonics; use eType for array indexing\n*/\n");
+	printf("const char *sType[] = \n{\n\t\"---\",");
+	for(int i = 0; i < isaTypeCntr; i++){
+		if(!i || strncmp(isaType[i].Name, isaType[i-1].Name, 2)) printf("\n\t");
+		else printf(" ");
+		printf("\"%s\",", isaType[i].Name);
+	}
+	printf("\n\tNULL\n};\n\n");
+
+	printf("/** \n* @brief Instruction Field mnemonics; use eField for array indexing\n*/\n");
+	printf("const char *sField[] = \n{");
+	for(int i = 0; i < isaFieldCntr; i++){
+		printf("%s\"%s\",", (i % 5) ? " " : "\n\t", isaField[i]);
+	}
+	printf("\n\tNULL\n};\n\n");
+
+	printf("/** \n* Binary Opcode mapping; use eType for array indexing\n*/\n");
+	printf("const sBinMapping sBinOp[] = \n{\n");
+	printf("\t{ %-*s, %2d },\n", ISA_WORD + 2, "NULL", 0);
+	for(int i = 0; i < isaTypeCntr; i++){
+		char q[ISA_WORD+3];
+
+		sprintf(q, "\"%s\"", isaType[i].Bits);
+		printf("\t{ %-*s, %2d }, /* %s */\n", ISA_WORD + 2, q, isaType[i].Width, isaType[i].Name);
+	}
+	printf("};\n\n");
+
+	printf("/** \n* Instruction format: use eType for array indexing\n*/\n");
+	printf("const sInstFormat sInstFormatTable[] = \n{\n");
+	printf("\t{ {}, {} },\t\t/* NULL */\n");
+	for(int i = 0; i < isaTypeCntr; i++){
+		sIsaType *t = &isaType[i];
+
+		printf("\t{ \n\t\t{ fOpcodeType, ");
+		for(int j = 0; j < t->FieldCntr; j++) printf("f%s, ", isaField[t->Field[j]]);
+		printf("0, },\n\t\t{ %2d, ", t->Width);
+		for(int j = 0; j < t->FieldCntr; j++) printf("%d, ", t->FieldWidth[j]);
+		printf("0, }\n\t}, /* %s */\n", t->Name);
+	}
+	printf("};\n\n");
+
+	/* decoder */
+	int *all = (int *)malloc(isaTypeCntr * sizeof(int));
+	for(int i = 0; i < isaTypeCntr; i++) all[i] = i;
+
+	printf("/** \n* @brief Decode instruction type from opcode bits.\n");
+	printf("* \n* @param w Instruction word (MSB: first bit of opcode)\n");
+	printf("* \n* @return eType value, or 0 if no type matches\n*/\n");
+	printf("int isaDecode(unsigned int w)\n{\n");
+	genDecode(all, isaTypeCntr, 0, 1);
+	printf("}\n\n");
+	free(all);
+
+	/* field extraction */
+	printf("/** \n* @brief Extract a field of an instruction word.\n");
+	printf("* \n* @param type eType value of the instruction\n");
+	printf("* @param field eField value\n* @param w Instruction word\n");
+	printf("* \n* @return Field value, or ISA_NO_FIELD if type has no such field\n*/\n");
+	printf("int isaGetField(int type, int field, unsigned int w)\n{\n");
+	printf("\tswitch(type){\n");
+	for(int i = 0; i < isaTypeCntr; i++){
+		sIsaType *t = &isaType[i];
+
+		printf("\t\tcase t%s:\n\t\t\tswitch(field){\n", t->Name);
+		printf("\t\t\t\tcase fOpcodeType:\treturn w >> %d;\n", ISA_WORD - t->Width);
+		for(int j = 0; j < t->FieldCntr; j++){
+			int shift = ISA_WORD - t->FieldPos[j] - t->FieldWidth[j];
+
+			printf("\t\t\t\tcase f%s:\treturn (w >> %d) & 0x%X;\n",
+				isaField[t->Field[j]], shift, isaMask(t->FieldWidth[j]));
+		}
+		printf("\t\t\t}\n\t\t\tbreak;\n");
+	}
+	printf("\t}\n\treturn ISA_NO_FIELD;\n}\n\n");
+
+	/* field encoding */
+	printf("/** \n* @brief Store a field into an instruction word.\n");
+	printf("* \n* @param type eType value of the instruction\n");
+	printf("* @param field eField value\n* @param w Instruction word\n");
+	printf("* @param v Field value, truncated to the field width\n");
+	printf("* \n* @return Updated instruction word; w if type has no such field\n*/\n");
+	printf("unsigned int isaSetField(int type, int field, unsigned int w, unsigned int v)\n{\n");
+	printf("\tswitch(type){\n");
+	for(int i = 0; i < isaTypeCntr; i++){
+		sIsaType *t = &isaType[i];
+		int shift = ISA_WORD - t->Width;
+
+		printf("\t\tcase t%s:\n\t\t\tswitch(field){\n", t->Name);
+		printf("\t\t\t\tcase fOpcodeType:\treturn (w & 0x%08XU) | ((v & 0x%X) << %d);\n",
+			~(isaMask(t->Width) << shift), isaMask(t->Width), shift);
+		for(int j = 0; j < t->FieldCntr; j++){
+			unsigned int m = isaMask(t->FieldWidth[j]);
+
+			shift = ISA_WORD - t->FieldPos[j] - t->FieldWidth[j];
+			printf("\t\t\t\tcase f%s:\treturn (w & 0x%08XU) | ((v & 0x%X) << %d);\n",
+				isaField[t->Field[j]], ~(m << shift), m, shift);
+		}
+		printf("\t\t\t}\n\t\t\tbreak;\n");
+	}
+	printf("\t}\n\treturn w;\n}\n\n");
+
+	/* opcode */
+	printf("/** \n* @brief Instruction word with the opcode of a type and all fields 0.\n");
+	printf("* \n* @param type eType value\n");
+	printf("* \n* @return Opcode bits at their position, 0 if type is unknown\n*/\n");
+	printf("unsigned int isaOpcode(int type)\n{\n");
+	printf("\tswitch(type){\n");
+	for(int i = 0; i < isaTypeCntr; i++){
+		sIsaType *t = &isaType[i];
+
+		printf("\t\tcase t%s:\treturn 0x%08XU;\n", t->Name,
+			opcodeBits(t, 0, t->Width) << (ISA_WORD - t->Width));
+	}
+	printf("\t}\n\treturn 0;\n}\n");
+}
+
+int main(int argc, char *argv[])
+{
+	int header = (argc == 3 && !strcmp(argv[1], "-h"));
+
+	if(argc != 2 && !header){
+		fprintf(stderr, "usage: mkisa [-h] file.isa\n");
+		return 1;
+	}
+	readIsa(argv[argc-1]);
+	if(header) genHeader();
+	else genSource();
+	return 0;
+}